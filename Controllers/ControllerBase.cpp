@@ -4,26 +4,61 @@
 【开发者及日期】 赵一彤 2024/7/24
 *************************************************************************/
 
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
 #include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <fstream>
+#include <functional>
 #include <memory>
+#include <numeric>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
+#include "../Models/Core/AffineTransform.hpp"
 #include "../Models/Core/Errors.hpp"
 #include "../Models/Core/Model.hpp"
+#include "../Models/Core/ModelStatistics.hpp"
 #include "../Models/Core/Line.hpp"
 #include "../Models/Core/Face.hpp"
+#include "../Models/Spatial/Bvh.hpp"
+#include "../Models/Spatial/KdTree.hpp"
 #include "../Models/Storage/ImporterBase.hpp"
 #include "../Models/Storage/ExporterBase.hpp"
+#include "../Models/Storage/ModelConverter.hpp"
+#include "../Models/Storage/ModelDelta.hpp"
+#include "../Models/Storage/StatisticsVisitor.hpp"
 #include "../Models/Storage/StorageFactory.hpp"
+#include "../Models/Tools/Hash.hpp"
+#include "../Models/Tools/MappedFile.hpp"
 #include "ControllerBase.hpp"
 using namespace std;
 using namespace C3w::Errors;
+using namespace C3w::Spatial;
 using namespace C3w::Storage;
 
 namespace C3w {
 
 namespace Controllers {
 
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】
+    创建一个默认的 ControllerBase 类型实例，
+    模型中的线段与面以墓碑方式删除。
+【参数】 无
+【返回值】 无
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+ControllerBase::ControllerBase() {
+    EnableTombstones();
+}
+
 /**********************************************************************
 【函数名称】 GetName
 【函数功能】 获取模型的名称。
@@ -36,6 +71,21 @@ string ControllerBase::GetName() const {
     return m_Model.Name;
 }
 
+/**********************************************************************
+【函数名称】 GetErrorLine
+【函数功能】
+    获取最近一次读取模型文件（载入、比较、统计或转换）
+    因内容错误或下标无效而失败时出错的行号。
+【参数】 无
+【返回值】
+    出错的行号，从 1 开始；最近一次读取成功、
+    因其他原因失败或文件格式没有行号时为 0。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+size_t ControllerBase::GetErrorLine() const {
+    return m_ErrorLine;
+}
+
 /**********************************************************************
 【函数名称】 GetLines
 【函数功能】 获取所有线段的字符串表达形式。
@@ -46,10 +96,13 @@ string ControllerBase::GetName() const {
 **********************************************************************/
 vector<ControllerBase::GetElementResult> ControllerBase::GetLines() const {
     vector<GetElementResult> result;
-    for (size_t i = 0; i < m_Model.Lines.Count(); i++) {
+    // 沿槽位遍历，不必逐个由下标换算槽位
+    auto end = m_Model.Lines.end();
+    for (auto it = m_Model.Lines.begin(); it != end; ++it) {
+        auto status = m_LineStatus[it.GetSlot()];
         result.push_back(GetElementResult {
-            LineToString(m_Model.Lines[i], m_LineStatus[i]),
-            m_LineStatus[i]
+            LineToString(*it, status),
+            status
         });
     }
     return result;
@@ -92,16 +145,20 @@ ControllerBase::Result ControllerBase::AddLine(
     double x1, double y1, double z1,
     double x2, double y2, double z2
 ) {
+    JournalEntry entry { JournalAction::ADD, {}, {}, nullptr, nullptr };
     try {
         Line<3> line { { x1, y1, z1 }, { x2, y2, z2 } };
-        if (!m_Model.Lines.TryAdd(line)) {
+        if (!AppendLine(line)) {
             return Result::ELEMENT_COLLISION;
         }
+        entry.Lines.push_back({
+            m_Model.Lines.Count() - 1, 0, line, line, Status::CREATED, 0
+        });
     }
     catch (CollectionException) {
         return Result::POINT_COLLISION;
     }
-    m_LineStatus.push_back(Status::CREATED);
+    CommitJournalEntry(move(entry));
     return Result::OK;
 }
 
@@ -121,25 +178,10 @@ ControllerBase::Result ControllerBase::ModifyLine(
     size_t pointIndex,
     double x, double y, double z
 ) {
-    try {
-        Line<3> line(m_Model.Lines[index]);
-        try {
-            if (!line.Points.TrySet(pointIndex, { x, y, z })) {
-                return Result::POINT_COLLISION;
-            }
-        }
-        catch (IndexOverflowException) {
-            return Result::POINT_INDEX_OVERFLOW;
-        }
-        if (!m_Model.Lines.TrySet(index, line)) {
-            return Result::ELEMENT_COLLISION;
-        }
-    }
-    catch (IndexOverflowException) {
-        return Result::INDEX_OVERFLOW;
-    }
-    m_LineStatus[index] = Status::MODIFIED;
-    return Result::OK;
+    JournalEntry entry { JournalAction::MODIFY, {}, {}, nullptr, nullptr };
+    auto result = ModifyLine(index, pointIndex, x, y, z, entry);
+    CommitJournalEntry(move(entry));
+    return result;
 }
 
 /**********************************************************************
@@ -152,15 +194,150 @@ ControllerBase::Result ControllerBase::ModifyLine(
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 ControllerBase::Result ControllerBase::RemoveLine(size_t index) {
+    JournalEntry entry { JournalAction::REMOVE, {}, {}, nullptr, nullptr };
     try {
-        m_Model.Lines.Remove(index);
+        auto slot = m_Model.Lines.GetSlot(index);
+        auto& line = m_Model.Lines[index];
+        entry.Lines.push_back({
+            index, slot, line, line, m_LineStatus[slot], m_LineOrigins[slot]
+        });
     }
     catch (IndexOverflowException) {
         return Result::INDEX_OVERFLOW;
     }
+    EraseLine(index);
+    // 状态按槽位存放，删除只标记槽位，足够多时再一并压缩
+    CompactModel(false);
+    CommitJournalEntry(move(entry));
     return Result::OK;
 }
 
+/**********************************************************************
+【函数名称】 AddLines
+【函数功能】
+    批量添加线段，逐项结果与按顺序逐个调用 AddLine 相同。
+    元素与状态只扩容一次，重复由哈希索引逐项检查，
+    同批中较早添加的线段也参与检查。
+【参数】
+    lines: 每个线段各点的三维坐标，依次排列。
+    results: 返回每一项发生的错误类型，与 lines 等长。
+【返回值】
+    第一项失败的错误类型，全部成功时为 OK。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+ControllerBase::Result ControllerBase::AddLines(
+    const vector<array<double, 6>>& lines,
+    vector<Result>& results
+) {
+    results.assign(lines.size(), Result::OK);
+    auto count = m_LineStatus.size() + lines.size();
+    if (count > m_LineStatus.capacity()) {
+        // 按倍数扩容，反复的小批量添加仍为均摊常数时间
+        count = max(count, 2 * m_LineStatus.capacity());
+        m_Model.Lines.Reserve(count);
+        m_LineStatus.reserve(count);
+        m_LineOrigins.reserve(count);
+    }
+    JournalEntry entry { JournalAction::ADD, {}, {}, nullptr, nullptr };
+    for (size_t i = 0; i < lines.size(); i++) {
+        auto& c = lines[i];
+        try {
+            Line<3> line { { c[0], c[1], c[2] }, { c[3], c[4], c[5] } };
+            if (!AppendLine(line)) {
+                results[i] = Result::ELEMENT_COLLISION;
+                continue;
+            }
+            entry.Lines.push_back({
+                m_Model.Lines.Count() - 1, 0, line, line, Status::CREATED, 0
+            });
+        }
+        catch (CollectionException) {
+            results[i] = Result::POINT_COLLISION;
+        }
+    }
+    CommitJournalEntry(move(entry));
+    return GetFirstError(results);
+}
+
+/**********************************************************************
+【函数名称】 ModifyLines
+【函数功能】 批量修改线段，逐项结果与按顺序逐个调用 ModifyLine 相同。
+【参数】
+    edits: 要进行的修改。
+    results: 返回每一项发生的错误类型，与 edits 等长。
+【返回值】
+    第一项失败的错误类型，全部成功时为 OK。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+ControllerBase::Result ControllerBase::ModifyLines(
+    const vector<PointEdit>& edits,
+    vector<Result>& results
+) {
+    // 后一项可能依赖前一项的结果，只能逐项检查；
+    // 每项检查只是一次哈希查找，不随模型大小增长
+    results.resize(edits.size());
+    JournalEntry entry { JournalAction::MODIFY, {}, {}, nullptr, nullptr };
+    for (size_t i = 0; i < edits.size(); i++) {
+        auto& edit = edits[i];
+        results[i] = ModifyLine(
+            edit.Index, edit.PointIndex, edit.X, edit.Y, edit.Z, entry
+        );
+    }
+    CommitJournalEntry(move(entry));
+    return GetFirstError(results);
+}
+
+/**********************************************************************
+【函数名称】 RemoveLines
+【函数功能】
+    批量删除线段，下标均指删除前的位置。
+    全部检查后再逐个标记删除，其余元素与状态不移动。
+【参数】
+    indices: 要删除线段的下标，越界或重复的项返回 INDEX_OVERFLOW。
+    results: 返回每一项发生的错误类型，与 indices 等长。
+【返回值】
+    第一项失败的错误类型，全部成功时为 OK。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+ControllerBase::Result ControllerBase::RemoveLines(
+    const vector<size_t>& indices,
+    vector<Result>& results
+) {
+    results.assign(indices.size(), Result::OK);
+    vector<bool> isKept(m_Model.Lines.Count(), true);
+    JournalEntry entry { JournalAction::REMOVE, {}, {}, nullptr, nullptr };
+    for (size_t i = 0; i < indices.size(); i++) {
+        auto index = indices[i];
+        if (index >= isKept.size() || !isKept[index]) {
+            results[i] = Result::INDEX_OVERFLOW;
+            continue;
+        }
+        isKept[index] = false;
+        auto slot = m_Model.Lines.GetSlot(index);
+        auto& line = m_Model.Lines[index];
+        entry.Lines.push_back({
+            index, slot, line, line, m_LineStatus[slot], m_LineOrigins[slot]
+        });
+        m_Statistics.Remove(line);
+        for (auto& point: line.Points) {
+            RemoveTreePoint(point);
+        }
+    }
+    if (!entry.Lines.empty()) {
+        m_Model.Lines.Retain(isKept);
+        CompactModel(false);
+        // 撤销时按下标升序放回，重做时按降序删除
+        sort(entry.Lines.begin(), entry.Lines.end(), [](
+            const ElementChange<Line<3>>& a,
+            const ElementChange<Line<3>>& b
+        ) {
+            return a.Index < b.Index;
+        });
+        CommitJournalEntry(move(entry));
+    }
+    return GetFirstError(results);
+}
+
 /**********************************************************************
 【函数名称】 GetFaces
 【函数功能】 获取所有面的字符串表达形式。
@@ -171,10 +348,12 @@ ControllerBase::Result ControllerBase::RemoveLine(size_t index) {
 **********************************************************************/
 vector<ControllerBase::GetElementResult> ControllerBase::GetFaces() const {
     vector<GetElementResult> result;
-    for (size_t i = 0; i < m_Model.Faces.Count(); i++) {
+    auto end = m_Model.Faces.end();
+    for (auto it = m_Model.Faces.begin(); it != end; ++it) {
+        auto status = m_FaceStatus[it.GetSlot()];
         result.push_back(GetElementResult {
-            FaceToString(m_Model.Faces[i], m_FaceStatus[i]),
-            m_FaceStatus[i]
+            FaceToString(*it, status),
+            status
         });
     }
     return result;
@@ -219,16 +398,20 @@ ControllerBase::Result ControllerBase::AddFace(
     double x2, double y2, double z2,
     double x3, double y3, double z3
 ) {
+    JournalEntry entry { JournalAction::ADD, {}, {}, nullptr, nullptr };
     try {
         Face<3> face { { x1, y1, z1 }, { x2, y2, z2 }, { x3, y3, z3 } };
-        if (!m_Model.Faces.TryAdd(face)) {
+        if (!AppendFace(face)) {
             return Result::ELEMENT_COLLISION;
         }
+        entry.Faces.push_back({
+            m_Model.Faces.Count() - 1, 0, face, face, Status::CREATED, 0
+        });
     }
     catch (CollectionException) {
         return Result::POINT_COLLISION;
     }
-    m_FaceStatus.push_back(Status::CREATED);
+    CommitJournalEntry(move(entry));
     return Result::OK;
 }
 
@@ -248,25 +431,10 @@ ControllerBase::Result ControllerBase::ModifyFace(
     size_t pointIndex,
     double x, double y, double z
 ) {
-    try {
-        Face<3> face(m_Model.Faces[index]);
-        try {
-            if (!face.Points.TrySet(pointIndex, { x, y, z })) {
-                return Result::POINT_COLLISION;
-            }
-        }
-        catch (IndexOverflowException) {
-            return Result::POINT_INDEX_OVERFLOW;
-        }
-        if (!m_Model.Faces.TrySet(index, face)) {
-            return Result::ELEMENT_COLLISION;
-        }
-    }
-    catch (IndexOverflowException) {
-        return Result::INDEX_OVERFLOW;
-    }
-    m_FaceStatus[index] = Status::MODIFIED;
-    return Result::OK;
+    JournalEntry entry { JournalAction::MODIFY, {}, {}, nullptr, nullptr };
+    auto result = ModifyFace(index, pointIndex, x, y, z, entry);
+    CommitJournalEntry(move(entry));
+    return result;
 }
 
 /**********************************************************************
@@ -279,108 +447,1887 @@ ControllerBase::Result ControllerBase::ModifyFace(
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 ControllerBase::Result ControllerBase::RemoveFace(size_t index) {
+    JournalEntry entry { JournalAction::REMOVE, {}, {}, nullptr, nullptr };
     try {
-        m_Model.Faces.Remove(index);
+        auto slot = m_Model.Faces.GetSlot(index);
+        auto& face = m_Model.Faces[index];
+        entry.Faces.push_back({
+            index, slot, face, face, m_FaceStatus[slot], m_FaceOrigins[slot]
+        });
     }
     catch (IndexOverflowException) {
         return Result::INDEX_OVERFLOW;
     }
+    EraseFace(index);
+    CompactModel(false);
+    CommitJournalEntry(move(entry));
     return Result::OK;
 }
 
 /**********************************************************************
-【函数名称】 GetStatistics
-【函数功能】 获取统计信息。
-【参数】 无
+【函数名称】 AddFaces
+【函数功能】
+    批量添加面，逐项结果与按顺序逐个调用 AddFace 相同。
+    元素与状态只扩容一次，重复由哈希索引逐项检查，
+    同批中较早添加的面也参与检查。
+【参数】
+    faces: 每个面各点的三维坐标，依次排列。
+    results: 返回每一项发生的错误类型，与 faces 等长。
 【返回值】
-    模型统计信息。
-【开发者及日期】 赵一彤 2024/7/24
+    第一项失败的错误类型，全部成功时为 OK。
+【开发者及日期】 赵一彤 2026/10/17
 **********************************************************************/
-ControllerBase::Statistics ControllerBase::GetStatistics() const {
-    Statistics stats {
-        0,
-        m_Model.Lines.Count(), 0,
-        m_Model.Faces.Count(), 0,
-        m_Model.GetBoundingBox().GetVolume()
-    };
-    stats.TotalPointCount = 
-        stats.TotalLineCount * 2 + stats.TotalFaceCount * 3;
-    for (auto& line: m_Model.Lines) {
-        stats.TotalLineLength += line.GetLength();
+ControllerBase::Result ControllerBase::AddFaces(
+    const vector<array<double, 9>>& faces,
+    vector<Result>& results
+) {
+    results.assign(faces.size(), Result::OK);
+    auto count = m_FaceStatus.size() + faces.size();
+    if (count > m_FaceStatus.capacity()) {
+        count = max(count, 2 * m_FaceStatus.capacity());
+        m_Model.Faces.Reserve(count);
+        m_FaceStatus.reserve(count);
+        m_FaceOrigins.reserve(count);
     }
-    for (auto& face: m_Model.Faces) {
-        stats.TotalFaceArea += face.GetArea();
+    JournalEntry entry { JournalAction::ADD, {}, {}, nullptr, nullptr };
+    for (size_t i = 0; i < faces.size(); i++) {
+        auto& c = faces[i];
+        try {
+            Face<3> face {
+                { c[0], c[1], c[2] },
+                { c[3], c[4], c[5] },
+                { c[6], c[7], c[8] }
+            };
+            if (!AppendFace(face)) {
+                results[i] = Result::ELEMENT_COLLISION;
+                continue;
+            }
+            entry.Faces.push_back({
+                m_Model.Faces.Count() - 1, 0, face, face, Status::CREATED, 0
+            });
+        }
+        catch (CollectionException) {
+            results[i] = Result::POINT_COLLISION;
+        }
     }
-    return stats;
+    CommitJournalEntry(move(entry));
+    return GetFirstError(results);
 }
 
 /**********************************************************************
-【函数名称】 LoadModel
-【函数功能】 从文件加载一个模型。
+【函数名称】 ModifyFaces
+【函数功能】 批量修改面，逐项结果与按顺序逐个调用 ModifyFace 相同。
 【参数】
-    path: 文件位置。
+    edits: 要进行的修改。
+    results: 返回每一项发生的错误类型，与 edits 等长。
+【返回值】
+    第一项失败的错误类型，全部成功时为 OK。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+ControllerBase::Result ControllerBase::ModifyFaces(
+    const vector<PointEdit>& edits,
+    vector<Result>& results
+) {
+    results.resize(edits.size());
+    JournalEntry entry { JournalAction::MODIFY, {}, {}, nullptr, nullptr };
+    for (size_t i = 0; i < edits.size(); i++) {
+        auto& edit = edits[i];
+        results[i] = ModifyFace(
+            edit.Index, edit.PointIndex, edit.X, edit.Y, edit.Z, entry
+        );
+    }
+    CommitJournalEntry(move(entry));
+    return GetFirstError(results);
+}
+
+/**********************************************************************
+【函数名称】 RemoveFaces
+【函数功能】
+    批量删除面，下标均指删除前的位置。
+    全部检查后再逐个标记删除，其余元素与状态不移动。
+【参数】
+    indices: 要删除面的下标，越界或重复的项返回 INDEX_OVERFLOW。
+    results: 返回每一项发生的错误类型，与 indices 等长。
+【返回值】
+    第一项失败的错误类型，全部成功时为 OK。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+ControllerBase::Result ControllerBase::RemoveFaces(
+    const vector<size_t>& indices,
+    vector<Result>& results
+) {
+    results.assign(indices.size(), Result::OK);
+    vector<bool> isKept(m_Model.Faces.Count(), true);
+    JournalEntry entry { JournalAction::REMOVE, {}, {}, nullptr, nullptr };
+    for (size_t i = 0; i < indices.size(); i++) {
+        auto index = indices[i];
+        if (index >= isKept.size() || !isKept[index]) {
+            results[i] = Result::INDEX_OVERFLOW;
+            continue;
+        }
+        isKept[index] = false;
+        auto slot = m_Model.Faces.GetSlot(index);
+        auto& face = m_Model.Faces[index];
+        entry.Faces.push_back({
+            index, slot, face, face, m_FaceStatus[slot], m_FaceOrigins[slot]
+        });
+        m_Statistics.Remove(face);
+        for (auto& point: face.Points) {
+            RemoveTreePoint(point);
+        }
+    }
+    if (!entry.Faces.empty()) {
+        m_Model.Faces.Retain(isKept);
+        CompactModel(false);
+        m_pFaceBvh.reset();
+        sort(entry.Faces.begin(), entry.Faces.end(), [](
+            const ElementChange<Face<3>>& a,
+            const ElementChange<Face<3>>& b
+        ) {
+            return a.Index < b.Index;
+        });
+        CommitJournalEntry(move(entry));
+    }
+    return GetFirstError(results);
+}
+
+/**********************************************************************
+【函数名称】 CastRay
+【函数功能】 求射线与模型中的面的第一个交点。
+【参数】
+    ox, oy, oz: 射线起点的三维坐标。
+    dx, dy, dz: 射线方向的三维向量。
+    isHit: 返回射线是否与某个面相交。
+    hit: 相交时返回交点。
 【返回值】
     函数发生的错误类型。
-【开发者及日期】 赵一彤 2024/7/24
+【开发者及日期】 赵一彤 2026/10/17
 **********************************************************************/
-ControllerBase::Result ControllerBase::LoadModel(string path) {
-    unique_ptr<ImporterBase<3>> importer;
-    try {
-        importer = StorageFactory::GetImporter<3>(path);
+ControllerBase::Result ControllerBase::CastRay(
+    double ox, double oy, double oz,
+    double dx, double dy, double dz,
+    bool& isHit,
+    FaceQueryResult& hit
+) {
+    Bvh<3>::Hit result { 0, 0, Point<3>() };
+    isHit = GetFaceBvh().Intersect({ ox, oy, oz }, { dx, dy, dz }, result);
+    if (isHit) {
+        hit = FaceQueryResult {
+            result.FaceIndex,
+            result.Distance,
+            PointToString(result.Position)
+        };
     }
-    catch (StorageFactoryLookupException) {
-        return Result::STORAGE_LOOKUP_ERROR;
+    return Result::OK;
+}
+
+/**********************************************************************
+【函数名称】 FindClosestFacePoint
+【函数功能】 求模型中的面上距给定点最近的点。
+【参数】
+    x, y, z: 给定点的三维坐标。
+    isFound: 返回是否找到，即模型中是否有面。
+    hit: 找到时返回最近的点。
+【返回值】
+    函数发生的错误类型。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+ControllerBase::Result ControllerBase::FindClosestFacePoint(
+    double x, double y, double z,
+    bool& isFound,
+    FaceQueryResult& hit
+) {
+    Bvh<3>::Hit result { 0, 0, Point<3>() };
+    isFound = GetFaceBvh().FindClosestPoint({ x, y, z }, result);
+    if (isFound) {
+        hit = FaceQueryResult {
+            result.FaceIndex,
+            result.Distance,
+            PointToString(result.Position)
+        };
     }
-    try {
-        importer->Import(path, m_Model);
+    return Result::OK;
+}
+
+/**********************************************************************
+【函数名称】 FindFacesInBox
+【函数功能】 查找包围盒与给定长方体相交的面。
+【参数】
+    x1, y1, z1: 长方体第一个顶点的三维坐标。
+    x2, y2, z2: 长方体第二个顶点的三维坐标。
+    indices: 返回按升序排列的面的下标。
+【返回值】
+    函数发生的错误类型。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+ControllerBase::Result ControllerBase::FindFacesInBox(
+    double x1, double y1, double z1,
+    double x2, double y2, double z2,
+    vector<size_t>& indices
+) {
+    indices = GetFaceBvh().FindOverlapping(
+        Tools::Box<3>({ x1, y1, z1 }, { x2, y2, z2 })
+    );
+    return Result::OK;
+}
+
+/**********************************************************************
+【函数名称】 FindPointsInRadius
+【函数功能】 查找模型中到给定点的距离不超过半径的点。
+【参数】
+    x, y, z: 给定点的三维坐标。
+    radius: 半径。
+    points: 返回按距离升序排列的点。
+【返回值】
+    函数发生的错误类型。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+ControllerBase::Result ControllerBase::FindPointsInRadius(
+    double x, double y, double z,
+    double radius,
+    vector<PointQueryResult>& points
+) {
+    Point<3> center { x, y, z };
+    auto& tree = GetPointTree();
+    vector<pair<double, Point<3>>> found;
+    for (auto index: tree.FindInRadius(center, radius)) {
+        auto point = tree.GetPoint(index);
+        found.push_back({ point.Distance(center), point });
     }
-    catch (FileOpenException) {
-        return Result::FILE_OPEN_ERROR;
+    stable_sort(
+        found.begin(),
+        found.end(),
+        [](const pair<double, Point<3>>& left,
+            const pair<double, Point<3>>& right) {
+            return left.first < right.first;
+        }
+    );
+    for (auto& item: found) {
+        points.push_back(PointQueryResult {
+            item.first,
+            PointToString(item.second)
+        });
     }
-    catch (FileFormatException) {
-        return Result::FILE_FORMAT_ERROR;
+    return Result::OK;
+}
+
+/**********************************************************************
+【函数名称】 FindNearestPoints
+【函数功能】 查找模型中距给定点最近的若干个点。
+【参数】
+    x, y, z: 给定点的三维坐标。
+    count: 要查找的个数。
+    points: 返回按距离升序排列的点。
+【返回值】
+    函数发生的错误类型。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+ControllerBase::Result ControllerBase::FindNearestPoints(
+    double x, double y, double z,
+    size_t count,
+    vector<PointQueryResult>& points
+) {
+    Point<3> center { x, y, z };
+    auto& tree = GetPointTree();
+    for (auto index: tree.FindNearest(center, count)) {
+        auto point = tree.GetPoint(index);
+        points.push_back(PointQueryResult {
+            point.Distance(center),
+            PointToString(point)
+        });
     }
-    catch (IndexOverflowException) {
-        return Result::INDEX_OVERFLOW;
+    return Result::OK;
+}
+
+/**********************************************************************
+【函数名称】 FindPointsInBox
+【函数功能】 查找模型中位于给定长方体内的点。
+【参数】
+    x1, y1, z1: 长方体第一个顶点的三维坐标。
+    x2, y2, z2: 长方体第二个顶点的三维坐标。
+    points: 返回点的字符串表达形式。
+【返回值】
+    函数发生的错误类型。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+ControllerBase::Result ControllerBase::FindPointsInBox(
+    double x1, double y1, double z1,
+    double x2, double y2, double z2,
+    vector<string>& points
+) {
+    auto& tree = GetPointTree();
+    auto indices = tree.FindInBox(
+        Tools::Box<3>({ x1, y1, z1 }, { x2, y2, z2 })
+    );
+    for (auto index: indices) {
+        points.push_back(PointToString(tree.GetPoint(index)));
     }
-    m_LineStatus.assign(m_Model.Lines.Count(), Status::UNTOUCHED);
-    m_FaceStatus.assign(m_Model.Faces.Count(), Status::UNTOUCHED);
-    m_Path = path;
     return Result::OK;
 }
 
 /**********************************************************************
-【函数名称】 SaveModel
-【函数功能】 向文件保存一个模型。
+【函数名称】 Translate
+【函数功能】 移动整个模型。
 【参数】
-    path: 文件位置。
+    x, y, z: 移动的三维向量。
 【返回值】
     函数发生的错误类型。
-【开发者及日期】 赵一彤 2024/7/24
+【开发者及日期】 赵一彤 2026/10/17
 **********************************************************************/
-ControllerBase::Result ControllerBase::SaveModel(string path) {
-    if (path.empty()) {
-        path = m_Path;
+ControllerBase::Result ControllerBase::Translate(double x, double y, double z) {
+    JournalEntry entry { JournalAction::TRANSFORM, {}, {}, nullptr, nullptr };
+    entry.Forward = [=](Model<3>& model) {
+        model.Translate({ x, y, z });
+        return true;
+    };
+    entry.Inverse = [=](Model<3>& model) {
+        model.Translate({ -x, -y, -z });
+        return true;
+    };
+    bool isInjective;
+    auto result = ApplyTransform(entry.Forward, isInjective);
+    if (result == Result::OK) {
+        CommitJournalEntry(move(entry));
     }
-    unique_ptr<ExporterBase<3>> exporter;
-    try {
-        exporter = StorageFactory::GetExporter<3>(path);
+    return result;
+}
+
+/**********************************************************************
+【函数名称】 Scale
+【函数功能】 以定点为中心缩放整个模型。
+【参数】
+    x, y, z: 参考点的三维坐标。
+    ratio: 缩放的比例。
+    isInjective: 返回变换是否为单射。
+【返回值】
+    函数发生的错误类型。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+ControllerBase::Result ControllerBase::Scale(
+    double x, double y, double z,
+    double ratio,
+    bool& isInjective
+) {
+    JournalEntry entry { JournalAction::TRANSFORM, {}, {}, nullptr, nullptr };
+    entry.Forward = [=](Model<3>& model) {
+        return model.ScaleAbout({ x, y, z }, ratio);
+    };
+    entry.Inverse = [=](Model<3>& model) {
+        return model.ScaleAbout({ x, y, z }, 1.0 / ratio);
+    };
+    auto result = ApplyTransform(entry.Forward, isInjective);
+    if (result == Result::OK) {
+        if (isInjective) {
+            CommitJournalEntry(move(entry));
+        }
+        else {
+            ClearJournal();
+        }
     }
-    catch (StorageFactoryLookupException) {
-        return Result::STORAGE_LOOKUP_ERROR;
+    return result;
+}
+
+/**********************************************************************
+【函数名称】 Transform
+【函数功能】 对整个模型施加仿射变换 x' = Ax + b。
+【参数】
+    linear: 线性部分 A，按行给出。
+    offset: 平移部分 b。
+    isInjective: 返回变换是否为单射。
+【返回值】
+    函数发生的错误类型。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+ControllerBase::Result ControllerBase::Transform(
+    const array<array<double, 3>, 3>& linear,
+    const array<double, 3>& offset,
+    bool& isInjective
+) {
+    AffineTransform<3> forward(linear, offset);
+    AffineTransform<3> inverse;
+    bool isInvertible = forward.TryGetInverse(inverse);
+    JournalEntry entry { JournalAction::TRANSFORM, {}, {}, nullptr, nullptr };
+    entry.Forward = [=](Model<3>& model) {
+        return model.Transform(forward);
+    };
+    entry.Inverse = [=](Model<3>& model) {
+        return model.Transform(inverse);
+    };
+    auto result = ApplyTransform(entry.Forward, isInjective);
+    if (result == Result::OK) {
+        if (isInvertible) {
+            CommitJournalEntry(move(entry));
+        }
+        else {
+            ClearJournal();
+        }
     }
-    try {
-        exporter->Export(path, m_Model);
+    return result;
+}
+
+/**********************************************************************
+【函数名称】 Weld
+【函数功能】
+    焊接模型中距离不超过给定值的点，见 Model::Weld。
+    保留的元素维持原来的状态，有点移动时都标记为已修改。
+【参数】
+    epsilon: 焊接的距离，不为正数时模型不变。
+    result: 返回移动的点数量与删除的元素数量。
+【返回值】
+    函数发生的错误类型。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+ControllerBase::Result ControllerBase::Weld(
+    double epsilon,
+    WeldResult& result
+) {
+    CompactModel(true);
+    auto welded = m_Model.Weld(epsilon);
+    EnableTombstones();
+    result.MovedPointCount = welded.MovedPointCount;
+    result.RemovedLineCount = m_LineStatus.size() - welded.KeptLines.size();
+    result.RemovedFaceCount = m_FaceStatus.size() - welded.KeptFaces.size();
+    vector<Status> lineStatus;
+    vector<size_t> lineOrigins;
+    lineStatus.reserve(welded.KeptLines.size());
+    lineOrigins.reserve(welded.KeptLines.size());
+    for (auto index: welded.KeptLines) {
+        lineStatus.push_back(m_LineStatus[index]);
+        lineOrigins.push_back(m_LineOrigins[index]);
     }
-    catch (FileOpenException) {
-        return Result::FILE_OPEN_ERROR;
+    vector<Status> faceStatus;
+    vector<size_t> faceOrigins;
+    faceStatus.reserve(welded.KeptFaces.size());
+    faceOrigins.reserve(welded.KeptFaces.size());
+    for (auto index: welded.KeptFaces) {
+        faceStatus.push_back(m_FaceStatus[index]);
+        faceOrigins.push_back(m_FaceOrigins[index]);
     }
-    catch (FileFormatException) {
-        return Result::FILE_FORMAT_ERROR;
+    m_LineStatus.swap(lineStatus);
+    m_FaceStatus.swap(faceStatus);
+    m_LineOrigins.swap(lineOrigins);
+    m_FaceOrigins.swap(faceOrigins);
+    if (welded.MovedPointCount == 0 &&
+        result.RemovedLineCount == 0 && result.RemovedFaceCount == 0) {
+        return Result::OK;
+    }
+    // 焊接不可逆，且删除元素后下标改变
+    ClearJournal();
+    m_Statistics.Rebuild(m_Model);
+    m_pFaceBvh.reset();
+    ResetPointTree();
+    if (welded.MovedPointCount > 0) {
+        MarkAllModified();
     }
     return Result::OK;
 }
 
+/**********************************************************************
+【函数名称】 Undo
+【函数功能】
+    撤销最近一次成功的编辑、批量编辑或整体变换，
+    耗时与该操作涉及的元素数成正比，与模型大小无关。
+    元素与状态恢复原样；整体变换以逆变换撤销，坐标可能有舍入误差，
+    元素仍为已修改。加载、焊接与不可逆的变换之前的操作不能撤销。
+【参数】 无
+【返回值】
+    函数发生的错误类型，没有可撤销的操作时为 NOTHING_TO_UNDO。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+ControllerBase::Result ControllerBase::Undo() {
+    if (m_UndoJournal.empty()) {
+        return Result::NOTHING_TO_UNDO;
+    }
+    auto result = RevertEntry(m_UndoJournal.back());
+    if (result != Result::OK) {
+        return result;
+    }
+    m_RedoJournal.push_back(move(m_UndoJournal.back()));
+    m_UndoJournal.pop_back();
+    return Result::OK;
+}
+
+/**********************************************************************
+【函数名称】 Redo
+【函数功能】
+    重做最近一次撤销的操作，耗时与该操作涉及的元素数成正比。
+    撤销后进行新的操作时不能再重做。
+【参数】 无
+【返回值】
+    函数发生的错误类型，没有可重做的操作时为 NOTHING_TO_REDO。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+ControllerBase::Result ControllerBase::Redo() {
+    if (m_RedoJournal.empty()) {
+        return Result::NOTHING_TO_REDO;
+    }
+    auto result = ReapplyEntry(m_RedoJournal.back());
+    if (result != Result::OK) {
+        return result;
+    }
+    m_UndoJournal.push_back(move(m_RedoJournal.back()));
+    m_RedoJournal.pop_back();
+    return Result::OK;
+}
+
+/**********************************************************************
+【函数名称】 GetStatistics
+【函数功能】
+    获取统计信息。各项由每次编辑增量维护，耗时与模型大小无关。
+    定义 C3W_VERIFY_STATISTICS 时会与完整重新计算的结果比对，
+    不一致则抛出 StatisticsMismatchException。
+【参数】 无
+【返回值】
+    模型统计信息。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+ControllerBase::Statistics ControllerBase::GetStatistics() const {
+    auto lineCount = m_Model.Lines.Count();
+    auto faceCount = m_Model.Faces.Count();
+    Statistics stats {
+        lineCount * 2 + faceCount * 3,
+        lineCount, m_Statistics.GetTotalLineLength(),
+        faceCount, m_Statistics.GetTotalFaceArea(),
+        m_Statistics.GetBoundingBox().GetVolume()
+    };
+#if defined(C3W_VERIFY_STATISTICS)
+    VerifyStatistics(stats);
+#endif
+    return stats;
+}
+
+/**********************************************************************
+【函数名称】 LoadModel
+【函数功能】
+    从文件加载一个模型，可选在加载后焊接相近的点。
+    文件旁有增量保存的差异文件时一并应用。
+    加载失败时当前模型保持不变。
+【参数】
+    path: 文件位置。
+    weldTolerance: 焊接的距离，不为正数时不焊接。
+【返回值】
+    函数发生的错误类型。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+ControllerBase::Result ControllerBase::LoadModel(
+    const string& path,
+    double weldTolerance
+) {
+    // 导入到新模型后整体移入，失败时当前模型保持不变
+    Model<3> model;
+    BaseFile base;
+    vector<size_t> lineOrigins;
+    vector<size_t> faceOrigins;
+    auto result = ImportModel(
+        path, model, base, lineOrigins, faceOrigins, m_ErrorLine
+    );
+    if (result != Result::OK) {
+        return result;
+    }
+    // 焊接在应用差异之后进行，有点移动时元素与基准文件不再相同
+    if (weldTolerance > 0 && model.Weld(weldTolerance).MovedPointCount > 0) {
+        lineOrigins.assign(model.Lines.Count(), ModelDelta<3>::NO_ORIGIN);
+        faceOrigins.assign(model.Faces.Count(), ModelDelta<3>::NO_ORIGIN);
+    }
+    m_Model = move(model);
+    EnableTombstones();
+    m_LineStatus.assign(m_Model.Lines.Count(), Status::UNTOUCHED);
+    m_FaceStatus.assign(m_Model.Faces.Count(), Status::UNTOUCHED);
+    m_LineOrigins.swap(lineOrigins);
+    m_FaceOrigins.swap(faceOrigins);
+    m_Base = base;
+    m_Statistics.Rebuild(m_Model);
+    m_pFaceBvh.reset();
+    ResetPointTree();
+    ClearJournal();
+    m_Path = path;
+    return Result::OK;
+}
+
+/**********************************************************************
+【函数名称】 SaveModel
+【函数功能】
+    向文件保存一个模型。保存到载入的文件且该文件未被替换时，
+    只将相对于它的差异写入旁边的差异文件，不改写模型文件；
+    差异文件超过模型文件的 1/DELTA_FOLD_RATIO 时改为完整保存，
+    将差异并入模型文件并删除差异文件。
+【参数】
+    path: 文件位置，为空时保存到载入的文件。
+【返回值】
+    函数发生的错误类型。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+ControllerBase::Result ControllerBase::SaveModel(string path) {
+    if (path.empty()) {
+        path = m_Path;
+    }
+    auto deltaPath = ModelDelta<3>::GetPath(path);
+    uint64_t size = 0;
+    uint64_t fingerprint = 0;
+    // 字节数或内容改变说明基准文件已被其他程序替换，差异不再适用
+    if (path == m_Path &&
+        TryGetFileSize(path, size) && size == m_Base.Size &&
+        TryGetFileFingerprint(path, fingerprint) &&
+        fingerprint == m_Base.Fingerprint) {
+        ModelDelta<3> delta(
+            m_Model, m_LineOrigins, m_FaceOrigins,
+            m_Base.Size, m_Base.Fingerprint,
+            m_Base.LineCount, m_Base.FaceCount
+        );
+        if (delta.IsEmpty()) {
+            remove(deltaPath.c_str());
+            return Result::OK;
+        }
+        if (delta.GetFileSize() * DELTA_FOLD_RATIO <= m_Base.Size) {
+            try {
+                delta.Write(deltaPath);
+            }
+            catch (FileOpenException) {
+                return Result::FILE_OPEN_ERROR;
+            }
+            return Result::OK;
+        }
+    }
+    unique_ptr<ExporterBase<3>> exporter;
+    try {
+        exporter = StorageFactory::GetExporter<3>(path);
+    }
+    catch (StorageFactoryLookupException) {
+        return Result::STORAGE_LOOKUP_ERROR;
+    }
+    try {
+        exporter->Export(path, m_Model);
+    }
+    catch (FileOpenException) {
+        return Result::FILE_OPEN_ERROR;
+    }
+    catch (FileFormatException) {
+        return Result::FILE_FORMAT_ERROR;
+    }
+    // 完整的文件已包含全部改变，旧的差异文件不能再应用到它上面
+    remove(deltaPath.c_str());
+    if (path == m_Path) {
+        TryGetFileSize(path, size);
+        TryGetFileFingerprint(path, fingerprint);
+        RebaseModel(size, fingerprint);
+    }
+    return Result::OK;
+}
+
+/**********************************************************************
+【函数名称】 DiffModel
+【函数功能】 从文件加载另一模型，与当前模型比较线段和面。
+【参数】
+    path: 另一模型的文件位置。
+    result: 返回新增与删除的元素。
+【返回值】
+    函数发生的错误类型。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+ControllerBase::Result ControllerBase::DiffModel(
+    const string& path,
+    DiffResult& result
+) {
+    Model<3> other;
+    BaseFile base;
+    vector<size_t> lineOrigins;
+    vector<size_t> faceOrigins;
+    auto importResult = ImportModel(
+        path, other, base, lineOrigins, faceOrigins, m_ErrorLine
+    );
+    if (importResult != Result::OK) {
+        return importResult;
+    }
+    auto diff = m_Model.Diff(other);
+    result.AddedLines.clear();
+    result.RemovedLines.clear();
+    result.AddedFaces.clear();
+    result.RemovedFaces.clear();
+    for (auto& line: diff.AddedLines) {
+        result.AddedLines.push_back(LineToString(line, Status::UNTOUCHED));
+    }
+    for (auto& line: diff.RemovedLines) {
+        result.RemovedLines.push_back(LineToString(line, Status::UNTOUCHED));
+    }
+    for (auto& face: diff.AddedFaces) {
+        result.AddedFaces.push_back(FaceToString(face, Status::UNTOUCHED));
+    }
+    for (auto& face: diff.RemovedFaces) {
+        result.RemovedFaces.push_back(FaceToString(face, Status::UNTOUCHED));
+    }
+    return Result::OK;
+}
+
+/**********************************************************************
+【函数名称】 ScanModel
+【函数功能】
+    流式读取模型文件并统计，不加载模型，也不影响当前模型。
+    占用的内存与文件大小无关，可以统计无法完整载入内存的文件。
+    不检查重复元素，重复的线段与面各计一次。
+    文件旁有增量保存的差异文件时，改为完整导入并应用差异后统计；
+    差异文件只由完整载入过的模型写出，这样的文件同样能载入内存。
+【参数】
+    path: 文件位置。
+    stats: 返回文件中模型的统计信息，各项含义与 GetStatistics 相同。
+【返回值】
+    函数发生的错误类型。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+ControllerBase::Result ControllerBase::ScanModel(
+    const string& path,
+    Statistics& stats
+) const {
+    if (ifstream(ModelDelta<3>::GetPath(path))) {
+        return ScanDeltaModel(path, stats);
+    }
+    unique_ptr<ImporterBase<3>> importer;
+    try {
+        importer = StorageFactory::GetImporter<3>(path);
+    }
+    catch (StorageFactoryLookupException) {
+        return Result::STORAGE_LOOKUP_ERROR;
+    }
+    StatisticsVisitor<3> visitor;
+    m_ErrorLine = 0;
+    try {
+        importer->Stream(path, visitor);
+    }
+    catch (FileOpenException) {
+        return Result::FILE_OPEN_ERROR;
+    }
+    catch (FileFormatException error) {
+        m_ErrorLine = error.GetLine();
+        return Result::FILE_FORMAT_ERROR;
+    }
+    catch (IndexOverflowException error) {
+        m_ErrorLine = error.GetLine();
+        return Result::INDEX_OVERFLOW;
+    }
+    // 线段或面的顶点重合
+    catch (CollectionException) {
+        return Result::POINT_COLLISION;
+    }
+    auto lineCount = visitor.GetLineCount();
+    auto faceCount = visitor.GetFaceCount();
+    stats = Statistics {
+        lineCount * 2 + faceCount * 3,
+        lineCount, visitor.GetTotalLineLength(),
+        faceCount, visitor.GetTotalFaceArea(),
+        visitor.GetBoundingBox().GetVolume()
+    };
+    return Result::OK;
+}
+
+/**********************************************************************
+【函数名称】 ConvertModel
+【函数功能】
+    流式地将模型文件转换为另一格式，不加载模型，也不影响当前模型。
+    解析、去重、编码与写入在四个线程中流水进行，
+    占用的内存与文件大小无关。出错时目标文件被删除。
+    源文件旁有增量保存的差异文件时，改为完整导入并应用差异后导出，
+    报告中只有总计，各阶段耗时为 0。
+【参数】
+    source: 源文件位置。
+    target: 目标文件位置，格式由扩展名决定。
+    report: 返回转换的进度总计与各阶段耗时。
+    progress: 进度回调，在写入线程中被调用，可以为空。
+【返回值】
+    函数发生的错误类型。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+ControllerBase::Result ControllerBase::ConvertModel(
+    const string& source,
+    const string& target,
+    ConvertReport& report,
+    const function<void(const ConvertProgress&)>& progress
+) const {
+    if (ifstream(ModelDelta<3>::GetPath(source))) {
+        return ConvertDeltaModel(source, target, report, progress);
+    }
+    unique_ptr<ModelConverter<3>> converter;
+    try {
+        converter.reset(new ModelConverter<3>(source, target));
+    }
+    catch (StorageFactoryLookupException) {
+        return Result::STORAGE_LOOKUP_ERROR;
+    }
+    converter->SetProgressHandler(progress);
+    m_ErrorLine = 0;
+    try {
+        report = converter->Convert();
+    }
+    catch (FileOpenException) {
+        return Result::FILE_OPEN_ERROR;
+    }
+    catch (FileFormatException error) {
+        m_ErrorLine = error.GetLine();
+        return Result::FILE_FORMAT_ERROR;
+    }
+    catch (IndexOverflowException error) {
+        m_ErrorLine = error.GetLine();
+        return Result::INDEX_OVERFLOW;
+    }
+    // 线段或面的顶点重合
+    catch (CollectionException) {
+        return Result::POINT_COLLISION;
+    }
+    return Result::OK;
+}
+
+/**********************************************************************
+【函数名称】 ImportModel
+【函数功能】
+    按扩展名选择导入器，从文件导入一个模型，
+    文件旁有差异文件时一并应用。
+【参数】
+    path: 文件位置。
+    model: 导入到的模型。
+    base: 返回作为基准的模型文件。
+    lineOrigins: 返回每个线段在模型文件中的下标。
+    faceOrigins: 返回每个面在模型文件中的下标。
+    errorLine: 返回出错的行号，没有时为 0。
+【返回值】
+    函数发生的错误类型。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+ControllerBase::Result ControllerBase::ImportModel(
+    const string& path,
+    Model<3>& model,
+    BaseFile& base,
+    vector<size_t>& lineOrigins,
+    vector<size_t>& faceOrigins,
+    size_t& errorLine
+) {
+    errorLine = 0;
+    unique_ptr<ImporterBase<3>> importer;
+    try {
+        importer = StorageFactory::GetImporter<3>(path);
+    }
+    catch (StorageFactoryLookupException) {
+        return Result::STORAGE_LOOKUP_ERROR;
+    }
+    try {
+        importer->Import(path, model);
+    }
+    catch (FileOpenException) {
+        return Result::FILE_OPEN_ERROR;
+    }
+    catch (FileFormatException error) {
+        errorLine = error.GetLine();
+        return Result::FILE_FORMAT_ERROR;
+    }
+    catch (IndexOverflowException error) {
+        errorLine = error.GetLine();
+        return Result::INDEX_OVERFLOW;
+    }
+    // 线段或面的顶点重合，或文件中有重复的元素
+    catch (CollectionException) {
+        return Result::POINT_COLLISION;
+    }
+    base.LineCount = model.Lines.Count();
+    base.FaceCount = model.Faces.Count();
+    if (!TryGetFileSize(path, base.Size) ||
+        !TryGetFileFingerprint(path, base.Fingerprint)) {
+        return Result::FILE_OPEN_ERROR;
+    }
+    lineOrigins.resize(base.LineCount);
+    iota(lineOrigins.begin(), lineOrigins.end(), 0);
+    faceOrigins.resize(base.FaceCount);
+    iota(faceOrigins.begin(), faceOrigins.end(), 0);
+
+    auto deltaPath = ModelDelta<3>::GetPath(path);
+    if (!ifstream(deltaPath)) {
+        return Result::OK;
+    }
+    try {
+        ModelDelta<3> delta(deltaPath);
+        // 基准文件被替换后差异不再适用，拒绝载入而不是静默丢弃改变
+        if (delta.GetBaseSize() != base.Size ||
+            delta.GetBaseFingerprint() != base.Fingerprint) {
+            return Result::FILE_FORMAT_ERROR;
+        }
+        delta.Apply(model, lineOrigins, faceOrigins);
+    }
+    catch (FileOpenException) {
+        return Result::FILE_OPEN_ERROR;
+    }
+    catch (FileFormatException) {
+        return Result::FILE_FORMAT_ERROR;
+    }
+    return Result::OK;
+}
+
+/**********************************************************************
+【函数名称】 RebaseModel
+【函数功能】
+    完整保存到基准文件后以其为新的基准，
+    日志中记录的旧基准文件中的下标不再有效。
+【参数】
+    size: 保存后基准文件的字节数。
+    fingerprint: 保存后基准文件内容的指纹。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+void ControllerBase::RebaseModel(uint64_t size, uint64_t fingerprint) {
+    CompactModel(true);
+    m_Base = {
+        size, fingerprint, m_Model.Lines.Count(), m_Model.Faces.Count()
+    };
+    iota(m_LineOrigins.begin(), m_LineOrigins.end(), 0);
+    iota(m_FaceOrigins.begin(), m_FaceOrigins.end(), 0);
+    auto forget = [](JournalEntry& entry) {
+        for (auto& change: entry.Lines) {
+            change.BeforeOrigin = ModelDelta<3>::NO_ORIGIN;
+        }
+        for (auto& change: entry.Faces) {
+            change.BeforeOrigin = ModelDelta<3>::NO_ORIGIN;
+        }
+    };
+    for (auto& entry: m_UndoJournal) {
+        forget(entry);
+    }
+    for (auto& entry: m_RedoJournal) {
+        forget(entry);
+    }
+}
+
+/**********************************************************************
+【函数名称】 TryGetFileSize
+【函数功能】 获取文件的字节数。
+【参数】
+    path: 文件位置。
+    size: 返回文件的字节数。
+【返回值】
+    文件能否打开。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+bool ControllerBase::TryGetFileSize(const string& path, uint64_t& size) {
+    ifstream stream(path, ios::in | ios::binary | ios::ate);
+    if (!stream) {
+        return false;
+    }
+    auto position = stream.tellg();
+    if (position < 0) {
+        return false;
+    }
+    size = static_cast<uint64_t>(position);
+    return true;
+}
+
+/**********************************************************************
+【函数名称】 TryGetFileFingerprint
+【函数功能】 读取整个文件，计算其内容的指纹。
+【参数】
+    path: 文件位置。
+    fingerprint: 返回文件内容的指纹。
+【返回值】
+    文件能否打开。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+bool ControllerBase::TryGetFileFingerprint(
+    const string& path,
+    uint64_t& fingerprint
+) {
+    try {
+        Tools::MappedFile file(path);
+        fingerprint = Tools::HashBytes(file.GetData(), file.GetSize());
+    }
+    catch (FileOpenException) {
+        return false;
+    }
+    return true;
+}
+
+/**********************************************************************
+【函数名称】 ScanDeltaModel
+【函数功能】 完整导入模型文件并应用旁边的差异文件，再统计。
+【参数】
+    path: 文件位置。
+    stats: 返回模型的统计信息。
+【返回值】
+    函数发生的错误类型。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+ControllerBase::Result ControllerBase::ScanDeltaModel(
+    const string& path,
+    Statistics& stats
+) const {
+    Model<3> model;
+    BaseFile base;
+    vector<size_t> lineOrigins;
+    vector<size_t> faceOrigins;
+    auto result = ImportModel(
+        path, model, base, lineOrigins, faceOrigins, m_ErrorLine
+    );
+    if (result != Result::OK) {
+        return result;
+    }
+    ModelStatistics<3> statistics(model);
+    auto lineCount = model.Lines.Count();
+    auto faceCount = model.Faces.Count();
+    stats = Statistics {
+        lineCount * 2 + faceCount * 3,
+        lineCount, statistics.GetTotalLineLength(),
+        faceCount, statistics.GetTotalFaceArea(),
+        statistics.GetBoundingBox().GetVolume()
+    };
+    return Result::OK;
+}
+
+/**********************************************************************
+【函数名称】 ConvertDeltaModel
+【函数功能】
+    完整导入模型文件并应用旁边的差异文件，再导出为另一格式。
+    出错时目标文件被删除。
+【参数】
+    source: 源文件位置。
+    target: 目标文件位置，格式由扩展名决定。
+    report: 返回转换的总计，各阶段耗时为 0。
+    progress: 进度回调，完成时被调用一次，可以为空。
+【返回值】
+    函数发生的错误类型。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+ControllerBase::Result ControllerBase::ConvertDeltaModel(
+    const string& source,
+    const string& target,
+    ConvertReport& report,
+    const function<void(const ConvertProgress&)>& progress
+) const {
+    auto start = chrono::steady_clock::now();
+    // 覆盖基准文件会使旁边的差异文件失效，与流式转换一样拒绝
+    if (source == target) {
+        return Result::FILE_OPEN_ERROR;
+    }
+    unique_ptr<ExporterBase<3>> exporter;
+    try {
+        exporter = StorageFactory::GetExporter<3>(target);
+    }
+    catch (StorageFactoryLookupException) {
+        return Result::STORAGE_LOOKUP_ERROR;
+    }
+    Model<3> model;
+    BaseFile base;
+    vector<size_t> lineOrigins;
+    vector<size_t> faceOrigins;
+    auto result = ImportModel(
+        source, model, base, lineOrigins, faceOrigins, m_ErrorLine
+    );
+    if (result != Result::OK) {
+        return result;
+    }
+    try {
+        exporter->Export(target, model);
+    }
+    catch (FileOpenException) {
+        remove(target.c_str());
+        return Result::FILE_OPEN_ERROR;
+    }
+    catch (FileFormatException) {
+        remove(target.c_str());
+        return Result::FILE_FORMAT_ERROR;
+    }
+    auto lineCount = model.Lines.Count();
+    auto faceCount = model.Faces.Count();
+    report = ConvertReport {};
+    report.Totals.VertexCount = lineCount * 2 + faceCount * 3;
+    report.Totals.UniqueVertexCount = model.CollectPoints().Count();
+    report.Totals.LineCount = lineCount;
+    report.Totals.FaceCount = faceCount;
+    TryGetFileSize(target, report.Totals.ByteCount);
+    report.Totals.Seconds = chrono::duration<double>(
+        chrono::steady_clock::now() - start
+    ).count();
+    if (progress) {
+        progress(report.Totals);
+    }
+    return Result::OK;
+}
+
+/**********************************************************************
+【函数名称】 VerifyStatistics
+【函数功能】
+    完整重新计算统计信息并与增量维护的结果比对，
+    不一致时抛出 StatisticsMismatchException。
+【参数】
+    stats: 增量维护得到的统计信息。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+void ControllerBase::VerifyStatistics(const Statistics& stats) const {
+    double totalLineLength = 0;
+    for (auto& line: m_Model.Lines) {
+        totalLineLength += line.GetLength();
+    }
+    double totalFaceArea = 0;
+    for (auto& face: m_Model.Faces) {
+        totalFaceArea += face.GetArea();
+    }
+    // 求和顺序不同，总长度与总面积只能在舍入误差内相等
+    auto isClose = [](double actual, double expected) {
+        return fabs(actual - expected) <= 1e-9 * fmax(1.0, fabs(expected));
+    };
+    if (stats.TotalLineCount != m_Model.Lines.Count() ||
+        stats.TotalFaceCount != m_Model.Faces.Count()) {
+        throw StatisticsMismatchException("element count");
+    }
+    if (!isClose(stats.TotalLineLength, totalLineLength)) {
+        throw StatisticsMismatchException("total line length");
+    }
+    if (!isClose(stats.TotalFaceArea, totalFaceArea)) {
+        throw StatisticsMismatchException("total face area");
+    }
+    if (stats.BoundingBoxVolume != m_Model.GetBoundingBox().GetVolume()) {
+        throw StatisticsMismatchException("bounding box volume");
+    }
+    if (m_LineStatus.size() != m_Model.Lines.GetSlotCount() ||
+        m_FaceStatus.size() != m_Model.Faces.GetSlotCount() ||
+        m_LineOrigins.size() != m_LineStatus.size() ||
+        m_FaceOrigins.size() != m_FaceStatus.size()) {
+        throw StatisticsMismatchException("element status count");
+    }
+}
+
+/**********************************************************************
+【函数名称】 GetFaceBvh
+【函数功能】 获取面的层次包围盒，面被修改后首次调用时重新构建。
+【参数】 无
+【返回值】
+    面的层次包围盒。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+const Bvh<3>& ControllerBase::GetFaceBvh() {
+    if (!m_pFaceBvh) {
+        m_pFaceBvh.reset(new Bvh<3>(m_Model));
+    }
+    return *m_pFaceBvh;
+}
+
+/**********************************************************************
+【函数名称】 GetPointTree
+【函数功能】
+    获取模型中所有点的 k-d 树，首次调用或模型被整体替换后重新构建。
+    构建后随线段/面的编辑增量维护。
+【参数】 无
+【返回值】
+    点的 k-d 树。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+const KdTree<3>& ControllerBase::GetPointTree() {
+    if (!m_pPointTree) {
+        vector<Point<3>> points;
+        auto collect = [&](const Point<3>& point) {
+            auto inserted = m_PointReferences.insert(
+                { point, PointReference { points.size(), 0 } }
+            );
+            if (inserted.second) {
+                points.push_back(point);
+            }
+            inserted.first->second.Count++;
+        };
+        for (auto& line: m_Model.Lines) {
+            for (auto& point: line.Points) {
+                collect(point);
+            }
+        }
+        for (auto& face: m_Model.Faces) {
+            for (auto& point: face.Points) {
+                collect(point);
+            }
+        }
+        m_pPointTree.reset(new KdTree<3>(points));
+    }
+    return *m_pPointTree;
+}
+
+/**********************************************************************
+【函数名称】 AddTreePoint
+【函数功能】 记录元素新引用的一个点，k-d 树未构建时不做任何事。
+【参数】
+    point: 元素中的点。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+void ControllerBase::AddTreePoint(const Point<3>& point) {
+    if (!m_pPointTree) {
+        return;
+    }
+    auto found = m_PointReferences.find(point);
+    if (found != m_PointReferences.end()) {
+        found->second.Count++;
+    }
+    else {
+        m_PointReferences.insert(
+            { point, PointReference { m_pPointTree->Add(point), 1 } }
+        );
+    }
+}
+
+/**********************************************************************
+【函数名称】 RemoveTreePoint
+【函数功能】
+    撤销元素对一个点的引用，不再被引用的点从 k-d 树中删除。
+    k-d 树未构建时不做任何事。
+【参数】
+    point: 元素中的点。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+void ControllerBase::RemoveTreePoint(const Point<3>& point) {
+    if (!m_pPointTree) {
+        return;
+    }
+    auto found = m_PointReferences.find(point);
+    if (--found->second.Count == 0) {
+        m_pPointTree->Remove(found->second.Index);
+        m_PointReferences.erase(found);
+    }
+}
+
+/**********************************************************************
+【函数名称】 ResetPointTree
+【函数功能】 丢弃 k-d 树，下次查询时重新构建。
+【参数】 无
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+void ControllerBase::ResetPointTree() {
+    m_pPointTree.reset();
+    m_PointReferences.clear();
+}
+
+/**********************************************************************
+【函数名称】 MarkAllModified
+【函数功能】
+    将所有未修改的线段/面标记为已修改，
+    它们都不再与基准文件中的元素相同。
+【参数】 无
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+void ControllerBase::MarkAllModified() {
+    fill(m_LineOrigins.begin(), m_LineOrigins.end(), ModelDelta<3>::NO_ORIGIN);
+    fill(m_FaceOrigins.begin(), m_FaceOrigins.end(), ModelDelta<3>::NO_ORIGIN);
+    for (auto& status: m_LineStatus) {
+        if (status == Status::UNTOUCHED) {
+            status = Status::MODIFIED;
+        }
+    }
+    for (auto& status: m_FaceStatus) {
+        if (status == Status::UNTOUCHED) {
+            status = Status::MODIFIED;
+        }
+    }
+}
+
+/**********************************************************************
+【函数名称】 GetFirstError
+【函数功能】 获取批量操作中第一项失败的错误类型。
+【参数】
+    results: 每一项的错误类型。
+【返回值】
+    第一项失败的错误类型，全部成功时为 OK。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+ControllerBase::Result ControllerBase::GetFirstError(
+    const vector<Result>& results
+) {
+    for (auto result: results) {
+        if (result != Result::OK) {
+            return result;
+        }
+    }
+    return Result::OK;
+}
+
+/**********************************************************************
+【函数名称】 RetainStatus
+【函数功能】
+    按与元素相同的方式压缩状态与在基准文件中的下标，
+    删除未标记保留的项。
+【参数】
+    status: 线段或面的状态。
+    origins: 线段或面在基准文件中的下标。
+    isKept: 每个元素是否保留。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+void ControllerBase::RetainStatus(
+    vector<Status>& status,
+    vector<size_t>& origins,
+    const vector<bool>& isKept
+) {
+    size_t count = 0;
+    for (size_t i = 0; i < status.size(); i++) {
+        if (isKept[i]) {
+            status[count] = status[i];
+            origins[count] = origins[i];
+            count++;
+        }
+    }
+    status.resize(count);
+    origins.resize(count);
+}
+
+/**********************************************************************
+【函数名称】 EnableTombstones
+【函数功能】 
+    使模型中的线段与面以墓碑方式删除。
+    模型整体替换后须重新调用。
+【参数】 无
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+void ControllerBase::EnableTombstones() {
+    m_Model.Lines.SetTombstoned(true);
+    m_Model.Faces.SetTombstoned(true);
+}
+
+/**********************************************************************
+【函数名称】 CompactModel
+【函数功能】
+    压缩线段与面中已删除的槽位，同时压缩对应的状态。
+    整体变换与焊接会重排元素，之前须强制压缩。
+【参数】
+    isForced: 为 false 时只压缩已删除的槽位足够多的集合。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+void ControllerBase::CompactModel(bool isForced) {
+    if (isForced || m_Model.Lines.IsCompactionDue()) {
+        RetainStatus(
+            m_LineStatus, m_LineOrigins, m_Model.Lines.Compact()
+        );
+    }
+    if (isForced || m_Model.Faces.IsCompactionDue()) {
+        RetainStatus(
+            m_FaceStatus, m_FaceOrigins, m_Model.Faces.Compact()
+        );
+    }
+}
+
+/**********************************************************************
+【函数名称】 ModifyLine
+【函数功能】 修改一个线段，成功时将改变记录到日志项中。
+【参数】
+    index: 线段的下标。
+    pointIndex: 要修改的点在线段中的下标。
+    x, y, z: 修改后点的三维坐标。
+    entry: 记录改变的日志项。
+【返回值】
+    函数发生的错误类型。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+ControllerBase::Result ControllerBase::ModifyLine(
+    size_t index,
+    size_t pointIndex,
+    double x, double y, double z,
+    JournalEntry& entry
+) {
+    try {
+        Line<3> line(m_Model.Lines[index]);
+        Line<3> original(line);
+        try {
+            if (!line.Points.TrySet(pointIndex, { x, y, z })) {
+                return Result::POINT_COLLISION;
+            }
+        }
+        catch (IndexOverflowException) {
+            return Result::POINT_INDEX_OVERFLOW;
+        }
+        auto slot = m_Model.Lines.GetSlot(index);
+        auto status = m_LineStatus[slot];
+        auto origin = m_LineOrigins[slot];
+        if (!ReplaceLine(
+            index, line, Status::MODIFIED, ModelDelta<3>::NO_ORIGIN
+        )) {
+            return Result::ELEMENT_COLLISION;
+        }
+        entry.Lines.push_back({ index, 0, original, line, status, origin });
+    }
+    catch (IndexOverflowException) {
+        return Result::INDEX_OVERFLOW;
+    }
+    return Result::OK;
+}
+
+/**********************************************************************
+【函数名称】 ModifyFace
+【函数功能】 修改一个面，成功时将改变记录到日志项中。
+【参数】
+    index: 面的下标。
+    pointIndex: 要修改的点在面中的下标。
+    x, y, z: 修改后点的三维坐标。
+    entry: 记录改变的日志项。
+【返回值】
+    函数发生的错误类型。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+ControllerBase::Result ControllerBase::ModifyFace(
+    size_t index,
+    size_t pointIndex,
+    double x, double y, double z,
+    JournalEntry& entry
+) {
+    try {
+        Face<3> face(m_Model.Faces[index]);
+        Face<3> original(face);
+        try {
+            if (!face.Points.TrySet(pointIndex, { x, y, z })) {
+                return Result::POINT_COLLISION;
+            }
+        }
+        catch (IndexOverflowException) {
+            return Result::POINT_INDEX_OVERFLOW;
+        }
+        auto slot = m_Model.Faces.GetSlot(index);
+        auto status = m_FaceStatus[slot];
+        auto origin = m_FaceOrigins[slot];
+        if (!ReplaceFace(
+            index, face, Status::MODIFIED, ModelDelta<3>::NO_ORIGIN
+        )) {
+            return Result::ELEMENT_COLLISION;
+        }
+        entry.Faces.push_back({ index, 0, original, face, status, origin });
+    }
+    catch (IndexOverflowException) {
+        return Result::INDEX_OVERFLOW;
+    }
+    return Result::OK;
+}
+
+/**********************************************************************
+【函数名称】 AppendLine
+【函数功能】 在末尾添加一个线段，维护统计信息、k-d 树与状态。
+【参数】
+    line: 要添加的线段。
+【返回值】
+    是否添加，已有相同的线段时为 false。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+bool ControllerBase::AppendLine(const Line<3>& line) {
+    if (!m_Model.Lines.TryAdd(line)) {
+        return false;
+    }
+    m_Statistics.Add(line);
+    for (auto& point: line.Points) {
+        AddTreePoint(point);
+    }
+    m_LineStatus.push_back(Status::CREATED);
+    m_LineOrigins.push_back(ModelDelta<3>::NO_ORIGIN);
+    return true;
+}
+
+/**********************************************************************
+【函数名称】 AppendFace
+【函数功能】 在末尾添加一个面，维护统计信息、包围盒、k-d 树与状态。
+【参数】
+    face: 要添加的面。
+【返回值】
+    是否添加，已有相同的面时为 false。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+bool ControllerBase::AppendFace(const Face<3>& face) {
+    if (!m_Model.Faces.TryAdd(face)) {
+        return false;
+    }
+    m_Statistics.Add(face);
+    m_pFaceBvh.reset();
+    for (auto& point: face.Points) {
+        AddTreePoint(point);
+    }
+    m_FaceStatus.push_back(Status::CREATED);
+    m_FaceOrigins.push_back(ModelDelta<3>::NO_ORIGIN);
+    return true;
+}
+
+/**********************************************************************
+【函数名称】 ReplaceLine
+【函数功能】
+    将指定下标处的线段替换为另一线段，
+    设置状态与在基准文件中的下标，k-d 树只更新变化的点。
+【参数】
+    index: 线段的下标，不检查越界。
+    line: 新的线段。
+    status: 新的状态。
+    origin: 新的线段在基准文件中的下标。
+【返回值】
+    是否替换，已有相同的线段时为 false。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+bool ControllerBase::ReplaceLine(
+    size_t index,
+    const Line<3>& line,
+    Status status,
+    size_t origin
+) {
+    Line<3> original(m_Model.Lines[index]);
+    if (!m_Model.Lines.TrySet(index, line)) {
+        return false;
+    }
+    m_Statistics.Remove(original);
+    m_Statistics.Add(line);
+    for (size_t i = 0; i < line.Points.Count(); i++) {
+        if (!(original.Points[i] == line.Points[i])) {
+            RemoveTreePoint(original.Points[i]);
+            AddTreePoint(line.Points[i]);
+        }
+    }
+    auto slot = m_Model.Lines.GetSlot(index);
+    m_LineStatus[slot] = status;
+    m_LineOrigins[slot] = origin;
+    return true;
+}
+
+/**********************************************************************
+【函数名称】 ReplaceFace
+【函数功能】
+    将指定下标处的面替换为另一面，
+    设置状态与在基准文件中的下标，k-d 树只更新变化的点。
+【参数】
+    index: 面的下标，不检查越界。
+    face: 新的面。
+    status: 新的状态。
+    origin: 新的面在基准文件中的下标。
+【返回值】
+    是否替换，已有相同的面时为 false。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+bool ControllerBase::ReplaceFace(
+    size_t index,
+    const Face<3>& face,
+    Status status,
+    size_t origin
+) {
+    Face<3> original(m_Model.Faces[index]);
+    if (!m_Model.Faces.TrySet(index, face)) {
+        return false;
+    }
+    m_Statistics.Remove(original);
+    m_Statistics.Add(face);
+    m_pFaceBvh.reset();
+    for (size_t i = 0; i < face.Points.Count(); i++) {
+        if (!(original.Points[i] == face.Points[i])) {
+            RemoveTreePoint(original.Points[i]);
+            AddTreePoint(face.Points[i]);
+        }
+    }
+    auto slot = m_Model.Faces.GetSlot(index);
+    m_FaceStatus[slot] = status;
+    m_FaceOrigins[slot] = origin;
+    return true;
+}
+
+/**********************************************************************
+【函数名称】 EraseLine
+【函数功能】 以墓碑方式删除一个线段，不压缩。
+【参数】
+    index: 线段的下标，不检查越界。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+void ControllerBase::EraseLine(size_t index) {
+    Line<3> line(m_Model.Lines[index]);
+    m_Model.Lines.Remove(index);
+    m_Statistics.Remove(line);
+    for (auto& point: line.Points) {
+        RemoveTreePoint(point);
+    }
+}
+
+/**********************************************************************
+【函数名称】 EraseFace
+【函数功能】 以墓碑方式删除一个面，不压缩。
+【参数】
+    index: 面的下标，不检查越界。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+void ControllerBase::EraseFace(size_t index) {
+    Face<3> face(m_Model.Faces[index]);
+    m_Model.Faces.Remove(index);
+    m_Statistics.Remove(face);
+    m_pFaceBvh.reset();
+    for (auto& point: face.Points) {
+        RemoveTreePoint(point);
+    }
+}
+
+/**********************************************************************
+【函数名称】 RestoreLine
+【函数功能】
+    将删除的线段放回删除前的下标，
+    并恢复状态与在基准文件中的下标。
+    槽位尚未压缩时直接恢复，为 O(log n)，否则先压缩再插入。
+【参数】
+    change: 删除线段时记录的改变。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+void ControllerBase::RestoreLine(const ElementChange<Line<3>>& change) {
+    auto& line = change.Before;
+    if (m_Model.Lines.TryRevive(change.Slot, change.Index, line)) {
+        m_LineStatus[change.Slot] = change.BeforeStatus;
+        m_LineOrigins[change.Slot] = change.BeforeOrigin;
+    }
+    else {
+        RetainStatus(m_LineStatus, m_LineOrigins, m_Model.Lines.Compact());
+        if (!m_Model.Lines.TryInsert(change.Index, line)) {
+            return;
+        }
+        m_LineStatus.insert(
+            m_LineStatus.begin() + change.Index,
+            change.BeforeStatus
+        );
+        m_LineOrigins.insert(
+            m_LineOrigins.begin() + change.Index,
+            change.BeforeOrigin
+        );
+    }
+    m_Statistics.Add(line);
+    for (auto& point: line.Points) {
+        AddTreePoint(point);
+    }
+}
+
+/**********************************************************************
+【函数名称】 RestoreFace
+【函数功能】
+    将删除的面放回删除前的下标，
+    并恢复状态与在基准文件中的下标。
+    槽位尚未压缩时直接恢复，为 O(log n)，否则先压缩再插入。
+【参数】
+    change: 删除面时记录的改变。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+void ControllerBase::RestoreFace(const ElementChange<Face<3>>& change) {
+    auto& face = change.Before;
+    if (m_Model.Faces.TryRevive(change.Slot, change.Index, face)) {
+        m_FaceStatus[change.Slot] = change.BeforeStatus;
+        m_FaceOrigins[change.Slot] = change.BeforeOrigin;
+    }
+    else {
+        RetainStatus(m_FaceStatus, m_FaceOrigins, m_Model.Faces.Compact());
+        if (!m_Model.Faces.TryInsert(change.Index, face)) {
+            return;
+        }
+        m_FaceStatus.insert(
+            m_FaceStatus.begin() + change.Index,
+            change.BeforeStatus
+        );
+        m_FaceOrigins.insert(
+            m_FaceOrigins.begin() + change.Index,
+            change.BeforeOrigin
+        );
+    }
+    m_Statistics.Add(face);
+    m_pFaceBvh.reset();
+    for (auto& point: face.Points) {
+        AddTreePoint(point);
+    }
+}
+
+/**********************************************************************
+【函数名称】 ApplyTransform
+【函数功能】 对整个模型施加变换，之后重建统计信息与空间索引。
+【参数】
+    transform: 作用于模型的变换，返回变换是否为单射。
+    isInjective: 返回变换是否为单射。
+【返回值】
+    函数发生的错误类型。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+ControllerBase::Result ControllerBase::ApplyTransform(
+    const function<bool(Model<3>&)>& transform,
+    bool& isInjective
+) {
+    CompactModel(true);
+    try {
+        isInjective = transform(m_Model);
+    }
+    catch (CollectionException) {
+        return Result::TRANSFORM_COLLISION;
+    }
+    m_Statistics.Rebuild(m_Model);
+    m_pFaceBvh.reset();
+    ResetPointTree();
+    MarkAllModified();
+    return Result::OK;
+}
+
+/**********************************************************************
+【函数名称】 RevertEntry
+【函数功能】 按相反的顺序撤销日志项中的操作。
+【参数】
+    entry: 要撤销的日志项。
+【返回值】
+    函数发生的错误类型。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+ControllerBase::Result ControllerBase::RevertEntry(const JournalEntry& entry) {
+    // 日志之后的操作均已撤销，模型与记录时相同，以下各步不会失败；
+    // 只有整体变换的逆变换可能因舍入使点或元素重合
+    auto& lines = entry.Lines;
+    auto& faces = entry.Faces;
+    switch (entry.Action) {
+        case JournalAction::ADD: {
+            for (auto it = lines.rbegin(); it != lines.rend(); ++it) {
+                EraseLine(it->Index);
+            }
+            for (auto it = faces.rbegin(); it != faces.rend(); ++it) {
+                EraseFace(it->Index);
+            }
+            CompactModel(false);
+            break;
+        }
+        case JournalAction::MODIFY: {
+            for (auto it = lines.rbegin(); it != lines.rend(); ++it) {
+                ReplaceLine(
+                    it->Index, it->Before, it->BeforeStatus, it->BeforeOrigin
+                );
+            }
+            for (auto it = faces.rbegin(); it != faces.rend(); ++it) {
+                ReplaceFace(
+                    it->Index, it->Before, it->BeforeStatus, it->BeforeOrigin
+                );
+            }
+            break;
+        }
+        case JournalAction::REMOVE: {
+            // 按下标升序放回，每个元素放回时其前方的元素均已就位
+            for (auto& change: lines) {
+                RestoreLine(change);
+            }
+            for (auto& change: faces) {
+                RestoreFace(change);
+            }
+            break;
+        }
+        case JournalAction::TRANSFORM: {
+            bool isInjective;
+            return ApplyTransform(entry.Inverse, isInjective);
+        }
+    }
+    return Result::OK;
+}
+
+/**********************************************************************
+【函数名称】 ReapplyEntry
+【函数功能】 重做日志项中的操作，并更新其中删除时的槽位。
+【参数】
+    entry: 要重做的日志项。
+【返回值】
+    函数发生的错误类型。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+ControllerBase::Result ControllerBase::ReapplyEntry(JournalEntry& entry) {
+    auto& lines = entry.Lines;
+    auto& faces = entry.Faces;
+    switch (entry.Action) {
+        case JournalAction::ADD: {
+            for (auto& change: lines) {
+                AppendLine(change.After);
+            }
+            for (auto& change: faces) {
+                AppendFace(change.After);
+            }
+            break;
+        }
+        case JournalAction::MODIFY: {
+            for (auto& change: lines) {
+                ReplaceLine(
+                    change.Index, change.After,
+                    Status::MODIFIED, ModelDelta<3>::NO_ORIGIN
+                );
+            }
+            for (auto& change: faces) {
+                ReplaceFace(
+                    change.Index, change.After,
+                    Status::MODIFIED, ModelDelta<3>::NO_ORIGIN
+                );
+            }
+            break;
+        }
+        case JournalAction::REMOVE: {
+            // 按下标降序删除，尚未删除的元素下标不变
+            for (auto it = lines.rbegin(); it != lines.rend(); ++it) {
+                it->Slot = m_Model.Lines.GetSlot(it->Index);
+                EraseLine(it->Index);
+            }
+            for (auto it = faces.rbegin(); it != faces.rend(); ++it) {
+                it->Slot = m_Model.Faces.GetSlot(it->Index);
+                EraseFace(it->Index);
+            }
+            CompactModel(false);
+            break;
+        }
+        case JournalAction::TRANSFORM: {
+            bool isInjective;
+            return ApplyTransform(entry.Forward, isInjective);
+        }
+    }
+    return Result::OK;
+}
+
+/**********************************************************************
+【函数名称】 CommitJournalEntry
+【函数功能】
+    将一次成功的操作记入日志并清空可重做的操作，
+    超出 MAX_JOURNAL_CHANGE_COUNT 时丢弃最早的操作。
+    没有改变的日志项被忽略。
+【参数】
+    entry: 要记录的日志项。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+void ControllerBase::CommitJournalEntry(JournalEntry&& entry) {
+    auto count = GetChangeCount(entry);
+    if (count == 0) {
+        return;
+    }
+    for (auto& redo: m_RedoJournal) {
+        m_JournalChangeCount -= GetChangeCount(redo);
+    }
+    m_RedoJournal.clear();
+    m_UndoJournal.push_back(move(entry));
+    m_JournalChangeCount += count;
+    // 单个操作超出上限时自身也被丢弃，日志为空
+    while (m_JournalChangeCount > MAX_JOURNAL_CHANGE_COUNT) {
+        m_JournalChangeCount -= GetChangeCount(m_UndoJournal.front());
+        m_UndoJournal.pop_front();
+    }
+}
+
+/**********************************************************************
+【函数名称】 ClearJournal
+【函数功能】 清空日志，之前的操作不能再撤销或重做。
+【参数】 无
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+void ControllerBase::ClearJournal() {
+    m_UndoJournal.clear();
+    m_RedoJournal.clear();
+    m_JournalChangeCount = 0;
+}
+
+/**********************************************************************
+【函数名称】 GetChangeCount
+【函数功能】 获取日志项的大小，整体变换计为 1。
+【参数】
+    entry: 日志项。
+【返回值】
+    日志项中元素改变的个数。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+size_t ControllerBase::GetChangeCount(const JournalEntry& entry) {
+    if (entry.Action == JournalAction::TRANSFORM) {
+        return 1;
+    }
+    return entry.Lines.size() + entry.Faces.size();
+}
+
 }
 
 }
\ No newline at end of file
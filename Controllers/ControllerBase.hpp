@@ -6,13 +6,24 @@
 
 #pragma once
 
+#include <array>
 #include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include "../Models/Core/Model.hpp"
+#include "../Models/Core/ModelStatistics.hpp"
 #include "../Models/Core/Line.hpp"
 #include "../Models/Core/Face.hpp"
 #include "../Models/Core/Point.hpp"
+#include "../Models/Spatial/Bvh.hpp"
+#include "../Models/Spatial/KdTree.hpp"
+#include "../Models/Storage/ModelConverter.hpp"
+#include "../Models/Storage/ModelDelta.hpp"
 using namespace std;
 
 namespace C3w {
@@ -51,7 +62,13 @@ class ControllerBase {
             // 点重复
             POINT_COLLISION,
             // 元素重复
-            ELEMENT_COLLISION
+            ELEMENT_COLLISION,
+            // 变换使点或元素重合
+            TRANSFORM_COLLISION,
+            // 没有可撤销的操作
+            NOTHING_TO_UNDO,
+            // 没有可重做的操作
+            NOTHING_TO_REDO
         };
 
         /**********************************************************************
@@ -84,7 +101,7 @@ class ControllerBase {
 
         /**********************************************************************
         【类名】 Statistics
-        【功能】 用于 GetStatistics 的返回值。
+        【功能】 用于 GetStatistics 与 ScanModel 的返回值。
         【接口说明】 点数量，线段数量/总长度，面数量/总面积，外接长方体体积。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
@@ -102,17 +119,101 @@ class ControllerBase {
             // 外接长方体体积
             double BoundingBoxVolume;
         };
+
+        // 用于 ConvertModel 的进度回调参数，见 ModelConverter::Progress
+        using ConvertProgress = Storage::ModelConverter<3>::Progress;
+        // 用于 ConvertModel 的返回值，见 ModelConverter::Report
+        using ConvertReport = Storage::ModelConverter<3>::Report;
+
+        /**********************************************************************
+        【类名】 FaceQueryResult
+        【功能】 用于 CastRay / FindClosestFacePoint 的返回值。
+        【接口说明】 命中的面的下标，距离，命中的点的字符串表达形式。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        struct FaceQueryResult {
+            // 面的下标
+            size_t FaceIndex;
+            // 命中的点到射线起点或查询点的距离
+            double Distance;
+            // 命中的点的字符串表达形式
+            string Position;
+        };
+
+        /**********************************************************************
+        【类名】 PointQueryResult
+        【功能】 用于 FindPointsInRadius / FindNearestPoints 的返回值。
+        【接口说明】 点到查询点的距离，点的字符串表达形式。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        struct PointQueryResult {
+            // 点到查询点的距离
+            double Distance;
+            // 点的字符串表达形式
+            string Position;
+        };
+
+        /**********************************************************************
+        【类名】 WeldResult
+        【功能】 用于 Weld 的返回值。
+        【接口说明】 移动的点数量，删除的线段数量，删除的面数量。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        struct WeldResult {
+            // 被合并到另一点而移动的点数量
+            size_t MovedPointCount;
+            // 退化或重复而删除的线段数量
+            size_t RemovedLineCount;
+            // 退化或重复而删除的面数量
+            size_t RemovedFaceCount;
+        };
+
+        /**********************************************************************
+        【类名】 DiffResult
+        【功能】 用于 DiffModel 的返回值。
+        【接口说明】 新增与删除的线段和面的字符串表达形式。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        struct DiffResult {
+            // 另一模型中新增的线段
+            vector<string> AddedLines;
+            // 另一模型中删除的线段
+            vector<string> RemovedLines;
+            // 另一模型中新增的面
+            vector<string> AddedFaces;
+            // 另一模型中删除的面
+            vector<string> RemovedFaces;
+        };
+
+        /**********************************************************************
+        【类名】 PointEdit
+        【功能】 用于 ModifyLines / ModifyFaces 的参数。
+        【接口说明】 元素下标，点在元素中的下标，修改后点的三维坐标。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        struct PointEdit {
+            // 元素的下标
+            size_t Index;
+            // 要修改的点在元素中的下标
+            size_t PointIndex;
+            // 修改后点的三维坐标
+            double X;
+            double Y;
+            double Z;
+        };
         
         // 构造函数
 
         /**********************************************************************
         【函数名称】 构造函数
-        【函数功能】 创建一个默认的 ControllerBase 类型实例。
+        【函数功能】
+            创建一个默认的 ControllerBase 类型实例，
+            模型中的线段与面以墓碑方式删除。
         【参数】 无
         【返回值】 无
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        ControllerBase() = default;
+        ControllerBase();
         // 删除拷贝构造函数
         ControllerBase(const ControllerBase& other) = delete;
         // 删除移动构造函数
@@ -130,6 +231,18 @@ class ControllerBase {
         **********************************************************************/
         string GetName() const;
         /**********************************************************************
+        【函数名称】 GetErrorLine
+        【函数功能】
+            获取最近一次读取模型文件（载入、比较、统计或转换）
+            因内容错误或下标无效而失败时出错的行号。
+        【参数】 无
+        【返回值】
+            出错的行号，从 1 开始；最近一次读取成功、
+            因其他原因失败或文件格式没有行号时为 0。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        size_t GetErrorLine() const;
+        /**********************************************************************
         【函数名称】 GetLines
         【函数功能】 获取所有线段的字符串表达形式。
         【参数】 无
@@ -190,6 +303,53 @@ class ControllerBase {
         **********************************************************************/
         Result RemoveLine(size_t index);
         /**********************************************************************
+        【函数名称】 AddLines
+        【函数功能】
+            批量添加线段，逐项结果与按顺序逐个调用 AddLine 相同。
+            元素与状态只扩容一次，重复由哈希索引逐项检查，
+            同批中较早添加的线段也参与检查。
+        【参数】
+            lines: 每个线段各点的三维坐标，依次排列。
+            results: 返回每一项发生的错误类型，与 lines 等长。
+        【返回值】
+            第一项失败的错误类型，全部成功时为 OK。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Result AddLines(
+            const vector<array<double, 6>>& lines,
+            vector<Result>& results
+        );
+        /**********************************************************************
+        【函数名称】 ModifyLines
+        【函数功能】 批量修改线段，逐项结果与按顺序逐个调用 ModifyLine 相同。
+        【参数】
+            edits: 要进行的修改。
+            results: 返回每一项发生的错误类型，与 edits 等长。
+        【返回值】
+            第一项失败的错误类型，全部成功时为 OK。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Result ModifyLines(
+            const vector<PointEdit>& edits,
+            vector<Result>& results
+        );
+        /**********************************************************************
+        【函数名称】 RemoveLines
+        【函数功能】
+            批量删除线段，下标均指删除前的位置。
+            全部检查后再逐个标记删除，其余元素与状态不移动。
+        【参数】
+            indices: 要删除线段的下标，越界或重复的项返回 INDEX_OVERFLOW。
+            results: 返回每一项发生的错误类型，与 indices 等长。
+        【返回值】
+            第一项失败的错误类型，全部成功时为 OK。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Result RemoveLines(
+            const vector<size_t>& indices,
+            vector<Result>& results
+        );
+        /**********************************************************************
         【函数名称】 GetFaces
         【函数功能】 获取所有面的字符串表达形式。
         【参数】 无
@@ -252,8 +412,235 @@ class ControllerBase {
         **********************************************************************/
         Result RemoveFace(size_t index);
         /**********************************************************************
+        【函数名称】 AddFaces
+        【函数功能】
+            批量添加面，逐项结果与按顺序逐个调用 AddFace 相同。
+            元素与状态只扩容一次，重复由哈希索引逐项检查，
+            同批中较早添加的面也参与检查。
+        【参数】
+            faces: 每个面各点的三维坐标，依次排列。
+            results: 返回每一项发生的错误类型，与 faces 等长。
+        【返回值】
+            第一项失败的错误类型，全部成功时为 OK。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Result AddFaces(
+            const vector<array<double, 9>>& faces,
+            vector<Result>& results
+        );
+        /**********************************************************************
+        【函数名称】 ModifyFaces
+        【函数功能】 批量修改面，逐项结果与按顺序逐个调用 ModifyFace 相同。
+        【参数】
+            edits: 要进行的修改。
+            results: 返回每一项发生的错误类型，与 edits 等长。
+        【返回值】
+            第一项失败的错误类型，全部成功时为 OK。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Result ModifyFaces(
+            const vector<PointEdit>& edits,
+            vector<Result>& results
+        );
+        /**********************************************************************
+        【函数名称】 RemoveFaces
+        【函数功能】
+            批量删除面，下标均指删除前的位置。
+            全部检查后再逐个标记删除，其余元素与状态不移动。
+        【参数】
+            indices: 要删除面的下标，越界或重复的项返回 INDEX_OVERFLOW。
+            results: 返回每一项发生的错误类型，与 indices 等长。
+        【返回值】
+            第一项失败的错误类型，全部成功时为 OK。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Result RemoveFaces(
+            const vector<size_t>& indices,
+            vector<Result>& results
+        );
+        /**********************************************************************
+        【函数名称】 CastRay
+        【函数功能】 求射线与模型中的面的第一个交点。
+        【参数】
+            ox, oy, oz: 射线起点的三维坐标。
+            dx, dy, dz: 射线方向的三维向量。
+            isHit: 返回射线是否与某个面相交。
+            hit: 相交时返回交点。
+        【返回值】
+            函数发生的错误类型。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Result CastRay(
+            double ox, double oy, double oz,
+            double dx, double dy, double dz,
+            bool& isHit,
+            FaceQueryResult& hit
+        );
+        /**********************************************************************
+        【函数名称】 FindClosestFacePoint
+        【函数功能】 求模型中的面上距给定点最近的点。
+        【参数】
+            x, y, z: 给定点的三维坐标。
+            isFound: 返回是否找到，即模型中是否有面。
+            hit: 找到时返回最近的点。
+        【返回值】
+            函数发生的错误类型。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Result FindClosestFacePoint(
+            double x, double y, double z,
+            bool& isFound,
+            FaceQueryResult& hit
+        );
+        /**********************************************************************
+        【函数名称】 FindFacesInBox
+        【函数功能】 查找包围盒与给定长方体相交的面。
+        【参数】
+            x1, y1, z1: 长方体第一个顶点的三维坐标。
+            x2, y2, z2: 长方体第二个顶点的三维坐标。
+            indices: 返回按升序排列的面的下标。
+        【返回值】
+            函数发生的错误类型。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Result FindFacesInBox(
+            double x1, double y1, double z1,
+            double x2, double y2, double z2,
+            vector<size_t>& indices
+        );
+        /**********************************************************************
+        【函数名称】 FindPointsInRadius
+        【函数功能】 查找模型中到给定点的距离不超过半径的点。
+        【参数】
+            x, y, z: 给定点的三维坐标。
+            radius: 半径。
+            points: 返回按距离升序排列的点。
+        【返回值】
+            函数发生的错误类型。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Result FindPointsInRadius(
+            double x, double y, double z,
+            double radius,
+            vector<PointQueryResult>& points
+        );
+        /**********************************************************************
+        【函数名称】 FindNearestPoints
+        【函数功能】 查找模型中距给定点最近的若干个点。
+        【参数】
+            x, y, z: 给定点的三维坐标。
+            count: 要查找的个数。
+            points: 返回按距离升序排列的点。
+        【返回值】
+            函数发生的错误类型。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Result FindNearestPoints(
+            double x, double y, double z,
+            size_t count,
+            vector<PointQueryResult>& points
+        );
+        /**********************************************************************
+        【函数名称】 FindPointsInBox
+        【函数功能】 查找模型中位于给定长方体内的点。
+        【参数】
+            x1, y1, z1: 长方体第一个顶点的三维坐标。
+            x2, y2, z2: 长方体第二个顶点的三维坐标。
+            points: 返回点的字符串表达形式。
+        【返回值】
+            函数发生的错误类型。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Result FindPointsInBox(
+            double x1, double y1, double z1,
+            double x2, double y2, double z2,
+            vector<string>& points
+        );
+        /**********************************************************************
+        【函数名称】 Translate
+        【函数功能】 移动整个模型。
+        【参数】
+            x, y, z: 移动的三维向量。
+        【返回值】
+            函数发生的错误类型。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Result Translate(double x, double y, double z);
+        /**********************************************************************
+        【函数名称】 Scale
+        【函数功能】 以定点为中心缩放整个模型。
+        【参数】
+            x, y, z: 参考点的三维坐标。
+            ratio: 缩放的比例。
+            isInjective: 返回变换是否为单射。
+        【返回值】
+            函数发生的错误类型。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Result Scale(
+            double x, double y, double z,
+            double ratio,
+            bool& isInjective
+        );
+        /**********************************************************************
+        【函数名称】 Transform
+        【函数功能】 对整个模型施加仿射变换 x' = Ax + b。
+        【参数】
+            linear: 线性部分 A，按行给出。
+            offset: 平移部分 b。
+            isInjective: 返回变换是否为单射。
+        【返回值】
+            函数发生的错误类型。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Result Transform(
+            const array<array<double, 3>, 3>& linear,
+            const array<double, 3>& offset,
+            bool& isInjective
+        );
+        /**********************************************************************
+        【函数名称】 Weld
+        【函数功能】
+            焊接模型中距离不超过给定值的点，见 Model::Weld。
+            保留的元素维持原来的状态，有点移动时都标记为已修改。
+        【参数】
+            epsilon: 焊接的距离，不为正数时模型不变。
+            result: 返回移动的点数量与删除的元素数量。
+        【返回值】
+            函数发生的错误类型。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Result Weld(double epsilon, WeldResult& result);
+        /**********************************************************************
+        【函数名称】 Undo
+        【函数功能】
+            撤销最近一次成功的编辑、批量编辑或整体变换，
+            耗时与该操作涉及的元素数成正比，与模型大小无关。
+            元素与状态恢复原样；整体变换以逆变换撤销，坐标可能有舍入误差，
+            元素仍为已修改。加载、焊接与不可逆的变换之前的操作不能撤销。
+        【参数】 无
+        【返回值】
+            函数发生的错误类型，没有可撤销的操作时为 NOTHING_TO_UNDO。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Result Undo();
+        /**********************************************************************
+        【函数名称】 Redo
+        【函数功能】
+            重做最近一次撤销的操作，耗时与该操作涉及的元素数成正比。
+            撤销后进行新的操作时不能再重做。
+        【参数】 无
+        【返回值】
+            函数发生的错误类型，没有可重做的操作时为 NOTHING_TO_REDO。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Result Redo();
+        /**********************************************************************
         【函数名称】 GetStatistics
-        【函数功能】 获取统计信息。
+        【函数功能】
+            获取统计信息。各项由每次编辑增量维护，耗时与模型大小无关。
+            定义 C3W_VERIFY_STATISTICS 时会与完整重新计算的结果比对，
+            不一致则抛出 StatisticsMismatchException。
         【参数】 无
         【返回值】
             模型统计信息。
@@ -262,24 +649,82 @@ class ControllerBase {
         Statistics GetStatistics() const;
         /**********************************************************************
         【函数名称】 LoadModel
-        【函数功能】 从文件加载一个模型。
+        【函数功能】
+            从文件加载一个模型，可选在加载后焊接相近的点。
+            文件旁有增量保存的差异文件时一并应用。
+            加载失败时当前模型保持不变。
         【参数】
             path: 文件位置。
+            weldTolerance: 焊接的距离，不为正数时不焊接。
         【返回值】
             函数发生的错误类型。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        Result LoadModel(string path);
+        Result LoadModel(const string& path, double weldTolerance = 0);
         /**********************************************************************
         【函数名称】 SaveModel
-        【函数功能】 向文件保存一个模型。
+        【函数功能】
+            向文件保存一个模型。保存到载入的文件且该文件未被替换时，
+            只将相对于它的差异写入旁边的差异文件，不改写模型文件；
+            差异文件超过模型文件的 1/DELTA_FOLD_RATIO 时改为完整保存，
+            将差异并入模型文件并删除差异文件。
         【参数】
-            path: 文件位置。
+            path: 文件位置，为空时保存到载入的文件。
         【返回值】
             函数发生的错误类型。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
         Result SaveModel(string path);
+        /**********************************************************************
+        【函数名称】 DiffModel
+        【函数功能】 从文件加载另一模型，与当前模型比较线段和面。
+        【参数】
+            path: 另一模型的文件位置。
+            result: 返回新增与删除的元素。
+        【返回值】
+            函数发生的错误类型。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Result DiffModel(const string& path, DiffResult& result);
+        /**********************************************************************
+        【函数名称】 ScanModel
+        【函数功能】
+            流式读取模型文件并统计，不加载模型，也不影响当前模型。
+            占用的内存与文件大小无关，可以统计无法完整载入内存的文件。
+            不检查重复元素，重复的线段与面各计一次。
+            文件旁有增量保存的差异文件时，改为完整导入并应用差异后统计；
+            差异文件只由完整载入过的模型写出，这样的文件同样能载入内存。
+        【参数】
+            path: 文件位置。
+            stats: 返回文件中模型的统计信息，各项含义与 GetStatistics 相同。
+        【返回值】
+            函数发生的错误类型。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Result ScanModel(const string& path, Statistics& stats) const;
+        /**********************************************************************
+        【函数名称】 ConvertModel
+        【函数功能】
+            流式地将模型文件转换为另一格式，不加载模型，也不影响当前模型。
+            解析、去重、编码与写入在四个线程中流水进行，
+            占用的内存与文件大小无关。出错时目标文件被删除。
+            源文件旁有增量保存的差异文件时，改为完整导入并应用差异后导出，
+            报告中只有总计，各阶段耗时为 0。
+        【参数】
+            source: 源文件位置。
+            target: 目标文件位置，格式由扩展名决定。
+            report: 返回转换的进度总计与各阶段耗时。
+            progress: 进度回调，在写入线程中被调用，可以为空。
+        【返回值】
+            函数发生的错误类型。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Result ConvertModel(
+            const string& source,
+            const string& target,
+            ConvertReport& report,
+            const function<void(const ConvertProgress&)>& progress = nullptr
+        ) const;
 
         // 虚析构函数
         virtual ~ControllerBase() = default;
@@ -324,10 +769,543 @@ class ControllerBase {
             Status status
         ) const = 0;
     private:
+        /**********************************************************************
+        【类名】 PointReference
+        【功能】 点在 k-d 树中的下标及引用它的元素个数。
+        【接口说明】 下标，引用次数。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        struct PointReference {
+            // 点在 k-d 树中的下标
+            size_t Index;
+            // 线段与面中该点出现的次数
+            size_t Count;
+        };
+
+        /**********************************************************************
+        【类名】 JournalAction
+        【功能】 日志中记录的操作类型。
+        【接口说明】 枚举，表示操作类型。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        enum class JournalAction {
+            // 添加线段或面
+            ADD,
+            // 修改线段或面
+            MODIFY,
+            // 删除线段或面
+            REMOVE,
+            // 整体变换
+            TRANSFORM
+        };
+
+        /**********************************************************************
+        【类名】 ElementChange
+        【功能】 日志中记录的一个线段或面的改变。
+        【接口说明】
+            下标，删除时的槽位，改变前后的元素，
+            改变前的状态与在基准文件中的下标。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        template <typename E>
+        struct ElementChange {
+            // 元素的下标，批量删除时为删除前的下标
+            size_t Index;
+            // 删除时元素所在的槽位，未压缩时撤销删除只需恢复该槽位
+            size_t Slot;
+            // 改变前的元素，添加时与 After 相同
+            E Before;
+            // 改变后的元素，删除时与 Before 相同
+            E After;
+            // 改变前的状态，添加时不使用
+            Status BeforeStatus;
+            // 改变前在基准文件中的下标，添加时不使用
+            size_t BeforeOrigin;
+        };
+
+        /**********************************************************************
+        【类名】 JournalEntry
+        【功能】 日志中的一次操作，只记录改变的元素而不复制模型。
+        【接口说明】
+            操作类型，改变的线段或面，整体变换及其逆变换。
+            批量操作的全部改变记录在同一项中。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        struct JournalEntry {
+            // 操作类型
+            JournalAction Action;
+            // 改变的线段，按操作的顺序排列，批量删除时按下标升序排列
+            vector<ElementChange<Line<3>>> Lines;
+            // 改变的面，排列方式同 Lines
+            vector<ElementChange<Face<3>>> Faces;
+            // 整体变换，仅用于 TRANSFORM
+            function<bool(Model<3>&)> Forward;
+            // 整体变换的逆变换，仅用于 TRANSFORM
+            function<bool(Model<3>&)> Inverse;
+        };
+
+        /**********************************************************************
+        【类名】 BaseFile
+        【功能】 载入或完整保存的模型文件，是增量保存时差异的基准。
+        【接口说明】 简单数据类型，无函数。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        struct BaseFile {
+            // 文件的字节数，用于确认文件未被替换
+            uint64_t Size;
+            // 文件内容的指纹，字节数相同时确认内容未被改写
+            uint64_t Fingerprint;
+            // 文件中的线段数
+            size_t LineCount;
+            // 文件中的面数
+            size_t FaceCount;
+        };
+
+        // 日志中最多保留的元素改变数，超出时丢弃最早的操作
+        static const size_t MAX_JOURNAL_CHANGE_COUNT { 100000 };
+        // 差异文件超过基准文件的几分之一时改为完整保存
+        static const uint64_t DELTA_FOLD_RATIO { 4 };
+
+        /**********************************************************************
+        【函数名称】 ImportModel
+        【函数功能】
+            按扩展名选择导入器，从文件导入一个模型，
+            文件旁有差异文件时一并应用。
+        【参数】
+            path: 文件位置。
+            model: 导入到的模型。
+            base: 返回作为基准的模型文件。
+            lineOrigins: 返回每个线段在模型文件中的下标。
+            faceOrigins: 返回每个面在模型文件中的下标。
+            errorLine: 返回出错的行号，没有时为 0。
+        【返回值】
+            函数发生的错误类型。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static Result ImportModel(
+            const string& path,
+            Model<3>& model,
+            BaseFile& base,
+            vector<size_t>& lineOrigins,
+            vector<size_t>& faceOrigins,
+            size_t& errorLine
+        );
+        /**********************************************************************
+        【函数名称】 RebaseModel
+        【函数功能】
+            完整保存到基准文件后以其为新的基准，
+            日志中记录的旧基准文件中的下标不再有效。
+        【参数】
+            size: 保存后基准文件的字节数。
+            fingerprint: 保存后基准文件内容的指纹。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void RebaseModel(uint64_t size, uint64_t fingerprint);
+        /**********************************************************************
+        【函数名称】 TryGetFileSize
+        【函数功能】 获取文件的字节数。
+        【参数】
+            path: 文件位置。
+            size: 返回文件的字节数。
+        【返回值】
+            文件能否打开。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static bool TryGetFileSize(const string& path, uint64_t& size);
+        /**********************************************************************
+        【函数名称】 TryGetFileFingerprint
+        【函数功能】 读取整个文件，计算其内容的指纹。
+        【参数】
+            path: 文件位置。
+            fingerprint: 返回文件内容的指纹。
+        【返回值】
+            文件能否打开。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static bool TryGetFileFingerprint(
+            const string& path,
+            uint64_t& fingerprint
+        );
+        /**********************************************************************
+        【函数名称】 ScanDeltaModel
+        【函数功能】 完整导入模型文件并应用旁边的差异文件，再统计。
+        【参数】
+            path: 文件位置。
+            stats: 返回模型的统计信息。
+        【返回值】
+            函数发生的错误类型。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Result ScanDeltaModel(const string& path, Statistics& stats) const;
+        /**********************************************************************
+        【函数名称】 ConvertDeltaModel
+        【函数功能】
+            完整导入模型文件并应用旁边的差异文件，再导出为另一格式。
+            出错时目标文件被删除。
+        【参数】
+            source: 源文件位置。
+            target: 目标文件位置，格式由扩展名决定。
+            report: 返回转换的总计，各阶段耗时为 0。
+            progress: 进度回调，完成时被调用一次，可以为空。
+        【返回值】
+            函数发生的错误类型。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Result ConvertDeltaModel(
+            const string& source,
+            const string& target,
+            ConvertReport& report,
+            const function<void(const ConvertProgress&)>& progress
+        ) const;
+        /**********************************************************************
+        【函数名称】 VerifyStatistics
+        【函数功能】
+            完整重新计算统计信息并与增量维护的结果比对，
+            不一致时抛出 StatisticsMismatchException。
+        【参数】
+            stats: 增量维护得到的统计信息。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void VerifyStatistics(const Statistics& stats) const;
+        /**********************************************************************
+        【函数名称】 GetFaceBvh
+        【函数功能】 获取面的层次包围盒，面被修改后首次调用时重新构建。
+        【参数】 无
+        【返回值】
+            面的层次包围盒。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        const Spatial::Bvh<3>& GetFaceBvh();
+        /**********************************************************************
+        【函数名称】 GetPointTree
+        【函数功能】
+            获取模型中所有点的 k-d 树，首次调用或模型被整体替换后重新构建。
+            构建后随线段/面的编辑增量维护。
+        【参数】 无
+        【返回值】
+            点的 k-d 树。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        const Spatial::KdTree<3>& GetPointTree();
+        /**********************************************************************
+        【函数名称】 AddTreePoint
+        【函数功能】 记录元素新引用的一个点，k-d 树未构建时不做任何事。
+        【参数】
+            point: 元素中的点。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void AddTreePoint(const Point<3>& point);
+        /**********************************************************************
+        【函数名称】 RemoveTreePoint
+        【函数功能】
+            撤销元素对一个点的引用，不再被引用的点从 k-d 树中删除。
+            k-d 树未构建时不做任何事。
+        【参数】
+            point: 元素中的点。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void RemoveTreePoint(const Point<3>& point);
+        /**********************************************************************
+        【函数名称】 ResetPointTree
+        【函数功能】 丢弃 k-d 树，下次查询时重新构建。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void ResetPointTree();
+        /**********************************************************************
+        【函数名称】 MarkAllModified
+        【函数功能】
+            将所有未修改的线段/面标记为已修改，
+            它们都不再与基准文件中的元素相同。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void MarkAllModified();
+        /**********************************************************************
+        【函数名称】 GetFirstError
+        【函数功能】 获取批量操作中第一项失败的错误类型。
+        【参数】
+            results: 每一项的错误类型。
+        【返回值】
+            第一项失败的错误类型，全部成功时为 OK。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static Result GetFirstError(const vector<Result>& results);
+        /**********************************************************************
+        【函数名称】 RetainStatus
+        【函数功能】
+            按与元素相同的方式压缩状态与在基准文件中的下标，
+            删除未标记保留的项。
+        【参数】
+            status: 线段或面的状态。
+            origins: 线段或面在基准文件中的下标。
+            isKept: 每个元素是否保留。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static void RetainStatus(
+            vector<Status>& status,
+            vector<size_t>& origins,
+            const vector<bool>& isKept
+        );
+        /**********************************************************************
+        【函数名称】 EnableTombstones
+        【函数功能】 
+            使模型中的线段与面以墓碑方式删除。
+            模型整体替换后须重新调用。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void EnableTombstones();
+        /**********************************************************************
+        【函数名称】 CompactModel
+        【函数功能】
+            压缩线段与面中已删除的槽位，同时压缩对应的状态。
+            整体变换与焊接会重排元素，之前须强制压缩。
+        【参数】
+            isForced: 为 false 时只压缩已删除的槽位足够多的集合。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void CompactModel(bool isForced);
+        /**********************************************************************
+        【函数名称】 ModifyLine
+        【函数功能】 修改一个线段，成功时将改变记录到日志项中。
+        【参数】
+            index: 线段的下标。
+            pointIndex: 要修改的点在线段中的下标。
+            x, y, z: 修改后点的三维坐标。
+            entry: 记录改变的日志项。
+        【返回值】
+            函数发生的错误类型。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Result ModifyLine(
+            size_t index,
+            size_t pointIndex,
+            double x, double y, double z,
+            JournalEntry& entry
+        );
+        /**********************************************************************
+        【函数名称】 ModifyFace
+        【函数功能】 修改一个面，成功时将改变记录到日志项中。
+        【参数】
+            index: 面的下标。
+            pointIndex: 要修改的点在面中的下标。
+            x, y, z: 修改后点的三维坐标。
+            entry: 记录改变的日志项。
+        【返回值】
+            函数发生的错误类型。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Result ModifyFace(
+            size_t index,
+            size_t pointIndex,
+            double x, double y, double z,
+            JournalEntry& entry
+        );
+        /**********************************************************************
+        【函数名称】 AppendLine
+        【函数功能】 在末尾添加一个线段，维护统计信息、k-d 树与状态。
+        【参数】
+            line: 要添加的线段。
+        【返回值】
+            是否添加，已有相同的线段时为 false。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        bool AppendLine(const Line<3>& line);
+        /**********************************************************************
+        【函数名称】 AppendFace
+        【函数功能】 在末尾添加一个面，维护统计信息、包围盒、k-d 树与状态。
+        【参数】
+            face: 要添加的面。
+        【返回值】
+            是否添加，已有相同的面时为 false。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        bool AppendFace(const Face<3>& face);
+        /**********************************************************************
+        【函数名称】 ReplaceLine
+        【函数功能】
+            将指定下标处的线段替换为另一线段，
+            设置状态与在基准文件中的下标，k-d 树只更新变化的点。
+        【参数】
+            index: 线段的下标，不检查越界。
+            line: 新的线段。
+            status: 新的状态。
+            origin: 新的线段在基准文件中的下标。
+        【返回值】
+            是否替换，已有相同的线段时为 false。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        bool ReplaceLine(
+            size_t index,
+            const Line<3>& line,
+            Status status,
+            size_t origin
+        );
+        /**********************************************************************
+        【函数名称】 ReplaceFace
+        【函数功能】
+            将指定下标处的面替换为另一面，
+            设置状态与在基准文件中的下标，k-d 树只更新变化的点。
+        【参数】
+            index: 面的下标，不检查越界。
+            face: 新的面。
+            status: 新的状态。
+            origin: 新的面在基准文件中的下标。
+        【返回值】
+            是否替换，已有相同的面时为 false。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        bool ReplaceFace(
+            size_t index,
+            const Face<3>& face,
+            Status status,
+            size_t origin
+        );
+        /**********************************************************************
+        【函数名称】 EraseLine
+        【函数功能】 以墓碑方式删除一个线段，不压缩。
+        【参数】
+            index: 线段的下标，不检查越界。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void EraseLine(size_t index);
+        /**********************************************************************
+        【函数名称】 EraseFace
+        【函数功能】 以墓碑方式删除一个面，不压缩。
+        【参数】
+            index: 面的下标，不检查越界。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void EraseFace(size_t index);
+        /**********************************************************************
+        【函数名称】 RestoreLine
+        【函数功能】
+            将删除的线段放回删除前的下标，
+            并恢复状态与在基准文件中的下标。
+            槽位尚未压缩时直接恢复，为 O(log n)，否则先压缩再插入。
+        【参数】
+            change: 删除线段时记录的改变。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void RestoreLine(const ElementChange<Line<3>>& change);
+        /**********************************************************************
+        【函数名称】 RestoreFace
+        【函数功能】
+            将删除的面放回删除前的下标，
+            并恢复状态与在基准文件中的下标。
+            槽位尚未压缩时直接恢复，为 O(log n)，否则先压缩再插入。
+        【参数】
+            change: 删除面时记录的改变。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void RestoreFace(const ElementChange<Face<3>>& change);
+        /**********************************************************************
+        【函数名称】 ApplyTransform
+        【函数功能】 对整个模型施加变换，之后重建统计信息与空间索引。
+        【参数】
+            transform: 作用于模型的变换，返回变换是否为单射。
+            isInjective: 返回变换是否为单射。
+        【返回值】
+            函数发生的错误类型。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Result ApplyTransform(
+            const function<bool(Model<3>&)>& transform,
+            bool& isInjective
+        );
+        /**********************************************************************
+        【函数名称】 RevertEntry
+        【函数功能】 按相反的顺序撤销日志项中的操作。
+        【参数】
+            entry: 要撤销的日志项。
+        【返回值】
+            函数发生的错误类型。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Result RevertEntry(const JournalEntry& entry);
+        /**********************************************************************
+        【函数名称】 ReapplyEntry
+        【函数功能】 重做日志项中的操作，并更新其中删除时的槽位。
+        【参数】
+            entry: 要重做的日志项。
+        【返回值】
+            函数发生的错误类型。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Result ReapplyEntry(JournalEntry& entry);
+        /**********************************************************************
+        【函数名称】 CommitJournalEntry
+        【函数功能】
+            将一次成功的操作记入日志并清空可重做的操作，
+            超出 MAX_JOURNAL_CHANGE_COUNT 时丢弃最早的操作。
+            没有改变的日志项被忽略。
+        【参数】
+            entry: 要记录的日志项。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void CommitJournalEntry(JournalEntry&& entry);
+        /**********************************************************************
+        【函数名称】 ClearJournal
+        【函数功能】 清空日志，之前的操作不能再撤销或重做。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void ClearJournal();
+        /**********************************************************************
+        【函数名称】 GetChangeCount
+        【函数功能】 获取日志项的大小，整体变换计为 1。
+        【参数】
+            entry: 日志项。
+        【返回值】
+            日志项中元素改变的个数。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static size_t GetChangeCount(const JournalEntry& entry);
+
         string m_Path;
         Model<3> m_Model;
+        // 线段的状态，按槽位存放，与线段同时压缩
         vector<Status> m_LineStatus;
+        // 面的状态，按槽位存放，与面同时压缩
         vector<Status> m_FaceStatus;
+        // 线段在基准文件中的下标，与其中的元素不同时为 NO_ORIGIN，
+        // 与状态一样按槽位存放
+        vector<size_t> m_LineOrigins;
+        // 面在基准文件中的下标，与线段的相同
+        vector<size_t> m_FaceOrigins;
+        // 增量保存时差异的基准
+        BaseFile m_Base { 0, 0, 0, 0 };
+        ModelStatistics<3> m_Statistics;
+        // 面的层次包围盒，为空表示需要重新构建
+        unique_ptr<Spatial::Bvh<3>> m_pFaceBvh;
+        // 模型中所有点的 k-d 树，为空表示需要重新构建
+        unique_ptr<Spatial::KdTree<3>> m_pPointTree;
+        // 模型中每个点在 k-d 树中的下标与引用次数，仅在 k-d 树存在时维护
+        unordered_map<Point<3>, PointReference> m_PointReferences;
+        // 可撤销的操作，最近的在末尾
+        deque<JournalEntry> m_UndoJournal;
+        // 可重做的操作，最近撤销的在末尾
+        vector<JournalEntry> m_RedoJournal;
+        // 两个日志中元素改变的总数
+        size_t m_JournalChangeCount { 0 };
+        // 最近一次读取模型文件出错的行号，统计与转换不改变模型但也会记录
+        mutable size_t m_ErrorLine { 0 };
 };
 
 }
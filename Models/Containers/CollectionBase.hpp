@@ -8,6 +8,7 @@
 
 #include <cstddef>
 #include <string>
+#include <utility>
 #include "../Tools/Representable.hpp"
 using namespace std;
 
@@ -119,6 +120,40 @@ class CollectionBase: public Tools::Representable {
         **********************************************************************/
         void Add(const T& element);
         /**********************************************************************
+        【函数名称】 TryAdd
+        【函数功能】 尝试添加一个元素，成功时取走其内容。
+        【参数】 
+            element: 新的元素，失败时保持不变。
+        【返回值】 
+            操作是否成功。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        bool TryAdd(T&& element);
+        /**********************************************************************
+        【函数名称】 Add
+        【函数功能】 
+            添加一个元素，取走其内容。
+            如果操作失败抛出 CollectionException。
+        【参数】 
+            element: 新的元素。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void Add(T&& element);
+        /**********************************************************************
+        【函数名称】 TryEmplace
+        【函数功能】 
+            以给定参数构造一个元素并尝试添加，
+            构造出的元素直接移入容器，不再复制。
+        【参数】 
+            args: 元素构造函数的参数。
+        【返回值】 
+            操作是否成功。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        template <typename... Args>
+        bool TryEmplace(Args&&... args);
+        /**********************************************************************
         【函数名称】 TryRemove
         【函数功能】 删除指定位置元素。如果越界抛出 IndexOverflowException。
         【参数】 
@@ -244,6 +279,19 @@ class CollectionBase: public Tools::Representable {
         **********************************************************************/
         virtual const T& InnerGet(size_t index) const = 0;
         /**********************************************************************
+        【函数名称】 InnerFind
+        【函数功能】 
+            查找给定值在容器中的下标。
+            默认逐个比较，子类可借助索引结构覆盖。
+        【参数】 
+            element: 要查找的值。
+            index: 找到时被赋值为元素的下标。
+        【返回值】 
+            是否找到。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        virtual bool InnerFind(const T& element, size_t& index) const;
+        /**********************************************************************
         【函数名称】 ShouldSet
         【函数功能】 判断是否应该设置元素值。
         【参数】 
@@ -284,6 +332,17 @@ class CollectionBase: public Tools::Representable {
         **********************************************************************/
         virtual void InnerAdd(const T& value) = 0;
         /**********************************************************************
+        【函数名称】 InnerAdd
+        【函数功能】 
+            无条件添加元素，可以取走其内容。
+            默认按常引用添加，子类可覆盖以避免复制。
+        【参数】 
+            value: 要添加的值。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        virtual void InnerAdd(T&& value);
+        /**********************************************************************
         【函数名称】 ShouldRemove
         【函数功能】 判断是否应该删除元素。
         【参数】 
@@ -7,6 +7,7 @@
 #include <cstddef>
 #include <sstream>
 #include <string>
+#include <utility>
 #include "CollectionBase.hpp"
 #include "../Core/Errors.hpp"
 using namespace std;
@@ -153,6 +154,60 @@ void CollectionBase<T>::Add(const T& element) {
     }
 }
 
+/**********************************************************************
+【函数名称】 TryAdd
+【函数功能】 尝试添加一个元素，成功时取走其内容。
+【参数】 
+    element: 新的元素，失败时保持不变。
+【返回值】 
+    操作是否成功。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+bool CollectionBase<T>::TryAdd(T&& element) {
+    if (ShouldAdd(element)) {
+        InnerAdd(move(element));
+        return true;
+    }
+    else {
+        return false;
+    }
+}
+
+/**********************************************************************
+【函数名称】 Add
+【函数功能】 
+    添加一个元素，取走其内容。
+    如果操作失败抛出 CollectionException。
+【参数】 
+    element: 新的元素。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+void CollectionBase<T>::Add(T&& element) {
+    if (!TryAdd(move(element))) {
+        throw CollectionException();
+    }
+}
+
+/**********************************************************************
+【函数名称】 TryEmplace
+【函数功能】 
+    以给定参数构造一个元素并尝试添加，
+    构造出的元素直接移入容器，不再复制。
+【参数】 
+    args: 元素构造函数的参数。
+【返回值】 
+    操作是否成功。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+template <typename... Args>
+bool CollectionBase<T>::TryEmplace(Args&&... args) {
+    return TryAdd(T(forward<Args>(args)...));
+}
+
 /**********************************************************************
 【函数名称】 TryRemove
 【函数功能】 删除指定位置元素。如果越界抛出 IndexOverflowException。
@@ -249,13 +304,8 @@ void CollectionBase<T>::Insert(size_t index, const T& element) {
 **********************************************************************/
 template <typename T>
 bool CollectionBase<T>::Contains(const T& element) const {
-    auto count = Count();
-    for (size_t i = 0; i < count; i++) {
-        if (InnerGet(i) == element) {
-            return true;
-        }
-    }
-    return false;
+    size_t index;
+    return InnerFind(element, index);
 }
 
 /**********************************************************************
@@ -269,13 +319,11 @@ bool CollectionBase<T>::Contains(const T& element) const {
 **********************************************************************/
 template <typename T>
 size_t CollectionBase<T>::FindIndex(const T& element) const {
-    auto count = Count();
-    for (size_t i = 0; i < count; i++) {
-        if (InnerGet(i) == element) {
-            return i;
-        }
+    size_t index;
+    if (!InnerFind(element, index)) {
+        throw CollectionException();
     }
-    throw CollectionException();
+    return index;
 }
 
 /**********************************************************************
@@ -343,6 +391,30 @@ string CollectionBase<T>::ToString() const {
     return stream.str();
 }
 
+/**********************************************************************
+【函数名称】 InnerFind
+【函数功能】 
+    查找给定值在容器中的下标。
+    默认逐个比较，子类可借助索引结构覆盖。
+【参数】 
+    element: 要查找的值。
+    index: 找到时被赋值为元素的下标。
+【返回值】 
+    是否找到。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+bool CollectionBase<T>::InnerFind(const T& element, size_t& index) const {
+    auto count = Count();
+    for (size_t i = 0; i < count; i++) {
+        if (InnerGet(i) == element) {
+            index = i;
+            return true;
+        }
+    }
+    return false;
+}
+
 /**********************************************************************
 【函数名称】 ShouldSet
 【函数功能】 判断是否应该设置元素值。
@@ -372,6 +444,21 @@ bool CollectionBase<T>::ShouldAdd(const T& value) const {
     return true;
 }
 
+/**********************************************************************
+【函数名称】 InnerAdd
+【函数功能】 
+    无条件添加元素，可以取走其内容。
+    默认按常引用添加，子类可覆盖以避免复制。
+【参数】 
+    value: 要添加的值。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+void CollectionBase<T>::InnerAdd(T&& value) {
+    InnerAdd(static_cast<const T&>(value));
+}
+
 /**********************************************************************
 【函数名称】 ShouldRemove
 【函数功能】 判断是否应该删除元素。
@@ -7,7 +7,9 @@
 #pragma once
 
 #include <cstddef>
+#include <type_traits>
 #include "CollectionBase.hpp"
+#include "HashIndex.hpp"
 using namespace std;
 
 namespace C3w {
@@ -23,9 +25,18 @@ namespace Containers {
 template <typename T>
 class DistinctCollection: public CollectionBase<T> {
     public:
+        // 成员
+
+        // 元素不超过此数目时 IsDistinct 逐对比较，否则借助哈希表
+        static constexpr size_t PAIRWISE_LIMIT { 32 };
+
         /**********************************************************************
         【函数名称】 IsDistinct
-        【函数功能】 判断迭代器中是否无重复元素。
+        【函数功能】
+            判断随机访问迭代器区间中是否无重复元素。
+            元素不超过 PAIRWISE_LIMIT 个时逐对比较；
+            否则若 std::hash<T> 可用，用开放寻址哈希表在 O(n) 内判断，
+            不可用时仍逐对比较。
         【参数】 
             begin: 头部迭代器。
             end: 尾部迭代器。
@@ -118,6 +129,44 @@ class DistinctCollection: public CollectionBase<T> {
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
         bool ShouldInsert(size_t index, const T& value) const override;
+
+    private:
+        /**********************************************************************
+        【函数名称】 IsDistinctPairwise
+        【函数功能】 逐对比较，判断迭代器区间中是否无重复元素，O(n²)。
+        【参数】 
+            begin: 头部迭代器。
+            end: 尾部迭代器。
+        【返回值】 
+            是否没有重复元素。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        template <typename It>
+        static bool IsDistinctPairwise(It begin, It end);
+        /**********************************************************************
+        【函数名称】 IsDistinctHashed
+        【函数功能】 借助 HashIndex 判断迭代器区间中是否无重复元素，期望 O(n)。
+        【参数】 
+            begin: 头部迭代器。
+            end: 尾部迭代器。
+        【返回值】 
+            是否没有重复元素。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        template <typename It>
+        static bool IsDistinctHashed(It begin, It end, true_type);
+        /**********************************************************************
+        【函数名称】 IsDistinctHashed
+        【函数功能】 元素不可求哈希值时退回逐对比较。
+        【参数】 
+            begin: 头部迭代器。
+            end: 尾部迭代器。
+        【返回值】 
+            是否没有重复元素。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        template <typename It>
+        static bool IsDistinctHashed(It begin, It end, false_type);
 };
 
 }
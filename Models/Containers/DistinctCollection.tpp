@@ -5,8 +5,10 @@
 *************************************************************************/
 
 #include <cstddef>
+#include <type_traits>
 #include "CollectionBase.hpp"
 #include "DistinctCollection.hpp"
+#include "HashIndex.hpp"
 using namespace std;
 
 namespace C3w {
@@ -15,7 +17,11 @@ namespace Containers {
 
 /**********************************************************************
 【函数名称】 IsDistinct
-【函数功能】 判断迭代器中是否无重复元素。
+【函数功能】
+    判断随机访问迭代器区间中是否无重复元素。
+    元素不超过 PAIRWISE_LIMIT 个时逐对比较；
+    否则若 std::hash<T> 可用，用开放寻址哈希表在 O(n) 内判断，
+    不可用时仍逐对比较。
 【参数】 
     begin: 头部迭代器。
     end: 尾部迭代器。
@@ -26,7 +32,26 @@ namespace Containers {
 template <typename T>
 template <typename It>
 bool DistinctCollection<T>::IsDistinct(It begin, It end) {
-    for (auto i = begin; i < end - 1; i++) {
+    if (end - begin <= static_cast<ptrdiff_t>(PAIRWISE_LIMIT)) {
+        return IsDistinctPairwise(begin, end);
+    }
+    return IsDistinctHashed(begin, end, IsHashable<T>());
+}
+
+/**********************************************************************
+【函数名称】 IsDistinctPairwise
+【函数功能】 逐对比较，判断迭代器区间中是否无重复元素，O(n²)。
+【参数】 
+    begin: 头部迭代器。
+    end: 尾部迭代器。
+【返回值】 
+    是否没有重复元素。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+template <typename It>
+bool DistinctCollection<T>::IsDistinctPairwise(It begin, It end) {
+    for (auto i = begin; i < end; i++) {
         for (auto j = i + 1; j < end; j++) {
             if (*i == *j) {
                 return false;
@@ -36,6 +61,45 @@ bool DistinctCollection<T>::IsDistinct(It begin, It end) {
     return true;
 }
 
+/**********************************************************************
+【函数名称】 IsDistinctHashed
+【函数功能】 借助 HashIndex 判断迭代器区间中是否无重复元素，期望 O(n)。
+【参数】 
+    begin: 头部迭代器。
+    end: 尾部迭代器。
+【返回值】 
+    是否没有重复元素。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+template <typename It>
+bool DistinctCollection<T>::IsDistinctHashed(It begin, It end, true_type) {
+    size_t count = end - begin;
+    HashIndex<T> index(count);
+    for (size_t i = 0; i < count; i++) {
+        if (!index.TryInsert(begin, i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**********************************************************************
+【函数名称】 IsDistinctHashed
+【函数功能】 元素不可求哈希值时退回逐对比较。
+【参数】 
+    begin: 头部迭代器。
+    end: 尾部迭代器。
+【返回值】 
+    是否没有重复元素。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+template <typename It>
+bool DistinctCollection<T>::IsDistinctHashed(It begin, It end, false_type) {
+    return IsDistinctPairwise(begin, end);
+}
+
 /**********************************************************************
 【函数名称】 IsEqualUnordered
 【函数功能】 判断自身与另一容器中元素是否一一对应。
@@ -123,16 +187,9 @@ bool DistinctCollection<T>::operator!=(
 **********************************************************************/
 template <typename T>
 bool DistinctCollection<T>::ShouldSet(size_t index, const T& value) const {
-    auto count = this->Count();
-    for (size_t i = 0; i < count; i++) {
-        if (index == i) {
-            continue;
-        }
-        if (this->InnerGet(i) == value) {
-            return false;
-        }
-    }
-    return true;
+    // 元素不重复，因此至多找到一个相等的元素
+    size_t found;
+    return !this->InnerFind(value, found) || found == index;
 }
 
 /**********************************************************************
@@ -7,8 +7,11 @@
 #pragma once
 
 #include <cstddef>
+#include <iterator>
+#include <type_traits>
 #include <vector>
 #include "DistinctCollection.hpp"
+#include "StaticCollection.hpp"
 using namespace std;
 
 namespace C3w {
@@ -17,12 +20,22 @@ namespace Containers {
 
 /*************************************************************************
 【类名】 DynamicSet
-【功能】 定义一个元素类型为 T 的动态大小的集合。
+【功能】
+    定义一个元素类型为 T 的动态大小的集合。
+    std::hash<T> 可用时，集合运算借助 HashIndex 在 O(n + m) 内完成，
+    否则逐个比较，为 O(n·m)。
+    可选以墓碑方式删除：删除只标记槽位，下标经树状数组换算为槽位，
+    已删除的槽位由持有者在合适的时机一次压缩。
+    Count 与 InnerGet 为 final，经由 StaticCollection 调用时不经过虚函数表。
 【接口说明】 获取/设置/添加/删除元素，判断是否包含元素，集合的交并补。
 【开发者及日期】 赵一彤 2024/7/24
 *************************************************************************/
 template <typename T>
-class DynamicSet: public DistinctCollection<T> {
+class DynamicSet:
+    public StaticCollection<DynamicSet<T>, T, DistinctCollection<T>> {
+    // 静态分派的公开接口需要访问 Inner 系列函数
+    friend class StaticCollection<DynamicSet<T>, T, DistinctCollection<T>>;
+
     public:
         // 构造函数
 
@@ -53,6 +66,17 @@ class DynamicSet: public DistinctCollection<T> {
         **********************************************************************/
         DynamicSet(const vector<T>& elements);
         /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 
+            取走 std::vector<T> 的存储初始化 DynamicSet 类型实例。
+            如果有重复元素抛出 CollectionException。
+        【参数】
+            elements: 元素组成的向量，成功后为空。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        DynamicSet(vector<T>&& elements);
+        /**********************************************************************
         【函数名称】 拷贝构造函数
         【函数功能】 使用另一 DynamicSet 初始化 DynamicSet 类的实例。
         【参数】
@@ -61,6 +85,15 @@ class DynamicSet: public DistinctCollection<T> {
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
         DynamicSet(const DynamicSet<T>& other) = default;
+        /**********************************************************************
+        【函数名称】 移动构造函数
+        【函数功能】 取走另一 DynamicSet 的存储初始化 DynamicSet 类的实例。
+        【参数】
+            other: 另一 DynamicSet 实例，之后为空。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        DynamicSet(DynamicSet<T>&& other) = default;
 
         // 属性
         /**********************************************************************
@@ -71,7 +104,7 @@ class DynamicSet: public DistinctCollection<T> {
             集合中的元素个数。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        size_t Count() const override;
+        size_t Count() const override final;
 
         // 操作
 
@@ -100,6 +133,20 @@ class DynamicSet: public DistinctCollection<T> {
             const DynamicSet<T>& right
         );
         /**********************************************************************
+        【函数名称】 Intersection
+        【函数功能】 返回两集合的交集，取走第一个集合的存储。
+        【参数】 
+            left: 第一个集合，之后为空。
+            right: 第二个集合。
+        【返回值】 
+            两集合的交集。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static DynamicSet<T> Intersection(
+            DynamicSet<T>&& left,
+            const DynamicSet<T>& right
+        );
+        /**********************************************************************
         【函数名称】 Union
         【函数功能】 返回此集合与另一集合的并集。
         【参数】 
@@ -124,6 +171,20 @@ class DynamicSet: public DistinctCollection<T> {
             const DynamicSet<T>& right
         );
         /**********************************************************************
+        【函数名称】 Union
+        【函数功能】 返回两集合的并集，取走第一个集合的存储。
+        【参数】 
+            left: 第一个集合，之后为空。
+            right: 第二个集合。
+        【返回值】 
+            两集合的并集。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static DynamicSet<T> Union(
+            DynamicSet<T>&& left,
+            const DynamicSet<T>& right
+        );
+        /**********************************************************************
         【函数名称】 Difference
         【函数功能】 返回此集合与另一集合的差集。
         【参数】 
@@ -148,6 +209,20 @@ class DynamicSet: public DistinctCollection<T> {
             const DynamicSet<T>& right
         );
         /**********************************************************************
+        【函数名称】 Difference
+        【函数功能】 返回两集合的差集，取走第一个集合的存储。
+        【参数】 
+            left: 第一个集合，之后为空。
+            right: 第二个集合。
+        【返回值】 
+            两集合的差集。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static DynamicSet<T> Difference(
+            DynamicSet<T>&& left,
+            const DynamicSet<T>& right
+        );
+        /**********************************************************************
         【函数名称】 SymmetricDifference
         【函数功能】 返回此集合与另一集合的对称差集。
         【参数】 
@@ -171,6 +246,139 @@ class DynamicSet: public DistinctCollection<T> {
             const DynamicSet<T>& left,
             const DynamicSet<T>& right
         );
+        /**********************************************************************
+        【函数名称】 SymmetricDifference
+        【函数功能】 返回两集合的对称差集，取走第一个集合的存储。
+        【参数】 
+            left: 第一个集合，之后为空。
+            right: 第二个集合。
+        【返回值】 
+            两集合的对称差集。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static DynamicSet<T> SymmetricDifference(
+            DynamicSet<T>&& left,
+            const DynamicSet<T>& right
+        );
+        /**********************************************************************
+        【函数名称】 TransformInplace
+        【函数功能】
+            对每个元素原地调用 transform，全部完成后重建内部状态，
+            并检查元素是否仍互不相同。不经过 ShouldSet 的逐个检查，
+            适合一次性修改全部元素。如果 transform 抛出异常，
+            已修改的元素保持修改后的值，内部状态仍会被重建。
+        【参数】
+            transform: 接受元素可变引用的可调用对象。
+        【返回值】
+            元素是否仍互不相同。若为 false，集合中存在重复元素，
+            调用者须负责将其恢复。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        template <typename F>
+        bool TransformInplace(F transform);
+        /**********************************************************************
+        【函数名称】 Reserve
+        【函数功能】 
+            为即将逐个添加的元素预留空间，避免添加过程中反复扩容。
+            不改变集合中的元素。
+        【参数】
+            count: 添加后预计的元素总数。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void Reserve(size_t count);
+        /**********************************************************************
+        【函数名称】 Retain
+        【函数功能】
+            一次删除所有未标记保留的元素，保留的元素维持原有顺序，
+            每个元素至多移动一次，适合批量删除。
+            isKept 的长度与元素个数不同时抛出 InvalidSizeException。
+        【参数】
+            isKept: 每个元素是否保留。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void Retain(const vector<bool>& isKept);
+        /**********************************************************************
+        【函数名称】 SetTombstoned
+        【函数功能】
+            设置是否以墓碑方式删除元素。开启后 Remove 与 Retain
+            只将元素所在的槽位标记为已删除而不移动其他元素，
+            为 O(log n)；下标仍按存活元素的顺序计算，
+            其余元素的槽位在压缩前保持不变。关闭时立即压缩。
+        【参数】
+            isTombstoned: 是否以墓碑方式删除。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void SetTombstoned(bool isTombstoned);
+        /**********************************************************************
+        【函数名称】 IsTombstoned
+        【函数功能】 获取是否以墓碑方式删除元素。
+        【参数】 无
+        【返回值】
+            是否以墓碑方式删除元素。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        bool IsTombstoned() const;
+        /**********************************************************************
+        【函数名称】 GetSlotCount
+        【函数功能】 获取槽位数，包括已删除但尚未压缩的槽位。
+        【参数】 无
+        【返回值】
+            槽位数。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        size_t GetSlotCount() const;
+        /**********************************************************************
+        【函数名称】 GetSlot
+        【函数功能】
+            获取指定下标处元素所在的槽位，供持有者维护与槽位对应的数据。
+            如果越界抛出 IndexOverflowException。
+        【参数】
+            index: 元素的下标。
+        【返回值】
+            元素所在的槽位，压缩前不变。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        size_t GetSlot(size_t index) const;
+        /**********************************************************************
+        【函数名称】 IsCompactionDue
+        【函数功能】
+            判断已删除的槽位是否达到全部槽位的 1/COMPACTION_DIVISOR，
+            此时压缩的代价可以均摊到每次删除上。
+        【参数】 无
+        【返回值】
+            是否应当压缩。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        bool IsCompactionDue() const;
+        /**********************************************************************
+        【函数名称】 Compact
+        【函数功能】
+            移除全部已删除的槽位，存活元素维持原有顺序，之后槽位与下标相同。
+            Insert、TransformInplace 与集合运算修改自身前会自动压缩。
+        【参数】 无
+        【返回值】
+            压缩前的每个槽位是否保留，持有者据此压缩与槽位对应的数据。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        vector<bool> Compact();
+        /**********************************************************************
+        【函数名称】 TryRevive
+        【函数功能】
+            恢复以墓碑方式删除、尚未压缩的元素，使其回到删除前的下标，
+            为 O(log n)。槽位未删除、其中的元素不等于 value、
+            恢复后的下标不等于 index 或集合中已有相等的元素时不做任何事。
+        【参数】
+            slot: 删除时元素所在的槽位。
+            index: 删除前元素的下标。
+            value: 被删除的元素。
+        【返回值】
+            是否恢复了元素。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        bool TryRevive(size_t slot, size_t index, const T& value);
 
         // 操作符
 
@@ -185,6 +393,16 @@ class DynamicSet: public DistinctCollection<T> {
         **********************************************************************/
         DynamicSet<T>& operator=(const DynamicSet<T>& other) = default;
         /**********************************************************************
+        【函数名称】 operator=
+        【函数功能】 取走其他集合的存储。
+        【参数】 
+            other: 从之取值的集合，之后为空。
+        【返回值】 
+            自身的引用。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        DynamicSet<T>& operator=(DynamicSet<T>&& other) = default;
+        /**********************************************************************
         【函数名称】 operator&
         【函数功能】 返回此集合与另一集合的交集。
         【参数】 
@@ -193,10 +411,20 @@ class DynamicSet: public DistinctCollection<T> {
             两集合的交集。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        DynamicSet<T> operator&(const DynamicSet<T>& other) const;
+        DynamicSet<T> operator&(const DynamicSet<T>& other) const&;
+        /**********************************************************************
+        【函数名称】 operator&
+        【函数功能】 返回此集合与另一集合的交集，取走自身的存储。
+        【参数】 
+            other: 另一集合。
+        【返回值】 
+            两集合的交集。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        DynamicSet<T> operator&(const DynamicSet<T>& other) &&;
         /**********************************************************************
         【函数名称】 operator&=
-        【函数功能】 将自身赋值为此集合与另一集合的交集。
+        【函数功能】 原地删除不属于另一集合的元素。
         【参数】 
             other: 另一集合。
         【返回值】 
@@ -213,10 +441,20 @@ class DynamicSet: public DistinctCollection<T> {
             两集合的并集。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        DynamicSet<T> operator|(const DynamicSet<T>& other) const;
+        DynamicSet<T> operator|(const DynamicSet<T>& other) const&;
+        /**********************************************************************
+        【函数名称】 operator|
+        【函数功能】 返回此集合与另一集合的并集，取走自身的存储。
+        【参数】 
+            other: 另一集合。
+        【返回值】 
+            两集合的并集。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        DynamicSet<T> operator|(const DynamicSet<T>& other) &&;
         /**********************************************************************
         【函数名称】 operator|=
-        【函数功能】 将自身赋值为此集合与另一集合的并集。
+        【函数功能】 原地添加另一集合中自身没有的元素。
         【参数】 
             other: 另一集合。
         【返回值】 
@@ -233,10 +471,20 @@ class DynamicSet: public DistinctCollection<T> {
             两集合的差集。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        DynamicSet<T> operator-(const DynamicSet<T>& other) const;
+        DynamicSet<T> operator-(const DynamicSet<T>& other) const&;
+        /**********************************************************************
+        【函数名称】 operator-
+        【函数功能】 返回此集合与另一集合的差集，取走自身的存储。
+        【参数】 
+            other: 另一集合。
+        【返回值】 
+            两集合的差集。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        DynamicSet<T> operator-(const DynamicSet<T>& other) &&;
         /**********************************************************************
         【函数名称】 operator-=
-        【函数功能】 将自身赋值为此集合与另一集合的差集。
+        【函数功能】 原地删除属于另一集合的元素。
         【参数】 
             other: 另一集合。
         【返回值】 
@@ -253,20 +501,134 @@ class DynamicSet: public DistinctCollection<T> {
             两集合的对称差集。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        DynamicSet<T> operator^(const DynamicSet<T>& other) const;
+        DynamicSet<T> operator^(const DynamicSet<T>& other) const&;
+        /**********************************************************************
+        【函数名称】 operator^
+        【函数功能】 返回此集合与另一集合的对称差集，取走自身的存储。
+        【参数】 
+            other: 另一集合。
+        【返回值】 
+            两集合的对称差集。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        DynamicSet<T> operator^(const DynamicSet<T>& other) &&;
         /**********************************************************************
         【函数名称】 operator^=
-        【函数功能】 将自身赋值为此集合与另一集合的对称差集。
+        【函数功能】
+            原地删除属于另一集合的元素，再添加另一集合中自身原来没有的元素。
         【参数】 
             other: 另一集合。
         【返回值】 
             自身的引用。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        DynamicSet<T> operator^=(const DynamicSet<T>& other);
+        DynamicSet<T>& operator^=(const DynamicSet<T>& other);
 
         // 迭代器
 
+        // 跳过已删除槽位的只读前向迭代器
+        class ConstIterator {
+            public:
+                typedef forward_iterator_tag iterator_category;
+                typedef T value_type;
+                typedef ptrdiff_t difference_type;
+                typedef const T* pointer;
+                typedef const T& reference;
+
+                /**************************************************************
+                【函数名称】 构造函数
+                【函数功能】
+                    使用集合与槽位初始化 ConstIterator 类型实例，
+                    并移动到不早于该槽位的首个存活槽位。
+                【参数】
+                    pSet: 所属集合的指针。
+                    slot: 起始槽位。
+                【返回值】 无
+                【开发者及日期】 赵一彤 2026/10/17
+                **************************************************************/
+                ConstIterator(const DynamicSet<T>* pSet, size_t slot);
+                /**************************************************************
+                【函数名称】 operator*
+                【函数功能】 获取当前元素。
+                【参数】 无
+                【返回值】
+                    当前元素的常引用。
+                【开发者及日期】 赵一彤 2026/10/17
+                **************************************************************/
+                const T& operator*() const;
+                /**************************************************************
+                【函数名称】 operator->
+                【函数功能】 获取当前元素的指针。
+                【参数】 无
+                【返回值】
+                    当前元素的常量指针。
+                【开发者及日期】 赵一彤 2026/10/17
+                **************************************************************/
+                const T* operator->() const;
+                /**************************************************************
+                【函数名称】 operator++
+                【函数功能】 前置自增，移动到下一个存活槽位。
+                【参数】 无
+                【返回值】
+                    自身的引用。
+                【开发者及日期】 赵一彤 2026/10/17
+                **************************************************************/
+                ConstIterator& operator++();
+                /**************************************************************
+                【函数名称】 operator++
+                【函数功能】 后置自增，移动到下一个存活槽位。
+                【参数】 无
+                【返回值】
+                    自增前的迭代器。
+                【开发者及日期】 赵一彤 2026/10/17
+                **************************************************************/
+                ConstIterator operator++(int);
+                /**************************************************************
+                【函数名称】 operator==
+                【函数功能】 判断两个迭代器是否指向同一槽位。
+                【参数】
+                    other: 另一迭代器。
+                【返回值】
+                    是否指向同一槽位。
+                【开发者及日期】 赵一彤 2026/10/17
+                **************************************************************/
+                bool operator==(const ConstIterator& other) const;
+                /**************************************************************
+                【函数名称】 operator!=
+                【函数功能】 判断两个迭代器是否指向不同槽位。
+                【参数】
+                    other: 另一迭代器。
+                【返回值】
+                    是否指向不同槽位。
+                【开发者及日期】 赵一彤 2026/10/17
+                **************************************************************/
+                bool operator!=(const ConstIterator& other) const;
+                /**************************************************************
+                【函数名称】 GetSlot
+                【函数功能】 获取当前元素所在的槽位。
+                【参数】 无
+                【返回值】
+                    当前元素所在的槽位。
+                【开发者及日期】 赵一彤 2026/10/17
+                **************************************************************/
+                size_t GetSlot() const;
+
+            private:
+                // 所属集合
+                const DynamicSet<T>* m_pSet;
+                // 当前槽位
+                size_t m_Slot;
+
+                /**************************************************************
+                【函数名称】 SkipDead
+                【函数功能】 跳过从当前槽位起连续的已删除槽位。
+                【参数】 无
+                【返回值】 无
+                【开发者及日期】 赵一彤 2026/10/17
+                **************************************************************/
+                void SkipDead();
+        };
+
         /**********************************************************************
         【函数名称】 begin
         【函数功能】 获取头部迭代器。
@@ -275,7 +637,7 @@ class DynamicSet: public DistinctCollection<T> {
             指向首个元素的迭代器。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        typename vector<T>::const_iterator begin() const;
+        ConstIterator begin() const;
         /**********************************************************************
         【函数名称】 end
         【函数功能】 获取尾部迭代器。
@@ -284,7 +646,7 @@ class DynamicSet: public DistinctCollection<T> {
             指向最后元素之后的迭代器。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        typename vector<T>::const_iterator end() const;
+        ConstIterator end() const;
 
     protected:
         /**********************************************************************
@@ -296,7 +658,18 @@ class DynamicSet: public DistinctCollection<T> {
             指定位置元素的常引用。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        const T& InnerGet(size_t index) const override;
+        const T& InnerGet(size_t index) const override final;
+        /**********************************************************************
+        【函数名称】 InnerFind
+        【函数功能】 直接遍历存储，查找给定值在集合中的下标。
+        【参数】
+            element: 要查找的值。
+            index: 找到时被赋值为元素的下标。
+        【返回值】
+            是否找到。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        bool InnerFind(const T& element, size_t& index) const override;
         /**********************************************************************
         【函数名称】 InnerSet
         【函数功能】 无条件设置元素值。
@@ -317,8 +690,17 @@ class DynamicSet: public DistinctCollection<T> {
         **********************************************************************/
         void InnerAdd(const T& value) override;
         /**********************************************************************
+        【函数名称】 InnerAdd
+        【函数功能】 无条件添加元素，取走其内容。
+        【参数】 
+            value: 要添加的值。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void InnerAdd(T&& value) override;
+        /**********************************************************************
         【函数名称】 InnerRemove
-        【函数功能】 无条件删除元素。
+        【函数功能】 无条件删除元素。以墓碑方式删除时只标记槽位。
         【参数】 
             index: 要删除的下标。
         【返回值】 无
@@ -327,7 +709,7 @@ class DynamicSet: public DistinctCollection<T> {
         void InnerRemove(size_t index) override;
         /**********************************************************************
         【函数名称】 InnerInsert
-        【函数功能】 无条件插入元素。
+        【函数功能】 无条件插入元素。有已删除的槽位时先压缩。
         【参数】 
             index: 要插入位置的下标。
             element: 新的元素。
@@ -335,9 +717,242 @@ class DynamicSet: public DistinctCollection<T> {
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
         void InnerInsert(size_t index, const T& element) override;
+        /**********************************************************************
+        【函数名称】 InnerReplace
+        【函数功能】 无条件将全部元素替换为另一集合的元素。
+        【参数】 
+            other: 提供新元素的集合。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        virtual void InnerReplace(const DynamicSet<T>& other);
+        /**********************************************************************
+        【函数名称】 InnerReplace
+        【函数功能】 无条件取走另一集合的存储作为全部元素。
+        【参数】 
+            other: 提供新元素的集合，之后为空。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        virtual void InnerReplace(DynamicSet<T>&& other);
+        /**********************************************************************
+        【函数名称】 InnerRebuild
+        【函数功能】
+            元素被原地修改后重建内部状态，并检查元素是否仍互不相同。
+            DynamicSet 没有额外状态，只调用 IsDistinct。
+        【参数】 无
+        【返回值】
+            元素是否仍互不相同。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        virtual bool InnerRebuild();
+        /**********************************************************************
+        【函数名称】 InnerRetain
+        【函数功能】 无条件删除未标记保留的元素，其余元素保持原有顺序。
+        【参数】 
+            isKept: 每个元素是否保留，长度与元素个数相同。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        virtual void InnerRetain(const vector<bool>& isKept);
+        /**********************************************************************
+        【函数名称】 InnerReserve
+        【函数功能】 为即将逐个添加的元素预留空间。
+        【参数】 
+            count: 添加后的元素总数。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        virtual void InnerReserve(size_t count);
+        /**********************************************************************
+        【函数名称】 InnerRevive
+        【函数功能】 无条件将已删除的槽位标记为存活并更新树状数组。
+        【参数】
+            slot: 已删除的槽位。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        virtual void InnerRevive(size_t slot);
+        /**********************************************************************
+        【函数名称】 FindSlot
+        【函数功能】 不检查越界，获取指定下标处元素所在的槽位。
+        【参数】
+            index: 元素的下标。
+        【返回值】
+            元素所在的槽位。没有已删除的槽位时与下标相同，
+            否则在树状数组上二分，为 O(log n)。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        size_t FindSlot(size_t index) const;
+        /**********************************************************************
+        【函数名称】 GetAtSlot
+        【函数功能】 无条件获取指定槽位中的元素。
+        【参数】
+            slot: 槽位。
+        【返回值】
+            槽位中元素的常引用。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        const T& GetAtSlot(size_t slot) const;
+        /**********************************************************************
+        【函数名称】 GetIndexOfSlot
+        【函数功能】 获取存活槽位中元素的下标，即此前存活槽位的个数。
+        【参数】
+            slot: 存活的槽位。
+        【返回值】
+            元素的下标。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        size_t GetIndexOfSlot(size_t slot) const;
 
     private:
+        // 已删除的槽位达到全部槽位的 1/COMPACTION_DIVISOR 时应当压缩
+        static const size_t COMPACTION_DIVISOR { 4 };
+
         vector<T> m_Elements;
+        // 是否以墓碑方式删除
+        bool m_IsTombstoned { false };
+        // 已删除的槽位数，为 0 时槽位与下标相同
+        size_t m_DeadCount { 0 };
+        // 每个槽位是否已删除，没有已删除的槽位时为空
+        vector<bool> m_IsDead;
+        // 存活槽位数的树状数组，从 1 开始，没有已删除的槽位时为空
+        vector<size_t> m_LiveCounts;
+
+        /**********************************************************************
+        【函数名称】 Bury
+        【函数功能】
+            将槽位标记为已删除并更新树状数组。
+            此前没有已删除的槽位时先在 O(n) 内建立树状数组。
+        【参数】
+            slot: 存活的槽位。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void Bury(size_t slot);
+        /**********************************************************************
+        【函数名称】 AppendSlot
+        【函数功能】 有已删除的槽位时，为刚添加的元素追加槽位标记与树状数组项。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void AppendSlot();
+        /**********************************************************************
+        【函数名称】 ClearDead
+        【函数功能】 清空已删除槽位的记录，不改变元素。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void ClearDead();
+        /**********************************************************************
+        【函数名称】 CountLive
+        【函数功能】 在树状数组上求前 count 个槽位中存活槽位的个数。
+        【参数】
+            count: 槽位个数。
+        【返回值】
+            存活槽位的个数。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        size_t CountLive(size_t count) const;
+        /**********************************************************************
+        【函数名称】 LowBit
+        【函数功能】 获取正整数二进制表示中最低的 1 所代表的值。
+        【参数】
+            value: 正整数。
+        【返回值】
+            最低的 1 所代表的值。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static size_t LowBit(size_t value);
+        /**********************************************************************
+        【函数名称】 GetLive
+        【函数功能】 获取集合中按顺序排列的存活元素。
+        【参数】
+            set: 集合。
+            buffer: 有已删除的槽位时用于存放存活元素的副本。
+        【返回值】
+            没有已删除的槽位时为集合的存储，否则为 buffer。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static const vector<T>& GetLive(
+            const DynamicSet<T>& set,
+            vector<T>& buffer
+        );
+
+        /**********************************************************************
+        【函数名称】 FindMembers
+        【函数功能】 标记 source 中的每个元素是否属于 other。
+        【参数】 
+            source: 要标记的元素，互不相同。
+            other: 另一组元素，互不相同。
+        【返回值】 
+            与 source 等长的标记。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static vector<bool> FindMembers(
+            const vector<T>& source,
+            const vector<T>& other
+        );
+        /**********************************************************************
+        【函数名称】 FindMembers
+        【函数功能】
+            为较少的一组元素建立 HashIndex，遍历另一组元素查找，O(n + m)。
+        【参数】 
+            source: 要标记的元素，互不相同。
+            other: 另一组元素，互不相同。
+        【返回值】 
+            与 source 等长的标记。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static vector<bool> FindMembers(
+            const vector<T>& source,
+            const vector<T>& other,
+            true_type
+        );
+        /**********************************************************************
+        【函数名称】 FindMembers
+        【函数功能】 元素不可求哈希值时逐个比较，O(n·m)。
+        【参数】 
+            source: 要标记的元素，互不相同。
+            other: 另一组元素，互不相同。
+        【返回值】 
+            与 source 等长的标记。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static vector<bool> FindMembers(
+            const vector<T>& source,
+            const vector<T>& other,
+            false_type
+        );
+        /**********************************************************************
+        【函数名称】 Select
+        【函数功能】 将标记与给定值相同的元素依次追加到结果中。
+        【参数】 
+            source: 要挑选的元素。
+            isMember: 与 source 等长的标记。
+            expected: 要挑选的元素的标记值。
+            result: 追加到的结果。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static void Select(
+            const vector<T>& source,
+            const vector<bool>& isMember,
+            bool expected,
+            vector<T>& result
+        );
+        /**********************************************************************
+        【函数名称】 Take
+        【函数功能】 取走集合的存储，并重建其内部状态使之成为空集合。
+        【参数】 
+            set: 要取走存储的集合。
+        【返回值】 
+            集合原来的元素。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static vector<T> Take(DynamicSet<T>& set);
 };
 
 }
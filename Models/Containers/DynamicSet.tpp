@@ -5,9 +5,14 @@
 *************************************************************************/
 
 #include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
 #include <vector>
 #include "DistinctCollection.hpp"
 #include "DynamicSet.hpp"
+#include "HashIndex.hpp"
+#include "StaticCollection.hpp"
 #include "../Core/Errors.hpp"
 using namespace std;
 using namespace C3w::Errors;
@@ -54,6 +59,27 @@ DynamicSet<T>::DynamicSet(const vector<T>& elements) {
     m_Elements = elements;
 }
 
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 
+    取走 std::vector<T> 的存储初始化 DynamicSet 类型实例。
+    如果有重复元素抛出 CollectionException。
+【参数】
+    elements: 元素组成的向量，成功后为空。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+DynamicSet<T>::DynamicSet(vector<T>&& elements) {
+    if (
+        elements.size() >= 2 &&
+        !this->IsDistinct(elements.begin(), elements.end())
+    ) {
+        throw CollectionException();
+    }
+    m_Elements = move(elements);
+}
+
 /**********************************************************************
 【函数名称】 Count
 【函数功能】 获取元素个数。
@@ -64,7 +90,7 @@ DynamicSet<T>::DynamicSet(const vector<T>& elements) {
 **********************************************************************/
 template <typename T>
 size_t DynamicSet<T>::Count() const {
-    return m_Elements.size();
+    return m_Elements.size() - m_DeadCount;
 }
 
 /**********************************************************************
@@ -96,13 +122,41 @@ DynamicSet<T> DynamicSet<T>::Intersection(
     const DynamicSet<T>& left,
     const DynamicSet<T>& right
 ) {
+    vector<T> leftBuffer;
+    auto& leftElements = GetLive(left, leftBuffer);
+    vector<T> rightBuffer;
+    auto& rightElements = GetLive(right, rightBuffer);
     DynamicSet<T> set;
-    for (auto& element: left) {
-        if (right.Contains(element)) {
-            // 无需检查，使用 InnerAdd
-            set.InnerAdd(element);
-        }
-    }
+    // 结果中的元素来自同一集合，无需检查
+    Select(
+        leftElements,
+        FindMembers(leftElements, rightElements),
+        true,
+        set.m_Elements
+    );
+    return set;
+}
+
+/**********************************************************************
+【函数名称】 Intersection
+【函数功能】 返回两集合的交集，取走第一个集合的存储。
+【参数】 
+    left: 第一个集合，之后为空。
+    right: 第二个集合。
+【返回值】 
+    两集合的交集。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+DynamicSet<T> DynamicSet<T>::Intersection(
+    DynamicSet<T>&& left,
+    const DynamicSet<T>& right
+) {
+    vector<T> rightBuffer;
+    auto& rightElements = GetLive(right, rightBuffer);
+    DynamicSet<T> set;
+    set.m_Elements = Take(left);
+    set.InnerRetain(FindMembers(set.m_Elements, rightElements));
     return set;
 }
 
@@ -135,11 +189,42 @@ DynamicSet<T> DynamicSet<T>::Union(
     const DynamicSet<T>& left,
     const DynamicSet<T>& right
 ) {
-    DynamicSet<T> set(left);
-    for (auto& element: right) {
-        // 使用 TryAdd，忽略返回值
-        set.TryAdd(element);
-    }
+    vector<T> leftBuffer;
+    auto& leftElements = GetLive(left, leftBuffer);
+    vector<T> rightBuffer;
+    auto& rightElements = GetLive(right, rightBuffer);
+    DynamicSet<T> set;
+    set.m_Elements = leftElements;
+    Select(
+        rightElements,
+        FindMembers(rightElements, leftElements),
+        false,
+        set.m_Elements
+    );
+    return set;
+}
+
+/**********************************************************************
+【函数名称】 Union
+【函数功能】 返回两集合的并集，取走第一个集合的存储。
+【参数】 
+    left: 第一个集合，之后为空。
+    right: 第二个集合。
+【返回值】 
+    两集合的并集。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+DynamicSet<T> DynamicSet<T>::Union(
+    DynamicSet<T>&& left,
+    const DynamicSet<T>& right
+) {
+    vector<T> rightBuffer;
+    auto& rightElements = GetLive(right, rightBuffer);
+    DynamicSet<T> set;
+    set.m_Elements = Take(left);
+    auto isMember = FindMembers(rightElements, set.m_Elements);
+    Select(rightElements, isMember, false, set.m_Elements);
     return set;
 }
 
@@ -172,13 +257,42 @@ DynamicSet<T> DynamicSet<T>::Difference(
     const DynamicSet<T>& left,
     const DynamicSet<T>& right
 ) {
+    vector<T> leftBuffer;
+    auto& leftElements = GetLive(left, leftBuffer);
+    vector<T> rightBuffer;
+    auto& rightElements = GetLive(right, rightBuffer);
     DynamicSet<T> set;
-    for (auto& element: left) {
-        if (!right.Contains(element)) {
-            // 无需检查，使用 InnerAdd
-            set.InnerAdd(element);
-        }
-    }
+    Select(
+        leftElements,
+        FindMembers(leftElements, rightElements),
+        false,
+        set.m_Elements
+    );
+    return set;
+}
+
+/**********************************************************************
+【函数名称】 Difference
+【函数功能】 返回两集合的差集，取走第一个集合的存储。
+【参数】 
+    left: 第一个集合，之后为空。
+    right: 第二个集合。
+【返回值】 
+    两集合的差集。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+DynamicSet<T> DynamicSet<T>::Difference(
+    DynamicSet<T>&& left,
+    const DynamicSet<T>& right
+) {
+    vector<T> rightBuffer;
+    auto& rightElements = GetLive(right, rightBuffer);
+    DynamicSet<T> set;
+    set.m_Elements = Take(left);
+    auto isKept = FindMembers(set.m_Elements, rightElements);
+    isKept.flip();
+    set.InnerRetain(isKept);
     return set;
 }
 
@@ -213,7 +327,53 @@ DynamicSet<T> DynamicSet<T>::SymmetricDifference(
     const DynamicSet<T>& left,
     const DynamicSet<T>& right
 ) {
-    return Union(Difference(left, right), Difference(right, left));
+    vector<T> leftBuffer;
+    auto& leftElements = GetLive(left, leftBuffer);
+    vector<T> rightBuffer;
+    auto& rightElements = GetLive(right, rightBuffer);
+    // 两部分互不相交，直接依次追加，不构造中间集合
+    DynamicSet<T> set;
+    Select(
+        leftElements,
+        FindMembers(leftElements, rightElements),
+        false,
+        set.m_Elements
+    );
+    Select(
+        rightElements,
+        FindMembers(rightElements, leftElements),
+        false,
+        set.m_Elements
+    );
+    return set;
+}
+
+/**********************************************************************
+【函数名称】 SymmetricDifference
+【函数功能】 返回两集合的对称差集，取走第一个集合的存储。
+【参数】 
+    left: 第一个集合，之后为空。
+    right: 第二个集合。
+【返回值】 
+    两集合的对称差集。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+DynamicSet<T> DynamicSet<T>::SymmetricDifference(
+    DynamicSet<T>&& left,
+    const DynamicSet<T>& right
+) {
+    vector<T> rightBuffer;
+    auto& rightElements = GetLive(right, rightBuffer);
+    DynamicSet<T> set;
+    set.m_Elements = Take(left);
+    // 两组标记都须在修改前求出
+    auto isKept = FindMembers(set.m_Elements, rightElements);
+    auto isMember = FindMembers(rightElements, set.m_Elements);
+    isKept.flip();
+    set.InnerRetain(isKept);
+    Select(rightElements, isMember, false, set.m_Elements);
+    return set;
 }
 
 /**********************************************************************
@@ -226,13 +386,27 @@ DynamicSet<T> DynamicSet<T>::SymmetricDifference(
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <typename T>
-DynamicSet<T> DynamicSet<T>::operator&(const DynamicSet<T>& other) const {
+DynamicSet<T> DynamicSet<T>::operator&(const DynamicSet<T>& other) const& {
     return Intersection(other);
 }
 
+/**********************************************************************
+【函数名称】 operator&
+【函数功能】 返回此集合与另一集合的交集，取走自身的存储。
+【参数】 
+    other: 另一集合。
+【返回值】 
+    两集合的交集。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+DynamicSet<T> DynamicSet<T>::operator&(const DynamicSet<T>& other) && {
+    return Intersection(move(*this), other);
+}
+
 /**********************************************************************
 【函数名称】 operator&=
-【函数功能】 将自身赋值为此集合与另一集合的交集。
+【函数功能】 原地删除不属于另一集合的元素。
 【参数】 
     other: 另一集合。
 【返回值】 
@@ -241,7 +415,12 @@ DynamicSet<T> DynamicSet<T>::operator&(const DynamicSet<T>& other) const {
 **********************************************************************/
 template <typename T>
 DynamicSet<T>& DynamicSet<T>::operator&=(const DynamicSet<T>& other) {
-    *this = Intersection(other);
+    if (m_DeadCount > 0) {
+        Compact();
+    }
+    vector<T> otherBuffer;
+    auto& otherElements = GetLive(other, otherBuffer);
+    InnerRetain(FindMembers(m_Elements, otherElements));
     return *this;
 }
 
@@ -255,13 +434,27 @@ DynamicSet<T>& DynamicSet<T>::operator&=(const DynamicSet<T>& other) {
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <typename T>
-DynamicSet<T> DynamicSet<T>::operator|(const DynamicSet<T>& other) const {
+DynamicSet<T> DynamicSet<T>::operator|(const DynamicSet<T>& other) const& {
     return Union(other);
 }
 
+/**********************************************************************
+【函数名称】 operator|
+【函数功能】 返回此集合与另一集合的并集，取走自身的存储。
+【参数】 
+    other: 另一集合。
+【返回值】 
+    两集合的并集。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+DynamicSet<T> DynamicSet<T>::operator|(const DynamicSet<T>& other) && {
+    return Union(move(*this), other);
+}
+
 /**********************************************************************
 【函数名称】 operator|=
-【函数功能】 将自身赋值为此集合与另一集合的并集。
+【函数功能】 原地添加另一集合中自身没有的元素。
 【参数】 
     other: 另一集合。
 【返回值】 
@@ -270,7 +463,20 @@ DynamicSet<T> DynamicSet<T>::operator|(const DynamicSet<T>& other) const {
 **********************************************************************/
 template <typename T>
 DynamicSet<T>& DynamicSet<T>::operator|=(const DynamicSet<T>& other) {
-    *this = Union(other);
+    if (m_DeadCount > 0) {
+        Compact();
+    }
+    vector<T> otherBuffer;
+    auto& otherElements = GetLive(other, otherBuffer);
+    // 先挑出要添加的元素，other 与自身为同一对象时也不受添加影响
+    vector<T> added;
+    auto isMember = FindMembers(otherElements, m_Elements);
+    Select(otherElements, isMember, false, added);
+    InnerReserve(m_Elements.size() + added.size());
+    for (auto& element: added) {
+        // 逐个经过 InnerAdd，使子类增量更新内部状态
+        InnerAdd(element);
+    }
     return *this;
 }
 
@@ -284,13 +490,27 @@ DynamicSet<T>& DynamicSet<T>::operator|=(const DynamicSet<T>& other) {
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <typename T>
-DynamicSet<T> DynamicSet<T>::operator-(const DynamicSet<T>& other) const {
+DynamicSet<T> DynamicSet<T>::operator-(const DynamicSet<T>& other) const& {
     return Difference(other);
 }
 
+/**********************************************************************
+【函数名称】 operator-
+【函数功能】 返回此集合与另一集合的差集，取走自身的存储。
+【参数】 
+    other: 另一集合。
+【返回值】 
+    两集合的差集。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+DynamicSet<T> DynamicSet<T>::operator-(const DynamicSet<T>& other) && {
+    return Difference(move(*this), other);
+}
+
 /**********************************************************************
 【函数名称】 operator-=
-【函数功能】 将自身赋值为此集合与另一集合的差集。
+【函数功能】 原地删除属于另一集合的元素。
 【参数】 
     other: 另一集合。
 【返回值】 
@@ -299,7 +519,14 @@ DynamicSet<T> DynamicSet<T>::operator-(const DynamicSet<T>& other) const {
 **********************************************************************/
 template <typename T>
 DynamicSet<T>& DynamicSet<T>::operator-=(const DynamicSet<T>& other) {
-    *this = Difference(other);
+    if (m_DeadCount > 0) {
+        Compact();
+    }
+    vector<T> otherBuffer;
+    auto& otherElements = GetLive(other, otherBuffer);
+    auto isKept = FindMembers(m_Elements, otherElements);
+    isKept.flip();
+    InnerRetain(isKept);
     return *this;
 }
 
@@ -313,13 +540,28 @@ DynamicSet<T>& DynamicSet<T>::operator-=(const DynamicSet<T>& other) {
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <typename T>
-DynamicSet<T> DynamicSet<T>::operator^(const DynamicSet<T>& other) const {
+DynamicSet<T> DynamicSet<T>::operator^(const DynamicSet<T>& other) const& {
     return SymmetricDifference(other);
 }
 
+/**********************************************************************
+【函数名称】 operator^
+【函数功能】 返回此集合与另一集合的对称差集，取走自身的存储。
+【参数】 
+    other: 另一集合。
+【返回值】 
+    两集合的对称差集。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+DynamicSet<T> DynamicSet<T>::operator^(const DynamicSet<T>& other) && {
+    return SymmetricDifference(move(*this), other);
+}
+
 /**********************************************************************
 【函数名称】 operator^=
-【函数功能】 将自身赋值为此集合与另一集合的对称差集。
+【函数功能】
+    原地删除属于另一集合的元素，再添加另一集合中自身原来没有的元素。
 【参数】 
     other: 另一集合。
 【返回值】 
@@ -327,8 +569,23 @@ DynamicSet<T> DynamicSet<T>::operator^(const DynamicSet<T>& other) const {
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <typename T>
-DynamicSet<T> DynamicSet<T>::operator^=(const DynamicSet<T>& other) {
-    *this = SymmetricDifference(other);
+DynamicSet<T>& DynamicSet<T>::operator^=(const DynamicSet<T>& other) {
+    if (m_DeadCount > 0) {
+        Compact();
+    }
+    vector<T> otherBuffer;
+    auto& otherElements = GetLive(other, otherBuffer);
+    // 修改前求出两组标记并挑出要添加的元素
+    auto isKept = FindMembers(m_Elements, otherElements);
+    vector<T> added;
+    auto isMember = FindMembers(otherElements, m_Elements);
+    Select(otherElements, isMember, false, added);
+    isKept.flip();
+    InnerRetain(isKept);
+    InnerReserve(m_Elements.size() + added.size());
+    for (auto& element: added) {
+        InnerAdd(element);
+    }
     return *this;
 }
 
@@ -343,7 +600,30 @@ DynamicSet<T> DynamicSet<T>::operator^=(const DynamicSet<T>& other) {
 **********************************************************************/
 template <typename T>
 const T& DynamicSet<T>::InnerGet(size_t index) const {
-    return m_Elements[index];
+    return m_Elements[m_DeadCount == 0 ? index : FindSlot(index)];
+}
+
+/**********************************************************************
+【函数名称】 InnerFind
+【函数功能】 直接遍历存储，查找给定值在集合中的下标。
+【参数】
+    element: 要查找的值。
+    index: 找到时被赋值为元素的下标。
+【返回值】
+    是否找到。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+bool DynamicSet<T>::InnerFind(const T& element, size_t& index) const {
+    size_t i = 0;
+    for (auto& candidate: *this) {
+        if (candidate == element) {
+            index = i;
+            return true;
+        }
+        i++;
+    }
+    return false;
 }
 
 /**********************************************************************
@@ -357,7 +637,7 @@ const T& DynamicSet<T>::InnerGet(size_t index) const {
 **********************************************************************/
 template <typename T>
 void DynamicSet<T>::InnerSet(size_t index, const T& value) {
-    m_Elements[index] = value;
+    m_Elements[m_DeadCount == 0 ? index : FindSlot(index)] = value;
 }
 
 /**********************************************************************
@@ -371,11 +651,30 @@ void DynamicSet<T>::InnerSet(size_t index, const T& value) {
 template <typename T>
 void DynamicSet<T>::InnerAdd(const T& value) {
     m_Elements.push_back(value);
+    if (m_DeadCount > 0) {
+        AppendSlot();
+    }
+}
+
+/**********************************************************************
+【函数名称】 InnerAdd
+【函数功能】 无条件添加元素，取走其内容。
+【参数】 
+    value: 要添加的值。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+void DynamicSet<T>::InnerAdd(T&& value) {
+    m_Elements.push_back(move(value));
+    if (m_DeadCount > 0) {
+        AppendSlot();
+    }
 }
 
 /**********************************************************************
 【函数名称】 InnerRemove
-【函数功能】 无条件删除元素。
+【函数功能】 无条件删除元素。以墓碑方式删除时只标记槽位。
 【参数】 
     index: 要删除的下标。
 【返回值】 无
@@ -383,12 +682,16 @@ void DynamicSet<T>::InnerAdd(const T& value) {
 **********************************************************************/
 template <typename T>
 void DynamicSet<T>::InnerRemove(size_t index) {
+    if (m_IsTombstoned) {
+        Bury(FindSlot(index));
+        return;
+    }
     m_Elements.erase(m_Elements.begin() + index);
 }
 
 /**********************************************************************
 【函数名称】 InnerInsert
-【函数功能】 无条件插入元素。
+【函数功能】 无条件插入元素。有已删除的槽位时先压缩。
 【参数】 
     index: 要插入位置的下标。
     element: 新的元素。
@@ -397,9 +700,640 @@ void DynamicSet<T>::InnerRemove(size_t index) {
 **********************************************************************/
 template <typename T>
 void DynamicSet<T>::InnerInsert(size_t index, const T& element) {
+    if (m_DeadCount > 0) {
+        Compact();
+    }
     m_Elements.insert(m_Elements.begin() + index, element);
 }
 
+/**********************************************************************
+【函数名称】 InnerReplace
+【函数功能】 无条件将全部元素替换为另一集合的元素。
+【参数】 
+    other: 提供新元素的集合。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+void DynamicSet<T>::InnerReplace(const DynamicSet<T>& other) {
+    vector<T> otherBuffer;
+    auto& otherElements = GetLive(other, otherBuffer);
+    m_Elements = otherElements;
+    ClearDead();
+}
+
+/**********************************************************************
+【函数名称】 InnerReplace
+【函数功能】 无条件取走另一集合的存储作为全部元素。
+【参数】 
+    other: 提供新元素的集合，之后为空。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+void DynamicSet<T>::InnerReplace(DynamicSet<T>&& other) {
+    if (other.m_DeadCount > 0) {
+        other.Compact();
+    }
+    m_Elements = move(other.m_Elements);
+    ClearDead();
+    // other 可能是 HashedSet，须同时清空其内部状态
+    other.m_Elements.clear();
+    other.InnerRebuild();
+}
+
+/**********************************************************************
+【函数名称】 TransformInplace
+【函数功能】
+    对每个元素原地调用 transform，全部完成后重建内部状态，
+    并检查元素是否仍互不相同。不经过 ShouldSet 的逐个检查，
+    适合一次性修改全部元素。如果 transform 抛出异常，
+    已修改的元素保持修改后的值，内部状态仍会被重建。
+【参数】
+    transform: 接受元素可变引用的可调用对象。
+【返回值】
+    元素是否仍互不相同。若为 false，集合中存在重复元素，
+    调用者须负责将其恢复。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+template <typename F>
+bool DynamicSet<T>::TransformInplace(F transform) {
+    // 已删除的元素不参与变换与重复检查
+    if (m_DeadCount > 0) {
+        Compact();
+    }
+    try {
+        for (auto& element: m_Elements) {
+            transform(element);
+        }
+    }
+    catch (...) {
+        InnerRebuild();
+        throw;
+    }
+    return InnerRebuild();
+}
+
+/**********************************************************************
+【函数名称】 Reserve
+【函数功能】 
+    为即将逐个添加的元素预留空间，避免添加过程中反复扩容。
+    不改变集合中的元素。
+【参数】
+    count: 添加后预计的元素总数。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+void DynamicSet<T>::Reserve(size_t count) {
+    InnerReserve(count);
+}
+
+/**********************************************************************
+【函数名称】 Retain
+【函数功能】
+    一次删除所有未标记保留的元素，保留的元素维持原有顺序，
+    每个元素至多移动一次，适合批量删除。
+    isKept 的长度与元素个数不同时抛出 InvalidSizeException。
+【参数】
+    isKept: 每个元素是否保留。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+void DynamicSet<T>::Retain(const vector<bool>& isKept) {
+    if (isKept.size() != Count()) {
+        throw InvalidSizeException();
+    }
+    if (!m_IsTombstoned) {
+        InnerRetain(isKept);
+        return;
+    }
+    // 从后向前删除，尚未处理的下标不受影响
+    for (size_t i = isKept.size(); i > 0; i--) {
+        if (!isKept[i - 1]) {
+            InnerRemove(i - 1);
+        }
+    }
+}
+
+/**********************************************************************
+【函数名称】 SetTombstoned
+【函数功能】
+    设置是否以墓碑方式删除元素。开启后 Remove 与 Retain
+    只将元素所在的槽位标记为已删除而不移动其他元素，
+    为 O(log n)；下标仍按存活元素的顺序计算，
+    其余元素的槽位在压缩前保持不变。关闭时立即压缩。
+【参数】
+    isTombstoned: 是否以墓碑方式删除。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+void DynamicSet<T>::SetTombstoned(bool isTombstoned) {
+    if (!isTombstoned && m_DeadCount > 0) {
+        Compact();
+    }
+    m_IsTombstoned = isTombstoned;
+}
+
+/**********************************************************************
+【函数名称】 IsTombstoned
+【函数功能】 获取是否以墓碑方式删除元素。
+【参数】 无
+【返回值】
+    是否以墓碑方式删除元素。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+bool DynamicSet<T>::IsTombstoned() const {
+    return m_IsTombstoned;
+}
+
+/**********************************************************************
+【函数名称】 GetSlotCount
+【函数功能】 获取槽位数，包括已删除但尚未压缩的槽位。
+【参数】 无
+【返回值】
+    槽位数。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+size_t DynamicSet<T>::GetSlotCount() const {
+    return m_Elements.size();
+}
+
+/**********************************************************************
+【函数名称】 GetSlot
+【函数功能】
+    获取指定下标处元素所在的槽位，供持有者维护与槽位对应的数据。
+    如果越界抛出 IndexOverflowException。
+【参数】
+    index: 元素的下标。
+【返回值】
+    元素所在的槽位，压缩前不变。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+size_t DynamicSet<T>::GetSlot(size_t index) const {
+    if (index >= Count()) {
+        throw IndexOverflowException();
+    }
+    return FindSlot(index);
+}
+
+/**********************************************************************
+【函数名称】 IsCompactionDue
+【函数功能】
+    判断已删除的槽位是否达到全部槽位的 1/COMPACTION_DIVISOR，
+    此时压缩的代价可以均摊到每次删除上。
+【参数】 无
+【返回值】
+    是否应当压缩。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+bool DynamicSet<T>::IsCompactionDue() const {
+    return m_DeadCount > 0 &&
+        m_DeadCount * COMPACTION_DIVISOR >= m_Elements.size();
+}
+
+/**********************************************************************
+【函数名称】 Compact
+【函数功能】
+    移除全部已删除的槽位，存活元素维持原有顺序，之后槽位与下标相同。
+    Insert、TransformInplace 与集合运算修改自身前会自动压缩。
+【参数】 无
+【返回值】
+    压缩前的每个槽位是否保留，持有者据此压缩与槽位对应的数据。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+vector<bool> DynamicSet<T>::Compact() {
+    vector<bool> isKept(m_Elements.size(), true);
+    if (m_DeadCount == 0) {
+        return isKept;
+    }
+    for (size_t i = 0; i < isKept.size(); i++) {
+        isKept[i] = !m_IsDead[i];
+    }
+    // 先清空记录，使 InnerRetain 面对的槽位与下标相同
+    ClearDead();
+    InnerRetain(isKept);
+    return isKept;
+}
+
+/**********************************************************************
+【函数名称】 TryRevive
+【函数功能】
+    恢复以墓碑方式删除、尚未压缩的元素，使其回到删除前的下标，
+    为 O(log n)。槽位未删除、其中的元素不等于 value、
+    恢复后的下标不等于 index 或集合中已有相等的元素时不做任何事。
+【参数】
+    slot: 删除时元素所在的槽位。
+    index: 删除前元素的下标。
+    value: 被删除的元素。
+【返回值】
+    是否恢复了元素。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+bool DynamicSet<T>::TryRevive(size_t slot, size_t index, const T& value) {
+    // 压缩过的槽位可能已被其他元素占据，逐项核对后才能恢复
+    if (m_DeadCount == 0 || slot >= m_Elements.size() || !m_IsDead[slot]) {
+        return false;
+    }
+    if (CountLive(slot) != index || !(m_Elements[slot] == value)) {
+        return false;
+    }
+    if (this->Contains(value)) {
+        return false;
+    }
+    InnerRevive(slot);
+    return true;
+}
+
+/**********************************************************************
+【函数名称】 InnerRebuild
+【函数功能】
+    元素被原地修改后重建内部状态，并检查元素是否仍互不相同。
+    DynamicSet 没有额外状态，只调用 IsDistinct。
+【参数】 无
+【返回值】
+    元素是否仍互不相同。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+bool DynamicSet<T>::InnerRebuild() {
+    return this->IsDistinct(m_Elements.begin(), m_Elements.end());
+}
+
+/**********************************************************************
+【函数名称】 InnerRetain
+【函数功能】 无条件删除未标记保留的元素，其余元素保持原有顺序。
+【参数】 
+    isKept: 每个元素是否保留，长度与元素个数相同。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+void DynamicSet<T>::InnerRetain(const vector<bool>& isKept) {
+    size_t count = 0;
+    for (size_t i = 0; i < m_Elements.size(); i++) {
+        if (isKept[i]) {
+            if (count != i) {
+                m_Elements[count] = move(m_Elements[i]);
+            }
+            count++;
+        }
+    }
+    m_Elements.erase(m_Elements.begin() + count, m_Elements.end());
+}
+
+/**********************************************************************
+【函数名称】 InnerReserve
+【函数功能】 为即将逐个添加的元素预留空间。
+【参数】 
+    count: 添加后的元素总数。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+void DynamicSet<T>::InnerReserve(size_t count) {
+    m_Elements.reserve(count);
+}
+
+/**********************************************************************
+【函数名称】 InnerRevive
+【函数功能】 无条件将已删除的槽位标记为存活并更新树状数组。
+【参数】
+    slot: 已删除的槽位。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+void DynamicSet<T>::InnerRevive(size_t slot) {
+    if (--m_DeadCount == 0) {
+        ClearDead();
+        return;
+    }
+    m_IsDead[slot] = false;
+    for (size_t i = slot + 1; i < m_LiveCounts.size(); i += LowBit(i)) {
+        m_LiveCounts[i]++;
+    }
+}
+
+/**********************************************************************
+【函数名称】 FindSlot
+【函数功能】 不检查越界，获取指定下标处元素所在的槽位。
+【参数】
+    index: 元素的下标。
+【返回值】
+    元素所在的槽位。没有已删除的槽位时与下标相同，
+    否则在树状数组上二分，为 O(log n)。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+size_t DynamicSet<T>::FindSlot(size_t index) const {
+    if (m_DeadCount == 0) {
+        return index;
+    }
+    // 求存活槽位数小于 index + 1 的最长前缀，其后一个槽位即为所求
+    size_t step = 1;
+    while (step * 2 < m_LiveCounts.size()) {
+        step *= 2;
+    }
+    size_t count = 0;
+    size_t remaining = index + 1;
+    for (; step > 0; step /= 2) {
+        if (
+            count + step < m_LiveCounts.size() &&
+            m_LiveCounts[count + step] < remaining
+        ) {
+            count += step;
+            remaining -= m_LiveCounts[count];
+        }
+    }
+    return count;
+}
+
+/**********************************************************************
+【函数名称】 GetAtSlot
+【函数功能】 无条件获取指定槽位中的元素。
+【参数】
+    slot: 槽位。
+【返回值】
+    槽位中元素的常引用。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+const T& DynamicSet<T>::GetAtSlot(size_t slot) const {
+    return m_Elements[slot];
+}
+
+/**********************************************************************
+【函数名称】 GetIndexOfSlot
+【函数功能】 获取存活槽位中元素的下标，即此前存活槽位的个数。
+【参数】
+    slot: 存活的槽位。
+【返回值】
+    元素的下标。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+size_t DynamicSet<T>::GetIndexOfSlot(size_t slot) const {
+    return m_DeadCount == 0 ? slot : CountLive(slot);
+}
+
+/**********************************************************************
+【函数名称】 Bury
+【函数功能】
+    将槽位标记为已删除并更新树状数组。
+    此前没有已删除的槽位时先在 O(n) 内建立树状数组。
+【参数】
+    slot: 存活的槽位。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+void DynamicSet<T>::Bury(size_t slot) {
+    if (m_DeadCount == 0) {
+        m_IsDead.assign(m_Elements.size(), false);
+        // 全部存活时第 i 项覆盖的槽位数恰为 LowBit(i)
+        m_LiveCounts.resize(m_Elements.size() + 1);
+        m_LiveCounts[0] = 0;
+        for (size_t i = 1; i < m_LiveCounts.size(); i++) {
+            m_LiveCounts[i] = LowBit(i);
+        }
+    }
+    m_IsDead[slot] = true;
+    m_DeadCount++;
+    for (size_t i = slot + 1; i < m_LiveCounts.size(); i += LowBit(i)) {
+        m_LiveCounts[i]--;
+    }
+}
+
+/**********************************************************************
+【函数名称】 AppendSlot
+【函数功能】 有已删除的槽位时，为刚添加的元素追加槽位标记与树状数组项。
+【参数】 无
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+void DynamicSet<T>::AppendSlot() {
+    m_IsDead.push_back(false);
+    // 新的第 i 项覆盖 (i - LowBit(i), i] 中的槽位，最后一个即新槽位
+    size_t i = m_LiveCounts.size();
+    m_LiveCounts.push_back(1 + CountLive(i - 1) - CountLive(i - LowBit(i)));
+}
+
+/**********************************************************************
+【函数名称】 ClearDead
+【函数功能】 清空已删除槽位的记录，不改变元素。
+【参数】 无
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+void DynamicSet<T>::ClearDead() {
+    m_DeadCount = 0;
+    m_IsDead.clear();
+    m_LiveCounts.clear();
+}
+
+/**********************************************************************
+【函数名称】 CountLive
+【函数功能】 在树状数组上求前 count 个槽位中存活槽位的个数。
+【参数】
+    count: 槽位个数。
+【返回值】
+    存活槽位的个数。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+size_t DynamicSet<T>::CountLive(size_t count) const {
+    size_t live = 0;
+    for (size_t i = count; i > 0; i -= LowBit(i)) {
+        live += m_LiveCounts[i];
+    }
+    return live;
+}
+
+/**********************************************************************
+【函数名称】 LowBit
+【函数功能】 获取正整数二进制表示中最低的 1 所代表的值。
+【参数】
+    value: 正整数。
+【返回值】
+    最低的 1 所代表的值。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+size_t DynamicSet<T>::LowBit(size_t value) {
+    return value & (~value + 1);
+}
+
+/**********************************************************************
+【函数名称】 GetLive
+【函数功能】 获取集合中按顺序排列的存活元素。
+【参数】
+    set: 集合。
+    buffer: 有已删除的槽位时用于存放存活元素的副本。
+【返回值】
+    没有已删除的槽位时为集合的存储，否则为 buffer。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+const vector<T>& DynamicSet<T>::GetLive(
+    const DynamicSet<T>& set,
+    vector<T>& buffer
+) {
+    if (set.m_DeadCount == 0) {
+        return set.m_Elements;
+    }
+    buffer.assign(set.begin(), set.end());
+    return buffer;
+}
+
+/**********************************************************************
+【函数名称】 FindMembers
+【函数功能】 标记 source 中的每个元素是否属于 other。
+【参数】 
+    source: 要标记的元素，互不相同。
+    other: 另一组元素，互不相同。
+【返回值】 
+    与 source 等长的标记。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+vector<bool> DynamicSet<T>::FindMembers(
+    const vector<T>& source,
+    const vector<T>& other
+) {
+    return FindMembers(source, other, IsHashable<T>());
+}
+
+/**********************************************************************
+【函数名称】 FindMembers
+【函数功能】
+    为较少的一组元素建立 HashIndex，遍历另一组元素查找，O(n + m)。
+【参数】 
+    source: 要标记的元素，互不相同。
+    other: 另一组元素，互不相同。
+【返回值】 
+    与 source 等长的标记。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+vector<bool> DynamicSet<T>::FindMembers(
+    const vector<T>& source,
+    const vector<T>& other,
+    true_type
+) {
+    vector<bool> isMember(source.size(), false);
+    if (source.empty() || other.empty()) {
+        return isMember;
+    }
+    if (source.size() <= other.size()) {
+        // 索引 source，other 中的元素至多对应 source 中的一个
+        HashIndex<T> index(source.size());
+        for (size_t i = 0; i < source.size(); i++) {
+            index.TryInsert(source.begin(), i);
+        }
+        size_t found;
+        for (auto& element: other) {
+            if (index.Find(source.begin(), element, found)) {
+                isMember[found] = true;
+            }
+        }
+    }
+    else {
+        HashIndex<T> index(other.size());
+        for (size_t i = 0; i < other.size(); i++) {
+            index.TryInsert(other.begin(), i);
+        }
+        for (size_t i = 0; i < source.size(); i++) {
+            isMember[i] = index.Contains(other.begin(), source[i]);
+        }
+    }
+    return isMember;
+}
+
+/**********************************************************************
+【函数名称】 FindMembers
+【函数功能】 元素不可求哈希值时逐个比较，O(n·m)。
+【参数】 
+    source: 要标记的元素，互不相同。
+    other: 另一组元素，互不相同。
+【返回值】 
+    与 source 等长的标记。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+vector<bool> DynamicSet<T>::FindMembers(
+    const vector<T>& source,
+    const vector<T>& other,
+    false_type
+) {
+    vector<bool> isMember(source.size(), false);
+    for (size_t i = 0; i < source.size(); i++) {
+        for (auto& element: other) {
+            if (source[i] == element) {
+                isMember[i] = true;
+                break;
+            }
+        }
+    }
+    return isMember;
+}
+
+/**********************************************************************
+【函数名称】 Select
+【函数功能】 将标记与给定值相同的元素依次追加到结果中。
+【参数】 
+    source: 要挑选的元素。
+    isMember: 与 source 等长的标记。
+    expected: 要挑选的元素的标记值。
+    result: 追加到的结果。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+void DynamicSet<T>::Select(
+    const vector<T>& source,
+    const vector<bool>& isMember,
+    bool expected,
+    vector<T>& result
+) {
+    for (size_t i = 0; i < source.size(); i++) {
+        if (isMember[i] == expected) {
+            result.push_back(source[i]);
+        }
+    }
+}
+
+/**********************************************************************
+【函数名称】 Take
+【函数功能】 取走集合的存储，并重建其内部状态使之成为空集合。
+【参数】 
+    set: 要取走存储的集合。
+【返回值】 
+    集合原来的元素。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+vector<T> DynamicSet<T>::Take(DynamicSet<T>& set) {
+    if (set.m_DeadCount > 0) {
+        set.Compact();
+    }
+    vector<T> elements;
+    elements.swap(set.m_Elements);
+    set.InnerRebuild();
+    return elements;
+}
+
 /**********************************************************************
 【函数名称】 begin
 【函数功能】 获取头部迭代器。
@@ -409,8 +1343,8 @@ void DynamicSet<T>::InnerInsert(size_t index, const T& element) {
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <typename T>
-typename vector<T>::const_iterator DynamicSet<T>::begin() const {
-    return m_Elements.cbegin();
+typename DynamicSet<T>::ConstIterator DynamicSet<T>::begin() const {
+    return ConstIterator(this, 0);
 }
 
 /**********************************************************************
@@ -422,8 +1356,148 @@ typename vector<T>::const_iterator DynamicSet<T>::begin() const {
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <typename T>
-typename vector<T>::const_iterator DynamicSet<T>::end() const {
-    return m_Elements.end();
+typename DynamicSet<T>::ConstIterator DynamicSet<T>::end() const {
+    return ConstIterator(this, m_Elements.size());
+}
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】
+    使用集合与槽位初始化 ConstIterator 类型实例，
+    并移动到不早于该槽位的首个存活槽位。
+【参数】
+    pSet: 所属集合的指针。
+    slot: 起始槽位。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+DynamicSet<T>::ConstIterator::ConstIterator(
+    const DynamicSet<T>* pSet,
+    size_t slot
+): m_pSet(pSet), m_Slot(slot) {
+    SkipDead();
+}
+
+/**********************************************************************
+【函数名称】 operator*
+【函数功能】 获取当前元素。
+【参数】 无
+【返回值】
+    当前元素的常引用。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+const T& DynamicSet<T>::ConstIterator::operator*() const {
+    return m_pSet->m_Elements[m_Slot];
+}
+
+/**********************************************************************
+【函数名称】 operator->
+【函数功能】 获取当前元素的指针。
+【参数】 无
+【返回值】
+    当前元素的常量指针。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+const T* DynamicSet<T>::ConstIterator::operator->() const {
+    return &m_pSet->m_Elements[m_Slot];
+}
+
+/**********************************************************************
+【函数名称】 operator++
+【函数功能】 前置自增，移动到下一个存活槽位。
+【参数】 无
+【返回值】
+    自身的引用。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+typename DynamicSet<T>::ConstIterator&
+DynamicSet<T>::ConstIterator::operator++() {
+    m_Slot++;
+    SkipDead();
+    return *this;
+}
+
+/**********************************************************************
+【函数名称】 operator++
+【函数功能】 后置自增，移动到下一个存活槽位。
+【参数】 无
+【返回值】
+    自增前的迭代器。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+typename DynamicSet<T>::ConstIterator
+DynamicSet<T>::ConstIterator::operator++(int) {
+    ConstIterator previous(*this);
+    ++*this;
+    return previous;
+}
+
+/**********************************************************************
+【函数名称】 operator==
+【函数功能】 判断两个迭代器是否指向同一槽位。
+【参数】
+    other: 另一迭代器。
+【返回值】
+    是否指向同一槽位。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+bool DynamicSet<T>::ConstIterator::operator==(
+    const ConstIterator& other
+) const {
+    return m_pSet == other.m_pSet && m_Slot == other.m_Slot;
+}
+
+/**********************************************************************
+【函数名称】 operator!=
+【函数功能】 判断两个迭代器是否指向不同槽位。
+【参数】
+    other: 另一迭代器。
+【返回值】
+    是否指向不同槽位。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+bool DynamicSet<T>::ConstIterator::operator!=(
+    const ConstIterator& other
+) const {
+    return !(*this == other);
+}
+
+/**********************************************************************
+【函数名称】 GetSlot
+【函数功能】 获取当前元素所在的槽位。
+【参数】 无
+【返回值】
+    当前元素所在的槽位。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+size_t DynamicSet<T>::ConstIterator::GetSlot() const {
+    return m_Slot;
+}
+
+/**********************************************************************
+【函数名称】 SkipDead
+【函数功能】 跳过从当前槽位起连续的已删除槽位。
+【参数】 无
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+void DynamicSet<T>::ConstIterator::SkipDead() {
+    if (m_pSet->m_DeadCount == 0) {
+        return;
+    }
+    auto count = m_pSet->m_Elements.size();
+    while (m_Slot < count && m_pSet->m_IsDead[m_Slot]) {
+        m_Slot++;
+    }
 }
 
 }
@@ -9,6 +9,8 @@
 #include <array>
 #include <cstddef>
 #include <initializer_list>
+#include <string>
+#include <type_traits>
 #include "DistinctCollection.hpp"
 #include "DynamicSet.hpp"
 using namespace std;
@@ -19,14 +21,18 @@ namespace Containers {
 
 // FixedSet 不实现交并补操作，因为操作后大小不定。
 // 因此 FixedSet 不继承于 DynamicSet。
+// FixedSet 也不继承于 CollectionBase：它是元素的存储，
+// 没有虚函数表，T 可平凡复制时 FixedSet 也可平凡复制。
 /*************************************************************************
 【类名】 FixedSet
 【功能】 定义一个元素类型为 T，大小为 N 的集合。
-【接口说明】 获取/设置元素，判断是否包含元素。
+【接口说明】
+    获取/设置元素，判断是否包含元素，有序与无序比较。
+    所有函数都不是虚函数，大小与 std::array<T, N> 相同。
 【开发者及日期】 赵一彤 2024/7/24
 *************************************************************************/
 template <typename T, size_t N>
-class FixedSet: public DistinctCollection<T> {
+class FixedSet final {
     public:
         // 构造函数
 
@@ -66,19 +72,126 @@ class FixedSet: public DistinctCollection<T> {
         【函数名称】 Count
         【函数功能】 获取元素个数。
         【参数】 无
-        【返回值】 
+        【返回值】
             容器中的元素个数。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        size_t Count() const override;
+        size_t Count() const;
+
+        // 访问器
+
+        /**********************************************************************
+        【函数名称】 Get
+        【函数功能】 获取指定下标处的元素。如果越界抛出 IndexOverflowException。
+        【参数】
+            index: 元素下标。
+        【返回值】
+            指定位置元素的常引用。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        const T& Get(size_t index) const;
+        /**********************************************************************
+        【函数名称】 TrySet
+        【函数功能】
+            尝试设置指定位置元素的值，与其他元素重复时失败。
+            如果越界抛出 IndexOverflowException。
+        【参数】
+            index: 元素下标。
+            value: 新的值。
+        【返回值】
+            操作是否成功。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        bool TrySet(size_t index, const T& value);
+        /**********************************************************************
+        【函数名称】 Set
+        【函数功能】
+            设置指定位置元素的值。
+            如果操作失败抛出 CollectionException。
+            如果越界抛出 IndexOverflowException。
+        【参数】
+            index: 元素下标。
+            value: 新的值。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void Set(size_t index, const T& value);
 
         // 操作
 
+        /**********************************************************************
+        【函数名称】 Contains
+        【函数功能】 判断给定的值是否在集合内。
+        【参数】
+            element: 要进行判断的值。
+        【返回值】
+            值是否在集合内。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        bool Contains(const T& element) const;
+        /**********************************************************************
+        【函数名称】 FindIndex
+        【函数功能】 寻找给定值在集合中的下标。找不到则抛出 CollectionException。
+        【参数】
+            element: 要寻找的值。
+        【返回值】
+            集合中的下标。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        size_t FindIndex(const T& element) const;
+        /**********************************************************************
+        【函数名称】 IsEqual
+        【函数功能】 判断自身和另一集合是否按顺序相等。
+        【参数】
+            other: 另一集合。
+        【返回值】
+            两集合是否相等。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        bool IsEqual(const FixedSet<T, N>& other) const;
+        /**********************************************************************
+        【函数名称】 IsEqual
+        【函数功能】 判断两集合是否按顺序相等。
+        【参数】
+            left: 第一个集合。
+            right: 第二个集合。
+        【返回值】
+            两集合是否相等。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static bool IsEqual(
+            const FixedSet<T, N>& left,
+            const FixedSet<T, N>& right
+        );
+        /**********************************************************************
+        【函数名称】 IsEqualUnordered
+        【函数功能】 判断自身与另一集合中元素是否一一对应。
+        【参数】
+            other: 另一集合。
+        【返回值】
+            元素是否一一对应。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        bool IsEqualUnordered(const FixedSet<T, N>& other) const;
+        /**********************************************************************
+        【函数名称】 IsEqualUnordered
+        【函数功能】 判断两个集合中元素是否一一对应。
+        【参数】
+            left: 第一个集合。
+            right: 第二个集合。
+        【返回值】
+            元素是否一一对应。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static bool IsEqualUnordered(
+            const FixedSet<T, N>& left,
+            const FixedSet<T, N>& right
+        );
         /**********************************************************************
         【函数名称】 ToDynamic
         【函数功能】 将自身转化为 DynamicSet。
         【参数】 无
-        【返回值】 
+        【返回值】
             转化后的对象。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
@@ -89,9 +202,9 @@ class FixedSet: public DistinctCollection<T> {
         /**********************************************************************
         【函数名称】 operator=
         【函数功能】 将其他集合赋值给自身。
-        【参数】 
+        【参数】
             other: 从之取值的集合。
-        【返回值】 
+        【返回值】
             自身的引用。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
@@ -100,11 +213,53 @@ class FixedSet: public DistinctCollection<T> {
         【函数名称】 operator DynamicSet<T>
         【函数功能】 将自身转化为 DynamicSet。
         【参数】 无
-        【返回值】 
+        【返回值】
             转化后的对象。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
         operator DynamicSet<T>() const;
+        /**********************************************************************
+        【函数名称】 operator[]
+        【函数功能】 获取指定下标处的元素。如果越界抛出 IndexOverflowException。
+        【参数】
+            index: 元素下标。
+        【返回值】
+            指定位置元素的常引用。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        const T& operator[](size_t index) const;
+        /**********************************************************************
+        【函数名称】 operator==
+        【函数功能】 判断自身与另一集合中元素是否一一对应。
+        【参数】
+            other: 另一集合。
+        【返回值】
+            元素是否一一对应。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        bool operator==(const FixedSet<T, N>& other) const;
+        /**********************************************************************
+        【函数名称】 operator!=
+        【函数功能】 判断自身与另一集合中元素是否不能一一对应。
+        【参数】
+            other: 另一集合。
+        【返回值】
+            元素是否不能一一对应。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        bool operator!=(const FixedSet<T, N>& other) const;
+
+        // 格式化
+
+        /**********************************************************************
+        【函数名称】 ToString
+        【函数功能】 返回此对象的字符串表达形式。
+        【参数】 无
+        【返回值】
+            此对象的字符串表达形式。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        string ToString() const;
 
         // 迭代器
 
@@ -112,7 +267,7 @@ class FixedSet: public DistinctCollection<T> {
         【函数名称】 begin
         【函数功能】 获取头部迭代器。
         【参数】 无
-        【返回值】 
+        【返回值】
             指向首个元素的迭代器。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
@@ -121,93 +276,66 @@ class FixedSet: public DistinctCollection<T> {
         【函数名称】 end
         【函数功能】 获取尾部迭代器。
         【参数】 无
-        【返回值】 
+        【返回值】
             指向最后元素之后的迭代器。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
         typename array<T, N>::const_iterator end() const;
-    protected:
-        /**********************************************************************
-        【函数名称】 InnerGet
-        【函数功能】 无条件获取元素值。
-        【参数】 
-            index: 要获取的下标。
-        【返回值】 
-            指定位置元素的常引用。
-        【开发者及日期】 赵一彤 2024/7/24
-        **********************************************************************/
-        const T& InnerGet(size_t index) const override;
-        /**********************************************************************
-        【函数名称】 InnerSet
-        【函数功能】 无条件设置元素值。
-        【参数】 
-            index: 要设置的下标。
-            value: 要设置的值。
-        【返回值】 无
-        【开发者及日期】 赵一彤 2024/7/24
-        **********************************************************************/
-        void InnerSet(size_t index, const T& value) override;
-        /**********************************************************************
-        【函数名称】 ShouldAdd
-        【函数功能】 判断是否应该添加元素。
-        【参数】 
-            value: 要添加的值。
-        【返回值】 
-            是否应该添加元素。
-        【开发者及日期】 赵一彤 2024/7/24
-        **********************************************************************/
-        bool ShouldAdd(const T& value) const override;
-        /**********************************************************************
-        【函数名称】 InnerAdd
-        【函数功能】 无条件添加元素。
-        【参数】 
-            value: 要添加的值。
-        【返回值】 无
-        【开发者及日期】 赵一彤 2024/7/24
-        **********************************************************************/
-        void InnerAdd(const T& value) override;
+
+    private:
+        array<T, N> m_Elements;
+
         /**********************************************************************
-        【函数名称】 ShouldRemove
-        【函数功能】 判断是否应该删除元素。
-        【参数】 
-            index: 要删除的下标。
-        【返回值】 
-            是否应该删除元素。
-        【开发者及日期】 赵一彤 2024/7/24
+        【函数名称】 InnerFind
+        【函数功能】 逐个比较，查找给定值在集合中的下标。
+        【参数】
+            element: 要查找的值。
+            index: 找到时被赋值为元素的下标。
+        【返回值】
+            是否找到。
+        【开发者及日期】 赵一彤 2026/10/17
         **********************************************************************/
-        bool ShouldRemove(size_t index) const override;
+        bool InnerFind(const T& element, size_t& index) const;
         /**********************************************************************
-        【函数名称】 InnerRemove
-        【函数功能】 无条件删除元素。
-        【参数】 
-            index: 要删除的下标。
-        【返回值】 无
-        【开发者及日期】 赵一彤 2024/7/24
+        【函数名称】 IsDistinctFixed
+        【函数功能】 展开比较，判断 2 个元素是否不同。
+        【参数】
+            elements: 指向首个元素的指针。
+        【返回值】
+            是否没有重复元素。
+        【开发者及日期】 赵一彤 2026/10/17
         **********************************************************************/
-        void InnerRemove(size_t index) override;
+        static bool IsDistinctFixed(
+            const T* elements,
+            integral_constant<size_t, 2>
+        );
         /**********************************************************************
-        【函数名称】 ShouldInsert
-        【函数功能】 判断是否应该插入元素。
-        【参数】 
-            index: 要插入位置的下标。
-            element: 新的元素。
-        【返回值】 
-            是否应该插入元素。
-        【开发者及日期】 赵一彤 2024/7/24
+        【函数名称】 IsDistinctFixed
+        【函数功能】 展开比较，判断 3 个元素是否互不相同。
+        【参数】
+            elements: 指向首个元素的指针。
+        【返回值】
+            是否没有重复元素。
+        【开发者及日期】 赵一彤 2026/10/17
         **********************************************************************/
-        bool ShouldInsert(size_t index, const T& element) const override;
+        static bool IsDistinctFixed(
+            const T* elements,
+            integral_constant<size_t, 3>
+        );
         /**********************************************************************
-        【函数名称】 InnerInsert
-        【函数功能】 无条件插入元素。
-        【参数】 
-            index: 要插入位置的下标。
-            element: 新的元素。
-        【返回值】 无
-        【开发者及日期】 赵一彤 2024/7/24
+        【函数名称】 IsDistinctFixed
+        【函数功能】 其他大小使用 DistinctCollection::IsDistinct。
+        【参数】
+            elements: 指向首个元素的指针。
+        【返回值】
+            是否没有重复元素。
+        【开发者及日期】 赵一彤 2026/10/17
         **********************************************************************/
-        void InnerInsert(size_t index, const T& element) override;
-    private:
-        array<T, N> m_Elements;
+        template <size_t M>
+        static bool IsDistinctFixed(
+            const T* elements,
+            integral_constant<size_t, M>
+        );
 };
 
 }
@@ -8,6 +8,9 @@
 #include <array>
 #include <cstddef>
 #include <initializer_list>
+#include <sstream>
+#include <string>
+#include <type_traits>
 #include <vector>
 #include "DistinctCollection.hpp"
 #include "DynamicSet.hpp"
@@ -33,10 +36,7 @@ FixedSet<T, N>::FixedSet(initializer_list<T> elements) {
     if (elements.size() != N) {
         throw InvalidSizeException();
     }
-    if (
-        N >= 2 &&
-        !this->IsDistinct(elements.begin(), elements.end())
-    ) {
+    if (!IsDistinctFixed(elements.begin(), integral_constant<size_t, N>())) {
         throw CollectionException();
     }
     copy(elements.begin(), elements.end(), m_Elements.begin());
@@ -52,10 +52,7 @@ FixedSet<T, N>::FixedSet(initializer_list<T> elements) {
 **********************************************************************/
 template <typename T, size_t N>
 FixedSet<T, N>::FixedSet(const array<T, N>& elements) {
-    if (
-        N >= 2 &&
-        !this->IsDistinct(elements.begin(), elements.end())
-    ) {
+    if (!IsDistinctFixed(elements.data(), integral_constant<size_t, N>())) {
         throw CollectionException();
     }
     m_Elements = elements;
@@ -74,6 +71,176 @@ size_t FixedSet<T, N>::Count() const {
     return N;
 }
 
+/**********************************************************************
+【函数名称】 Get
+【函数功能】 获取指定下标处的元素。如果越界抛出 IndexOverflowException。
+【参数】
+    index: 元素下标。
+【返回值】
+    指定位置元素的常引用。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T, size_t N>
+const T& FixedSet<T, N>::Get(size_t index) const {
+    if (index >= N) {
+        throw IndexOverflowException();
+    }
+    return m_Elements[index];
+}
+
+/**********************************************************************
+【函数名称】 TrySet
+【函数功能】 
+    尝试设置指定位置元素的值，与其他元素重复时失败。
+    如果越界抛出 IndexOverflowException。
+【参数】
+    index: 元素下标。
+    value: 新的值。
+【返回值】
+    操作是否成功。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T, size_t N>
+bool FixedSet<T, N>::TrySet(size_t index, const T& value) {
+    if (index >= N) {
+        throw IndexOverflowException();
+    }
+    size_t found;
+    if (InnerFind(value, found) && found != index) {
+        return false;
+    }
+    m_Elements[index] = value;
+    return true;
+}
+
+/**********************************************************************
+【函数名称】 Set
+【函数功能】 
+    设置指定位置元素的值。
+    如果操作失败抛出 CollectionException。
+    如果越界抛出 IndexOverflowException。
+【参数】
+    index: 元素下标。
+    value: 新的值。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T, size_t N>
+void FixedSet<T, N>::Set(size_t index, const T& value) {
+    if (!TrySet(index, value)) {
+        throw CollectionException();
+    }
+}
+
+/**********************************************************************
+【函数名称】 Contains
+【函数功能】 判断给定的值是否在集合内。
+【参数】
+    element: 要进行判断的值。
+【返回值】
+    值是否在集合内。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T, size_t N>
+bool FixedSet<T, N>::Contains(const T& element) const {
+    size_t index;
+    return InnerFind(element, index);
+}
+
+/**********************************************************************
+【函数名称】 FindIndex
+【函数功能】 寻找给定值在集合中的下标。找不到则抛出 CollectionException。
+【参数】
+    element: 要寻找的值。
+【返回值】
+    集合中的下标。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T, size_t N>
+size_t FixedSet<T, N>::FindIndex(const T& element) const {
+    size_t index;
+    if (!InnerFind(element, index)) {
+        throw CollectionException();
+    }
+    return index;
+}
+
+/**********************************************************************
+【函数名称】 IsEqual
+【函数功能】 判断自身和另一集合是否按顺序相等。
+【参数】
+    other: 另一集合。
+【返回值】
+    两集合是否相等。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T, size_t N>
+bool FixedSet<T, N>::IsEqual(const FixedSet<T, N>& other) const {
+    return IsEqual(*this, other);
+}
+
+/**********************************************************************
+【函数名称】 IsEqual
+【函数功能】 判断两集合是否按顺序相等。
+【参数】
+    left: 第一个集合。
+    right: 第二个集合。
+【返回值】
+    两集合是否相等。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T, size_t N>
+bool FixedSet<T, N>::IsEqual(
+    const FixedSet<T, N>& left,
+    const FixedSet<T, N>& right
+) {
+    for (size_t i = 0; i < N; i++) {
+        if (left.m_Elements[i] != right.m_Elements[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**********************************************************************
+【函数名称】 IsEqualUnordered
+【函数功能】 判断自身与另一集合中元素是否一一对应。
+【参数】
+    other: 另一集合。
+【返回值】
+    元素是否一一对应。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T, size_t N>
+bool FixedSet<T, N>::IsEqualUnordered(const FixedSet<T, N>& other) const {
+    return IsEqualUnordered(*this, other);
+}
+
+/**********************************************************************
+【函数名称】 IsEqualUnordered
+【函数功能】 判断两个集合中元素是否一一对应。
+【参数】
+    left: 第一个集合。
+    right: 第二个集合。
+【返回值】
+    元素是否一一对应。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T, size_t N>
+bool FixedSet<T, N>::IsEqualUnordered(
+    const FixedSet<T, N>& left,
+    const FixedSet<T, N>& right
+) {
+    // 两集合大小相同且元素各不相同，左侧元素都在右侧即一一对应
+    size_t index;
+    for (auto& element: left.m_Elements) {
+        if (!right.InnerFind(element, index)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 /**********************************************************************
 【函数名称】 ToDynamic
 【函数功能】 将自身转化为 DynamicSet。
@@ -101,140 +268,165 @@ FixedSet<T, N>::operator DynamicSet<T>() const {
 }
 
 /**********************************************************************
-【函数名称】 begin
-【函数功能】 获取头部迭代器。
-【参数】 无
-【返回值】 
-    指向首个元素的迭代器。
-【开发者及日期】 赵一彤 2024/7/24
+【函数名称】 operator[]
+【函数功能】 获取指定下标处的元素。如果越界抛出 IndexOverflowException。
+【参数】
+    index: 元素下标。
+【返回值】
+    指定位置元素的常引用。
+【开发者及日期】 赵一彤 2026/10/17
 **********************************************************************/
 template <typename T, size_t N>
-typename array<T, N>::const_iterator FixedSet<T, N>::begin() const {
-    return m_Elements.cbegin();
+const T& FixedSet<T, N>::operator[](size_t index) const {
+    return Get(index);
 }
 
 /**********************************************************************
-【函数名称】 begin
-【函数功能】 获取尾部迭代器。
-【参数】 无
-【返回值】 
-    指向最后元素之后的迭代器。
-【开发者及日期】 赵一彤 2024/7/24
+【函数名称】 operator==
+【函数功能】 判断自身与另一集合中元素是否一一对应。
+【参数】
+    other: 另一集合。
+【返回值】
+    元素是否一一对应。
+【开发者及日期】 赵一彤 2026/10/17
 **********************************************************************/
 template <typename T, size_t N>
-typename array<T, N>::const_iterator FixedSet<T, N>::end() const {
-    return m_Elements.cend();
+bool FixedSet<T, N>::operator==(const FixedSet<T, N>& other) const {
+    return IsEqualUnordered(*this, other);
 }
 
 /**********************************************************************
-【函数名称】 InnerGet
-【函数功能】 无条件获取元素值。
-【参数】 
-    index: 要获取的下标。
-【返回值】 
-    指定位置元素的常引用。
-【开发者及日期】 赵一彤 2024/7/24
+【函数名称】 operator!=
+【函数功能】 判断自身与另一集合中元素是否不能一一对应。
+【参数】
+    other: 另一集合。
+【返回值】
+    元素是否不能一一对应。
+【开发者及日期】 赵一彤 2026/10/17
 **********************************************************************/
 template <typename T, size_t N>
-const T& FixedSet<T, N>::InnerGet(size_t index) const {
-    return m_Elements[index];
+bool FixedSet<T, N>::operator!=(const FixedSet<T, N>& other) const {
+    return !IsEqualUnordered(*this, other);
 }
 
 /**********************************************************************
-【函数名称】 InnerSet
-【函数功能】 无条件设置元素值。
-【参数】 
-    index: 要设置的下标。
-    value: 要设置的值。
-【返回值】 无
-【开发者及日期】 赵一彤 2024/7/24
+【函数名称】 ToString
+【函数功能】 返回此对象的字符串表达形式。
+【参数】 无
+【返回值】
+    此对象的字符串表达形式。
+【开发者及日期】 赵一彤 2026/10/17
 **********************************************************************/
 template <typename T, size_t N>
-void FixedSet<T, N>::InnerSet(size_t index, const T& value) {
-    m_Elements[index] = value;
+string FixedSet<T, N>::ToString() const {
+    ostringstream stream;
+    stream << "{";
+    for (size_t i = 0; i < N - 1; i++) {
+        stream << m_Elements[i] << ", ";
+    }
+    stream << m_Elements[N - 1] << "}";
+    return stream.str();
 }
 
 /**********************************************************************
-【函数名称】 ShouldAdd
-【函数功能】 判断是否应该添加元素。
-【参数】 
-    value: 要添加的值。
+【函数名称】 begin
+【函数功能】 获取头部迭代器。
+【参数】 无
 【返回值】 
-    是否应该添加元素。
+    指向首个元素的迭代器。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <typename T, size_t N>
-bool FixedSet<T, N>::ShouldAdd(const T& value) const {
-    return false;
+typename array<T, N>::const_iterator FixedSet<T, N>::begin() const {
+    return m_Elements.cbegin();
 }
 
 /**********************************************************************
-【函数名称】 InnerAdd
-【函数功能】 无条件添加元素。
-【参数】 
-    value: 要添加的值。
-【返回值】 无
+【函数名称】 begin
+【函数功能】 获取尾部迭代器。
+【参数】 无
+【返回值】 
+    指向最后元素之后的迭代器。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <typename T, size_t N>
-void FixedSet<T, N>::InnerAdd(const T& value) {
-    throw CollectionException();
+typename array<T, N>::const_iterator FixedSet<T, N>::end() const {
+    return m_Elements.cend();
 }
 
 /**********************************************************************
-【函数名称】 ShouldRemove
-【函数功能】 判断是否应该删除元素。
-【参数】 
-    index: 要删除的下标。
-【返回值】 
-    是否应该删除元素。
-【开发者及日期】 赵一彤 2024/7/24
+【函数名称】 InnerFind
+【函数功能】 逐个比较，查找给定值在集合中的下标。
+【参数】
+    element: 要查找的值。
+    index: 找到时被赋值为元素的下标。
+【返回值】
+    是否找到。
+【开发者及日期】 赵一彤 2026/10/17
 **********************************************************************/
 template <typename T, size_t N>
-bool FixedSet<T, N>::ShouldRemove(size_t index) const {
+bool FixedSet<T, N>::InnerFind(const T& element, size_t& index) const {
+    for (size_t i = 0; i < N; i++) {
+        if (m_Elements[i] == element) {
+            index = i;
+            return true;
+        }
+    }
     return false;
 }
 
 /**********************************************************************
-【函数名称】 InnerRemove
-【函数功能】 无条件删除元素。
+【函数名称】 IsDistinctFixed
+【函数功能】 展开比较，判断 2 个元素是否不同。
 【参数】 
-    index: 要删除的下标。
-【返回值】 无
-【开发者及日期】 赵一彤 2024/7/24
+    elements: 指向首个元素的指针。
+【返回值】 
+    是否没有重复元素。
+【开发者及日期】 赵一彤 2026/10/17
 **********************************************************************/
 template <typename T, size_t N>
-void FixedSet<T, N>::InnerRemove(size_t index) {
-    throw CollectionException();
+bool FixedSet<T, N>::IsDistinctFixed(
+    const T* elements,
+    integral_constant<size_t, 2>
+) {
+    return !(elements[0] == elements[1]);
 }
 
 /**********************************************************************
-【函数名称】 ShouldInsert
-【函数功能】 判断是否应该插入元素。
+【函数名称】 IsDistinctFixed
+【函数功能】 展开比较，判断 3 个元素是否互不相同。
 【参数】 
-    index: 要插入位置的下标。
-    element: 新的元素。
+    elements: 指向首个元素的指针。
 【返回值】 
-    是否应该插入元素。
-【开发者及日期】 赵一彤 2024/7/24
+    是否没有重复元素。
+【开发者及日期】 赵一彤 2026/10/17
 **********************************************************************/
 template <typename T, size_t N>
-bool FixedSet<T, N>::ShouldInsert(size_t index, const T& element) const {
-    return false;
+bool FixedSet<T, N>::IsDistinctFixed(
+    const T* elements,
+    integral_constant<size_t, 3>
+) {
+    return !(elements[0] == elements[1]) &&
+        !(elements[0] == elements[2]) &&
+        !(elements[1] == elements[2]);
 }
 
 /**********************************************************************
-【函数名称】 InnerInsert
-【函数功能】 无条件插入元素。
+【函数名称】 IsDistinctFixed
+【函数功能】 其他大小使用 DistinctCollection::IsDistinct。
 【参数】 
-    index: 要插入位置的下标。
-    element: 新的元素。
-【返回值】 无
-【开发者及日期】 赵一彤 2024/7/24
+    elements: 指向首个元素的指针。
+【返回值】 
+    是否没有重复元素。
+【开发者及日期】 赵一彤 2026/10/17
 **********************************************************************/
 template <typename T, size_t N>
-void FixedSet<T, N>::InnerInsert(size_t index, const T& element) {
-    throw CollectionException();
+template <size_t M>
+bool FixedSet<T, N>::IsDistinctFixed(
+    const T* elements,
+    integral_constant<size_t, M>
+) {
+    return DistinctCollection<T>::IsDistinct(elements, elements + M);
 }
 
 }
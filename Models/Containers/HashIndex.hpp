@@ -0,0 +1,171 @@
+/*************************************************************************
+【文件名】 HashIndex.hpp
+【功能模块和目的】 HashIndex 类为一段连续存放的元素建立临时的哈希索引。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+using namespace std;
+
+namespace C3w {
+
+namespace Containers {
+
+/*************************************************************************
+【类名】 IsHashable
+【功能】 判断类型是否可以用 std::hash 求哈希值。
+【接口说明】 继承于 true_type 或 false_type。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+template <typename T, typename = void>
+struct IsHashable: false_type {};
+template <typename T>
+struct IsHashable<
+    T,
+    decltype((void)hash<T>()(declval<const T&>()))
+>: true_type {};
+
+/*************************************************************************
+【类名】 HashIndex
+【功能】
+    为随机访问迭代器指向的一段元素建立线性探测的开放寻址哈希表。
+    表中只存放哈希值与元素下标，不复制元素，哈希值相同时才比较元素；
+    容量在构造时按元素个数确定，负载因子不超过 1/2，不会扩容。
+    用于一次性的成员判断，如判断重复元素与集合运算。
+【接口说明】 加入元素的下标，判断是否包含或查找与给定值相等的元素。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+template <typename T>
+class HashIndex final {
+    public:
+        // 构造函数
+
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 初始化最多容纳 count 个下标的空索引。
+        【参数】
+            count: 最多加入的下标个数，加入更多时行为未定义。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        explicit HashIndex(size_t count);
+        /**********************************************************************
+        【函数名称】 拷贝构造函数
+        【函数功能】 使用另一 HashIndex 初始化 HashIndex 类型实例。
+        【参数】
+            other: 另一 HashIndex 实例。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        HashIndex(const HashIndex<T>& other) = default;
+
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 TryInsert
+        【函数功能】 若索引中没有与 elements[index] 相等的元素则加入其下标。
+        【参数】
+            elements: 指向首个元素的迭代器，每次调用可以不同，
+                但已加入的下标须仍指向原来的元素。
+            index: 要加入的元素的下标。
+        【返回值】
+            是否加入，即此前是否没有相等的元素。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        template <typename It>
+        bool TryInsert(It elements, size_t index);
+        /**********************************************************************
+        【函数名称】 Contains
+        【函数功能】 判断索引中是否有与给定值相等的元素。
+        【参数】
+            elements: 指向首个元素的迭代器。
+            value: 要查找的值。
+        【返回值】
+            是否找到。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        template <typename It>
+        bool Contains(It elements, const T& value) const;
+        /**********************************************************************
+        【函数名称】 Find
+        【函数功能】 查找索引中与给定值相等的元素。
+        【参数】
+            elements: 指向首个元素的迭代器。
+            value: 要查找的值。
+            index: 找到时被赋值为元素的下标。
+        【返回值】
+            是否找到。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        template <typename It>
+        bool Find(It elements, const T& value, size_t& index) const;
+
+        // 操作符
+
+        /**********************************************************************
+        【函数名称】 operator=
+        【函数功能】 将另一 HashIndex 赋值给自身。
+        【参数】
+            other: 从之取值的 HashIndex。
+        【返回值】
+            自身的引用。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        HashIndex<T>& operator=(const HashIndex<T>& other) = default;
+
+    private:
+        /**********************************************************************
+        【类名】 Slot
+        【功能】 哈希表中的一格。
+        【接口说明】 打散后的哈希值，元素下标加 1，0 表示空格。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        struct Slot {
+            // 打散后的哈希值
+            size_t Hash;
+            // 元素下标加 1，0 表示空格
+            size_t Index;
+        };
+
+        // 哈希表，容量为 2 的幂
+        vector<Slot> m_Slots;
+        // 容量减 1，用于取模
+        size_t m_Mask;
+
+        /**********************************************************************
+        【函数名称】 Probe
+        【函数功能】 从哈希值对应的位置开始探测，直到空格或相等的元素。
+        【参数】
+            elements: 指向首个元素的迭代器。
+            value: 要查找的值。
+            code: 打散后的哈希值。
+            found: 返回是否找到相等的元素。
+        【返回值】
+            找到时为相等元素所在的格，否则为探测到的空格。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        template <typename It>
+        size_t Probe(It elements, const T& value, size_t code, bool& found) const;
+        /**********************************************************************
+        【函数名称】 GetHashCode
+        【函数功能】 求值的哈希值并打散，避免恒等哈希在线性探测下聚集。
+        【参数】
+            value: 要求哈希值的值。
+        【返回值】
+            打散后的哈希值。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static size_t GetHashCode(const T& value);
+};
+
+}
+
+}
+
+#include "HashIndex.tpp"
\ No newline at end of file
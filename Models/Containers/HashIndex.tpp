@@ -0,0 +1,151 @@
+/*************************************************************************
+【文件名】 HashIndex.tpp
+【功能模块和目的】 为 HashIndex.hpp 提供实现。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+#include "HashIndex.hpp"
+#include "../Tools/Hash.hpp"
+using namespace std;
+
+namespace C3w {
+
+namespace Containers {
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 初始化最多容纳 count 个下标的空索引。
+【参数】
+    count: 最多加入的下标个数，加入更多时行为未定义。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+HashIndex<T>::HashIndex(size_t count) {
+    // 容量为不小于 2n 的 2 的幂，至少为 2，保证总有空格
+    size_t capacity = 2;
+    while (capacity < count * 2) {
+        capacity <<= 1;
+    }
+    m_Slots.assign(capacity, Slot { 0, 0 });
+    m_Mask = capacity - 1;
+}
+
+/**********************************************************************
+【函数名称】 TryInsert
+【函数功能】 若索引中没有与 elements[index] 相等的元素则加入其下标。
+【参数】
+    elements: 指向首个元素的迭代器，每次调用可以不同，
+        但已加入的下标须仍指向原来的元素。
+    index: 要加入的元素的下标。
+【返回值】
+    是否加入，即此前是否没有相等的元素。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+template <typename It>
+bool HashIndex<T>::TryInsert(It elements, size_t index) {
+    auto& value = elements[index];
+    size_t code = GetHashCode(value);
+    bool found;
+    size_t position = Probe(elements, value, code, found);
+    if (found) {
+        return false;
+    }
+    m_Slots[position] = Slot { code, index + 1 };
+    return true;
+}
+
+/**********************************************************************
+【函数名称】 Contains
+【函数功能】 判断索引中是否有与给定值相等的元素。
+【参数】
+    elements: 指向首个元素的迭代器。
+    value: 要查找的值。
+【返回值】
+    是否找到。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+template <typename It>
+bool HashIndex<T>::Contains(It elements, const T& value) const {
+    bool found;
+    Probe(elements, value, GetHashCode(value), found);
+    return found;
+}
+
+/**********************************************************************
+【函数名称】 Find
+【函数功能】 查找索引中与给定值相等的元素。
+【参数】
+    elements: 指向首个元素的迭代器。
+    value: 要查找的值。
+    index: 找到时被赋值为元素的下标。
+【返回值】
+    是否找到。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+template <typename It>
+bool HashIndex<T>::Find(It elements, const T& value, size_t& index) const {
+    bool found;
+    size_t position = Probe(elements, value, GetHashCode(value), found);
+    if (found) {
+        index = m_Slots[position].Index - 1;
+    }
+    return found;
+}
+
+/**********************************************************************
+【函数名称】 Probe
+【函数功能】 从哈希值对应的位置开始探测，直到空格或相等的元素。
+【参数】
+    elements: 指向首个元素的迭代器。
+    value: 要查找的值。
+    code: 打散后的哈希值。
+    found: 返回是否找到相等的元素。
+【返回值】
+    找到时为相等元素所在的格，否则为探测到的空格。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+template <typename It>
+size_t HashIndex<T>::Probe(
+    It elements,
+    const T& value,
+    size_t code,
+    bool& found
+) const {
+    size_t position = code & m_Mask;
+    while (m_Slots[position].Index != 0) {
+        auto& slot = m_Slots[position];
+        if (slot.Hash == code && elements[slot.Index - 1] == value) {
+            found = true;
+            return position;
+        }
+        position = (position + 1) & m_Mask;
+    }
+    found = false;
+    return position;
+}
+
+/**********************************************************************
+【函数名称】 GetHashCode
+【函数功能】 求值的哈希值并打散，避免恒等哈希在线性探测下聚集。
+【参数】
+    value: 要求哈希值的值。
+【返回值】
+    打散后的哈希值。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+size_t HashIndex<T>::GetHashCode(const T& value) {
+    return Tools::MixHash(hash<T>()(value));
+}
+
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,327 @@
+/*************************************************************************
+【文件名】 HashedSet.hpp
+【功能模块和目的】 HashedSet 类定义了一个带哈希索引的动态大小的集合。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <unordered_map>
+#include <vector>
+#include "DynamicSet.hpp"
+#include "StaticCollection.hpp"
+using namespace std;
+
+namespace C3w {
+
+namespace Containers {
+
+/*************************************************************************
+【类名】 HashedSet
+【功能】
+    定义一个元素类型为 T 的、带哈希索引的动态大小的集合。
+    元素仍按插入顺序存储，下标语义与 DynamicSet 相同，
+    但查找、去重检查的平均复杂度为 O(1)。T 须特化 std::hash。
+    索引记录槽位，以墓碑方式删除时无需改写其余条目。
+    经由 StaticCollection 静态分派，查找不经过虚函数表。
+【接口说明】 与 DynamicSet 相同。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+template <typename T>
+class HashedSet final:
+    public StaticCollection<HashedSet<T>, T, DynamicSet<T>> {
+    // 静态分派的公开接口需要访问 Inner 系列函数
+    friend class StaticCollection<HashedSet<T>, T, DynamicSet<T>>;
+
+    public:
+        // 构造函数
+
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 初始化空的 HashedSet 类型实例。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        HashedSet() = default;
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】
+            使用初始化列表初始化 HashedSet 类型实例。
+            如果有重复元素抛出 CollectionException。
+        【参数】
+            elements: 元素初始化列表。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        HashedSet(initializer_list<T> elements);
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】
+            使用 std::vector<T> 初始化 HashedSet 类型实例。
+            如果有重复元素抛出 CollectionException。
+        【参数】
+            elements: 元素组成的向量。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        HashedSet(const vector<T>& elements);
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】
+            取走 std::vector<T> 的存储初始化 HashedSet 类型实例。
+            如果有重复元素抛出 CollectionException。
+        【参数】
+            elements: 元素组成的向量，成功后为空。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        HashedSet(vector<T>&& elements);
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 使用 DynamicSet 初始化 HashedSet 类型实例。
+        【参数】
+            other: 一个 DynamicSet 实例。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        HashedSet(const DynamicSet<T>& other);
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 取走 DynamicSet 的存储初始化 HashedSet 类型实例。
+        【参数】
+            other: 一个 DynamicSet 实例，之后为空。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        HashedSet(DynamicSet<T>&& other);
+        /**********************************************************************
+        【函数名称】 拷贝构造函数
+        【函数功能】 使用另一 HashedSet 初始化 HashedSet 类的实例。
+        【参数】
+            other: 另一 HashedSet 实例。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        HashedSet(const HashedSet<T>& other) = default;
+        /**********************************************************************
+        【函数名称】 移动构造函数
+        【函数功能】 取走另一 HashedSet 的元素与索引初始化 HashedSet 类的实例。
+        【参数】
+            other: 另一 HashedSet 实例，之后为空。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        HashedSet(HashedSet<T>&& other) = default;
+
+        // 操作符
+
+        /**********************************************************************
+        【函数名称】 operator=
+        【函数功能】 将其他集合赋值给自身。
+        【参数】
+            other: 从之取值的集合。
+        【返回值】
+            自身的引用。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        HashedSet<T>& operator=(const HashedSet<T>& other) = default;
+        /**********************************************************************
+        【函数名称】 operator=
+        【函数功能】 取走其他集合的元素与索引。
+        【参数】
+            other: 从之取值的集合，之后为空。
+        【返回值】
+            自身的引用。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        HashedSet<T>& operator=(HashedSet<T>&& other) = default;
+
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 TryAddHashed
+        【函数功能】
+            以事先算好的哈希值添加元素，取走其内容，不再计算哈希值。
+            供在其他线程中预先计算哈希值的调用者使用。
+        【参数】
+            value: 要添加的值。
+            code: value 的哈希值，须与 hash<T>()(value) 相等。
+        【返回值】
+            是否添加，即此前是否没有相等的元素。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        bool TryAddHashed(T&& value, size_t code);
+
+    protected:
+        /**********************************************************************
+        【函数名称】 InnerFind
+        【函数功能】 借助哈希索引查找给定值在集合中的下标。
+        【参数】
+            element: 要查找的值。
+            index: 找到时被赋值为元素的下标。
+        【返回值】
+            是否找到。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        bool InnerFind(const T& element, size_t& index) const override;
+        /**********************************************************************
+        【函数名称】 InnerSet
+        【函数功能】 无条件设置元素值，并更新索引。
+        【参数】
+            index: 要设置的下标。
+            value: 要设置的值。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void InnerSet(size_t index, const T& value) override;
+        /**********************************************************************
+        【函数名称】 InnerAdd
+        【函数功能】 无条件添加元素，并更新索引。
+        【参数】
+            value: 要添加的值。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void InnerAdd(const T& value) override;
+        /**********************************************************************
+        【函数名称】 InnerAdd
+        【函数功能】 无条件添加元素，取走其内容，并更新索引。
+        【参数】
+            value: 要添加的值。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void InnerAdd(T&& value) override;
+        /**********************************************************************
+        【函数名称】 InnerRemove
+        【函数功能】 无条件删除元素，并更新索引。
+        【参数】
+            index: 要删除的下标。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void InnerRemove(size_t index) override;
+        /**********************************************************************
+        【函数名称】 InnerInsert
+        【函数功能】 无条件插入元素，并更新索引。
+        【参数】
+            index: 要插入位置的下标。
+            element: 新的元素。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void InnerInsert(size_t index, const T& element) override;
+        /**********************************************************************
+        【函数名称】 InnerReplace
+        【函数功能】 无条件将全部元素替换为另一集合的元素，并重建索引。
+        【参数】
+            other: 提供新元素的集合。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void InnerReplace(const DynamicSet<T>& other) override;
+        /**********************************************************************
+        【函数名称】 InnerReplace
+        【函数功能】 无条件取走另一集合的存储作为全部元素，并重建索引。
+        【参数】
+            other: 提供新元素的集合，之后为空。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void InnerReplace(DynamicSet<T>&& other) override;
+        /**********************************************************************
+        【函数名称】 InnerRebuild
+        【函数功能】
+            元素被原地修改后重建哈希索引，
+            并在插入索引的同时检查元素是否仍互不相同。
+        【参数】 无
+        【返回值】
+            元素是否仍互不相同。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        bool InnerRebuild() override;
+        /**********************************************************************
+        【函数名称】 InnerRetain
+        【函数功能】
+            无条件删除未标记保留的元素，并就地改写哈希索引中的下标，
+            不重新计算哈希值。
+        【参数】 
+            isKept: 每个元素是否保留，长度与元素个数相同。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void InnerRetain(const vector<bool>& isKept) override;
+        /**********************************************************************
+        【函数名称】 InnerReserve
+        【函数功能】 为即将逐个添加的元素预留元素与哈希索引的空间。
+        【参数】 
+            count: 添加后的元素总数。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void InnerReserve(size_t count) override;
+        /**********************************************************************
+        【函数名称】 InnerRevive
+        【函数功能】 无条件恢复已删除的槽位，并重新加入索引。
+        【参数】
+            slot: 已删除的槽位。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void InnerRevive(size_t slot) override;
+
+    private:
+        // 哈希值到槽位的索引，没有已删除的槽位时槽位即下标
+        unordered_multimap<size_t, size_t> m_Index;
+
+        /**********************************************************************
+        【函数名称】 UnindexAt
+        【函数功能】 从索引中移除指定槽位中元素的条目。
+        【参数】
+            slot: 元素所在的槽位。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void UnindexAt(size_t slot);
+        /**********************************************************************
+        【函数名称】 ShiftIndices
+        【函数功能】 将索引中不小于 from 的下标加上 delta。
+        【参数】
+            from: 起始下标。
+            delta: 要加上的值，可以为负。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void ShiftIndices(size_t from, ptrdiff_t delta);
+        /**********************************************************************
+        【函数名称】 IndexAll
+        【函数功能】 清空索引并为全部元素重新建立索引，不检查重复。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void IndexAll();
+        /**********************************************************************
+        【函数名称】 AddAll
+        【函数功能】
+            逐个添加迭代器中的元素。
+            如果有重复元素抛出 CollectionException。
+        【参数】
+            begin: 头部迭代器。
+            end: 尾部迭代器。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        template <typename It>
+        void AddAll(It begin, It end);
+};
+
+}
+
+}
+
+#include "HashedSet.tpp"
\ No newline at end of file
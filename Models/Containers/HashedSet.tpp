@@ -0,0 +1,432 @@
+/*************************************************************************
+【文件名】 HashedSet.tpp
+【功能模块和目的】 为 HashedSet.hpp 提供实现。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "DynamicSet.hpp"
+#include "HashedSet.hpp"
+#include "StaticCollection.hpp"
+#include "../Core/Errors.hpp"
+using namespace std;
+using namespace C3w::Errors;
+
+namespace C3w {
+
+namespace Containers {
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】
+    使用初始化列表初始化 HashedSet 类型实例。
+    如果有重复元素抛出 CollectionException。
+【参数】
+    elements: 元素初始化列表。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+HashedSet<T>::HashedSet(initializer_list<T> elements) {
+    AddAll(elements.begin(), elements.end());
+}
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】
+    使用 std::vector<T> 初始化 HashedSet 类型实例。
+    如果有重复元素抛出 CollectionException。
+【参数】
+    elements: 元素组成的向量。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+HashedSet<T>::HashedSet(const vector<T>& elements) {
+    AddAll(elements.begin(), elements.end());
+}
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】
+    取走 std::vector<T> 的存储初始化 HashedSet 类型实例。
+    如果有重复元素抛出 CollectionException。
+【参数】
+    elements: 元素组成的向量，成功后为空。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+HashedSet<T>::HashedSet(vector<T>&& elements) {
+    // DynamicSet 的构造函数一次性检查重复，之后元素不再复制
+    InnerReplace(DynamicSet<T>(move(elements)));
+}
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 使用 DynamicSet 初始化 HashedSet 类型实例。
+【参数】
+    other: 一个 DynamicSet 实例。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+HashedSet<T>::HashedSet(const DynamicSet<T>& other) {
+    InnerReplace(other);
+}
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 取走 DynamicSet 的存储初始化 HashedSet 类型实例。
+【参数】
+    other: 一个 DynamicSet 实例，之后为空。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+HashedSet<T>::HashedSet(DynamicSet<T>&& other) {
+    InnerReplace(move(other));
+}
+
+/**********************************************************************
+【函数名称】 TryAddHashed
+【函数功能】
+    以事先算好的哈希值添加元素，取走其内容，不再计算哈希值。
+    供在其他线程中预先计算哈希值的调用者使用。
+【参数】
+    value: 要添加的值。
+    code: value 的哈希值，须与 hash<T>()(value) 相等。
+【返回值】
+    是否添加，即此前是否没有相等的元素。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+bool HashedSet<T>::TryAddHashed(T&& value, size_t code) {
+    auto range = m_Index.equal_range(code);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (this->GetAtSlot(it->second) == value) {
+            return false;
+        }
+    }
+    size_t slot = this->GetSlotCount();
+    DynamicSet<T>::InnerAdd(move(value));
+    m_Index.insert({ code, slot });
+    return true;
+}
+
+/**********************************************************************
+【函数名称】 InnerFind
+【函数功能】 借助哈希索引查找给定值在集合中的下标。
+【参数】
+    element: 要查找的值。
+    index: 找到时被赋值为元素的下标。
+【返回值】
+    是否找到。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+bool HashedSet<T>::InnerFind(const T& element, size_t& index) const {
+    // 索引中存放的是槽位，已删除的槽位不在索引中
+    auto range = m_Index.equal_range(hash<T>()(element));
+    for (auto it = range.first; it != range.second; ++it) {
+        if (this->GetAtSlot(it->second) == element) {
+            index = this->GetIndexOfSlot(it->second);
+            return true;
+        }
+    }
+    return false;
+}
+
+/**********************************************************************
+【函数名称】 InnerSet
+【函数功能】 无条件设置元素值，并更新索引。
+【参数】
+    index: 要设置的下标。
+    value: 要设置的值。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+void HashedSet<T>::InnerSet(size_t index, const T& value) {
+    auto slot = this->FindSlot(index);
+    UnindexAt(slot);
+    DynamicSet<T>::InnerSet(index, value);
+    m_Index.insert({ hash<T>()(value), slot });
+}
+
+/**********************************************************************
+【函数名称】 InnerAdd
+【函数功能】 无条件添加元素，并更新索引。
+【参数】
+    value: 要添加的值。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+void HashedSet<T>::InnerAdd(const T& value) {
+    size_t slot = this->GetSlotCount();
+    DynamicSet<T>::InnerAdd(value);
+    m_Index.insert({ hash<T>()(value), slot });
+}
+
+/**********************************************************************
+【函数名称】 InnerAdd
+【函数功能】 无条件添加元素，取走其内容，并更新索引。
+【参数】
+    value: 要添加的值。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+void HashedSet<T>::InnerAdd(T&& value) {
+    size_t slot = this->GetSlotCount();
+    // 取走内容之前先计算哈希值
+    auto code = hash<T>()(value);
+    DynamicSet<T>::InnerAdd(move(value));
+    m_Index.insert({ code, slot });
+}
+
+/**********************************************************************
+【函数名称】 InnerRemove
+【函数功能】 无条件删除元素，并更新索引。
+【参数】
+    index: 要删除的下标。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+void HashedSet<T>::InnerRemove(size_t index) {
+    if (this->IsTombstoned()) {
+        // 只标记槽位，其余元素的槽位不变，索引无需改写
+        UnindexAt(this->FindSlot(index));
+        DynamicSet<T>::InnerRemove(index);
+        return;
+    }
+    UnindexAt(index);
+    DynamicSet<T>::InnerRemove(index);
+    // 后方元素前移，与 vector::erase 的代价同阶
+    ShiftIndices(index + 1, -1);
+}
+
+/**********************************************************************
+【函数名称】 InnerInsert
+【函数功能】 无条件插入元素，并更新索引。
+【参数】
+    index: 要插入位置的下标。
+    element: 新的元素。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+void HashedSet<T>::InnerInsert(size_t index, const T& element) {
+    // 先压缩，使索引中的槽位与下标相同
+    this->Compact();
+    ShiftIndices(index, 1);
+    DynamicSet<T>::InnerInsert(index, element);
+    m_Index.insert({ hash<T>()(element), index });
+}
+
+/**********************************************************************
+【函数名称】 InnerReplace
+【函数功能】 无条件将全部元素替换为另一集合的元素，并重建索引。
+【参数】
+    other: 提供新元素的集合。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+void HashedSet<T>::InnerReplace(const DynamicSet<T>& other) {
+    DynamicSet<T>::InnerReplace(other);
+    IndexAll();
+}
+
+/**********************************************************************
+【函数名称】 InnerReplace
+【函数功能】 无条件取走另一集合的存储作为全部元素，并重建索引。
+【参数】
+    other: 提供新元素的集合，之后为空。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+void HashedSet<T>::InnerReplace(DynamicSet<T>&& other) {
+    DynamicSet<T>::InnerReplace(move(other));
+    IndexAll();
+}
+
+/**********************************************************************
+【函数名称】 InnerRebuild
+【函数功能】
+    元素被原地修改后重建哈希索引，
+    并在插入索引的同时检查元素是否仍互不相同。
+【参数】 无
+【返回值】
+    元素是否仍互不相同。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+bool HashedSet<T>::InnerRebuild() {
+    m_Index.clear();
+    auto count = this->Count();
+    m_Index.reserve(count);
+    bool isDistinct = true;
+    for (size_t i = 0; i < count; i++) {
+        auto& element = this->InnerGet(i);
+        auto code = hash<T>()(element);
+        // 只需与哈希值相同的元素比较
+        auto range = m_Index.equal_range(code);
+        for (auto it = range.first; isDistinct && it != range.second; ++it) {
+            if (this->InnerGet(it->second) == element) {
+                isDistinct = false;
+            }
+        }
+        m_Index.insert({ code, i });
+    }
+    return isDistinct;
+}
+
+/**********************************************************************
+【函数名称】 InnerRetain
+【函数功能】
+    无条件删除未标记保留的元素，并就地改写哈希索引中的下标，
+    不重新计算哈希值。
+【参数】 
+    isKept: 每个元素是否保留，长度与元素个数相同。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+void HashedSet<T>::InnerRetain(const vector<bool>& isKept) {
+    // 保留的元素的新下标，删除的元素为 NONE
+    const size_t NONE = static_cast<size_t>(-1);
+    vector<size_t> newIndices(isKept.size(), NONE);
+    size_t count = 0;
+    for (size_t i = 0; i < isKept.size(); i++) {
+        if (isKept[i]) {
+            newIndices[i] = count++;
+        }
+    }
+    DynamicSet<T>::InnerRetain(isKept);
+    for (auto it = m_Index.begin(); it != m_Index.end();) {
+        auto index = newIndices[it->second];
+        if (index == NONE) {
+            it = m_Index.erase(it);
+        }
+        else {
+            it->second = index;
+            ++it;
+        }
+    }
+}
+
+/**********************************************************************
+【函数名称】 InnerReserve
+【函数功能】 为即将逐个添加的元素预留元素与哈希索引的空间。
+【参数】 
+    count: 添加后的元素总数。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+void HashedSet<T>::InnerReserve(size_t count) {
+    DynamicSet<T>::InnerReserve(count);
+    m_Index.reserve(count);
+}
+
+/**********************************************************************
+【函数名称】 InnerRevive
+【函数功能】 无条件恢复已删除的槽位，并重新加入索引。
+【参数】
+    slot: 已删除的槽位。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+void HashedSet<T>::InnerRevive(size_t slot) {
+    DynamicSet<T>::InnerRevive(slot);
+    m_Index.insert({ hash<T>()(this->GetAtSlot(slot)), slot });
+}
+
+/**********************************************************************
+【函数名称】 UnindexAt
+【函数功能】 从索引中移除指定槽位中元素的条目。
+【参数】
+    slot: 元素所在的槽位。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+void HashedSet<T>::UnindexAt(size_t slot) {
+    auto range = m_Index.equal_range(hash<T>()(this->GetAtSlot(slot)));
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second == slot) {
+            m_Index.erase(it);
+            return;
+        }
+    }
+}
+
+/**********************************************************************
+【函数名称】 ShiftIndices
+【函数功能】 将索引中不小于 from 的下标加上 delta。
+【参数】
+    from: 起始下标。
+    delta: 要加上的值，可以为负。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+void HashedSet<T>::ShiftIndices(size_t from, ptrdiff_t delta) {
+    for (auto& pair: m_Index) {
+        if (pair.second >= from) {
+            pair.second += delta;
+        }
+    }
+}
+
+/**********************************************************************
+【函数名称】 IndexAll
+【函数功能】 清空索引并为全部元素重新建立索引，不检查重复。
+【参数】 无
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+void HashedSet<T>::IndexAll() {
+    m_Index.clear();
+    auto count = this->Count();
+    m_Index.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        m_Index.insert({ hash<T>()(this->InnerGet(i)), i });
+    }
+}
+
+/**********************************************************************
+【函数名称】 AddAll
+【函数功能】
+    逐个添加迭代器中的元素。
+    如果有重复元素抛出 CollectionException。
+【参数】
+    begin: 头部迭代器。
+    end: 尾部迭代器。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+template <typename It>
+void HashedSet<T>::AddAll(It begin, It end) {
+    for (auto it = begin; it != end; ++it) {
+        if (!this->TryAdd(*it)) {
+            throw CollectionException();
+        }
+    }
+}
+
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,296 @@
+/*************************************************************************
+【文件名】 StaticCollection.hpp
+【功能模块和目的】 StaticCollection 类为具体集合提供静态分派的公开接口。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include "DistinctCollection.hpp"
+using namespace std;
+
+namespace C3w {
+
+namespace Containers {
+
+/*************************************************************************
+【类名】 StaticCollection
+【功能】
+    以 CRTP 方式插在 Base 与具体集合 Derived 之间，
+    重新声明 CollectionBase 与 DistinctCollection 的公开接口，
+    通过 Derived 类型而非基类指针调用 Count、InnerGet、InnerFind 等函数。
+    Derived 为 final 类或相应函数为 final 时，编译器可直接调用乃至内联，
+    循环中的元素访问不再经过虚函数表。
+    经由 CollectionBase 的引用访问时仍使用原有的虚函数接口，二者语义相同。
+【接口说明】
+    与 CollectionBase 同名的获取/设置/添加/删除/插入/查找操作，
+    以及与 DistinctCollection 相同的无序比较。
+    Derived 须声明本类为友元，Base 须派生自 DistinctCollection<T>。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+template <typename Derived, typename T, typename Base>
+class StaticCollection: public Base {
+    static_assert(
+        is_base_of<DistinctCollection<T>, Base>::value,
+        "Base must derive from DistinctCollection<T>"
+    );
+
+    public:
+        // 构造函数
+
+        // 继承 Base 的构造函数
+        using Base::Base;
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 初始化 StaticCollection 类型实例。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        StaticCollection() = default;
+
+        // 访问器
+
+        /**********************************************************************
+        【函数名称】 Get
+        【函数功能】 获取指定下标处的元素。如果越界抛出 IndexOverflowException。
+        【参数】
+            index: 元素下标。
+        【返回值】
+            指定位置元素的常引用。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        const T& Get(size_t index) const;
+        /**********************************************************************
+        【函数名称】 TrySet
+        【函数功能】 尝试设置指定位置元素的值。如果越界抛出 IndexOverflowException。
+        【参数】
+            index: 元素下标。
+            value: 新的值。
+        【返回值】
+            操作是否成功。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        bool TrySet(size_t index, const T& value);
+        /**********************************************************************
+        【函数名称】 Set
+        【函数功能】
+            设置指定位置元素的值。
+            如果操作失败抛出 CollectionException。
+            如果越界抛出 IndexOverflowException。
+        【参数】
+            index: 元素下标。
+            value: 新的值。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void Set(size_t index, const T& value);
+
+        // 操作
+
+        // 保留 Base 中接受任意容器的比较
+        using Base::IsEqual;
+        using Base::IsEqualUnordered;
+        /**********************************************************************
+        【函数名称】 IsEqual
+        【函数功能】 判断自身和另一同类集合是否按顺序相等。
+        【参数】
+            other: 另一集合。
+        【返回值】
+            两集合是否相等。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        bool IsEqual(const Derived& other) const;
+        /**********************************************************************
+        【函数名称】 IsEqualUnordered
+        【函数功能】 判断自身与另一同类集合中元素是否一一对应。
+        【参数】
+            other: 另一集合。
+        【返回值】
+            元素是否一一对应。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        bool IsEqualUnordered(const Derived& other) const;
+        /**********************************************************************
+        【函数名称】 TryAdd
+        【函数功能】 尝试添加一个元素。
+        【参数】
+            element: 新的元素。
+        【返回值】
+            操作是否成功。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        bool TryAdd(const T& element);
+        /**********************************************************************
+        【函数名称】 Add
+        【函数功能】 添加一个元素。如果操作失败抛出 CollectionException。
+        【参数】
+            element: 新的元素。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void Add(const T& element);
+        /**********************************************************************
+        【函数名称】 TryAdd
+        【函数功能】 尝试添加一个元素，成功时取走其内容。
+        【参数】
+            element: 新的元素，失败时保持不变。
+        【返回值】
+            操作是否成功。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        bool TryAdd(T&& element);
+        /**********************************************************************
+        【函数名称】 Add
+        【函数功能】
+            添加一个元素，取走其内容。
+            如果操作失败抛出 CollectionException。
+        【参数】
+            element: 新的元素。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void Add(T&& element);
+        /**********************************************************************
+        【函数名称】 TryEmplace
+        【函数功能】 以给定参数构造一个元素并尝试添加，元素直接移入集合。
+        【参数】
+            args: 元素构造函数的参数。
+        【返回值】
+            操作是否成功。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        template <typename... Args>
+        bool TryEmplace(Args&&... args);
+        /**********************************************************************
+        【函数名称】 TryRemove
+        【函数功能】 删除指定位置元素。如果越界抛出 IndexOverflowException。
+        【参数】
+            index: 元素下标。
+        【返回值】
+            操作是否成功。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        bool TryRemove(size_t index);
+        /**********************************************************************
+        【函数名称】 Remove
+        【函数功能】
+            删除指定位置元素。
+            如果操作失败抛出 CollectionException。
+            如果越界抛出 IndexOverflowException。
+        【参数】
+            index: 元素下标。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void Remove(size_t index);
+        /**********************************************************************
+        【函数名称】 TryInsert
+        【函数功能】 将指定元素插入集合。如果越界抛出 IndexOverflowException。
+        【参数】
+            index: 元素被插入位置的下标。
+            element: 新的元素。
+        【返回值】
+            操作是否成功。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        bool TryInsert(size_t index, const T& element);
+        /**********************************************************************
+        【函数名称】 Insert
+        【函数功能】
+            将指定元素插入集合。
+            如果操作失败抛出 CollectionException。
+            如果越界抛出 IndexOverflowException。
+        【参数】
+            index: 元素被插入位置的下标。
+            element: 新的元素。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void Insert(size_t index, const T& element);
+        /**********************************************************************
+        【函数名称】 Contains
+        【函数功能】 判断给定的值是否在集合内。
+        【参数】
+            element: 要进行判断的值。
+        【返回值】
+            值是否在集合内。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        bool Contains(const T& element) const;
+        /**********************************************************************
+        【函数名称】 FindIndex
+        【函数功能】 寻找给定值在集合中的下标。找不到则抛出 CollectionException。
+        【参数】
+            element: 要寻找的值。
+        【返回值】
+            集合中的下标。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        size_t FindIndex(const T& element) const;
+
+        // 操作符
+
+        // 保留 Base 中接受任意容器的比较
+        using Base::operator==;
+        using Base::operator!=;
+        /**********************************************************************
+        【函数名称】 operator[]
+        【函数功能】 获取指定下标处的元素。如果越界抛出 IndexOverflowException。
+        【参数】
+            index: 元素下标。
+        【返回值】
+            指定位置元素的常引用。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        const T& operator[](size_t index) const;
+        /**********************************************************************
+        【函数名称】 operator==
+        【函数功能】 判断自身与另一同类集合中元素是否一一对应。
+        【参数】
+            other: 另一集合。
+        【返回值】
+            元素是否一一对应。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        bool operator==(const Derived& other) const;
+        /**********************************************************************
+        【函数名称】 operator!=
+        【函数功能】 判断自身与另一同类集合中元素是否不能一一对应。
+        【参数】
+            other: 另一集合。
+        【返回值】
+            元素是否不能一一对应。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        bool operator!=(const Derived& other) const;
+
+    private:
+        /**********************************************************************
+        【函数名称】 Self
+        【函数功能】 将自身转换为 Derived 类型。
+        【参数】 无
+        【返回值】
+            自身作为 Derived 的常引用。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        const Derived& Self() const;
+        /**********************************************************************
+        【函数名称】 Self
+        【函数功能】 将自身转换为 Derived 类型。
+        【参数】 无
+        【返回值】
+            自身作为 Derived 的引用。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Derived& Self();
+};
+
+}
+
+}
+
+#include "StaticCollection.tpp"
\ No newline at end of file
@@ -0,0 +1,412 @@
+/*************************************************************************
+【文件名】 StaticCollection.tpp
+【功能模块和目的】 为 StaticCollection.hpp 提供实现。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#include <cstddef>
+#include <utility>
+#include "StaticCollection.hpp"
+#include "../Core/Errors.hpp"
+using namespace std;
+using namespace C3w::Errors;
+
+namespace C3w {
+
+namespace Containers {
+
+/**********************************************************************
+【函数名称】 Get
+【函数功能】 获取指定下标处的元素。如果越界抛出 IndexOverflowException。
+【参数】
+    index: 元素下标。
+【返回值】
+    指定位置元素的常引用。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename Derived, typename T, typename Base>
+const T& StaticCollection<Derived, T, Base>::Get(size_t index) const {
+    if (index >= Self().Count()) {
+        throw IndexOverflowException();
+    }
+    return Self().InnerGet(index);
+}
+
+/**********************************************************************
+【函数名称】 TrySet
+【函数功能】 尝试设置指定位置元素的值。如果越界抛出 IndexOverflowException。
+【参数】
+    index: 元素下标。
+    value: 新的值。
+【返回值】
+    操作是否成功。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename Derived, typename T, typename Base>
+bool StaticCollection<Derived, T, Base>::TrySet(size_t index, const T& value) {
+    if (index >= Self().Count()) {
+        throw IndexOverflowException();
+    }
+    if (Self().ShouldSet(index, value)) {
+        Self().InnerSet(index, value);
+        return true;
+    }
+    else {
+        return false;
+    }
+}
+
+/**********************************************************************
+【函数名称】 Set
+【函数功能】
+    设置指定位置元素的值。
+    如果操作失败抛出 CollectionException。
+    如果越界抛出 IndexOverflowException。
+【参数】
+    index: 元素下标。
+    value: 新的值。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename Derived, typename T, typename Base>
+void StaticCollection<Derived, T, Base>::Set(size_t index, const T& value) {
+    if (!TrySet(index, value)) {
+        throw CollectionException();
+    }
+}
+
+/**********************************************************************
+【函数名称】 IsEqual
+【函数功能】 判断自身和另一同类集合是否按顺序相等。
+【参数】
+    other: 另一集合。
+【返回值】
+    两集合是否相等。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename Derived, typename T, typename Base>
+bool StaticCollection<Derived, T, Base>::IsEqual(const Derived& other) const {
+    auto count = Self().Count();
+    if (count != other.Count()) {
+        return false;
+    }
+    for (size_t i = 0; i < count; i++) {
+        if (Self().InnerGet(i) != other.InnerGet(i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**********************************************************************
+【函数名称】 IsEqualUnordered
+【函数功能】 判断自身与另一同类集合中元素是否一一对应。
+【参数】
+    other: 另一集合。
+【返回值】
+    元素是否一一对应。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename Derived, typename T, typename Base>
+bool StaticCollection<Derived, T, Base>::IsEqualUnordered(
+    const Derived& other
+) const {
+    auto count = Self().Count();
+    if (count != other.Count()) {
+        return false;
+    }
+    size_t index;
+    for (size_t i = 0; i < count; i++) {
+        if (!other.InnerFind(Self().InnerGet(i), index)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**********************************************************************
+【函数名称】 TryAdd
+【函数功能】 尝试添加一个元素。
+【参数】
+    element: 新的元素。
+【返回值】
+    操作是否成功。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename Derived, typename T, typename Base>
+bool StaticCollection<Derived, T, Base>::TryAdd(const T& element) {
+    if (Self().ShouldAdd(element)) {
+        Self().InnerAdd(element);
+        return true;
+    }
+    else {
+        return false;
+    }
+}
+
+/**********************************************************************
+【函数名称】 Add
+【函数功能】 添加一个元素。如果操作失败抛出 CollectionException。
+【参数】
+    element: 新的元素。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename Derived, typename T, typename Base>
+void StaticCollection<Derived, T, Base>::Add(const T& element) {
+    if (!TryAdd(element)) {
+        throw CollectionException();
+    }
+}
+
+/**********************************************************************
+【函数名称】 TryAdd
+【函数功能】 尝试添加一个元素，成功时取走其内容。
+【参数】
+    element: 新的元素，失败时保持不变。
+【返回值】
+    操作是否成功。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename Derived, typename T, typename Base>
+bool StaticCollection<Derived, T, Base>::TryAdd(T&& element) {
+    if (Self().ShouldAdd(element)) {
+        Self().InnerAdd(move(element));
+        return true;
+    }
+    else {
+        return false;
+    }
+}
+
+/**********************************************************************
+【函数名称】 Add
+【函数功能】
+    添加一个元素，取走其内容。
+    如果操作失败抛出 CollectionException。
+【参数】
+    element: 新的元素。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename Derived, typename T, typename Base>
+void StaticCollection<Derived, T, Base>::Add(T&& element) {
+    if (!TryAdd(move(element))) {
+        throw CollectionException();
+    }
+}
+
+/**********************************************************************
+【函数名称】 TryEmplace
+【函数功能】 以给定参数构造一个元素并尝试添加，元素直接移入集合。
+【参数】
+    args: 元素构造函数的参数。
+【返回值】
+    操作是否成功。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename Derived, typename T, typename Base>
+template <typename... Args>
+bool StaticCollection<Derived, T, Base>::TryEmplace(Args&&... args) {
+    return TryAdd(T(forward<Args>(args)...));
+}
+
+/**********************************************************************
+【函数名称】 TryRemove
+【函数功能】 删除指定位置元素。如果越界抛出 IndexOverflowException。
+【参数】
+    index: 元素下标。
+【返回值】
+    操作是否成功。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename Derived, typename T, typename Base>
+bool StaticCollection<Derived, T, Base>::TryRemove(size_t index) {
+    if (index >= Self().Count()) {
+        throw IndexOverflowException();
+    }
+    if (Self().ShouldRemove(index)) {
+        Self().InnerRemove(index);
+        return true;
+    }
+    else {
+        return false;
+    }
+}
+
+/**********************************************************************
+【函数名称】 Remove
+【函数功能】
+    删除指定位置元素。
+    如果操作失败抛出 CollectionException。
+    如果越界抛出 IndexOverflowException。
+【参数】
+    index: 元素下标。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename Derived, typename T, typename Base>
+void StaticCollection<Derived, T, Base>::Remove(size_t index) {
+    if (!TryRemove(index)) {
+        throw CollectionException();
+    }
+}
+
+/**********************************************************************
+【函数名称】 TryInsert
+【函数功能】 将指定元素插入集合。如果越界抛出 IndexOverflowException。
+【参数】
+    index: 元素被插入位置的下标。
+    element: 新的元素。
+【返回值】
+    操作是否成功。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename Derived, typename T, typename Base>
+bool StaticCollection<Derived, T, Base>::TryInsert(
+    size_t index,
+    const T& element
+) {
+    // index 可以为 Count()，此时与 Add 行为相同
+    if (index > Self().Count()) {
+        throw IndexOverflowException();
+    }
+    if (Self().ShouldInsert(index, element)) {
+        Self().InnerInsert(index, element);
+        return true;
+    }
+    else {
+        return false;
+    }
+}
+
+/**********************************************************************
+【函数名称】 Insert
+【函数功能】
+    将指定元素插入集合。
+    如果操作失败抛出 CollectionException。
+    如果越界抛出 IndexOverflowException。
+【参数】
+    index: 元素被插入位置的下标。
+    element: 新的元素。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename Derived, typename T, typename Base>
+void StaticCollection<Derived, T, Base>::Insert(
+    size_t index,
+    const T& element
+) {
+    if (!TryInsert(index, element)) {
+        throw CollectionException();
+    }
+}
+
+/**********************************************************************
+【函数名称】 Contains
+【函数功能】 判断给定的值是否在集合内。
+【参数】
+    element: 要进行判断的值。
+【返回值】
+    值是否在集合内。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename Derived, typename T, typename Base>
+bool StaticCollection<Derived, T, Base>::Contains(const T& element) const {
+    size_t index;
+    return Self().InnerFind(element, index);
+}
+
+/**********************************************************************
+【函数名称】 FindIndex
+【函数功能】 寻找给定值在集合中的下标。找不到则抛出 CollectionException。
+【参数】
+    element: 要寻找的值。
+【返回值】
+    集合中的下标。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename Derived, typename T, typename Base>
+size_t StaticCollection<Derived, T, Base>::FindIndex(const T& element) const {
+    size_t index;
+    if (!Self().InnerFind(element, index)) {
+        throw CollectionException();
+    }
+    return index;
+}
+
+/**********************************************************************
+【函数名称】 operator[]
+【函数功能】 获取指定下标处的元素。如果越界抛出 IndexOverflowException。
+【参数】
+    index: 元素下标。
+【返回值】
+    指定位置元素的常引用。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename Derived, typename T, typename Base>
+const T& StaticCollection<Derived, T, Base>::operator[](size_t index) const {
+    return Get(index);
+}
+
+/**********************************************************************
+【函数名称】 operator==
+【函数功能】 判断自身与另一同类集合中元素是否一一对应。
+【参数】
+    other: 另一集合。
+【返回值】
+    元素是否一一对应。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename Derived, typename T, typename Base>
+bool StaticCollection<Derived, T, Base>::operator==(
+    const Derived& other
+) const {
+    return IsEqualUnordered(other);
+}
+
+/**********************************************************************
+【函数名称】 operator!=
+【函数功能】 判断自身与另一同类集合中元素是否不能一一对应。
+【参数】
+    other: 另一集合。
+【返回值】
+    元素是否不能一一对应。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename Derived, typename T, typename Base>
+bool StaticCollection<Derived, T, Base>::operator!=(
+    const Derived& other
+) const {
+    return !IsEqualUnordered(other);
+}
+
+/**********************************************************************
+【函数名称】 Self
+【函数功能】 将自身转换为 Derived 类型。
+【参数】 无
+【返回值】
+    自身作为 Derived 的常引用。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename Derived, typename T, typename Base>
+const Derived& StaticCollection<Derived, T, Base>::Self() const {
+    return static_cast<const Derived&>(*this);
+}
+
+/**********************************************************************
+【函数名称】 Self
+【函数功能】 将自身转换为 Derived 类型。
+【参数】 无
+【返回值】
+    自身作为 Derived 的引用。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename Derived, typename T, typename Base>
+Derived& StaticCollection<Derived, T, Base>::Self() {
+    return static_cast<Derived&>(*this);
+}
+
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,171 @@
+/*************************************************************************
+【文件名】 AffineTransform.hpp
+【功能模块和目的】 AffineTransform 类定义了一个 N 维仿射变换。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include "Point.hpp"
+#include "PointBatch.hpp"
+#include "Vector.hpp"
+using namespace std;
+
+namespace C3w {
+
+/*************************************************************************
+【类名】 AffineTransform
+【功能】
+    定义一个 N 维仿射变换 x' = A x + b，
+    其中 A 为 N × N 的线性部分，b 为平移部分。
+【接口说明】
+    构造平移、缩放变换，求行列式并判断是否为单射，
+    变换单个点或原地变换一个点批。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+template <size_t N>
+class AffineTransform final {
+    public:
+        // 内嵌类型
+
+        // 线性部分，Linear[r][c] 为第 r 行第 c 列
+        typedef array<array<double, N>, N> Matrix;
+
+        // 成员
+
+        // 维数
+        static constexpr size_t Dimension { N };
+        // 线性部分
+        Matrix Linear;
+        // 平移部分
+        Vector<double, N> Offset;
+
+        // 构造函数
+
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 初始化恒等变换。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        AffineTransform();
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 使用线性部分与平移部分初始化 AffineTransform 类型实例。
+        【参数】
+            linear: 线性部分。
+            offset: 平移部分。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        AffineTransform(const Matrix& linear, const Vector<double, N>& offset);
+        /**********************************************************************
+        【函数名称】 拷贝构造函数
+        【函数功能】 使用另一 AffineTransform 初始化 AffineTransform 类型实例。
+        【参数】
+            other: 另一 AffineTransform 实例。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        AffineTransform(const AffineTransform<N>& other) = default;
+
+        // 属性
+
+        /**********************************************************************
+        【函数名称】 Translation
+        【函数功能】 构造一个平移变换。
+        【参数】
+            delta: 移动的方向和长度。
+        【返回值】
+            对应的仿射变换。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static AffineTransform<N> Translation(const Vector<double, N>& delta);
+        /**********************************************************************
+        【函数名称】 Scaling
+        【函数功能】 构造一个以定点为中心的缩放变换。
+        【参数】
+            ref: 参考点。
+            ratio: 缩放的比例。
+        【返回值】
+            对应的仿射变换。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static AffineTransform<N> Scaling(const Point<N>& ref, double ratio);
+        /**********************************************************************
+        【函数名称】 GetDeterminant
+        【函数功能】 用列主元消去法求线性部分的行列式。
+        【参数】 无
+        【返回值】
+            线性部分的行列式。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        double GetDeterminant() const;
+        /**********************************************************************
+        【函数名称】 IsInjective
+        【函数功能】
+            判断变换是否为单射，即行列式是否不为 0。
+            单射变换不会把不同的点映到同一点（不计浮点舍入）。
+        【参数】 无
+        【返回值】
+            变换是否为单射。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        bool IsInjective() const;
+        /**********************************************************************
+        【函数名称】 TryGetInverse
+        【函数功能】
+            用列主元高斯-约当消去法求逆变换 x = A⁻¹x' - A⁻¹b。
+            变换不是单射时不改变 inverse。
+        【参数】
+            inverse: 成功时被赋值为逆变换。
+        【返回值】
+            是否存在逆变换。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        bool TryGetInverse(AffineTransform<N>& inverse) const;
+
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 Apply
+        【函数功能】 变换一个点。
+        【参数】
+            point: 要变换的点。
+        【返回值】
+            变换后的点。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Point<N> Apply(const Point<N>& point) const;
+        /**********************************************************************
+        【函数名称】 ApplyInplace
+        【函数功能】
+            原地变换点批中的所有点。逐维遍历连续的坐标数组，
+            累加顺序与 Apply 相同，结果逐位相同。
+        【参数】
+            points: 要变换的点批。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void ApplyInplace(PointBatch<N>& points) const;
+
+        // 操作符
+
+        /**********************************************************************
+        【函数名称】 operator=
+        【函数功能】 将另一变换赋值给自身。
+        【参数】
+            other: 从之取值的变换。
+        【返回值】
+            自身的引用。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        AffineTransform<N>& operator=(const AffineTransform<N>& other) = default;
+};
+
+}
+
+#include "AffineTransform.tpp"
\ No newline at end of file
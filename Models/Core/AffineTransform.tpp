@@ -0,0 +1,262 @@
+/*************************************************************************
+【文件名】 AffineTransform.tpp
+【功能模块和目的】 为 AffineTransform.hpp 提供实现。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <utility>
+#include "AffineTransform.hpp"
+#include "Point.hpp"
+#include "PointBatch.hpp"
+#include "Vector.hpp"
+using namespace std;
+
+namespace C3w {
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 初始化恒等变换。
+【参数】 无
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+AffineTransform<N>::AffineTransform() {
+    for (size_t r = 0; r < N; r++) {
+        Linear[r].fill(0.0);
+        Linear[r][r] = 1.0;
+    }
+}
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 使用线性部分与平移部分初始化 AffineTransform 类型实例。
+【参数】
+    linear: 线性部分。
+    offset: 平移部分。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+AffineTransform<N>::AffineTransform(
+    const Matrix& linear,
+    const Vector<double, N>& offset
+): Linear(linear), Offset(offset) {}
+
+/**********************************************************************
+【函数名称】 Translation
+【函数功能】 构造一个平移变换。
+【参数】
+    delta: 移动的方向和长度。
+【返回值】
+    对应的仿射变换。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+AffineTransform<N> AffineTransform<N>::Translation(
+    const Vector<double, N>& delta
+) {
+    AffineTransform<N> transform;
+    transform.Offset = delta;
+    return transform;
+}
+
+/**********************************************************************
+【函数名称】 Scaling
+【函数功能】 构造一个以定点为中心的缩放变换。
+【参数】
+    ref: 参考点。
+    ratio: 缩放的比例。
+【返回值】
+    对应的仿射变换。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+AffineTransform<N> AffineTransform<N>::Scaling(
+    const Point<N>& ref,
+    double ratio
+) {
+    AffineTransform<N> transform;
+    auto center = ref.GetData();
+    auto offset = transform.Offset.GetData();
+    for (size_t r = 0; r < N; r++) {
+        transform.Linear[r][r] = ratio;
+        // x' = ratio * x + (1 - ratio) * ref
+        offset[r] = center[r] - ratio * center[r];
+    }
+    return transform;
+}
+
+/**********************************************************************
+【函数名称】 GetDeterminant
+【函数功能】 用列主元消去法求线性部分的行列式。
+【参数】 无
+【返回值】
+    线性部分的行列式。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+double AffineTransform<N>::GetDeterminant() const {
+    Matrix matrix = Linear;
+    double determinant = 1.0;
+    for (size_t c = 0; c < N; c++) {
+        size_t pivot = c;
+        for (size_t r = c + 1; r < N; r++) {
+            if (fabs(matrix[r][c]) > fabs(matrix[pivot][c])) {
+                pivot = r;
+            }
+        }
+        if (matrix[pivot][c] == 0.0) {
+            return 0.0;
+        }
+        if (pivot != c) {
+            swap(matrix[pivot], matrix[c]);
+            determinant = -determinant;
+        }
+        determinant *= matrix[c][c];
+        for (size_t r = c + 1; r < N; r++) {
+            double factor = matrix[r][c] / matrix[c][c];
+            for (size_t k = c; k < N; k++) {
+                matrix[r][k] -= factor * matrix[c][k];
+            }
+        }
+    }
+    return determinant;
+}
+
+/**********************************************************************
+【函数名称】 IsInjective
+【函数功能】
+    判断变换是否为单射，即行列式是否不为 0。
+    单射变换不会把不同的点映到同一点（不计浮点舍入）。
+【参数】 无
+【返回值】
+    变换是否为单射。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+bool AffineTransform<N>::IsInjective() const {
+    return GetDeterminant() != 0.0;
+}
+
+/**********************************************************************
+【函数名称】 TryGetInverse
+【函数功能】
+    用列主元高斯-约当消去法求逆变换 x = A⁻¹x' - A⁻¹b。
+    变换不是单射时不改变 inverse。
+【参数】
+    inverse: 成功时被赋值为逆变换。
+【返回值】
+    是否存在逆变换。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+bool AffineTransform<N>::TryGetInverse(AffineTransform<N>& inverse) const {
+    // 对 matrix 的行变换同样施加于 result，matrix 化为单位阵时 result 即逆
+    Matrix matrix = Linear;
+    Matrix result = AffineTransform<N>().Linear;
+    for (size_t c = 0; c < N; c++) {
+        size_t pivot = c;
+        for (size_t r = c + 1; r < N; r++) {
+            if (fabs(matrix[r][c]) > fabs(matrix[pivot][c])) {
+                pivot = r;
+            }
+        }
+        if (matrix[pivot][c] == 0.0) {
+            return false;
+        }
+        swap(matrix[pivot], matrix[c]);
+        swap(result[pivot], result[c]);
+        double scale = matrix[c][c];
+        for (size_t k = 0; k < N; k++) {
+            matrix[c][k] /= scale;
+            result[c][k] /= scale;
+        }
+        for (size_t r = 0; r < N; r++) {
+            double factor = matrix[r][c];
+            if (r == c || factor == 0.0) {
+                continue;
+            }
+            for (size_t k = 0; k < N; k++) {
+                matrix[r][k] -= factor * matrix[c][k];
+                result[r][k] -= factor * result[c][k];
+            }
+        }
+    }
+    auto offset = Offset.GetData();
+    array<double, N> shift;
+    for (size_t r = 0; r < N; r++) {
+        shift[r] = 0.0;
+        for (size_t c = 0; c < N; c++) {
+            shift[r] -= result[r][c] * offset[c];
+        }
+    }
+    inverse = AffineTransform<N>(result, Vector<double, N>(shift));
+    return true;
+}
+
+/**********************************************************************
+【函数名称】 Apply
+【函数功能】 变换一个点。
+【参数】
+    point: 要变换的点。
+【返回值】
+    变换后的点。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+Point<N> AffineTransform<N>::Apply(const Point<N>& point) const {
+    auto input = point.GetData();
+    auto offset = Offset.GetData();
+    array<double, N> output;
+    for (size_t r = 0; r < N; r++) {
+        double value = Linear[r][0] * input[0];
+        for (size_t c = 1; c < N; c++) {
+            value += Linear[r][c] * input[c];
+        }
+        output[r] = value + offset[r];
+    }
+    return Point<N>(output);
+}
+
+/**********************************************************************
+【函数名称】 ApplyInplace
+【函数功能】
+    原地变换点批中的所有点。逐维遍历连续的坐标数组，
+    累加顺序与 Apply 相同，结果逐位相同。
+【参数】
+    points: 要变换的点批。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void AffineTransform<N>::ApplyInplace(PointBatch<N>& points) const {
+    // 每一维的输出依赖所有维的输入，先保留一份原坐标
+    PointBatch<N> input(points);
+    auto count = points.Count();
+    auto offset = Offset.GetData();
+    for (size_t r = 0; r < N; r++) {
+        double* output = points.GetAxis(r);
+        const double* first = input.GetAxis(0);
+        double factor = Linear[r][0];
+        for (size_t i = 0; i < count; i++) {
+            output[i] = factor * first[i];
+        }
+        for (size_t c = 1; c < N; c++) {
+            const double* coords = input.GetAxis(c);
+            factor = Linear[r][c];
+            for (size_t i = 0; i < count; i++) {
+                output[i] += factor * coords[i];
+            }
+        }
+        double shift = offset[r];
+        for (size_t i = 0; i < count; i++) {
+            output[i] += shift;
+        }
+    }
+}
+
+}
\ No newline at end of file
@@ -1,6 +1,6 @@
 /*************************************************************************
 【文件名】 Element.hpp
-【功能模块和目的】 Element 类定义了一个抽象的元素。
+【功能模块和目的】 Element 类定义了由若干个点组成的元素。
 【开发者及日期】 赵一彤 2024/7/24
 *************************************************************************/
 
@@ -12,7 +12,7 @@
 #include "Point.hpp"
 #include "Vector.hpp"
 #include "../Containers/FixedSet.hpp"
-#include "../Tools/Representable.hpp"
+#include "../Tools/Formattable.hpp"
 using namespace std;
 using namespace C3w::Containers;
 
@@ -20,12 +20,14 @@ namespace C3w {
 
 /*************************************************************************
 【类名】 Element
-【功能】 定义一个维数 N，点数 S 的抽象元素作为 Line 与 Face 的基类。
-【接口说明】 求长度/面积，升维/降维，移动/缩放。
+【功能】 定义一个维数 N，点数 S 的元素作为 Line 与 Face 的基类。
+【接口说明】
+    升维/降维，移动/缩放。长度与面积由 Line 与 Face 分别给出。
+    没有虚函数，只含 S 个点，可平凡复制，便于模型大量存储。
 【开发者及日期】 赵一彤 2024/7/24
 *************************************************************************/
 template <size_t N, size_t S>
-class Element: public Tools::Representable {
+class Element {
     public:
         // 成员
 
@@ -68,27 +70,6 @@ class Element: public Tools::Representable {
         **********************************************************************/
         Element(const Element<N, S>& other) = default;
 
-        // 属性
-
-        /**********************************************************************
-        【函数名称】 GetLength
-        【函数功能】 求此元素的长度。
-        【参数】 无
-        【返回值】
-            此元素的长度。
-        【开发者及日期】 赵一彤 2024/7/24
-        **********************************************************************/
-        virtual double GetLength() const = 0;
-        /**********************************************************************
-        【函数名称】 GetArea
-        【函数功能】 求此元素的面积。
-        【参数】 无
-        【返回值】
-            此元素的面积。
-        【开发者及日期】 赵一彤 2024/7/24
-        **********************************************************************/
-        virtual double GetArea() const = 0;
-
         // 操作
 
         /**********************************************************************
@@ -116,6 +97,16 @@ class Element: public Tools::Representable {
             const Element<N, S>& right
         );
         /**********************************************************************
+        【函数名称】 GetHashCode
+        【函数功能】 
+            求元素的哈希值。与点的顺序无关，因此相等的元素哈希值相同。
+        【参数】 无
+        【返回值】 
+            元素的哈希值。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        size_t GetHashCode() const;
+        /**********************************************************************
         【函数名称】 Project
         【函数功能】 将自身投影至 M 维。
         【参数】 无
@@ -165,7 +156,7 @@ class Element: public Tools::Representable {
         【返回值】 无
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        void MoveInplace(const Vector<double, N>& delta) const;
+        void MoveInplace(const Vector<double, N>& delta);
         /**********************************************************************
         【函数名称】 Scale
         【函数功能】 将自身以定点为中心缩放并存储为新的元素。
@@ -247,10 +238,7 @@ class Element: public Tools::Representable {
             此对象的字符串表达形式。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        string ToString() const override;
-
-        // 虚析构函数
-        virtual ~Element() = default;
+        string ToString() const;
 };
 
 }
@@ -12,6 +12,7 @@
 #include "Point.hpp"
 #include "Vector.hpp"
 #include "../Containers/FixedSet.hpp"
+#include "../Tools/Hash.hpp"
 using namespace std;
 using namespace C3w::Containers;
 
@@ -71,6 +72,25 @@ bool Element<N, S>::IsEqual(
     return left.Points == right.Points;
 }
 
+/**********************************************************************
+【函数名称】 GetHashCode
+【函数功能】 
+    求元素的哈希值。与点的顺序无关，因此相等的元素哈希值相同。
+【参数】 无
+【返回值】 
+    元素的哈希值。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N, size_t S>
+size_t Element<N, S>::GetHashCode() const {
+    // 点集合的相等是无序的，故使用满足交换律的加法组合
+    size_t sum = S;
+    for (auto& point: Points) {
+        sum += Tools::MixHash(point.GetHashCode());
+    }
+    return Tools::MixHash(sum);
+}
+
 /**********************************************************************
 【函数名称】 Project
 【函数功能】 将自身投影至 M 维。
@@ -81,7 +101,7 @@ bool Element<N, S>::IsEqual(
 template <size_t N, size_t S>
 template <size_t M>
 Element<M, S> Element<N, S>::Project() const {
-    array<Point<N>, S> points;
+    array<Point<M>, S> points;
     for (size_t i = 0; i < S; i++) {
         points[i] = Points[i].template Project<M>();
     }
@@ -98,7 +118,7 @@ Element<M, S> Element<N, S>::Project() const {
 template <size_t N, size_t S>
 template <size_t M>
 Element<M, S> Element<N, S>::Promote(double pad) const {
-    array<Point<N>, S> points;
+    array<Point<M>, S> points;
     for (size_t i = 0; i < S; i++) {
         points[i] = Points[i].template Promote<M>(pad);
     }
@@ -150,7 +170,7 @@ Element<N, S> Element<N, S>::Move(
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <size_t N, size_t S>
-void Element<N, S>::MoveInplace(const Vector<double, N>& delta) const {
+void Element<N, S>::MoveInplace(const Vector<double, N>& delta) {
     // 不能对 FixedSet 的元素使用 +=
     // 因为 FixedSet::operator[] 只能返回常引用
     *this = Move(*this, delta);
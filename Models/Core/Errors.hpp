@@ -6,7 +6,9 @@
 
 #pragma once
 
+#include <cstddef>
 #include <stdexcept>
+#include <string>
 using namespace std;
 
 namespace C3w {
@@ -16,7 +18,7 @@ namespace Errors {
 /*************************************************************************
 【类名】 IndexOverflowException
 【功能】 下标越界时抛出的异常。
-【接口说明】 无
+【接口说明】 获取出错的行号。
 【开发者及日期】 赵一彤 2024/7/24
 *************************************************************************/
 class IndexOverflowException: public out_of_range {
@@ -30,6 +32,36 @@ class IndexOverflowException: public out_of_range {
         **********************************************************************/
         IndexOverflowException()
             : out_of_range("index out of bounds.") {}
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 以出错的行号初始化异常。
+        【参数】
+            line: 出错位置在文件中的行号，从 1 开始。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        explicit IndexOverflowException(size_t line)
+            : out_of_range(
+                "index out of bounds at line " + to_string(line) + "."
+            ), m_Line(line) {}
+
+        // 属性
+
+        /**********************************************************************
+        【函数名称】 GetLine
+        【函数功能】 获取出错位置在文件中的行号。
+        【参数】 无
+        【返回值】
+            从 1 开始的行号，与文件无关的错误为 0。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        size_t GetLine() const {
+            return m_Line;
+        }
+
+    private:
+        // 出错位置的行号，0 表示未知
+        size_t m_Line { 0 };
 };
 
 /**************************************************************************
@@ -92,7 +124,7 @@ class FileOpenException: public runtime_error {
 /**************************************************************************
 【类名】 FileFormatException
 【功能】 文件内容无效时抛出的异常。
-【接口说明】 无
+【接口说明】 获取出错的行号。
 【开发者及日期】 赵一彤 2024/7/24
 *************************************************************************/
 class FileFormatException: public runtime_error {
@@ -106,6 +138,36 @@ class FileFormatException: public runtime_error {
         **********************************************************************/
         FileFormatException()
             : runtime_error("file contains invalid format.") {}
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 以出错的行号初始化异常。
+        【参数】
+            line: 出错位置在文件中的行号，从 1 开始。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        explicit FileFormatException(size_t line)
+            : runtime_error(
+                "file contains invalid format at line " + to_string(line) + "."
+            ), m_Line(line) {}
+
+        // 属性
+
+        /**********************************************************************
+        【函数名称】 GetLine
+        【函数功能】 获取出错位置在文件中的行号。
+        【参数】 无
+        【返回值】
+            从 1 开始的行号，与文件无关的错误为 0。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        size_t GetLine() const {
+            return m_Line;
+        }
+
+    private:
+        // 出错位置的行号，0 表示未知
+        size_t m_Line { 0 };
 };
 
 /**************************************************************************
@@ -127,6 +189,26 @@ class StorageFactoryLookupException: public invalid_argument {
             : invalid_argument("cannot find appropriate importer/exporter.") {}
 };
 
+/**************************************************************************
+【类名】 StatisticsMismatchException
+【功能】 增量维护的统计量与完整重新计算的结果不一致时抛出的异常。
+【接口说明】 无
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+class StatisticsMismatchException: public logic_error {
+    public:
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 以不一致的统计量名称初始化异常。
+        【参数】
+            field: 不一致的统计量名称。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        explicit StatisticsMismatchException(const string& field)
+            : logic_error("incremental statistics mismatch: " + field + ".") {}
+};
+
 }
 
 
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <type_traits>
 #include "Element.hpp"
 #include "Point.hpp"
 
@@ -20,15 +21,6 @@ namespace C3w {
 template <size_t N>
 class Face: public Element<N, 3> {
     public:
-        // 属性
-
-        // 第一个点
-        const Point<N>& First { this->Points[0] };
-        // 第二个点
-        const Point<N>& Second { this->Points[1] };
-        // 第三个点
-        const Point<N>& Third { this->Points[2] };
-
         // 构造函数
 
         // 使用 Element 的构造函数
@@ -50,7 +42,7 @@ class Face: public Element<N, 3> {
         【返回值】 无
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        Face(const Face<N>& other);
+        Face(const Face<N>& other) = default;
 
         // 属性
 
@@ -62,7 +54,7 @@ class Face: public Element<N, 3> {
             此元素的长度。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        double GetLength() const override;
+        double GetLength() const;
         /**********************************************************************
         【函数名称】 GetArea
         【函数功能】 求此元素的面积。
@@ -71,7 +63,34 @@ class Face: public Element<N, 3> {
             此元素的面积。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        double GetArea() const override;
+        double GetArea() const;
+        /**********************************************************************
+        【函数名称】 GetFirst
+        【函数功能】 获取第一个点。
+        【参数】 无
+        【返回值】
+            第一个点的常引用。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        const Point<N>& GetFirst() const;
+        /**********************************************************************
+        【函数名称】 GetSecond
+        【函数功能】 获取第二个点。
+        【参数】 无
+        【返回值】
+            第二个点的常引用。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        const Point<N>& GetSecond() const;
+        /**********************************************************************
+        【函数名称】 GetThird
+        【函数功能】 获取第三个点。
+        【参数】 无
+        【返回值】
+            第三个点的常引用。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        const Point<N>& GetThird() const;
 
         // 操作符
 
@@ -94,7 +113,38 @@ class Face: public Element<N, 3> {
             自身的引用。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        Face<N>& operator=(const Face<N>& other);
+        Face<N>& operator=(const Face<N>& other) = default;
+};
+
+// 元素没有虚函数表，只含 3 个点，可整体按字节复制
+static_assert(
+    sizeof(Face<3>) == 3 * sizeof(Point<3>),
+    "Face<3> must consist of exactly three points."
+);
+static_assert(
+    is_standard_layout<Face<3>>::value,
+    "Face<3> must be standard-layout."
+);
+static_assert(
+    is_trivially_copyable<Face<3>>::value,
+    "Face<3> must be trivially copyable."
+);
+
+}
+
+namespace std {
+
+/*************************************************************************
+【类名】 hash<C3w::Face<N>>
+【功能】 使 Face 可以用作无序容器的键。
+【接口说明】 函数对象，调用 GetHashCode。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+template <size_t N>
+struct hash<C3w::Face<N>> {
+    size_t operator()(const C3w::Face<N>& face) const {
+        return face.GetHashCode();
+    }
 };
 
 }
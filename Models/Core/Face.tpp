@@ -23,17 +23,6 @@ namespace C3w {
 template <size_t N>
 Face<N>::Face(const Element<N, 3>& element): Element<N, 3>(element) {}
 
-/**********************************************************************
-【函数名称】 拷贝构造函数
-【函数功能】 使用另一 Face 对象初始化 Face 对象。
-【参数】 
-    other: 另一个 Face 对象。
-【返回值】 无
-【开发者及日期】 赵一彤 2024/7/24
-**********************************************************************/
-template <size_t N>
-Face<N>::Face(const Face<N>& other): Element<N, 3>(other) {}
-
 /**********************************************************************
 【函数名称】 GetLength
 【函数功能】 求此元素的长度。
@@ -44,10 +33,12 @@ Face<N>::Face(const Face<N>& other): Element<N, 3>(other) {}
 **********************************************************************/
 template <size_t N>
 double Face<N>::GetLength() const {
+    // 三个点必然存在，直接用迭代器访问，免去越界检测与虚函数调用
+    auto points = this->Points.begin();
     return (
-        Point<N>::Distance(this->Points[0], this->Points[1]) +
-        Point<N>::Distance(this->Points[1], this->Points[2]) +
-        Point<N>::Distance(this->Points[2], this->Points[0])
+        Point<N>::Distance(points[0], points[1]) +
+        Point<N>::Distance(points[1], points[2]) +
+        Point<N>::Distance(points[2], points[0])
     );
 }
 
@@ -61,43 +52,66 @@ double Face<N>::GetLength() const {
 **********************************************************************/
 template <size_t N>
 double Face<N>::GetArea() const {
-    auto a = Point<N>::Distance(this->Points[0], this->Points[1]);
-    auto b = Point<N>::Distance(this->Points[1], this->Points[2]);
-    auto c = Point<N>::Distance(this->Points[2], this->Points[0]);
+    auto points = this->Points.begin();
+    auto a = Point<N>::Distance(points[0], points[1]);
+    auto b = Point<N>::Distance(points[1], points[2]);
+    auto c = Point<N>::Distance(points[2], points[0]);
     auto p = (a + b + c) / 2;
     return sqrt((p - a) * (p - b) * (p - c) * p);
 }
 
 /**********************************************************************
-【函数名称】 operator=
-【函数功能】 将另一元素赋值给自身。
-【参数】
-    other: 从之取值的元素。
+【函数名称】 GetFirst
+【函数功能】 获取第一个点。
+【参数】 无
 【返回值】
-    自身的引用。
-【开发者及日期】 赵一彤 2024/7/24
+    第一个点的常引用。
+【开发者及日期】 赵一彤 2026/10/17
 **********************************************************************/
 template <size_t N>
-Face<N>& Face<N>::operator=(const Element<N, 3>& element) {
-    if (this != &element) {
-        Element<N, 3>::operator=(element);
-    }
-    return *this;
+const Point<N>& Face<N>::GetFirst() const {
+    return this->Points[0];
+}
+
+/**********************************************************************
+【函数名称】 GetSecond
+【函数功能】 获取第二个点。
+【参数】 无
+【返回值】
+    第二个点的常引用。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+const Point<N>& Face<N>::GetSecond() const {
+    return this->Points[1];
+}
+
+/**********************************************************************
+【函数名称】 GetThird
+【函数功能】 获取第三个点。
+【参数】 无
+【返回值】
+    第三个点的常引用。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+const Point<N>& Face<N>::GetThird() const {
+    return this->Points[2];
 }
 
 /**********************************************************************
 【函数名称】 operator=
-【函数功能】 将另一面赋值给自身。
+【函数功能】 将另一元素赋值给自身。
 【参数】
-    other: 从之取值的面。
+    other: 从之取值的元素。
 【返回值】
     自身的引用。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <size_t N>
-Face<N>& Face<N>::operator=(const Face<N>& other) {
-    if (this != &other) {
-        Element<N, 3>::operator=(other);
+Face<N>& Face<N>::operator=(const Element<N, 3>& element) {
+    if (this != &element) {
+        Element<N, 3>::operator=(element);
     }
     return *this;
 }
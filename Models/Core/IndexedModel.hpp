@@ -0,0 +1,269 @@
+/*************************************************************************
+【文件名】 IndexedModel.hpp
+【功能模块和目的】 IndexedModel 类定义了一个以共享顶点池存储的 N 维模型。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "Face.hpp"
+#include "Line.hpp"
+#include "Model.hpp"
+#include "Point.hpp"
+#include "../Tools/Box.hpp"
+using namespace std;
+
+namespace C3w {
+
+/*************************************************************************
+【类名】 IndexedModel
+【功能】
+    定义一个维数为 N 的、索引形式的模型。
+    模型持有去重后的顶点数组，线段/面只保存 32 位的顶点下标，
+    被多个元素共享的顶点只存储一次。
+    只在导入 / 导出时临时构建，控制器持有的仍是 Model，
+    因此不减少载入后模型占用的内存。
+【接口说明】
+    与 Model 互相转换，添加顶点/线段/面，获取元素，获取外接长方体。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+template <size_t N>
+class IndexedModel {
+    public:
+        // 内嵌类型
+
+        // 线段的顶点下标
+        typedef array<uint32_t, 2> LineIndices;
+        // 面的顶点下标
+        typedef array<uint32_t, 3> FaceIndices;
+
+        // 成员
+
+        // 维数
+        static constexpr size_t Dimension { N };
+        // 名称
+        string Name;
+
+        // 构造函数
+
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 初始化空的 IndexedModel 类型实例。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        IndexedModel() = default;
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 使用名称初始化 IndexedModel 类型实例。
+        【参数】
+            name: 模型的名称。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        IndexedModel(string name);
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】
+            将 Model 转化为索引形式。顶点按首次出现的顺序编号，
+            先遍历线段再遍历面，与 Model::CollectPoints 的顺序一致。
+            如果顶点数超出 32 位下标范围抛出 IndexOverflowException。
+        【参数】
+            model: 要转化的模型。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        IndexedModel(const Model<N>& model);
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】
+            直接接管已建好的顶点与下标数组，不逐个去重。
+            如果有下标超出顶点数抛出 IndexOverflowException。
+        【参数】
+            name: 模型的名称。
+            vertices: 顶点数组。
+            lines: 线段的顶点下标。
+            faces: 面的顶点下标。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        IndexedModel(
+            string name,
+            vector<Point<N>> vertices,
+            vector<LineIndices> lines,
+            vector<FaceIndices> faces
+        );
+        /**********************************************************************
+        【函数名称】 拷贝构造函数
+        【函数功能】 使用另一 IndexedModel 对象初始化 IndexedModel 类型实例。
+        【参数】
+            other: 另一 IndexedModel 对象。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        IndexedModel(const IndexedModel<N>& other) = default;
+
+        // 属性
+
+        /**********************************************************************
+        【函数名称】 GetVertices
+        【函数功能】 获取去重后的顶点数组。
+        【参数】 无
+        【返回值】
+            顶点数组的常引用。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        const vector<Point<N>>& GetVertices() const;
+        /**********************************************************************
+        【函数名称】 GetLineIndices
+        【函数功能】 获取所有线段的顶点下标。
+        【参数】 无
+        【返回值】
+            线段顶点下标数组的常引用。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        const vector<LineIndices>& GetLineIndices() const;
+        /**********************************************************************
+        【函数名称】 GetFaceIndices
+        【函数功能】 获取所有面的顶点下标。
+        【参数】 无
+        【返回值】
+            面顶点下标数组的常引用。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        const vector<FaceIndices>& GetFaceIndices() const;
+        /**********************************************************************
+        【函数名称】 GetLine
+        【函数功能】 获取指定下标处的线段。如果越界抛出 IndexOverflowException。
+        【参数】
+            index: 线段的下标。
+        【返回值】
+            由顶点构造出的线段。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Line<N> GetLine(size_t index) const;
+        /**********************************************************************
+        【函数名称】 GetFace
+        【函数功能】 获取指定下标处的面。如果越界抛出 IndexOverflowException。
+        【参数】
+            index: 面的下标。
+        【返回值】
+            由顶点构造出的面。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Face<N> GetFace(size_t index) const;
+        /**********************************************************************
+        【函数名称】 GetBoundingBox
+        【函数功能】 直接由顶点数组求能包含此模型中所有元素的最小长方体。
+        【参数】 无
+        【返回值】
+            能包含此模型中所有元素的最小长方体。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Tools::Box<N> GetBoundingBox() const;
+
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 Reserve
+        【函数功能】 为顶点与元素预留空间。
+        【参数】
+            vertexCount: 预计的顶点数。
+            lineCount: 预计的线段数。
+            faceCount: 预计的面数。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void Reserve(size_t vertexCount, size_t lineCount, size_t faceCount);
+        /**********************************************************************
+        【函数名称】 AddVertex
+        【函数功能】
+            添加一个顶点。如果相同的顶点已存在则直接返回其下标。
+            如果顶点数超出 32 位下标范围抛出 IndexOverflowException。
+        【参数】
+            point: 要添加的顶点。
+        【返回值】
+            顶点在顶点数组中的下标。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        uint32_t AddVertex(const Point<N>& point);
+        /**********************************************************************
+        【函数名称】 AddLine
+        【函数功能】
+            按顶点下标添加一条线段，不检查元素是否重复。
+            如果下标越界抛出 IndexOverflowException。
+        【参数】
+            indices: 两个顶点的下标。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void AddLine(const LineIndices& indices);
+        /**********************************************************************
+        【函数名称】 AddFace
+        【函数功能】
+            按顶点下标添加一个面，不检查元素是否重复。
+            如果下标越界抛出 IndexOverflowException。
+        【参数】
+            indices: 三个顶点的下标。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void AddFace(const FaceIndices& indices);
+        /**********************************************************************
+        【函数名称】 ReleaseLookup
+        【函数功能】
+            释放用于顶点去重的查找表以节省内存。
+            之后再调用 AddVertex 时会重新建立。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void ReleaseLookup();
+        /**********************************************************************
+        【函数名称】 ToModel
+        【函数功能】
+            将索引形式转化为 Model。
+            如果有重复元素抛出 CollectionException。
+        【参数】 无
+        【返回值】
+            对应的 Model。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Model<N> ToModel() const;
+
+        // 操作符
+
+        /**********************************************************************
+        【函数名称】 operator=
+        【函数功能】 将其他模型赋值给自身。
+        【参数】
+            other: 从之取值的模型。
+        【返回值】
+            自身的引用。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        IndexedModel<N>& operator=(const IndexedModel<N>& other) = default;
+
+    private:
+        // 去重后的顶点
+        vector<Point<N>> m_Vertices;
+        // 线段的顶点下标
+        vector<LineIndices> m_Lines;
+        // 面的顶点下标
+        vector<FaceIndices> m_Faces;
+        // 顶点到下标的查找表，按需建立
+        unordered_map<Point<N>, uint32_t> m_Lookup;
+        // 查找表是否与顶点数组一致
+        bool m_IsLookupValid { true };
+};
+
+}
+
+#include "IndexedModel.tpp"
\ No newline at end of file
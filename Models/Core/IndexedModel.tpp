@@ -0,0 +1,347 @@
+/*************************************************************************
+【文件名】 IndexedModel.tpp
+【功能模块和目的】 为 IndexedModel.hpp 提供实现。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "Errors.hpp"
+#include "Face.hpp"
+#include "IndexedModel.hpp"
+#include "Line.hpp"
+#include "Model.hpp"
+#include "Point.hpp"
+#include "../Tools/Box.hpp"
+using namespace std;
+using namespace C3w::Errors;
+
+namespace C3w {
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 使用名称初始化 IndexedModel 类型实例。
+【参数】
+    name: 模型的名称。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+IndexedModel<N>::IndexedModel(string name): Name(move(name)) {}
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】
+    将 Model 转化为索引形式。顶点按首次出现的顺序编号，
+    先遍历线段再遍历面，与 Model::CollectPoints 的顺序一致。
+    如果顶点数超出 32 位下标范围抛出 IndexOverflowException。
+【参数】
+    model: 要转化的模型。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+IndexedModel<N>::IndexedModel(const Model<N>& model): Name(model.Name) {
+    auto lineCount = model.Lines.Count();
+    auto faceCount = model.Faces.Count();
+    // 顶点数不超过元素中点的总数
+    Reserve(lineCount * 2 + faceCount * 3, lineCount, faceCount);
+    for (auto& line: model.Lines) {
+        m_Lines.push_back({
+            AddVertex(line.Points[0]),
+            AddVertex(line.Points[1])
+        });
+    }
+    for (auto& face: model.Faces) {
+        m_Faces.push_back({
+            AddVertex(face.Points[0]),
+            AddVertex(face.Points[1]),
+            AddVertex(face.Points[2])
+        });
+    }
+}
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】
+    直接接管已建好的顶点与下标数组，不逐个去重。
+    如果有下标超出顶点数抛出 IndexOverflowException。
+【参数】
+    name: 模型的名称。
+    vertices: 顶点数组。
+    lines: 线段的顶点下标。
+    faces: 面的顶点下标。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+IndexedModel<N>::IndexedModel(
+    string name,
+    vector<Point<N>> vertices,
+    vector<LineIndices> lines,
+    vector<FaceIndices> faces
+): Name(move(name)),
+    m_Vertices(move(vertices)),
+    m_Lines(move(lines)),
+    m_Faces(move(faces)),
+    m_IsLookupValid(false) {
+    if (m_Vertices.size() > numeric_limits<uint32_t>::max()) {
+        throw IndexOverflowException();
+    }
+    for (auto& indices: m_Lines) {
+        for (auto index: indices) {
+            if (index >= m_Vertices.size()) {
+                throw IndexOverflowException();
+            }
+        }
+    }
+    for (auto& indices: m_Faces) {
+        for (auto index: indices) {
+            if (index >= m_Vertices.size()) {
+                throw IndexOverflowException();
+            }
+        }
+    }
+}
+
+/**********************************************************************
+【函数名称】 GetVertices
+【函数功能】 获取去重后的顶点数组。
+【参数】 无
+【返回值】
+    顶点数组的常引用。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+const vector<Point<N>>& IndexedModel<N>::GetVertices() const {
+    return m_Vertices;
+}
+
+/**********************************************************************
+【函数名称】 GetLineIndices
+【函数功能】 获取所有线段的顶点下标。
+【参数】 无
+【返回值】
+    线段顶点下标数组的常引用。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+const vector<typename IndexedModel<N>::LineIndices>&
+IndexedModel<N>::GetLineIndices() const {
+    return m_Lines;
+}
+
+/**********************************************************************
+【函数名称】 GetFaceIndices
+【函数功能】 获取所有面的顶点下标。
+【参数】 无
+【返回值】
+    面顶点下标数组的常引用。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+const vector<typename IndexedModel<N>::FaceIndices>&
+IndexedModel<N>::GetFaceIndices() const {
+    return m_Faces;
+}
+
+/**********************************************************************
+【函数名称】 GetLine
+【函数功能】 获取指定下标处的线段。如果越界抛出 IndexOverflowException。
+【参数】
+    index: 线段的下标。
+【返回值】
+    由顶点构造出的线段。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+Line<N> IndexedModel<N>::GetLine(size_t index) const {
+    if (index >= m_Lines.size()) {
+        throw IndexOverflowException();
+    }
+    auto& indices = m_Lines[index];
+    return Line<N> { m_Vertices[indices[0]], m_Vertices[indices[1]] };
+}
+
+/**********************************************************************
+【函数名称】 GetFace
+【函数功能】 获取指定下标处的面。如果越界抛出 IndexOverflowException。
+【参数】
+    index: 面的下标。
+【返回值】
+    由顶点构造出的面。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+Face<N> IndexedModel<N>::GetFace(size_t index) const {
+    if (index >= m_Faces.size()) {
+        throw IndexOverflowException();
+    }
+    auto& indices = m_Faces[index];
+    return Face<N> {
+        m_Vertices[indices[0]],
+        m_Vertices[indices[1]],
+        m_Vertices[indices[2]]
+    };
+}
+
+/**********************************************************************
+【函数名称】 GetBoundingBox
+【函数功能】 直接由顶点数组求能包含此模型中所有元素的最小长方体。
+【参数】 无
+【返回值】
+    能包含此模型中所有元素的最小长方体。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+Tools::Box<N> IndexedModel<N>::GetBoundingBox() const {
+    return Tools::Box<N>::GetBoundingBoxOf(
+        m_Vertices.begin(),
+        m_Vertices.end()
+    );
+}
+
+/**********************************************************************
+【函数名称】 Reserve
+【函数功能】 为顶点与元素预留空间。
+【参数】
+    vertexCount: 预计的顶点数。
+    lineCount: 预计的线段数。
+    faceCount: 预计的面数。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void IndexedModel<N>::Reserve(
+    size_t vertexCount,
+    size_t lineCount,
+    size_t faceCount
+) {
+    m_Vertices.reserve(vertexCount);
+    m_Lines.reserve(lineCount);
+    m_Faces.reserve(faceCount);
+    if (m_IsLookupValid) {
+        m_Lookup.reserve(vertexCount);
+    }
+}
+
+/**********************************************************************
+【函数名称】 AddVertex
+【函数功能】
+    添加一个顶点。如果相同的顶点已存在则直接返回其下标。
+    如果顶点数超出 32 位下标范围抛出 IndexOverflowException。
+【参数】
+    point: 要添加的顶点。
+【返回值】
+    顶点在顶点数组中的下标。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+uint32_t IndexedModel<N>::AddVertex(const Point<N>& point) {
+    if (!m_IsLookupValid) {
+        m_Lookup.reserve(m_Vertices.size());
+        for (size_t i = 0; i < m_Vertices.size(); i++) {
+            m_Lookup.insert({ m_Vertices[i], static_cast<uint32_t>(i) });
+        }
+        m_IsLookupValid = true;
+    }
+    auto found = m_Lookup.find(point);
+    if (found != m_Lookup.end()) {
+        return found->second;
+    }
+    if (m_Vertices.size() >= numeric_limits<uint32_t>::max()) {
+        throw IndexOverflowException();
+    }
+    auto index = static_cast<uint32_t>(m_Vertices.size());
+    m_Vertices.push_back(point);
+    m_Lookup.insert({ point, index });
+    return index;
+}
+
+/**********************************************************************
+【函数名称】 AddLine
+【函数功能】
+    按顶点下标添加一条线段，不检查元素是否重复。
+    如果下标越界抛出 IndexOverflowException。
+【参数】
+    indices: 两个顶点的下标。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void IndexedModel<N>::AddLine(const LineIndices& indices) {
+    for (auto index: indices) {
+        if (index >= m_Vertices.size()) {
+            throw IndexOverflowException();
+        }
+    }
+    m_Lines.push_back(indices);
+}
+
+/**********************************************************************
+【函数名称】 AddFace
+【函数功能】
+    按顶点下标添加一个面，不检查元素是否重复。
+    如果下标越界抛出 IndexOverflowException。
+【参数】
+    indices: 三个顶点的下标。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void IndexedModel<N>::AddFace(const FaceIndices& indices) {
+    for (auto index: indices) {
+        if (index >= m_Vertices.size()) {
+            throw IndexOverflowException();
+        }
+    }
+    m_Faces.push_back(indices);
+}
+
+/**********************************************************************
+【函数名称】 ReleaseLookup
+【函数功能】
+    释放用于顶点去重的查找表以节省内存。
+    之后再调用 AddVertex 时会重新建立。
+【参数】 无
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void IndexedModel<N>::ReleaseLookup() {
+    // clear 不会释放桶数组，故与空表交换
+    unordered_map<Point<N>, uint32_t>().swap(m_Lookup);
+    m_IsLookupValid = false;
+}
+
+/**********************************************************************
+【函数名称】 ToModel
+【函数功能】
+    将索引形式转化为 Model。
+    如果有重复元素抛出 CollectionException。
+【参数】 无
+【返回值】
+    对应的 Model。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+Model<N> IndexedModel<N>::ToModel() const {
+    Model<N> model(Name);
+    model.Lines.Reserve(m_Lines.size());
+    model.Faces.Reserve(m_Faces.size());
+    for (size_t i = 0; i < m_Lines.size(); i++) {
+        model.Lines.Add(GetLine(i));
+    }
+    for (size_t i = 0; i < m_Faces.size(); i++) {
+        model.Faces.Add(GetFace(i));
+    }
+    return model;
+}
+
+}
\ No newline at end of file
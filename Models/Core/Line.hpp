@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <type_traits>
 #include "Element.hpp"
 #include "Vector.hpp"
 #include "Point.hpp"
@@ -21,13 +22,6 @@ namespace C3w {
 template <size_t N>
 class Line: public Element<N, 2> {
     public:
-        // 属性
-        
-        // 起始点
-        const Point<N>& Start { this->Points[0] };
-        // 中止点
-        const Point<N>& End { this->Points[1] };
-
         // 构造函数
 
         // 使用 Element 的构造函数
@@ -49,7 +43,7 @@ class Line: public Element<N, 2> {
         【返回值】 无
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        Line(const Line<N>& other);
+        Line(const Line<N>& other) = default;
 
         // 属性
 
@@ -61,7 +55,7 @@ class Line: public Element<N, 2> {
             此元素的长度。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        double GetLength() const override;
+        double GetLength() const;
         /**********************************************************************
         【函数名称】 GetArea
         【函数功能】 求此元素的面积。
@@ -70,7 +64,25 @@ class Line: public Element<N, 2> {
             此元素的面积。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        double GetArea() const override;
+        double GetArea() const;
+        /**********************************************************************
+        【函数名称】 GetStart
+        【函数功能】 获取起始点。
+        【参数】 无
+        【返回值】
+            起始点的常引用。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        const Point<N>& GetStart() const;
+        /**********************************************************************
+        【函数名称】 GetEnd
+        【函数功能】 获取中止点。
+        【参数】 无
+        【返回值】
+            中止点的常引用。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        const Point<N>& GetEnd() const;
 
         // 操作符
 
@@ -93,7 +105,7 @@ class Line: public Element<N, 2> {
             自身的引用。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        Line<N>& operator=(const Line<N>& other);
+        Line<N>& operator=(const Line<N>& other) = default;
         /**********************************************************************
         【函数名称】 operator Vector<double, N>
         【函数功能】 将自身转化为向量。
@@ -105,6 +117,37 @@ class Line: public Element<N, 2> {
         operator Vector<double, N>() const;
 };
 
+// 元素没有虚函数表，只含 2 个点，可整体按字节复制
+static_assert(
+    sizeof(Line<3>) == 2 * sizeof(Point<3>),
+    "Line<3> must consist of exactly two points."
+);
+static_assert(
+    is_standard_layout<Line<3>>::value,
+    "Line<3> must be standard-layout."
+);
+static_assert(
+    is_trivially_copyable<Line<3>>::value,
+    "Line<3> must be trivially copyable."
+);
+
+}
+
+namespace std {
+
+/*************************************************************************
+【类名】 hash<C3w::Line<N>>
+【功能】 使 Line 可以用作无序容器的键。
+【接口说明】 函数对象，调用 GetHashCode。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+template <size_t N>
+struct hash<C3w::Line<N>> {
+    size_t operator()(const C3w::Line<N>& line) const {
+        return line.GetHashCode();
+    }
+};
+
 }
 
 #include "Line.tpp"
\ No newline at end of file
@@ -23,17 +23,6 @@ namespace C3w {
 template <size_t N>
 Line<N>::Line(const Element<N, 2>& element): Element<N, 2>(element) {}
 
-/**********************************************************************
-【函数名称】 拷贝构造函数
-【函数功能】 使用另一 Line 对象初始化 Line 对象。
-【参数】 
-    other: 另一个 Line 对象。
-【返回值】 无
-【开发者及日期】 赵一彤 2024/7/24
-**********************************************************************/
-template <size_t N>
-Line<N>::Line(const Line<N>& other): Element<N, 2>(other) {}
-
 /**********************************************************************
 【函数名称】 GetLength
 【函数功能】 求此元素的长度。
@@ -44,7 +33,9 @@ Line<N>::Line(const Line<N>& other): Element<N, 2>(other) {}
 **********************************************************************/
 template <size_t N>
 double Line<N>::GetLength() const {
-    return Point<N>::Distance(this->Points[0], this->Points[1]);
+    // 两个点必然存在，直接用迭代器访问，免去越界检测与虚函数调用
+    auto points = this->Points.begin();
+    return Point<N>::Distance(points[0], points[1]);
 }
 
 /**********************************************************************
@@ -61,35 +52,44 @@ double Line<N>::GetArea() const {
 }
 
 /**********************************************************************
-【函数名称】 operator=
-【函数功能】 将另一元素赋值给自身。
-【参数】
-    other: 从之取值的元素。
+【函数名称】 GetStart
+【函数功能】 获取起始点。
+【参数】 无
 【返回值】
-    自身的引用。
-【开发者及日期】 赵一彤 2024/7/24
+    起始点的常引用。
+【开发者及日期】 赵一彤 2026/10/17
 **********************************************************************/
 template <size_t N>
-Line<N>& Line<N>::operator=(const Element<N, 2>& element) {
-    if (this != &element) {
-        Element<N, 2>::operator=(element);
-    }
-    return *this;
+const Point<N>& Line<N>::GetStart() const {
+    return this->Points[0];
+}
+
+/**********************************************************************
+【函数名称】 GetEnd
+【函数功能】 获取中止点。
+【参数】 无
+【返回值】
+    中止点的常引用。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+const Point<N>& Line<N>::GetEnd() const {
+    return this->Points[1];
 }
 
 /**********************************************************************
 【函数名称】 operator=
-【函数功能】 将另一线段赋值给自身。
+【函数功能】 将另一元素赋值给自身。
 【参数】
-    other: 从之取值的线段。
+    other: 从之取值的元素。
 【返回值】
     自身的引用。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <size_t N>
-Line<N>& Line<N>::operator=(const Line<N>& other) {
-    if (this != &other) {
-        Element<N, 2>::operator=(other);
+Line<N>& Line<N>::operator=(const Element<N, 2>& element) {
+    if (this != &element) {
+        Element<N, 2>::operator=(element);
     }
     return *this;
 }
@@ -8,10 +8,15 @@
 
 #include <cstddef>
 #include <string>
+#include <vector>
+#include "AffineTransform.hpp"
 #include "Face.hpp"
 #include "Line.hpp"
 #include "Point.hpp"
+#include "PointBatch.hpp"
+#include "Vector.hpp"
 #include "../Containers/DynamicSet.hpp"
+#include "../Containers/HashedSet.hpp"
 #include "../Tools/Box.hpp"
 using namespace std;
 using namespace C3w::Containers;
@@ -27,6 +32,40 @@ namespace C3w {
 template <size_t N>
 class Model {
     public:
+        // 内嵌类型
+
+        /**********************************************************************
+        【类名】 WeldResult
+        【功能】 用于 Weld 的返回值。
+        【接口说明】 被移动的点数，保留的线段与面在焊接前的下标。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        struct WeldResult {
+            // 被并入其他位置的点的个数，元素中的每个点各计一次
+            size_t MovedPointCount;
+            // 保留的线段在焊接前的下标，按升序排列
+            vector<size_t> KeptLines;
+            // 保留的面在焊接前的下标，按升序排列
+            vector<size_t> KeptFaces;
+        };
+
+        /**********************************************************************
+        【类名】 DiffResult
+        【功能】 用于 Diff 的返回值。
+        【接口说明】 另一模型中新增的与删除的线段和面。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        struct DiffResult {
+            // 另一模型中有而自身没有的线段
+            DynamicSet<Line<N>> AddedLines;
+            // 自身有而另一模型中没有的线段
+            DynamicSet<Line<N>> RemovedLines;
+            // 另一模型中有而自身没有的面
+            DynamicSet<Face<N>> AddedFaces;
+            // 自身有而另一模型中没有的面
+            DynamicSet<Face<N>> RemovedFaces;
+        };
+
         // 成员
 
         // 维数
@@ -34,9 +73,9 @@ class Model {
         // 名称
         string Name;
         // 线段集合
-        DynamicSet<Line<N>> Lines;
+        HashedSet<Line<N>> Lines;
         // 面集合
-        DynamicSet<Face<N>> Faces;
+        HashedSet<Face<N>> Faces;
 
         // 构造函数
 
@@ -73,6 +112,39 @@ class Model {
             const DynamicSet<Face<N>>& faces
         );
         /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 
+            使用名称，并取走线段集合与面集合的存储初始化 Model 类型实例。
+            元素不被复制，只为其建立哈希索引。
+        【参数】
+            name: 模型的名称。
+            lines: 模型中的线集合，之后为空。
+            faces: 模型中的面集合，之后为空。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Model(
+            string name,
+            DynamicSet<Line<N>>&& lines,
+            DynamicSet<Face<N>>&& faces
+        );
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 
+            使用名称，并取走已建好索引的线段集合与面集合初始化 Model 类型实例。
+        【参数】
+            name: 模型的名称。
+            lines: 模型中的线集合，之后为空。
+            faces: 模型中的面集合，之后为空。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Model(
+            string name,
+            HashedSet<Line<N>>&& lines,
+            HashedSet<Face<N>>&& faces
+        );
+        /**********************************************************************
         【函数名称】 拷贝构造函数
         【函数功能】 使用另一 Model 对象初始化 Model 类型实例。
         【参数】
@@ -81,6 +153,15 @@ class Model {
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
         Model(const Model<N>& other) = default;
+        /**********************************************************************
+        【函数名称】 移动构造函数
+        【函数功能】 取走另一 Model 对象的名称与元素初始化 Model 类型实例。
+        【参数】
+            other: 另一 Model 对象，之后为空。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Model(Model<N>&& other) = default;
 
         // 属性
 
@@ -92,7 +173,7 @@ class Model {
             包含模型中所有点的集合。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        virtual DynamicSet<Point<N>> CollectPoints() const;
+        virtual HashedSet<Point<N>> CollectPoints() const;
         /**********************************************************************
         【函数名称】 GetBoundingBox
         【函数功能】 获取能包含此模型中所有元素的最小长方体。
@@ -102,6 +183,98 @@ class Model {
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
         Tools::Box<N> GetBoundingBox() const;
+        /**********************************************************************
+        【函数名称】 ExportVertices
+        【函数功能】
+            按元素顺序将所有点导出到 PointBatch：先是每条线段的 2 个点，
+            再是每个面的 3 个点。共享的点不去重，以保持与元素一一对应。
+        【参数】 无
+        【返回值】
+            含有 Lines.Count() * 2 + Faces.Count() * 3 个点的点批。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        PointBatch<N> ExportVertices() const;
+
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 ImportVertices
+        【函数功能】
+            按 ExportVertices 的顺序用点批中的点替换所有元素的点。
+            点数不符时抛出 InvalidSizeException；
+            替换后元素内有重合的点或元素重复时抛出 CollectionException，
+            此时模型保持不变。
+        【参数】
+            vertices: 提供新坐标的点批。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void ImportVertices(const PointBatch<N>& vertices);
+        /**********************************************************************
+        【函数名称】 Translate
+        【函数功能】
+            将整个模型向指定方向移动指定长度。
+            点批一次算出所有新坐标后原地写回元素，只重建一次索引。
+            舍入使元素内的点重合或元素重复时抛出 CollectionException，
+            此时模型保持不变。
+        【参数】
+            delta: 移动的方向和长度。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void Translate(const Vector<double, N>& delta);
+        /**********************************************************************
+        【函数名称】 ScaleAbout
+        【函数功能】
+            将整个模型以定点为中心缩放，写回方式与异常同 Translate。
+        【参数】
+            ref: 参考点。
+            ratio: 缩放的比例。
+        【返回值】
+            变换是否为单射，即 ratio 是否不为 0。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        bool ScaleAbout(const Point<N>& ref, double ratio);
+        /**********************************************************************
+        【函数名称】 Transform
+        【函数功能】
+            对整个模型施加仿射变换，写回方式与异常同 Translate。
+            非单射的变换不一定失败，只要实际没有点或元素被合并。
+        【参数】
+            transform: 要施加的仿射变换。
+        【返回值】
+            变换是否为单射。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        bool Transform(const AffineTransform<N>& transform);
+        /**********************************************************************
+        【函数名称】 Weld
+        【函数功能】
+            焊接相距不超过 epsilon 的点。按 ExportVertices 的顺序逐点处理，
+            以边长 2 * epsilon 的均匀网格哈希查找已有的代表点：
+            距离不超过 epsilon 的代表点中取最近者，并将该点移到代表点处，
+            找不到时该点成为新的代表点。代表点之间的距离均大于 epsilon。
+            随后用新位置重建元素，丢弃点重合而退化的元素与重复的元素。
+            期望复杂度为 O(V)。epsilon 不为正数时不做任何改变。
+        【参数】
+            epsilon: 焊接的距离。
+        【返回值】
+            被移动的点数与保留的元素。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        WeldResult Weld(double epsilon);
+        /**********************************************************************
+        【函数名称】 Diff
+        【函数功能】
+            比较自身与另一模型的线段和面，元素相等即视为相同，与顺序无关。
+            借助 DynamicSet 的差集运算，复杂度为 O(n + m)。
+        【参数】
+            other: 另一模型，视为自身修改后的版本。
+        【返回值】
+            新增与删除的元素，各自按所在模型中的顺序排列。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        DiffResult Diff(const Model<N>& other) const;
 
         // 操作符
         
@@ -115,9 +288,57 @@ class Model {
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
         Model<N>& operator=(const Model<N>& other) = default;
+        /**********************************************************************
+        【函数名称】 operator=
+        【函数功能】 取走其他模型的名称与元素。
+        【参数】 
+            other: 从之取值的模型，之后为空。
+        【返回值】 
+            自身的引用。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Model<N>& operator=(Model<N>&& other) = default;
 
         // 虚析构函数
         virtual ~Model() = default;
+
+    private:
+        /**********************************************************************
+        【函数名称】 ApplyVertices
+        【函数功能】
+            按 ExportVertices 的顺序将点批中的点原地写回所有元素，
+            不重新构造元素，每个集合只重建一次索引。
+            失败时写回 original 并抛出 CollectionException。
+        【参数】
+            vertices: 提供新坐标的点批。
+            original: 变换前由 ExportVertices 导出的点批。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void ApplyVertices(
+            const PointBatch<N>& vertices,
+            const PointBatch<N>& original
+        );
+        /**********************************************************************
+        【函数名称】 WeldElements
+        【函数功能】
+            将焊接后的位置写入一个元素集合，丢弃退化与重复的元素。
+            没有退化的元素时原地写回，只重建一次索引；
+            否则逐个加入新的集合，保留每组重复元素中的第一个。
+        【参数】
+            elements: 要写回的元素集合。
+            mapping: 集合中每个元素的每个点对应的代表点，按元素顺序排列。
+            representatives: 代表点的坐标，每个点 N 个。
+        【返回值】
+            保留的元素在写回前的下标，按升序排列。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        template <size_t S, typename E>
+        static vector<size_t> WeldElements(
+            HashedSet<E>& elements,
+            const size_t* mapping,
+            const vector<double>& representatives
+        );
 };
 
 }
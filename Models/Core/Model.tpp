@@ -4,16 +4,33 @@
 【开发者及日期】 赵一彤 2024/7/24
 *************************************************************************/
 
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <cstddef>
+#include <functional>
+#include <limits>
+#include <numeric>
 #include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "AffineTransform.hpp"
+#include "Errors.hpp"
 #include "Face.hpp"
 #include "Line.hpp"
 #include "Point.hpp"
+#include "PointBatch.hpp"
+#include "Vector.hpp"
 #include "../Containers/DynamicSet.hpp"
+#include "../Containers/FixedSet.hpp"
+#include "../Containers/HashedSet.hpp"
 #include "../Tools/Box.hpp"
+#include "../Tools/Hash.hpp"
 #include "Model.hpp"
 using namespace std;
 using namespace C3w::Containers;
+using namespace C3w::Errors;
 
 namespace C3w {
 
@@ -26,7 +43,7 @@ namespace C3w {
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <size_t N>
-Model<N>::Model(string name): Name(name) {}
+Model<N>::Model(string name): Name(move(name)) {}
 
 /**********************************************************************
 【函数名称】 构造函数
@@ -43,7 +60,44 @@ Model<N>::Model(
     string name, 
     const DynamicSet<Line<N>>& lines, 
     const DynamicSet<Face<N>>& faces
-): Name(name), Lines(lines), Faces(faces) {}
+): Name(move(name)), Lines(lines), Faces(faces) {}
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 
+    使用名称，并取走线段集合与面集合的存储初始化 Model 类型实例。
+    元素不被复制，只为其建立哈希索引。
+【参数】
+    name: 模型的名称。
+    lines: 模型中的线集合，之后为空。
+    faces: 模型中的面集合，之后为空。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+Model<N>::Model(
+    string name,
+    DynamicSet<Line<N>>&& lines,
+    DynamicSet<Face<N>>&& faces
+): Name(move(name)), Lines(move(lines)), Faces(move(faces)) {}
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 
+    使用名称，并取走已建好索引的线段集合与面集合初始化 Model 类型实例。
+【参数】
+    name: 模型的名称。
+    lines: 模型中的线集合，之后为空。
+    faces: 模型中的面集合，之后为空。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+Model<N>::Model(
+    string name,
+    HashedSet<Line<N>>&& lines,
+    HashedSet<Face<N>>&& faces
+): Name(move(name)), Lines(move(lines)), Faces(move(faces)) {}
 
 /**********************************************************************
 【函数名称】 CollectPoints
@@ -54,8 +108,8 @@ Model<N>::Model(
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <size_t N>
-DynamicSet<Point<N>> Model<N>::CollectPoints() const {
-    DynamicSet<Point<N>> points;
+HashedSet<Point<N>> Model<N>::CollectPoints() const {
+    HashedSet<Point<N>> points;
     for (auto& line: Lines) {
         for (auto& point: line.Points) {
             points.TryAdd(point);
@@ -79,7 +133,430 @@ DynamicSet<Point<N>> Model<N>::CollectPoints() const {
 **********************************************************************/
 template <size_t N>
 Tools::Box<N> Model<N>::GetBoundingBox() const {
-    return Tools::Box<N>::GetBoundingBoxOf(CollectPoints());
+    // 重复的点不影响最值，无需先用 CollectPoints 去重
+    return ExportVertices().GetBoundingBox();
+}
+
+/**********************************************************************
+【函数名称】 ExportVertices
+【函数功能】
+    按元素顺序将所有点导出到 PointBatch：先是每条线段的 2 个点，
+    再是每个面的 3 个点。共享的点不去重，以保持与元素一一对应。
+【参数】 无
+【返回值】
+    含有 Lines.Count() * 2 + Faces.Count() * 3 个点的点批。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+PointBatch<N> Model<N>::ExportVertices() const {
+    PointBatch<N> vertices;
+    vertices.Reserve(Lines.Count() * 2 + Faces.Count() * 3);
+    for (auto& line: Lines) {
+        for (auto& point: line.Points) {
+            vertices.Add(point);
+        }
+    }
+    for (auto& face: Faces) {
+        for (auto& point: face.Points) {
+            vertices.Add(point);
+        }
+    }
+    return vertices;
+}
+
+/**********************************************************************
+【函数名称】 ImportVertices
+【函数功能】
+    按 ExportVertices 的顺序用点批中的点替换所有元素的点。
+    点数不符时抛出 InvalidSizeException；
+    替换后元素内有重合的点或元素重复时抛出 CollectionException，
+    此时模型保持不变。
+【参数】
+    vertices: 提供新坐标的点批。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void Model<N>::ImportVertices(const PointBatch<N>& vertices) {
+    auto lineCount = Lines.Count();
+    auto faceCount = Faces.Count();
+    if (vertices.Count() != lineCount * 2 + faceCount * 3) {
+        throw InvalidSizeException();
+    }
+    // 先建出新的集合，全部成功后再替换，保证异常时模型不变
+    vector<Line<N>> lines;
+    lines.reserve(lineCount);
+    size_t index = 0;
+    for (size_t i = 0; i < lineCount; i++, index += 2) {
+        lines.push_back(Line<N> {
+            vertices.GetPoint(index),
+            vertices.GetPoint(index + 1)
+        });
+    }
+    vector<Face<N>> faces;
+    faces.reserve(faceCount);
+    for (size_t i = 0; i < faceCount; i++, index += 3) {
+        faces.push_back(Face<N> {
+            vertices.GetPoint(index),
+            vertices.GetPoint(index + 1),
+            vertices.GetPoint(index + 2)
+        });
+    }
+    HashedSet<Line<N>> newLines(move(lines));
+    HashedSet<Face<N>> newFaces(move(faces));
+    Lines = move(newLines);
+    Faces = move(newFaces);
+}
+
+/**********************************************************************
+【函数名称】 Translate
+【函数功能】
+    将整个模型向指定方向移动指定长度。
+    点批一次算出所有新坐标后原地写回元素，只重建一次索引。
+    舍入使元素内的点重合或元素重复时抛出 CollectionException，
+    此时模型保持不变。
+【参数】
+    delta: 移动的方向和长度。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void Model<N>::Translate(const Vector<double, N>& delta) {
+    auto original = ExportVertices();
+    PointBatch<N> vertices(original);
+    vertices.MoveInplace(delta);
+    ApplyVertices(vertices, original);
+}
+
+/**********************************************************************
+【函数名称】 ScaleAbout
+【函数功能】
+    将整个模型以定点为中心缩放，写回方式与异常同 Translate。
+【参数】
+    ref: 参考点。
+    ratio: 缩放的比例。
+【返回值】
+    变换是否为单射，即 ratio 是否不为 0。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+bool Model<N>::ScaleAbout(const Point<N>& ref, double ratio) {
+    auto original = ExportVertices();
+    PointBatch<N> vertices(original);
+    vertices.ScaleInplace(ref, ratio);
+    ApplyVertices(vertices, original);
+    return ratio != 0.0;
+}
+
+/**********************************************************************
+【函数名称】 Transform
+【函数功能】
+    对整个模型施加仿射变换，写回方式与异常同 Translate。
+    非单射的变换不一定失败，只要实际没有点或元素被合并。
+【参数】
+    transform: 要施加的仿射变换。
+【返回值】
+    变换是否为单射。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+bool Model<N>::Transform(const AffineTransform<N>& transform) {
+    auto original = ExportVertices();
+    PointBatch<N> vertices(original);
+    transform.ApplyInplace(vertices);
+    ApplyVertices(vertices, original);
+    return transform.IsInjective();
+}
+
+/**********************************************************************
+【函数名称】 Weld
+【函数功能】
+    焊接相距不超过 epsilon 的点。按 ExportVertices 的顺序逐点处理，
+    以边长 2 * epsilon 的均匀网格哈希查找已有的代表点：
+    距离不超过 epsilon 的代表点中取最近者，并将该点移到代表点处，
+    找不到时该点成为新的代表点。代表点之间的距离均大于 epsilon。
+    随后用新位置重建元素，丢弃点重合而退化的元素与重复的元素。
+    期望复杂度为 O(V)。epsilon 不为正数时不做任何改变。
+【参数】
+    epsilon: 焊接的距离。
+【返回值】
+    被移动的点数与保留的元素。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+typename Model<N>::WeldResult Model<N>::Weld(double epsilon) {
+    WeldResult result { 0, vector<size_t>(), vector<size_t>() };
+    auto lineCount = Lines.Count();
+    auto faceCount = Faces.Count();
+    if (!(epsilon > 0)) {
+        result.KeptLines.resize(lineCount);
+        iota(result.KeptLines.begin(), result.KeptLines.end(), size_t(0));
+        result.KeptFaces.resize(faceCount);
+        iota(result.KeptFaces.begin(), result.KeptFaces.end(), size_t(0));
+        return result;
+    }
+    auto vertices = ExportVertices();
+    auto count = vertices.Count();
+    array<const double*, N> axes;
+    for (size_t axis = 0; axis < N; axis++) {
+        axes[axis] = vertices.GetAxis(axis);
+    }
+
+    // 网格坐标取浮点数，坐标很大或 epsilon 很小时也不会溢出
+    typedef array<double, N> Cell;
+    struct CellHash {
+        size_t operator()(const Cell& cell) const {
+            size_t seed = 0;
+            for (auto value: cell) {
+                seed = Tools::CombineHash(seed, hash<double>()(value));
+            }
+            return seed;
+        }
+    };
+    const size_t NONE = numeric_limits<size_t>::max();
+    // 每个格子中最后加入的代表点，同一格子的代表点由 next 串成链表
+    unordered_map<Cell, size_t, CellHash> heads;
+    heads.reserve(count);
+    vector<double> representatives;
+    vector<size_t> next;
+    // 每个点对应的代表点
+    vector<size_t> mapping(count);
+    double inverse = 1 / (2 * epsilon);
+    double limit = epsilon * epsilon;
+    for (size_t i = 0; i < count; i++) {
+        array<double, N> coordinates;
+        Cell cell;
+        // 每一维上离该点较近的相邻格子的方向
+        Cell side;
+        for (size_t axis = 0; axis < N; axis++) {
+            coordinates[axis] = axes[axis][i];
+            double scaled = coordinates[axis] * inverse;
+            cell[axis] = floor(scaled);
+            side[axis] = scaled - cell[axis] < 0.5 ? -1 : 1;
+        }
+        size_t best = NONE;
+        double bestDistance = numeric_limits<double>::infinity();
+        auto search = [&](const Cell& key) {
+            auto found = heads.find(key);
+            if (found == heads.end()) {
+                return;
+            }
+            for (auto k = found->second; k != NONE; k = next[k]) {
+                double distance = 0;
+                for (size_t axis = 0; axis < N; axis++) {
+                    double delta = representatives[k * N + axis] -
+                        coordinates[axis];
+                    distance += delta * delta;
+                }
+                if (distance <= limit && (distance < bestDistance ||
+                    (distance == bestDistance && k < best))) {
+                    best = k;
+                    bestDistance = distance;
+                }
+            }
+        };
+        search(cell);
+        // 重合的代表点至多一个，找到后无需再查相邻格子
+        if (bestDistance != 0) {
+            for (size_t mask = 1; mask < (size_t(1) << N); mask++) {
+                auto neighbor = cell;
+                for (size_t axis = 0; axis < N; axis++) {
+                    if ((mask >> axis) & 1) {
+                        neighbor[axis] += side[axis];
+                    }
+                }
+                search(neighbor);
+            }
+        }
+        if (best == NONE) {
+            best = next.size();
+            representatives.insert(
+                representatives.end(),
+                coordinates.begin(),
+                coordinates.end()
+            );
+            auto inserted = heads.insert({ cell, best });
+            if (inserted.second) {
+                next.push_back(NONE);
+            }
+            else {
+                next.push_back(inserted.first->second);
+                inserted.first->second = best;
+            }
+        }
+        else if (bestDistance != 0) {
+            result.MovedPointCount++;
+        }
+        mapping[i] = best;
+    }
+
+    result.KeptLines = WeldElements<2>(
+        Lines,
+        mapping.data(),
+        representatives
+    );
+    result.KeptFaces = WeldElements<3>(
+        Faces,
+        mapping.data() + lineCount * 2,
+        representatives
+    );
+    return result;
+}
+
+/**********************************************************************
+【函数名称】 ApplyVertices
+【函数功能】
+    按 ExportVertices 的顺序将点批中的点原地写回所有元素，
+    不重新构造元素，每个集合只重建一次索引。
+    失败时写回 original 并抛出 CollectionException。
+【参数】
+    vertices: 提供新坐标的点批。
+    original: 变换前由 ExportVertices 导出的点批。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void Model<N>::ApplyVertices(
+    const PointBatch<N>& vertices,
+    const PointBatch<N>& original
+) {
+    // 按顺序写回所有元素，返回各集合是否仍互不相同；
+    // 元素内的点重合时 FixedSet 抛出 CollectionException
+    auto write = [this](const PointBatch<N>& source) {
+        size_t index = 0;
+        bool isDistinct = Lines.TransformInplace([&](Line<N>& line) {
+            line.Points = FixedSet<Point<N>, 2>(array<Point<N>, 2> {{
+                source.GetPoint(index),
+                source.GetPoint(index + 1)
+            }});
+            index += 2;
+        });
+        if (isDistinct) {
+            isDistinct = Faces.TransformInplace([&](Face<N>& face) {
+                face.Points = FixedSet<Point<N>, 3>(array<Point<N>, 3> {{
+                    source.GetPoint(index),
+                    source.GetPoint(index + 1),
+                    source.GetPoint(index + 2)
+                }});
+                index += 3;
+            });
+        }
+        return isDistinct;
+    };
+    bool isApplied = false;
+    try {
+        isApplied = write(vertices);
+    }
+    catch (CollectionException) {
+        isApplied = false;
+    }
+    if (!isApplied) {
+        // 原坐标来自变换前的合法模型，写回不会失败
+        write(original);
+        throw CollectionException();
+    }
+}
+
+/**********************************************************************
+【函数名称】 Diff
+【函数功能】
+    比较自身与另一模型的线段和面，元素相等即视为相同，与顺序无关。
+    借助 DynamicSet 的差集运算，复杂度为 O(n + m)。
+【参数】
+    other: 另一模型，视为自身修改后的版本。
+【返回值】
+    新增与删除的元素，各自按所在模型中的顺序排列。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+typename Model<N>::DiffResult Model<N>::Diff(const Model<N>& other) const {
+    return DiffResult {
+        other.Lines - Lines,
+        Lines - other.Lines,
+        other.Faces - Faces,
+        Faces - other.Faces
+    };
+}
+
+/**********************************************************************
+【函数名称】 WeldElements
+【函数功能】
+    将焊接后的位置写入一个元素集合，丢弃退化与重复的元素。
+    没有退化的元素时原地写回，只重建一次索引；
+    否则逐个加入新的集合，保留每组重复元素中的第一个。
+【参数】
+    elements: 要写回的元素集合。
+    mapping: 集合中每个元素的每个点对应的代表点，按元素顺序排列。
+    representatives: 代表点的坐标，每个点 N 个。
+【返回值】
+    保留的元素在写回前的下标，按升序排列。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+template <size_t S, typename E>
+vector<size_t> Model<N>::WeldElements(
+    HashedSet<E>& elements,
+    const size_t* mapping,
+    const vector<double>& representatives
+) {
+    auto count = elements.Count();
+    auto getPoints = [&](size_t index) {
+        array<Point<N>, S> points;
+        for (size_t k = 0; k < S; k++) {
+            array<double, N> coordinates;
+            auto source = &representatives[mapping[index * S + k] * N];
+            copy(source, source + N, coordinates.begin());
+            points[k] = Point<N>(coordinates);
+        }
+        return FixedSet<Point<N>, S>(points);
+    };
+    auto isDegenerate = [&](size_t index) {
+        for (size_t a = 0; a < S; a++) {
+            for (size_t b = a + 1; b < S; b++) {
+                if (mapping[index * S + a] == mapping[index * S + b]) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    };
+    bool hasDegenerate = false;
+    for (size_t i = 0; i < count && !hasDegenerate; i++) {
+        hasDegenerate = isDegenerate(i);
+    }
+    vector<size_t> kept;
+    if (!hasDegenerate) {
+        size_t index = 0;
+        bool isDistinct = elements.TransformInplace([&](E& element) {
+            element.Points = getPoints(index++);
+        });
+        if (isDistinct) {
+            kept.resize(count);
+            iota(kept.begin(), kept.end(), size_t(0));
+            return kept;
+        }
+        HashedSet<E> distinct;
+        for (size_t i = 0; i < count; i++) {
+            if (distinct.TryAdd(elements[i])) {
+                kept.push_back(i);
+            }
+        }
+        elements = distinct;
+        return kept;
+    }
+    HashedSet<E> welded;
+    for (size_t i = 0; i < count; i++) {
+        if (isDegenerate(i)) {
+            continue;
+        }
+        E element(elements[i]);
+        element.Points = getPoints(i);
+        if (welded.TryAdd(element)) {
+            kept.push_back(i);
+        }
+    }
+    elements = welded;
+    return kept;
 }
 
 }
\ No newline at end of file
@@ -0,0 +1,192 @@
+/*************************************************************************
+【文件名】 ModelStatistics.hpp
+【功能模块和目的】 ModelStatistics 类增量维护 N 维模型的统计量。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <map>
+#include "Face.hpp"
+#include "Line.hpp"
+#include "Model.hpp"
+#include "Point.hpp"
+#include "../Tools/Box.hpp"
+#include "../Tools/CompensatedSum.hpp"
+using namespace std;
+
+namespace C3w {
+
+/*************************************************************************
+【类名】 ModelStatistics
+【功能】
+    随元素的添加与删除增量维护模型的统计量：线段总长度、面总面积，
+    以及每一维上所有点坐标的计数表，用于求外接长方体。
+    总长度与总面积使用补偿求和，反复加减后误差仍不随次数累积。
+【接口说明】
+    添加/删除线段与面，从模型重建，获取总长度、总面积与外接长方体。
+    添加与删除的复杂度为 O(log k)，k 为某一维上不同坐标值的个数。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+template <size_t N>
+class ModelStatistics final {
+    public:
+        // 成员
+
+        // 维数
+        static constexpr size_t Dimension { N };
+
+        // 构造函数
+
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 初始化空模型的统计量。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        ModelStatistics();
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 使用模型中的所有元素初始化统计量。
+        【参数】
+            model: 要统计的模型。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        explicit ModelStatistics(const Model<N>& model);
+        /**********************************************************************
+        【函数名称】 拷贝构造函数
+        【函数功能】 使用另一 ModelStatistics 初始化 ModelStatistics 类型实例。
+        【参数】
+            other: 另一 ModelStatistics 实例。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        ModelStatistics(const ModelStatistics<N>& other) = default;
+
+        // 属性
+
+        /**********************************************************************
+        【函数名称】 GetTotalLineLength
+        【函数功能】 获取线段总长度。
+        【参数】 无
+        【返回值】
+            所有线段的长度之和。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        double GetTotalLineLength() const;
+        /**********************************************************************
+        【函数名称】 GetTotalFaceArea
+        【函数功能】 获取面总面积。
+        【参数】 无
+        【返回值】
+            所有面的面积之和。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        double GetTotalFaceArea() const;
+        /**********************************************************************
+        【函数名称】 GetBoundingBox
+        【函数功能】 由每一维坐标的最值得到能包含所有元素的最小长方体。
+        【参数】 无
+        【返回值】
+            能包含所有元素的最小长方体。没有元素时两个顶点都为原点，
+            与 Model::GetBoundingBox 一致。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Tools::Box<N> GetBoundingBox() const;
+
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 Add
+        【函数功能】 将一条线段计入统计量。
+        【参数】
+            line: 要计入的线段。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void Add(const Line<N>& line);
+        /**********************************************************************
+        【函数名称】 Add
+        【函数功能】 将一个面计入统计量。
+        【参数】
+            face: 要计入的面。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void Add(const Face<N>& face);
+        /**********************************************************************
+        【函数名称】 Remove
+        【函数功能】 从统计量中移除一条此前计入的线段。
+        【参数】
+            line: 要移除的线段。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void Remove(const Line<N>& line);
+        /**********************************************************************
+        【函数名称】 Remove
+        【函数功能】 从统计量中移除一个此前计入的面。
+        【参数】
+            face: 要移除的面。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void Remove(const Face<N>& face);
+        /**********************************************************************
+        【函数名称】 Rebuild
+        【函数功能】 清空统计量并重新计入模型中的所有元素。
+        【参数】
+            model: 要统计的模型。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void Rebuild(const Model<N>& model);
+
+        // 操作符
+
+        /**********************************************************************
+        【函数名称】 operator=
+        【函数功能】 将另一 ModelStatistics 赋值给自身。
+        【参数】
+            other: 从之取值的 ModelStatistics。
+        【返回值】
+            自身的引用。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        ModelStatistics<N>& operator=(const ModelStatistics<N>& other) = default;
+
+    private:
+        // 线段总长度
+        Tools::CompensatedSum m_LineLength;
+        // 面总面积
+        Tools::CompensatedSum m_FaceArea;
+        // 每一维上各坐标值出现的次数，元素中的每个点各计一次
+        array<map<double, size_t>, N> m_Coordinates;
+
+        /**********************************************************************
+        【函数名称】 AddPoint
+        【函数功能】 将一个点的各维坐标计入计数表。
+        【参数】
+            point: 要计入的点。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void AddPoint(const Point<N>& point);
+        /**********************************************************************
+        【函数名称】 RemovePoint
+        【函数功能】 从计数表中移除一个点的各维坐标。
+        【参数】
+            point: 要移除的点。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void RemovePoint(const Point<N>& point);
+};
+
+}
+
+#include "ModelStatistics.tpp"
\ No newline at end of file
@@ -0,0 +1,236 @@
+/*************************************************************************
+【文件名】 ModelStatistics.tpp
+【功能模块和目的】 为 ModelStatistics.hpp 提供实现。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <map>
+#include <vector>
+#include "Face.hpp"
+#include "Line.hpp"
+#include "Model.hpp"
+#include "Point.hpp"
+#include "PointBatch.hpp"
+#include "../Tools/Box.hpp"
+#include "../Tools/CompensatedSum.hpp"
+#include "ModelStatistics.hpp"
+using namespace std;
+
+namespace C3w {
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 初始化空模型的统计量。
+【参数】 无
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+ModelStatistics<N>::ModelStatistics() {}
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 使用模型中的所有元素初始化统计量。
+【参数】
+    model: 要统计的模型。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+ModelStatistics<N>::ModelStatistics(const Model<N>& model):
+    ModelStatistics() {
+    Rebuild(model);
+}
+
+/**********************************************************************
+【函数名称】 GetTotalLineLength
+【函数功能】 获取线段总长度。
+【参数】 无
+【返回值】
+    所有线段的长度之和。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+double ModelStatistics<N>::GetTotalLineLength() const {
+    return m_LineLength.Get();
+}
+
+/**********************************************************************
+【函数名称】 GetTotalFaceArea
+【函数功能】 获取面总面积。
+【参数】 无
+【返回值】
+    所有面的面积之和。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+double ModelStatistics<N>::GetTotalFaceArea() const {
+    return m_FaceArea.Get();
+}
+
+/**********************************************************************
+【函数名称】 GetBoundingBox
+【函数功能】 由每一维坐标的最值得到能包含所有元素的最小长方体。
+【参数】 无
+【返回值】
+    能包含所有元素的最小长方体。没有元素时两个顶点都为原点，
+    与 Model::GetBoundingBox 一致。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+Tools::Box<N> ModelStatistics<N>::GetBoundingBox() const {
+    Point<N> minimum(Point<N>::Origin);
+    Point<N> maximum(Point<N>::Origin);
+    auto lower = minimum.GetData();
+    auto upper = maximum.GetData();
+    for (size_t axis = 0; axis < N; axis++) {
+        if (!m_Coordinates[axis].empty()) {
+            lower[axis] = m_Coordinates[axis].begin()->first;
+            upper[axis] = m_Coordinates[axis].rbegin()->first;
+        }
+    }
+    return Tools::Box<N>(minimum, maximum);
+}
+
+/**********************************************************************
+【函数名称】 Add
+【函数功能】 将一条线段计入统计量。
+【参数】
+    line: 要计入的线段。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void ModelStatistics<N>::Add(const Line<N>& line) {
+    m_LineLength.Add(line.GetLength());
+    for (auto& point: line.Points) {
+        AddPoint(point);
+    }
+}
+
+/**********************************************************************
+【函数名称】 Add
+【函数功能】 将一个面计入统计量。
+【参数】
+    face: 要计入的面。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void ModelStatistics<N>::Add(const Face<N>& face) {
+    m_FaceArea.Add(face.GetArea());
+    for (auto& point: face.Points) {
+        AddPoint(point);
+    }
+}
+
+/**********************************************************************
+【函数名称】 Remove
+【函数功能】 从统计量中移除一条此前计入的线段。
+【参数】
+    line: 要移除的线段。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void ModelStatistics<N>::Remove(const Line<N>& line) {
+    m_LineLength.Add(-line.GetLength());
+    for (auto& point: line.Points) {
+        RemovePoint(point);
+    }
+}
+
+/**********************************************************************
+【函数名称】 Remove
+【函数功能】 从统计量中移除一个此前计入的面。
+【参数】
+    face: 要移除的面。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void ModelStatistics<N>::Remove(const Face<N>& face) {
+    m_FaceArea.Add(-face.GetArea());
+    for (auto& point: face.Points) {
+        RemovePoint(point);
+    }
+}
+
+/**********************************************************************
+【函数名称】 Rebuild
+【函数功能】 清空统计量并重新计入模型中的所有元素。
+【参数】
+    model: 要统计的模型。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void ModelStatistics<N>::Rebuild(const Model<N>& model) {
+    m_LineLength = Tools::CompensatedSum();
+    m_FaceArea = Tools::CompensatedSum();
+    for (auto& line: model.Lines) {
+        m_LineLength.Add(line.GetLength());
+    }
+    for (auto& face: model.Faces) {
+        m_FaceArea.Add(face.GetArea());
+    }
+    // 逐维排序后按顺序插入计数表，比逐点查找插入快得多
+    auto vertices = model.ExportVertices();
+    auto count = vertices.Count();
+    vector<double> sorted;
+    for (size_t axis = 0; axis < N; axis++) {
+        auto coords = vertices.GetAxis(axis);
+        sorted.assign(coords, coords + count);
+        sort(sorted.begin(), sorted.end());
+        auto& coordinates = m_Coordinates[axis];
+        coordinates.clear();
+        for (size_t i = 0; i < count;) {
+            size_t j = i + 1;
+            while (j < count && sorted[j] == sorted[i]) {
+                j++;
+            }
+            coordinates.emplace_hint(coordinates.end(), sorted[i], j - i);
+            i = j;
+        }
+    }
+}
+
+/**********************************************************************
+【函数名称】 AddPoint
+【函数功能】 将一个点的各维坐标计入计数表。
+【参数】
+    point: 要计入的点。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void ModelStatistics<N>::AddPoint(const Point<N>& point) {
+    auto coords = point.GetData();
+    for (size_t axis = 0; axis < N; axis++) {
+        m_Coordinates[axis][coords[axis]]++;
+    }
+}
+
+/**********************************************************************
+【函数名称】 RemovePoint
+【函数功能】 从计数表中移除一个点的各维坐标。
+【参数】
+    point: 要移除的点。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void ModelStatistics<N>::RemovePoint(const Point<N>& point) {
+    auto coords = point.GetData();
+    for (size_t axis = 0; axis < N; axis++) {
+        auto it = m_Coordinates[axis].find(coords[axis]);
+        if (it != m_Coordinates[axis].end() && --it->second == 0) {
+            m_Coordinates[axis].erase(it);
+        }
+    }
+}
+
+}
\ No newline at end of file
@@ -8,6 +8,7 @@
 
 #include <cstddef>
 #include <string>
+#include <type_traits>
 #include "Vector.hpp"
 using namespace std;
 
@@ -72,6 +73,30 @@ class Point: public Vector<double, N> {
         **********************************************************************/
         double Distance(const Point<N>& other) const;
         /**********************************************************************
+        【函数名称】 SquaredDistance
+        【函数功能】 求两个点之间直线距离的平方，省去开方，适合比较远近。
+        【参数】
+            left: 第一个点。
+            right: 第二个点。
+        【返回值】
+            两点之间直线距离的平方。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static double SquaredDistance(
+            const Point<N>& left,
+            const Point<N>& right
+        );
+        /**********************************************************************
+        【函数名称】 SquaredDistance
+        【函数功能】 求自身与另一点之间直线距离的平方，省去开方，适合比较远近。
+        【参数】
+            other: 另一个点。
+        【返回值】
+            两点之间直线距离的平方。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        double SquaredDistance(const Point<N>& other) const;
+        /**********************************************************************
         【函数名称】 GeneralDistance
         【函数功能】 求两个点之间的广义直线距离。
         【参数】 
@@ -295,7 +320,7 @@ class Point: public Vector<double, N> {
             此对象的字符串表达形式。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        string ToString() const override;
+        string ToString() const;
 
         // 继承基类的函数：
         // GetComponent
@@ -319,6 +344,37 @@ class Point: public Vector<double, N> {
         using Vector<double, N>::Zero;
 };
 
+// 点没有虚函数表，按 POD 布局存储，可整体按字节复制
+static_assert(
+    sizeof(Point<3>) == 3 * sizeof(double),
+    "Point<3> must consist of exactly three doubles."
+);
+static_assert(
+    is_standard_layout<Point<3>>::value,
+    "Point<3> must be standard-layout."
+);
+static_assert(
+    is_trivially_copyable<Point<3>>::value,
+    "Point<3> must be trivially copyable."
+);
+
+}
+
+namespace std {
+
+/*************************************************************************
+【类名】 hash<C3w::Point<N>>
+【功能】 使 Point 可以用作无序容器的键。
+【接口说明】 函数对象，调用 GetHashCode。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+template <size_t N>
+struct hash<C3w::Point<N>> {
+    size_t operator()(const C3w::Point<N>& point) const {
+        return point.GetHashCode();
+    }
+};
+
 }
 
 #include "Point.tpp"
\ No newline at end of file
@@ -8,6 +8,7 @@
 #include <cstddef>
 #include <string>
 #include "Point.hpp"
+#include "VectorKernels.hpp"
 using namespace std;
 
 namespace C3w {
@@ -28,7 +29,7 @@ const Point<N> Point<N>::Origin { Point<N>() };
 **********************************************************************/
 template <size_t N>
 double Point<N>::Distance(const Point<N>& left, const Point<N>& right) {
-    return (left - right).Module();
+    return sqrt(SquaredDistance(left, right));
 }
 
 /**********************************************************************
@@ -45,6 +46,42 @@ double Point<N>::Distance(const Point<N>& other) const {
     return Distance(*this, other);
 }
 
+/**********************************************************************
+【函数名称】 SquaredDistance
+【函数功能】 求两个点之间直线距离的平方，省去开方，适合比较远近。
+【参数】
+    left: 第一个点。
+    right: 第二个点。
+【返回值】
+    两点之间直线距离的平方。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+double Point<N>::SquaredDistance(
+    const Point<N>& left,
+    const Point<N>& right
+) {
+    // 直接在分量数组上计算，不构造临时的差向量
+    return VectorKernels<double, N>::SquaredDistance(
+        left.GetData(),
+        right.GetData()
+    );
+}
+
+/**********************************************************************
+【函数名称】 SquaredDistance
+【函数功能】 求自身与另一点之间直线距离的平方，省去开方，适合比较远近。
+【参数】
+    other: 另一个点。
+【返回值】
+    两点之间直线距离的平方。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+double Point<N>::SquaredDistance(const Point<N>& other) const {
+    return SquaredDistance(*this, other);
+}
+
 /**********************************************************************
 【函数名称】 GeneralDistance
 【函数功能】 求两个点之间的广义直线距离。
@@ -98,8 +135,9 @@ Point<M> Point<N>::Project() const {
         return *reinterpret_cast<const Point<M>*>(this);
     }
     array<double, M> components;
+    auto data = this->GetData();
     for (size_t i = 0; i < M; i++) {
-        components[i] = this->GetComponent(i);
+        components[i] = data[i];
     }
     return Point<M>(components);
 }
@@ -122,9 +160,10 @@ Point<M> Point<N>::Promote(double pad) const {
         return *reinterpret_cast<const Point<M>*>(this);
     }
     array<double, M> components;
+    auto data = this->GetData();
     for (size_t i = 0; i < M; i++) {
         if (i < N) {
-            components[i] = this->GetComponent(i);
+            components[i] = data[i];
         }
         else {
             components[i] = pad;
@@ -189,7 +228,9 @@ Point<N> Point<N>::Add(
     const Point<N>& point, 
     const Vector<double, N>& delta
 ) {
-    return Point<N>(Vector<double, N>::Add(point, delta));
+    Point<N> result(point);
+    result.AddInplace(delta);
+    return result;
 }
 
 /**********************************************************************
@@ -235,7 +276,9 @@ Point<N> Point<N>::Subtract(
     const Point<N>& point,
     const Vector<double, N>& delta
 ) {
-    return Point<N>(Vector<double, N>::Subtract(point, delta));
+    Point<N> result(point);
+    result.SubtractInplace(delta);
+    return result;
 }
 
 /**********************************************************************
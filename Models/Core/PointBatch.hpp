@@ -0,0 +1,313 @@
+/*************************************************************************
+【文件名】 PointBatch.hpp
+【功能模块和目的】 PointBatch 类以分量分离的形式批量存储 N 维点。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include "Point.hpp"
+#include "Vector.hpp"
+#include "../Tools/Box.hpp"
+using namespace std;
+
+namespace C3w {
+
+/*************************************************************************
+【类名】 PointBatch
+【功能】
+    以“结构体数组”转置后的形式批量存储 N 维点：每一维的坐标各占一段
+    连续且按 64 字节对齐的数组，点本身不带虚函数表。
+    批量运算逐维遍历连续内存，便于编译器向量化。
+【接口说明】
+    添加、获取、设置点，按维获取坐标数组，
+    批量平移、缩放、求距离、求外接长方体，投影与升维。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+template <size_t N>
+class PointBatch final {
+    static_assert(N > 0, "Dimension must be positive.");
+    public:
+        // 成员
+
+        // 维数
+        static constexpr size_t Dimension { N };
+        // 每一维坐标数组的对齐字节数
+        static constexpr size_t ALIGNMENT { 64 };
+
+        // 构造函数
+
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 初始化空的 PointBatch 类型实例。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        PointBatch();
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 初始化含有 count 个原点的 PointBatch 类型实例。
+        【参数】
+            count: 点的个数。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        explicit PointBatch(size_t count);
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 使用点数组初始化 PointBatch 类型实例。
+        【参数】
+            points: 点构成的数组。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        PointBatch(const vector<Point<N>>& points);
+        /**********************************************************************
+        【函数名称】 拷贝构造函数
+        【函数功能】 使用另一 PointBatch 初始化 PointBatch 类型实例。
+        【参数】
+            other: 另一 PointBatch 实例。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        PointBatch(const PointBatch<N>& other);
+        /**********************************************************************
+        【函数名称】 移动构造函数
+        【函数功能】 接管另一 PointBatch 的存储，另一实例变为空。
+        【参数】
+            other: 另一 PointBatch 实例。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        PointBatch(PointBatch<N>&& other);
+
+        // 属性
+
+        /**********************************************************************
+        【函数名称】 Count
+        【函数功能】 获取点的个数。
+        【参数】 无
+        【返回值】
+            点的个数。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        size_t Count() const;
+        /**********************************************************************
+        【函数名称】 GetAxis
+        【函数功能】
+            获取某一维上所有点的坐标构成的连续数组，首地址按 ALIGNMENT 对齐。
+            如果维数越界抛出 IndexOverflowException。
+        【参数】
+            axis: 维的下标。
+        【返回值】
+            指向该维第一个坐标的常量指针，之后紧跟其余 Count() - 1 个坐标。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        const double* GetAxis(size_t axis) const;
+        /**********************************************************************
+        【函数名称】 GetAxis
+        【函数功能】
+            获取某一维上所有点的坐标构成的连续数组，首地址按 ALIGNMENT 对齐。
+            如果维数越界抛出 IndexOverflowException。
+        【参数】
+            axis: 维的下标。
+        【返回值】
+            指向该维第一个坐标的指针，之后紧跟其余 Count() - 1 个坐标。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        double* GetAxis(size_t axis);
+        /**********************************************************************
+        【函数名称】 GetPoint
+        【函数功能】 获取指定下标处的点。如果越界抛出 IndexOverflowException。
+        【参数】
+            index: 点的下标。
+        【返回值】
+            由各维坐标组成的点。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Point<N> GetPoint(size_t index) const;
+        /**********************************************************************
+        【函数名称】 SetPoint
+        【函数功能】 设置指定下标处的点。如果越界抛出 IndexOverflowException。
+        【参数】
+            index: 点的下标。
+            point: 新的点。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void SetPoint(size_t index, const Point<N>& point);
+        /**********************************************************************
+        【函数名称】 ToPoints
+        【函数功能】 将所有点转化为点数组。
+        【参数】 无
+        【返回值】
+            按下标顺序排列的点数组。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        vector<Point<N>> ToPoints() const;
+        /**********************************************************************
+        【函数名称】 GetBoundingBox
+        【函数功能】 逐维求最值，得到能包含所有点的最小长方体。
+        【参数】 无
+        【返回值】
+            能包含所有点的最小长方体。没有点时两个顶点都为原点。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Tools::Box<N> GetBoundingBox() const;
+        /**********************************************************************
+        【函数名称】 GetDistancesTo
+        【函数功能】
+            求每个点到给定点的直线距离。
+            各维按顺序累加，结果与 Point::Distance 逐位相同。
+        【参数】
+            point: 给定点。
+        【返回值】
+            按下标顺序排列的距离。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        vector<double> GetDistancesTo(const Point<N>& point) const;
+
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 Reserve
+        【函数功能】 为至少 capacity 个点预留空间。
+        【参数】
+            capacity: 预计的点数。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void Reserve(size_t capacity);
+        /**********************************************************************
+        【函数名称】 Resize
+        【函数功能】 改变点的个数，新增的点为原点。
+        【参数】
+            count: 新的点数。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void Resize(size_t count);
+        /**********************************************************************
+        【函数名称】 Add
+        【函数功能】 在末尾添加一个点。
+        【参数】
+            point: 要添加的点。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void Add(const Point<N>& point);
+        /**********************************************************************
+        【函数名称】 Clear
+        【函数功能】 删除所有点，保留已分配的空间。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void Clear();
+        /**********************************************************************
+        【函数名称】 MoveInplace
+        【函数功能】 将所有点向指定方向移动指定长度。
+        【参数】
+            delta: 移动的方向和长度。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void MoveInplace(const Vector<double, N>& delta);
+        /**********************************************************************
+        【函数名称】 ScaleInplace
+        【函数功能】
+            将所有点以定点为中心缩放。
+            与 Element::Scale 使用相同的公式，结果逐位相同。
+        【参数】
+            ref: 参考点。
+            ratio: 缩放的比例。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void ScaleInplace(const Point<N>& ref, double ratio);
+        /**********************************************************************
+        【函数名称】 Project
+        【函数功能】 将所有点投影到更低的 M 维，即只保留前 M 维的坐标。
+        【参数】 无
+        【返回值】
+            一个 M 维的点批。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        template <size_t M>
+        PointBatch<M> Project() const;
+        /**********************************************************************
+        【函数名称】 Promote
+        【函数功能】 将所有点升至更高的 M 维。
+        【参数】
+            pad: 新增维度上的坐标。
+        【返回值】
+            一个 M 维的点批。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        template <size_t M>
+        PointBatch<M> Promote(double pad = 0) const;
+
+        // 操作符
+
+        /**********************************************************************
+        【函数名称】 operator=
+        【函数功能】 将另一 PointBatch 赋值给自身。
+        【参数】
+            other: 从之取值的 PointBatch。
+        【返回值】
+            自身的引用。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        PointBatch<N>& operator=(const PointBatch<N>& other);
+        /**********************************************************************
+        【函数名称】 operator=
+        【函数功能】 接管另一 PointBatch 的存储，另一实例变为空。
+        【参数】
+            other: 从之取值的 PointBatch。
+        【返回值】
+            自身的引用。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        PointBatch<N>& operator=(PointBatch<N>&& other);
+
+    private:
+        // 每次扩容时容量取整到的点数，使每一维的起始地址都保持对齐
+        static constexpr size_t LANE_COUNT { ALIGNMENT / sizeof(double) };
+
+        // 所有维的坐标，在首部留有对齐所需的余量
+        vector<double> m_Storage;
+        // 第一维坐标数组的对齐后首地址，第 i 维位于 m_Base + i * m_Capacity
+        double* m_Base;
+        // 点的个数
+        size_t m_Count;
+        // 每一维能容纳的点数
+        size_t m_Capacity;
+
+        /**********************************************************************
+        【函数名称】 InnerGetPoint
+        【函数功能】 获取指定下标处的点，不检查越界。
+        【参数】
+            index: 点的下标。
+        【返回值】
+            由各维坐标组成的点。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Point<N> InnerGetPoint(size_t index) const;
+        /**********************************************************************
+        【函数名称】 InnerSetPoint
+        【函数功能】 设置指定下标处的点，不检查越界。
+        【参数】
+            index: 点的下标。
+            point: 新的点。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void InnerSetPoint(size_t index, const Point<N>& point);
+};
+
+}
+
+#include "PointBatch.tpp"
\ No newline at end of file
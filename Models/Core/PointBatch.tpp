@@ -0,0 +1,518 @@
+/*************************************************************************
+【文件名】 PointBatch.tpp
+【功能模块和目的】 为 PointBatch.hpp 提供实现。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+#include "Errors.hpp"
+#include "Point.hpp"
+#include "PointBatch.hpp"
+#include "Vector.hpp"
+#include "../Tools/Box.hpp"
+using namespace std;
+using namespace C3w::Errors;
+
+namespace C3w {
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 初始化空的 PointBatch 类型实例。
+【参数】 无
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+PointBatch<N>::PointBatch(): m_Base(nullptr), m_Count(0), m_Capacity(0) {}
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 初始化含有 count 个原点的 PointBatch 类型实例。
+【参数】
+    count: 点的个数。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+PointBatch<N>::PointBatch(size_t count): PointBatch() {
+    Resize(count);
+}
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 使用点数组初始化 PointBatch 类型实例。
+【参数】
+    points: 点构成的数组。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+PointBatch<N>::PointBatch(const vector<Point<N>>& points): PointBatch() {
+    Reserve(points.size());
+    m_Count = points.size();
+    for (size_t i = 0; i < m_Count; i++) {
+        InnerSetPoint(i, points[i]);
+    }
+}
+
+/**********************************************************************
+【函数名称】 拷贝构造函数
+【函数功能】 使用另一 PointBatch 初始化 PointBatch 类型实例。
+【参数】
+    other: 另一 PointBatch 实例。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+PointBatch<N>::PointBatch(const PointBatch<N>& other): PointBatch() {
+    Reserve(other.m_Count);
+    m_Count = other.m_Count;
+    for (size_t axis = 0; axis < N; axis++) {
+        copy(
+            other.m_Base + axis * other.m_Capacity,
+            other.m_Base + axis * other.m_Capacity + m_Count,
+            m_Base + axis * m_Capacity
+        );
+    }
+}
+
+/**********************************************************************
+【函数名称】 移动构造函数
+【函数功能】 接管另一 PointBatch 的存储，另一实例变为空。
+【参数】
+    other: 另一 PointBatch 实例。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+PointBatch<N>::PointBatch(PointBatch<N>&& other): PointBatch() {
+    *this = move(other);
+}
+
+/**********************************************************************
+【函数名称】 Count
+【函数功能】 获取点的个数。
+【参数】 无
+【返回值】
+    点的个数。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+size_t PointBatch<N>::Count() const {
+    return m_Count;
+}
+
+/**********************************************************************
+【函数名称】 GetAxis
+【函数功能】
+    获取某一维上所有点的坐标构成的连续数组，首地址按 ALIGNMENT 对齐。
+    如果维数越界抛出 IndexOverflowException。
+【参数】
+    axis: 维的下标。
+【返回值】
+    指向该维第一个坐标的常量指针，之后紧跟其余 Count() - 1 个坐标。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+const double* PointBatch<N>::GetAxis(size_t axis) const {
+    if (axis >= N) {
+        throw IndexOverflowException();
+    }
+    return m_Base + axis * m_Capacity;
+}
+
+/**********************************************************************
+【函数名称】 GetAxis
+【函数功能】
+    获取某一维上所有点的坐标构成的连续数组，首地址按 ALIGNMENT 对齐。
+    如果维数越界抛出 IndexOverflowException。
+【参数】
+    axis: 维的下标。
+【返回值】
+    指向该维第一个坐标的指针，之后紧跟其余 Count() - 1 个坐标。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+double* PointBatch<N>::GetAxis(size_t axis) {
+    if (axis >= N) {
+        throw IndexOverflowException();
+    }
+    return m_Base + axis * m_Capacity;
+}
+
+/**********************************************************************
+【函数名称】 GetPoint
+【函数功能】 获取指定下标处的点。如果越界抛出 IndexOverflowException。
+【参数】
+    index: 点的下标。
+【返回值】
+    由各维坐标组成的点。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+Point<N> PointBatch<N>::GetPoint(size_t index) const {
+    if (index >= m_Count) {
+        throw IndexOverflowException();
+    }
+    return InnerGetPoint(index);
+}
+
+/**********************************************************************
+【函数名称】 SetPoint
+【函数功能】 设置指定下标处的点。如果越界抛出 IndexOverflowException。
+【参数】
+    index: 点的下标。
+    point: 新的点。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void PointBatch<N>::SetPoint(size_t index, const Point<N>& point) {
+    if (index >= m_Count) {
+        throw IndexOverflowException();
+    }
+    InnerSetPoint(index, point);
+}
+
+/**********************************************************************
+【函数名称】 ToPoints
+【函数功能】 将所有点转化为点数组。
+【参数】 无
+【返回值】
+    按下标顺序排列的点数组。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+vector<Point<N>> PointBatch<N>::ToPoints() const {
+    vector<Point<N>> points;
+    points.reserve(m_Count);
+    for (size_t i = 0; i < m_Count; i++) {
+        points.push_back(InnerGetPoint(i));
+    }
+    return points;
+}
+
+/**********************************************************************
+【函数名称】 GetBoundingBox
+【函数功能】 逐维求最值，得到能包含所有点的最小长方体。
+【参数】 无
+【返回值】
+    能包含所有点的最小长方体。没有点时两个顶点都为原点。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+Tools::Box<N> PointBatch<N>::GetBoundingBox() const {
+    if (m_Count == 0) {
+        return Tools::Box<N>(Point<N>::Origin, Point<N>::Origin);
+    }
+    array<double, N> minCoords;
+    array<double, N> maxCoords;
+    for (size_t axis = 0; axis < N; axis++) {
+        const double* coords = m_Base + axis * m_Capacity;
+        double minCoord = coords[0];
+        double maxCoord = coords[0];
+        for (size_t i = 1; i < m_Count; i++) {
+            minCoord = coords[i] < minCoord ? coords[i] : minCoord;
+            maxCoord = coords[i] > maxCoord ? coords[i] : maxCoord;
+        }
+        minCoords[axis] = minCoord;
+        maxCoords[axis] = maxCoord;
+    }
+    return Tools::Box<N>(Point<N>(minCoords), Point<N>(maxCoords));
+}
+
+/**********************************************************************
+【函数名称】 GetDistancesTo
+【函数功能】
+    求每个点到给定点的直线距离。
+    各维按顺序累加，结果与 Point::Distance 逐位相同。
+【参数】
+    point: 给定点。
+【返回值】
+    按下标顺序排列的距离。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+vector<double> PointBatch<N>::GetDistancesTo(const Point<N>& point) const {
+    vector<double> distances(m_Count);
+    double* output = distances.data();
+    auto target = point.GetData();
+    for (size_t axis = 0; axis < N; axis++) {
+        const double* coords = m_Base + axis * m_Capacity;
+        double ref = target[axis];
+        if (axis == 0) {
+            for (size_t i = 0; i < m_Count; i++) {
+                double difference = coords[i] - ref;
+                output[i] = difference * difference;
+            }
+        }
+        else {
+            for (size_t i = 0; i < m_Count; i++) {
+                double difference = coords[i] - ref;
+                output[i] += difference * difference;
+            }
+        }
+    }
+    for (size_t i = 0; i < m_Count; i++) {
+        output[i] = sqrt(output[i]);
+    }
+    return distances;
+}
+
+/**********************************************************************
+【函数名称】 Reserve
+【函数功能】 为至少 capacity 个点预留空间。
+【参数】
+    capacity: 预计的点数。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void PointBatch<N>::Reserve(size_t capacity) {
+    if (capacity <= m_Capacity) {
+        return;
+    }
+    // 取整到 LANE_COUNT 的倍数，使每一维的起始地址都对齐
+    size_t newCapacity = (capacity + LANE_COUNT - 1) / LANE_COUNT * LANE_COUNT;
+    vector<double> storage(N * newCapacity + LANE_COUNT - 1);
+    auto address = reinterpret_cast<uintptr_t>(storage.data());
+    auto padding = (ALIGNMENT - address % ALIGNMENT) % ALIGNMENT;
+    double* base = storage.data() + padding / sizeof(double);
+    for (size_t axis = 0; axis < N; axis++) {
+        copy(
+            m_Base + axis * m_Capacity,
+            m_Base + axis * m_Capacity + m_Count,
+            base + axis * newCapacity
+        );
+    }
+    // vector 交换时不移动缓冲区，base 仍然有效
+    m_Storage.swap(storage);
+    m_Base = base;
+    m_Capacity = newCapacity;
+}
+
+/**********************************************************************
+【函数名称】 Resize
+【函数功能】 改变点的个数，新增的点为原点。
+【参数】
+    count: 新的点数。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void PointBatch<N>::Resize(size_t count) {
+    Reserve(count);
+    if (count > m_Count) {
+        for (size_t axis = 0; axis < N; axis++) {
+            fill(
+                m_Base + axis * m_Capacity + m_Count,
+                m_Base + axis * m_Capacity + count,
+                0.0
+            );
+        }
+    }
+    m_Count = count;
+}
+
+/**********************************************************************
+【函数名称】 Add
+【函数功能】 在末尾添加一个点。
+【参数】
+    point: 要添加的点。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void PointBatch<N>::Add(const Point<N>& point) {
+    if (m_Count == m_Capacity) {
+        Reserve(max(m_Capacity * 2, size_t(LANE_COUNT)));
+    }
+    InnerSetPoint(m_Count, point);
+    m_Count++;
+}
+
+/**********************************************************************
+【函数名称】 Clear
+【函数功能】 删除所有点，保留已分配的空间。
+【参数】 无
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void PointBatch<N>::Clear() {
+    m_Count = 0;
+}
+
+/**********************************************************************
+【函数名称】 MoveInplace
+【函数功能】 将所有点向指定方向移动指定长度。
+【参数】
+    delta: 移动的方向和长度。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void PointBatch<N>::MoveInplace(const Vector<double, N>& delta) {
+    auto offsets = delta.GetData();
+    for (size_t axis = 0; axis < N; axis++) {
+        double* coords = m_Base + axis * m_Capacity;
+        double offset = offsets[axis];
+        for (size_t i = 0; i < m_Count; i++) {
+            coords[i] += offset;
+        }
+    }
+}
+
+/**********************************************************************
+【函数名称】 ScaleInplace
+【函数功能】
+    将所有点以定点为中心缩放。
+    与 Element::Scale 使用相同的公式，结果逐位相同。
+【参数】
+    ref: 参考点。
+    ratio: 缩放的比例。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void PointBatch<N>::ScaleInplace(const Point<N>& ref, double ratio) {
+    auto center = ref.GetData();
+    for (size_t axis = 0; axis < N; axis++) {
+        double* coords = m_Base + axis * m_Capacity;
+        double origin = center[axis];
+        for (size_t i = 0; i < m_Count; i++) {
+            coords[i] = origin + (coords[i] - origin) * ratio;
+        }
+    }
+}
+
+/**********************************************************************
+【函数名称】 Project
+【函数功能】 将所有点投影到更低的 M 维，即只保留前 M 维的坐标。
+【参数】 无
+【返回值】
+    一个 M 维的点批。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+template <size_t M>
+PointBatch<M> PointBatch<N>::Project() const {
+    static_assert(M <= N, "Cannot project to a higher dimension.");
+    PointBatch<M> result(m_Count);
+    for (size_t axis = 0; axis < M; axis++) {
+        const double* coords = m_Base + axis * m_Capacity;
+        copy(coords, coords + m_Count, result.GetAxis(axis));
+    }
+    return result;
+}
+
+/**********************************************************************
+【函数名称】 Promote
+【函数功能】 将所有点升至更高的 M 维。
+【参数】
+    pad: 新增维度上的坐标。
+【返回值】
+    一个 M 维的点批。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+template <size_t M>
+PointBatch<M> PointBatch<N>::Promote(double pad) const {
+    static_assert(M >= N, "Cannot promote to a lower dimension.");
+    PointBatch<M> result(m_Count);
+    for (size_t axis = 0; axis < M; axis++) {
+        double* output = result.GetAxis(axis);
+        if (axis < N) {
+            const double* coords = m_Base + axis * m_Capacity;
+            copy(coords, coords + m_Count, output);
+        }
+        else {
+            fill(output, output + m_Count, pad);
+        }
+    }
+    return result;
+}
+
+/**********************************************************************
+【函数名称】 operator=
+【函数功能】 将另一 PointBatch 赋值给自身。
+【参数】
+    other: 从之取值的 PointBatch。
+【返回值】
+    自身的引用。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+PointBatch<N>& PointBatch<N>::operator=(const PointBatch<N>& other) {
+    if (this != &other) {
+        PointBatch<N> copied(other);
+        *this = move(copied);
+    }
+    return *this;
+}
+
+/**********************************************************************
+【函数名称】 operator=
+【函数功能】 接管另一 PointBatch 的存储，另一实例变为空。
+【参数】
+    other: 从之取值的 PointBatch。
+【返回值】
+    自身的引用。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+PointBatch<N>& PointBatch<N>::operator=(PointBatch<N>&& other) {
+    if (this != &other) {
+        // vector 交换时不移动缓冲区，两侧的 m_Base 仍然有效
+        m_Storage.swap(other.m_Storage);
+        swap(m_Base, other.m_Base);
+        swap(m_Count, other.m_Count);
+        swap(m_Capacity, other.m_Capacity);
+        other.Clear();
+    }
+    return *this;
+}
+
+/**********************************************************************
+【函数名称】 InnerGetPoint
+【函数功能】 获取指定下标处的点，不检查越界。
+【参数】
+    index: 点的下标。
+【返回值】
+    由各维坐标组成的点。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+Point<N> PointBatch<N>::InnerGetPoint(size_t index) const {
+    array<double, N> components;
+    for (size_t axis = 0; axis < N; axis++) {
+        components[axis] = m_Base[axis * m_Capacity + index];
+    }
+    return Point<N>(components);
+}
+
+/**********************************************************************
+【函数名称】 InnerSetPoint
+【函数功能】 设置指定下标处的点，不检查越界。
+【参数】
+    index: 点的下标。
+    point: 新的点。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void PointBatch<N>::InnerSetPoint(size_t index, const Point<N>& point) {
+    auto components = point.GetData();
+    for (size_t axis = 0; axis < N; axis++) {
+        m_Base[axis * m_Capacity + index] = components[axis];
+    }
+}
+
+}
\ No newline at end of file
@@ -8,10 +8,13 @@
 
 #include <array>
 #include <cstddef>
+#include <functional>
 #include <initializer_list>
 #include <iostream>
 #include <string>
-#include "../Tools/Representable.hpp"
+#include "VectorKernels.hpp"
+#include "../Tools/Hash.hpp"
+#include "../Tools/Formattable.hpp"
 using namespace std;
 
 namespace C3w { 
@@ -19,11 +22,13 @@ namespace C3w {
 /*************************************************************************
 【类名】 Vector
 【功能】 定义一个分量类型为 T，维数为 N 的向量。
-【接口说明】 获取/设置分量，向量的加减以及内积。
+【接口说明】
+    获取/设置分量，向量的加减以及内积。
+    没有虚函数，只含 N 个分量，T 可平凡复制时 Vector 也可平凡复制。
 【开发者及日期】 赵一彤 2024/7/24
 *************************************************************************/
 template <typename T, size_t N>
-class Vector: public Tools::Representable {
+class Vector {
     static_assert(N > 0, "Dimension must be positive.");
     public:
         // 成员
@@ -114,6 +119,24 @@ class Vector: public Tools::Representable {
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
         void SetAllComponents(const array<T, N>& components);
+        /**********************************************************************
+        【函数名称】 GetData
+        【函数功能】 获取连续存储的分量数组首地址，供热点路径不经越界检测地访问。
+        【参数】 无
+        【返回值】
+            指向第一个分量的常量指针，之后紧跟其余 N - 1 个分量。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        const T* GetData() const;
+        /**********************************************************************
+        【函数名称】 GetData
+        【函数功能】 获取连续存储的分量数组首地址，供热点路径不经越界检测地访问。
+        【参数】 无
+        【返回值】
+            指向第一个分量的指针，之后紧跟其余 N - 1 个分量。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        T* GetData();
 
         // 属性
 
@@ -155,6 +178,15 @@ class Vector: public Tools::Representable {
             const Vector<T, N>& right
         );
         /**********************************************************************
+        【函数名称】 GetHashCode
+        【函数功能】 求向量的哈希值，相等的向量哈希值相同。
+        【参数】 无
+        【返回值】 
+            向量的哈希值。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        size_t GetHashCode() const;
+        /**********************************************************************
         【函数名称】 NegateInplace
         【函数功能】 反转此向量。
         【参数】 无
@@ -348,7 +380,8 @@ class Vector: public Tools::Representable {
         【函数功能】 将自身加以另一个向量。
         【参数】 
             other: 另一个向量。
-        【返回值】 无
+        【返回值】
+            自身的引用。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
         Vector<T, N>& operator+=(const Vector<T, N>& other);
@@ -367,7 +400,8 @@ class Vector: public Tools::Representable {
         【函数功能】 将自身减去另一个向量。
         【参数】 
             other: 另一个向量。
-        【返回值】 无
+        【返回值】
+            自身的引用。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
         Vector<T, N>& operator-=(const Vector<T, N>& other);
@@ -454,11 +488,8 @@ class Vector: public Tools::Representable {
             此对象的字符串表达形式。
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        string ToString() const override;
+        string ToString() const;
 
-        // 虚析构函数
-        virtual ~Vector() = default;
-    
     private:
         // 分量
         array<T, N> m_Components;
@@ -466,4 +497,21 @@ class Vector: public Tools::Representable {
 
 }
 
+namespace std {
+
+/*************************************************************************
+【类名】 hash<C3w::Vector<T, N>>
+【功能】 使 Vector 可以用作无序容器的键。
+【接口说明】 函数对象，调用 GetHashCode。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+template <typename T, size_t N>
+struct hash<C3w::Vector<T, N>> {
+    size_t operator()(const C3w::Vector<T, N>& vector) const {
+        return vector.GetHashCode();
+    }
+};
+
+}
+
 #include "Vector.tpp"
\ No newline at end of file
@@ -8,12 +8,15 @@
 #include <array>
 #include <cmath>
 #include <cstddef>
+#include <functional>
 #include <initializer_list>
 #include <iostream>
 #include <sstream>
 #include <string>
 #include "Errors.hpp"
 #include "Vector.hpp"
+#include "VectorKernels.hpp"
+#include "../Tools/Hash.hpp"
 using namespace std;
 using namespace C3w;
 using namespace C3w::Errors;
@@ -116,6 +119,32 @@ void Vector<T, N>::SetAllComponents(const array<T, N>& components) {
     m_Components = components;
 }
 
+/**********************************************************************
+【函数名称】 GetData
+【函数功能】 获取连续存储的分量数组首地址，供热点路径不经越界检测地访问。
+【参数】 无
+【返回值】
+    指向第一个分量的常量指针，之后紧跟其余 N - 1 个分量。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T, size_t N>
+const T* Vector<T, N>::GetData() const {
+    return m_Components.data();
+}
+
+/**********************************************************************
+【函数名称】 GetData
+【函数功能】 获取连续存储的分量数组首地址，供热点路径不经越界检测地访问。
+【参数】 无
+【返回值】
+    指向第一个分量的指针，之后紧跟其余 N - 1 个分量。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T, size_t N>
+T* Vector<T, N>::GetData() {
+    return m_Components.data();
+}
+
 /**********************************************************************
 【函数名称】 Module
 【函数功能】 求此向量的模长。
@@ -125,11 +154,8 @@ void Vector<T, N>::SetAllComponents(const array<T, N>& components) {
 **********************************************************************/
 template <typename T, size_t N>
 T Vector<T, N>::Module() const {
-    T squareSum = 0;
-    for (size_t i = 0; i < N; i++) {
-        squareSum += pow(m_Components[i], 2);
-    }
-    return sqrt(squareSum);
+    auto data = m_Components.data();
+    return sqrt(VectorKernels<T, N>::InnerProduct(data, data));
 }
 
 /**********************************************************************
@@ -169,6 +195,25 @@ bool Vector<T, N>::IsEqual(
     return true;
 }
 
+/**********************************************************************
+【函数名称】 GetHashCode
+【函数功能】 求向量的哈希值，相等的向量哈希值相同。
+【参数】 无
+【返回值】 
+    向量的哈希值。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T, size_t N>
+size_t Vector<T, N>::GetHashCode() const {
+    size_t seed = N;
+    for (size_t i = 0; i < N; i++) {
+        // 0.0 与 -0.0 相等，须使用相同的哈希值
+        T component = m_Components[i] == T() ? T() : m_Components[i];
+        seed = Tools::CombineHash(seed, hash<T>()(component));
+    }
+    return seed;
+}
+
 /**********************************************************************
 【函数名称】 NegateInplace
 【函数功能】 反转此向量。
@@ -178,9 +223,7 @@ bool Vector<T, N>::IsEqual(
 **********************************************************************/
 template <typename T, size_t N>
 void Vector<T, N>::NegateInplace() {
-    for (auto& component: m_Components) {
-        component = -component;
-    }
+    VectorKernels<T, N>::Negate(m_Components.data(), m_Components.data());
 }
 
 /**********************************************************************
@@ -208,9 +251,10 @@ Vector<T, N> Vector<T, N>::Negate() const {
 template <typename T, size_t N>
 Vector<T, N> Vector<T, N>::Negate(const Vector<T, N>& vector) {
     Vector<T, N> result;
-    for (size_t i = 0; i < N; i++) {
-        result.m_Components[i] = -vector.m_Components[i];
-    }
+    VectorKernels<T, N>::Negate(
+        result.m_Components.data(),
+        vector.m_Components.data()
+    );
     return result;
 }
 
@@ -224,9 +268,11 @@ Vector<T, N> Vector<T, N>::Negate(const Vector<T, N>& vector) {
 **********************************************************************/
 template <typename T, size_t N>
 void Vector<T, N>::AddInplace(const Vector<T, N>& other) {
-    for (size_t i = 0; i < N; i++) {
-        m_Components[i] += other.m_Components[i];
-    }
+    VectorKernels<T, N>::Add(
+        m_Components.data(),
+        m_Components.data(),
+        other.m_Components.data()
+    );
 }
 
 /**********************************************************************
@@ -259,9 +305,11 @@ Vector<T, N> Vector<T, N>::Add(
     const Vector<T, N>& right
 ) {
     Vector<T, N> result;
-    for (size_t i = 0; i < N; i++) {
-        result.m_Components[i] = left.m_Components[i] + right.m_Components[i];
-    }
+    VectorKernels<T, N>::Add(
+        result.m_Components.data(),
+        left.m_Components.data(),
+        right.m_Components.data()
+    );
     return result;
 }
 
@@ -275,9 +323,11 @@ Vector<T, N> Vector<T, N>::Add(
 **********************************************************************/
 template <typename T, size_t N>
 void Vector<T, N>::SubtractInplace(const Vector<T, N>& other) {
-    for (size_t i = 0; i < N; i++) {
-        m_Components[i] -= other.m_Components[i];
-    }
+    VectorKernels<T, N>::Subtract(
+        m_Components.data(),
+        m_Components.data(),
+        other.m_Components.data()
+    );
 }
 
 /**********************************************************************
@@ -310,9 +360,11 @@ Vector<T, N> Vector<T, N>::Subtract(
     const Vector<T, N>& right
 ) {
     Vector<T, N> result;
-    for (size_t i = 0; i < N; i++) {
-        result.m_Components[i] = left.m_Components[i] - right.m_Components[i];
-    }
+    VectorKernels<T, N>::Subtract(
+        result.m_Components.data(),
+        left.m_Components.data(),
+        right.m_Components.data()
+    );
     return result;
 }
 
@@ -326,9 +378,11 @@ Vector<T, N> Vector<T, N>::Subtract(
 **********************************************************************/
 template <typename T, size_t N>
 void Vector<T, N>::MultiplyInplace(T factor) {
-    for (auto& component: m_Components) {
-        component *= factor;
-    }
+    VectorKernels<T, N>::Multiply(
+        m_Components.data(),
+        m_Components.data(),
+        factor
+    );
 }
 
 /**********************************************************************
@@ -358,9 +412,11 @@ Vector<T, N> Vector<T, N>::Multiply(T factor) const {
 template <typename T, size_t N>
 Vector<T, N> Vector<T, N>::Multiply(const Vector<T, N> vector, T factor) {
     Vector<T, N> result;
-    for (size_t i = 0; i < N; i++) {
-        result.m_Components[i] = vector.m_Components[i] * factor;
-    }
+    VectorKernels<T, N>::Multiply(
+        result.m_Components.data(),
+        vector.m_Components.data(),
+        factor
+    );
     return result;
 }
 
@@ -392,11 +448,10 @@ T Vector<T, N>::InnerProduct(
     const Vector<T, N>& left, 
     const Vector<T, N>& right
 ) {
-    T result = 0;
-    for (size_t i = 0; i < N; i++) {
-        result += (left.m_Components[i] * right.m_Components[i]);
-    }
-    return result;
+    return VectorKernels<T, N>::InnerProduct(
+        left.m_Components.data(),
+        right.m_Components.data()
+    );
 }
 
 /**********************************************************************
@@ -459,12 +514,14 @@ Vector<T, N> Vector<T, N>::operator+(const Vector<T, N>& other) const {
 【函数功能】 将自身加以另一个向量。
 【参数】 
     other: 另一个向量。
-【返回值】 无
+【返回值】
+    自身的引用。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <typename T, size_t N>
 Vector<T, N>& Vector<T, N>::operator+=(const Vector<T, N>& other) {
     AddInplace(other);
+    return *this;
 }
 
 /**********************************************************************
@@ -486,12 +543,14 @@ Vector<T, N> Vector<T, N>::operator-(const Vector<T, N>& other) const {
 【函数功能】 将自身减去另一个向量。
 【参数】 
     other: 另一个向量。
-【返回值】 无
+【返回值】
+    自身的引用。
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <typename T, size_t N>
 Vector<T, N>& Vector<T, N>::operator-=(const Vector<T, N>& other) {
     SubtractInplace(other);
+    return *this;
 }
 
 /**********************************************************************
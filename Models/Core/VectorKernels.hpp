@@ -0,0 +1,111 @@
+/*************************************************************************
+【文件名】 VectorKernels.hpp
+【功能模块和目的】 VectorKernels 类提供定长向量运算的底层实现。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+using namespace std;
+
+// 编译期选择指令集。定义 C3W_NO_SIMD 可强制使用标量实现。
+#if !defined(C3W_NO_SIMD)
+    #if defined(__SSE2__) || defined(_M_X64) || \
+        (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #define C3W_VECTOR_SSE2
+    #endif
+    #if defined(__AVX__)
+        #define C3W_VECTOR_AVX
+    #endif
+#endif
+
+namespace C3w {
+
+/*************************************************************************
+【类名】 VectorKernels
+【功能】
+    对以连续数组存储的 N 个 T 类型分量进行运算的静态类。
+    所有函数都不检查下标，结果数组可以与输入数组相同。
+    通用实现为标量循环；对 double 的 2、3、4 维特化使用 SSE2/AVX，
+    求和仍按分量顺序进行，因此结果与标量实现逐位相同。
+【接口说明】 加、减、取反、数乘、内积、距离平方。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+template <typename T, size_t N>
+class VectorKernels final {
+    public:
+        /**********************************************************************
+        【函数名称】 Add
+        【函数功能】 逐分量相加。
+        【参数】
+            result: 存放结果的数组。
+            left: 第一个向量的分量。
+            right: 第二个向量的分量。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static void Add(T* result, const T* left, const T* right);
+        /**********************************************************************
+        【函数名称】 Subtract
+        【函数功能】 逐分量相减。
+        【参数】
+            result: 存放结果的数组。
+            left: 被减向量的分量。
+            right: 减向量的分量。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static void Subtract(T* result, const T* left, const T* right);
+        /**********************************************************************
+        【函数名称】 Negate
+        【函数功能】 逐分量取反。
+        【参数】
+            result: 存放结果的数组。
+            vector: 要取反的向量的分量。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static void Negate(T* result, const T* vector);
+        /**********************************************************************
+        【函数名称】 Multiply
+        【函数功能】 逐分量数乘。
+        【参数】
+            result: 存放结果的数组。
+            vector: 要数乘的向量的分量。
+            factor: 要数乘的标量。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static void Multiply(T* result, const T* vector, T factor);
+        /**********************************************************************
+        【函数名称】 InnerProduct
+        【函数功能】 求两向量的内积。
+        【参数】
+            left: 第一个向量的分量。
+            right: 第二个向量的分量。
+        【返回值】
+            两向量的内积。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static T InnerProduct(const T* left, const T* right);
+        /**********************************************************************
+        【函数名称】 SquaredDistance
+        【函数功能】 求两向量之差的模长的平方，不构造临时向量。
+        【参数】
+            left: 第一个向量的分量。
+            right: 第二个向量的分量。
+        【返回值】
+            两向量之差的模长的平方。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static T SquaredDistance(const T* left, const T* right);
+
+    private:
+        // 静态类，隐藏构造函数。
+        VectorKernels();
+};
+
+}
+
+#include "VectorKernels.tpp"
\ No newline at end of file
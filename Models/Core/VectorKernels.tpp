@@ -0,0 +1,728 @@
+/*************************************************************************
+【文件名】 VectorKernels.tpp
+【功能模块和目的】 为 VectorKernels.hpp 提供实现。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#include <cstddef>
+#include "VectorKernels.hpp"
+#if defined(C3W_VECTOR_SSE2)
+    #include <emmintrin.h>
+#endif
+#if defined(C3W_VECTOR_AVX)
+    #include <immintrin.h>
+#endif
+using namespace std;
+
+namespace C3w {
+
+/**********************************************************************
+【函数名称】 Add
+【函数功能】 逐分量相加。
+【参数】
+    result: 存放结果的数组。
+    left: 第一个向量的分量。
+    right: 第二个向量的分量。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T, size_t N>
+void VectorKernels<T, N>::Add(T* result, const T* left, const T* right) {
+    for (size_t i = 0; i < N; i++) {
+        result[i] = left[i] + right[i];
+    }
+}
+
+/**********************************************************************
+【函数名称】 Subtract
+【函数功能】 逐分量相减。
+【参数】
+    result: 存放结果的数组。
+    left: 被减向量的分量。
+    right: 减向量的分量。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T, size_t N>
+void VectorKernels<T, N>::Subtract(T* result, const T* left, const T* right) {
+    for (size_t i = 0; i < N; i++) {
+        result[i] = left[i] - right[i];
+    }
+}
+
+/**********************************************************************
+【函数名称】 Negate
+【函数功能】 逐分量取反。
+【参数】
+    result: 存放结果的数组。
+    vector: 要取反的向量的分量。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T, size_t N>
+void VectorKernels<T, N>::Negate(T* result, const T* vector) {
+    for (size_t i = 0; i < N; i++) {
+        result[i] = -vector[i];
+    }
+}
+
+/**********************************************************************
+【函数名称】 Multiply
+【函数功能】 逐分量数乘。
+【参数】
+    result: 存放结果的数组。
+    vector: 要数乘的向量的分量。
+    factor: 要数乘的标量。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T, size_t N>
+void VectorKernels<T, N>::Multiply(T* result, const T* vector, T factor) {
+    for (size_t i = 0; i < N; i++) {
+        result[i] = vector[i] * factor;
+    }
+}
+
+/**********************************************************************
+【函数名称】 InnerProduct
+【函数功能】 求两向量的内积。
+【参数】
+    left: 第一个向量的分量。
+    right: 第二个向量的分量。
+【返回值】
+    两向量的内积。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T, size_t N>
+T VectorKernels<T, N>::InnerProduct(const T* left, const T* right) {
+    // 从第一项开始累加而不是从 0 开始，与特化版本的求和顺序一致
+    T result = left[0] * right[0];
+    for (size_t i = 1; i < N; i++) {
+        result += left[i] * right[i];
+    }
+    return result;
+}
+
+/**********************************************************************
+【函数名称】 SquaredDistance
+【函数功能】 求两向量之差的模长的平方，不构造临时向量。
+【参数】
+    left: 第一个向量的分量。
+    right: 第二个向量的分量。
+【返回值】
+    两向量之差的模长的平方。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T, size_t N>
+T VectorKernels<T, N>::SquaredDistance(const T* left, const T* right) {
+    T difference = left[0] - right[0];
+    T result = difference * difference;
+    for (size_t i = 1; i < N; i++) {
+        difference = left[i] - right[i];
+        result += difference * difference;
+    }
+    return result;
+}
+
+#if defined(C3W_VECTOR_SSE2)
+
+/**********************************************************************
+【函数名称】 Add
+【函数功能】
+    逐分量相加。
+    2 维 double 的 SSE2 特化。
+【参数】
+    result: 存放结果的数组。
+    left: 第一个向量的分量。
+    right: 第二个向量的分量。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <>
+inline void VectorKernels<double, 2>::Add(
+    double* result,
+    const double* left,
+    const double* right
+) {
+    _mm_storeu_pd(
+        result,
+        _mm_add_pd(_mm_loadu_pd(left), _mm_loadu_pd(right))
+    );
+}
+
+/**********************************************************************
+【函数名称】 Subtract
+【函数功能】
+    逐分量相减。
+    2 维 double 的 SSE2 特化。
+【参数】
+    result: 存放结果的数组。
+    left: 被减向量的分量。
+    right: 减向量的分量。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <>
+inline void VectorKernels<double, 2>::Subtract(
+    double* result,
+    const double* left,
+    const double* right
+) {
+    _mm_storeu_pd(
+        result,
+        _mm_sub_pd(_mm_loadu_pd(left), _mm_loadu_pd(right))
+    );
+}
+
+/**********************************************************************
+【函数名称】 Negate
+【函数功能】
+    逐分量取反。
+    2 维 double 的 SSE2 特化。
+【参数】
+    result: 存放结果的数组。
+    vector: 要取反的向量的分量。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <>
+inline void VectorKernels<double, 2>::Negate(
+    double* result,
+    const double* vector
+) {
+    // 翻转符号位，与标量取反一致（0.0 变为 -0.0）
+    _mm_storeu_pd(
+        result,
+        _mm_xor_pd(_mm_loadu_pd(vector), _mm_set1_pd(-0.0))
+    );
+}
+
+/**********************************************************************
+【函数名称】 Multiply
+【函数功能】
+    逐分量数乘。
+    2 维 double 的 SSE2 特化。
+【参数】
+    result: 存放结果的数组。
+    vector: 要数乘的向量的分量。
+    factor: 要数乘的标量。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <>
+inline void VectorKernels<double, 2>::Multiply(
+    double* result,
+    const double* vector,
+    double factor
+) {
+    _mm_storeu_pd(
+        result,
+        _mm_mul_pd(_mm_loadu_pd(vector), _mm_set1_pd(factor))
+    );
+}
+
+/**********************************************************************
+【函数名称】 InnerProduct
+【函数功能】
+    求两向量的内积。
+    2 维 double 的 SSE2 特化。
+【参数】
+    left: 第一个向量的分量。
+    right: 第二个向量的分量。
+【返回值】
+    两向量的内积。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <>
+inline double VectorKernels<double, 2>::InnerProduct(
+    const double* left,
+    const double* right
+) {
+    __m128d products = _mm_mul_pd(_mm_loadu_pd(left), _mm_loadu_pd(right));
+    return _mm_cvtsd_f64(products) +
+        _mm_cvtsd_f64(_mm_unpackhi_pd(products, products));
+}
+
+/**********************************************************************
+【函数名称】 SquaredDistance
+【函数功能】
+    求两向量之差的模长的平方，不构造临时向量。
+    2 维 double 的 SSE2 特化。
+【参数】
+    left: 第一个向量的分量。
+    right: 第二个向量的分量。
+【返回值】
+    两向量之差的模长的平方。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <>
+inline double VectorKernels<double, 2>::SquaredDistance(
+    const double* left,
+    const double* right
+) {
+    __m128d difference = _mm_sub_pd(_mm_loadu_pd(left), _mm_loadu_pd(right));
+    __m128d squares = _mm_mul_pd(difference, difference);
+    return _mm_cvtsd_f64(squares) +
+        _mm_cvtsd_f64(_mm_unpackhi_pd(squares, squares));
+}
+
+/**********************************************************************
+【函数名称】 Add
+【函数功能】
+    逐分量相加。
+    3 维 double 的 SSE2 特化，前两个分量成对计算。
+【参数】
+    result: 存放结果的数组。
+    left: 第一个向量的分量。
+    right: 第二个向量的分量。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <>
+inline void VectorKernels<double, 3>::Add(
+    double* result,
+    const double* left,
+    const double* right
+) {
+    double last = left[2] + right[2];
+    _mm_storeu_pd(
+        result,
+        _mm_add_pd(_mm_loadu_pd(left), _mm_loadu_pd(right))
+    );
+    result[2] = last;
+}
+
+/**********************************************************************
+【函数名称】 Subtract
+【函数功能】
+    逐分量相减。
+    3 维 double 的 SSE2 特化，前两个分量成对计算。
+【参数】
+    result: 存放结果的数组。
+    left: 被减向量的分量。
+    right: 减向量的分量。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <>
+inline void VectorKernels<double, 3>::Subtract(
+    double* result,
+    const double* left,
+    const double* right
+) {
+    double last = left[2] - right[2];
+    _mm_storeu_pd(
+        result,
+        _mm_sub_pd(_mm_loadu_pd(left), _mm_loadu_pd(right))
+    );
+    result[2] = last;
+}
+
+/**********************************************************************
+【函数名称】 Negate
+【函数功能】
+    逐分量取反。
+    3 维 double 的 SSE2 特化，前两个分量成对计算。
+【参数】
+    result: 存放结果的数组。
+    vector: 要取反的向量的分量。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <>
+inline void VectorKernels<double, 3>::Negate(
+    double* result,
+    const double* vector
+) {
+    double last = -vector[2];
+    _mm_storeu_pd(
+        result,
+        _mm_xor_pd(_mm_loadu_pd(vector), _mm_set1_pd(-0.0))
+    );
+    result[2] = last;
+}
+
+/**********************************************************************
+【函数名称】 Multiply
+【函数功能】
+    逐分量数乘。
+    3 维 double 的 SSE2 特化，前两个分量成对计算。
+【参数】
+    result: 存放结果的数组。
+    vector: 要数乘的向量的分量。
+    factor: 要数乘的标量。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <>
+inline void VectorKernels<double, 3>::Multiply(
+    double* result,
+    const double* vector,
+    double factor
+) {
+    double last = vector[2] * factor;
+    _mm_storeu_pd(
+        result,
+        _mm_mul_pd(_mm_loadu_pd(vector), _mm_set1_pd(factor))
+    );
+    result[2] = last;
+}
+
+/**********************************************************************
+【函数名称】 InnerProduct
+【函数功能】
+    求两向量的内积。
+    3 维 double 的 SSE2 特化，前两个分量成对计算。
+【参数】
+    left: 第一个向量的分量。
+    right: 第二个向量的分量。
+【返回值】
+    两向量的内积。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <>
+inline double VectorKernels<double, 3>::InnerProduct(
+    const double* left,
+    const double* right
+) {
+    __m128d products = _mm_mul_pd(_mm_loadu_pd(left), _mm_loadu_pd(right));
+    return _mm_cvtsd_f64(products) +
+        _mm_cvtsd_f64(_mm_unpackhi_pd(products, products)) +
+        left[2] * right[2];
+}
+
+/**********************************************************************
+【函数名称】 SquaredDistance
+【函数功能】
+    求两向量之差的模长的平方，不构造临时向量。
+    3 维 double 的 SSE2 特化，前两个分量成对计算。
+【参数】
+    left: 第一个向量的分量。
+    right: 第二个向量的分量。
+【返回值】
+    两向量之差的模长的平方。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <>
+inline double VectorKernels<double, 3>::SquaredDistance(
+    const double* left,
+    const double* right
+) {
+    __m128d difference = _mm_sub_pd(_mm_loadu_pd(left), _mm_loadu_pd(right));
+    __m128d squares = _mm_mul_pd(difference, difference);
+    double last = left[2] - right[2];
+    return _mm_cvtsd_f64(squares) +
+        _mm_cvtsd_f64(_mm_unpackhi_pd(squares, squares)) +
+        last * last;
+}
+
+#if defined(C3W_VECTOR_AVX)
+
+/**********************************************************************
+【函数名称】 Add
+【函数功能】
+    逐分量相加。
+    4 维 double 的 AVX 特化。
+【参数】
+    result: 存放结果的数组。
+    left: 第一个向量的分量。
+    right: 第二个向量的分量。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <>
+inline void VectorKernels<double, 4>::Add(
+    double* result,
+    const double* left,
+    const double* right
+) {
+    _mm256_storeu_pd(
+        result,
+        _mm256_add_pd(_mm256_loadu_pd(left), _mm256_loadu_pd(right))
+    );
+}
+
+/**********************************************************************
+【函数名称】 Subtract
+【函数功能】
+    逐分量相减。
+    4 维 double 的 AVX 特化。
+【参数】
+    result: 存放结果的数组。
+    left: 被减向量的分量。
+    right: 减向量的分量。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <>
+inline void VectorKernels<double, 4>::Subtract(
+    double* result,
+    const double* left,
+    const double* right
+) {
+    _mm256_storeu_pd(
+        result,
+        _mm256_sub_pd(_mm256_loadu_pd(left), _mm256_loadu_pd(right))
+    );
+}
+
+/**********************************************************************
+【函数名称】 Negate
+【函数功能】
+    逐分量取反。
+    4 维 double 的 AVX 特化。
+【参数】
+    result: 存放结果的数组。
+    vector: 要取反的向量的分量。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <>
+inline void VectorKernels<double, 4>::Negate(
+    double* result,
+    const double* vector
+) {
+    _mm256_storeu_pd(
+        result,
+        _mm256_xor_pd(_mm256_loadu_pd(vector), _mm256_set1_pd(-0.0))
+    );
+}
+
+/**********************************************************************
+【函数名称】 Multiply
+【函数功能】
+    逐分量数乘。
+    4 维 double 的 AVX 特化。
+【参数】
+    result: 存放结果的数组。
+    vector: 要数乘的向量的分量。
+    factor: 要数乘的标量。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <>
+inline void VectorKernels<double, 4>::Multiply(
+    double* result,
+    const double* vector,
+    double factor
+) {
+    _mm256_storeu_pd(
+        result,
+        _mm256_mul_pd(_mm256_loadu_pd(vector), _mm256_set1_pd(factor))
+    );
+}
+
+/**********************************************************************
+【函数名称】 InnerProduct
+【函数功能】
+    求两向量的内积。
+    4 维 double 的 AVX 特化。
+【参数】
+    left: 第一个向量的分量。
+    right: 第二个向量的分量。
+【返回值】
+    两向量的内积。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <>
+inline double VectorKernels<double, 4>::InnerProduct(
+    const double* left,
+    const double* right
+) {
+    __m256d products = _mm256_mul_pd(
+        _mm256_loadu_pd(left),
+        _mm256_loadu_pd(right)
+    );
+    __m128d low = _mm256_castpd256_pd128(products);
+    __m128d high = _mm256_extractf128_pd(products, 1);
+    return _mm_cvtsd_f64(low) +
+        _mm_cvtsd_f64(_mm_unpackhi_pd(low, low)) +
+        _mm_cvtsd_f64(high) +
+        _mm_cvtsd_f64(_mm_unpackhi_pd(high, high));
+}
+
+/**********************************************************************
+【函数名称】 SquaredDistance
+【函数功能】
+    求两向量之差的模长的平方，不构造临时向量。
+    4 维 double 的 AVX 特化。
+【参数】
+    left: 第一个向量的分量。
+    right: 第二个向量的分量。
+【返回值】
+    两向量之差的模长的平方。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <>
+inline double VectorKernels<double, 4>::SquaredDistance(
+    const double* left,
+    const double* right
+) {
+    __m256d difference = _mm256_sub_pd(
+        _mm256_loadu_pd(left),
+        _mm256_loadu_pd(right)
+    );
+    __m256d squares = _mm256_mul_pd(difference, difference);
+    __m128d low = _mm256_castpd256_pd128(squares);
+    __m128d high = _mm256_extractf128_pd(squares, 1);
+    return _mm_cvtsd_f64(low) +
+        _mm_cvtsd_f64(_mm_unpackhi_pd(low, low)) +
+        _mm_cvtsd_f64(high) +
+        _mm_cvtsd_f64(_mm_unpackhi_pd(high, high));
+}
+
+#else
+
+/**********************************************************************
+【函数名称】 Add
+【函数功能】
+    逐分量相加。
+    4 维 double 的 SSE2 特化，分两对计算。
+【参数】
+    result: 存放结果的数组。
+    left: 第一个向量的分量。
+    right: 第二个向量的分量。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <>
+inline void VectorKernels<double, 4>::Add(
+    double* result,
+    const double* left,
+    const double* right
+) {
+    __m128d low = _mm_add_pd(_mm_loadu_pd(left), _mm_loadu_pd(right));
+    __m128d high = _mm_add_pd(_mm_loadu_pd(left + 2), _mm_loadu_pd(right + 2));
+    _mm_storeu_pd(result, low);
+    _mm_storeu_pd(result + 2, high);
+}
+
+/**********************************************************************
+【函数名称】 Subtract
+【函数功能】
+    逐分量相减。
+    4 维 double 的 SSE2 特化，分两对计算。
+【参数】
+    result: 存放结果的数组。
+    left: 被减向量的分量。
+    right: 减向量的分量。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <>
+inline void VectorKernels<double, 4>::Subtract(
+    double* result,
+    const double* left,
+    const double* right
+) {
+    __m128d low = _mm_sub_pd(_mm_loadu_pd(left), _mm_loadu_pd(right));
+    __m128d high = _mm_sub_pd(_mm_loadu_pd(left + 2), _mm_loadu_pd(right + 2));
+    _mm_storeu_pd(result, low);
+    _mm_storeu_pd(result + 2, high);
+}
+
+/**********************************************************************
+【函数名称】 Negate
+【函数功能】
+    逐分量取反。
+    4 维 double 的 SSE2 特化，分两对计算。
+【参数】
+    result: 存放结果的数组。
+    vector: 要取反的向量的分量。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <>
+inline void VectorKernels<double, 4>::Negate(
+    double* result,
+    const double* vector
+) {
+    __m128d sign = _mm_set1_pd(-0.0);
+    __m128d low = _mm_xor_pd(_mm_loadu_pd(vector), sign);
+    __m128d high = _mm_xor_pd(_mm_loadu_pd(vector + 2), sign);
+    _mm_storeu_pd(result, low);
+    _mm_storeu_pd(result + 2, high);
+}
+
+/**********************************************************************
+【函数名称】 Multiply
+【函数功能】
+    逐分量数乘。
+    4 维 double 的 SSE2 特化，分两对计算。
+【参数】
+    result: 存放结果的数组。
+    vector: 要数乘的向量的分量。
+    factor: 要数乘的标量。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <>
+inline void VectorKernels<double, 4>::Multiply(
+    double* result,
+    const double* vector,
+    double factor
+) {
+    __m128d scale = _mm_set1_pd(factor);
+    __m128d low = _mm_mul_pd(_mm_loadu_pd(vector), scale);
+    __m128d high = _mm_mul_pd(_mm_loadu_pd(vector + 2), scale);
+    _mm_storeu_pd(result, low);
+    _mm_storeu_pd(result + 2, high);
+}
+
+/**********************************************************************
+【函数名称】 InnerProduct
+【函数功能】
+    求两向量的内积。
+    4 维 double 的 SSE2 特化，分两对计算。
+【参数】
+    left: 第一个向量的分量。
+    right: 第二个向量的分量。
+【返回值】
+    两向量的内积。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <>
+inline double VectorKernels<double, 4>::InnerProduct(
+    const double* left,
+    const double* right
+) {
+    __m128d low = _mm_mul_pd(_mm_loadu_pd(left), _mm_loadu_pd(right));
+    __m128d high = _mm_mul_pd(_mm_loadu_pd(left + 2), _mm_loadu_pd(right + 2));
+    return _mm_cvtsd_f64(low) +
+        _mm_cvtsd_f64(_mm_unpackhi_pd(low, low)) +
+        _mm_cvtsd_f64(high) +
+        _mm_cvtsd_f64(_mm_unpackhi_pd(high, high));
+}
+
+/**********************************************************************
+【函数名称】 SquaredDistance
+【函数功能】
+    求两向量之差的模长的平方，不构造临时向量。
+    4 维 double 的 SSE2 特化，分两对计算。
+【参数】
+    left: 第一个向量的分量。
+    right: 第二个向量的分量。
+【返回值】
+    两向量之差的模长的平方。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <>
+inline double VectorKernels<double, 4>::SquaredDistance(
+    const double* left,
+    const double* right
+) {
+    __m128d low = _mm_sub_pd(_mm_loadu_pd(left), _mm_loadu_pd(right));
+    __m128d high = _mm_sub_pd(_mm_loadu_pd(left + 2), _mm_loadu_pd(right + 2));
+    low = _mm_mul_pd(low, low);
+    high = _mm_mul_pd(high, high);
+    return _mm_cvtsd_f64(low) +
+        _mm_cvtsd_f64(_mm_unpackhi_pd(low, low)) +
+        _mm_cvtsd_f64(high) +
+        _mm_cvtsd_f64(_mm_unpackhi_pd(high, high));
+}
+
+#endif
+
+#endif
+
+}
\ No newline at end of file
@@ -0,0 +1,268 @@
+/*************************************************************************
+【文件名】 Bvh.hpp
+【功能模块和目的】 Bvh 类为模型中的面建立层次包围盒，加速空间查询。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+#include "../Core/Face.hpp"
+#include "../Core/Model.hpp"
+#include "../Core/Point.hpp"
+#include "../Core/Vector.hpp"
+#include "../Tools/Box.hpp"
+using namespace std;
+
+namespace C3w {
+
+namespace Spatial {
+
+/*************************************************************************
+【类名】 Bvh
+【功能】
+    为 N 维模型中的所有面建立层次包围盒（BVH）。
+    构建时在每个结点上按面中心分桶，用表面积启发式（SAH）选择划分；
+    结点按数组存储，两个子结点相邻。面的顶点按叶结点顺序另存一份，
+    之后模型被修改不影响已建好的 Bvh，需要重新构建。
+【接口说明】
+    射线求交（仅 3 维）、求模型上距给定点最近的点、
+    查找包围盒与给定长方体相交的面。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+template <size_t N>
+class Bvh final {
+    public:
+        // 内嵌类型
+
+        /**********************************************************************
+        【类名】 Node
+        【功能】 Bvh 的一个结点。
+        【接口说明】 包围盒，叶结点中的面或子结点的位置。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        struct Node {
+            // 包围盒，Vertex1 为各维最小值，Vertex2 为各维最大值
+            Tools::Box<N> Bounds;
+            // 叶结点为首个面在叶结点顺序中的位置；
+            // 内部结点为左子结点的下标，右子结点紧随其后
+            size_t First;
+            // 叶结点中面的个数，内部结点为 0
+            size_t Count;
+        };
+
+        /**********************************************************************
+        【类名】 Hit
+        【功能】 查询命中的面。
+        【接口说明】 面的下标，距离，命中的点。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        struct Hit {
+            // 面在模型 Faces 中的下标
+            size_t FaceIndex;
+            // 命中的点到射线起点或查询点的距离
+            double Distance;
+            // 命中的点
+            Point<N> Position;
+        };
+
+        // 成员
+
+        // 维数
+        static constexpr size_t Dimension { N };
+        // 每个结点上分桶的个数
+        static constexpr size_t BIN_COUNT { 16 };
+        // 不满足 SAH 时叶结点最多容纳的面数
+        static constexpr size_t MAX_LEAF_SIZE { 4 };
+
+        // 构造函数
+
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 初始化不含任何面的 Bvh 类型实例。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Bvh() = default;
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 为模型中的所有面构建 Bvh。
+        【参数】
+            model: 要建立索引的模型。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        explicit Bvh(const Model<N>& model);
+        /**********************************************************************
+        【函数名称】 拷贝构造函数
+        【函数功能】 使用另一 Bvh 初始化 Bvh 类型实例。
+        【参数】
+            other: 另一 Bvh 实例。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Bvh(const Bvh<N>& other) = default;
+
+        // 属性
+
+        /**********************************************************************
+        【函数名称】 Count
+        【函数功能】 获取建立索引的面的个数。
+        【参数】 无
+        【返回值】
+            面的个数。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        size_t Count() const;
+        /**********************************************************************
+        【函数名称】 GetNodes
+        【函数功能】 获取所有结点，下标 0 为根结点。
+        【参数】 无
+        【返回值】
+            结点数组的常引用。没有面时为空。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        const vector<Node>& GetNodes() const;
+        /**********************************************************************
+        【函数名称】 GetBoundingBox
+        【函数功能】 获取能包含所有面的最小长方体。
+        【参数】 无
+        【返回值】
+            根结点的包围盒。没有面时两个顶点都为原点。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Tools::Box<N> GetBoundingBox() const;
+
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 Intersect
+        【函数功能】
+            求射线与面的第一个交点，仅适用于 3 维。
+            射线的方向为 0 向量时视为不相交。
+        【参数】
+            origin: 射线起点。
+            direction: 射线方向，不必为单位向量。
+            hit: 相交时存放最近的交点。
+            maxDistance: 只考虑到起点距离不超过此值的交点。
+        【返回值】
+            射线是否与某个面相交。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        bool Intersect(
+            const Point<N>& origin,
+            const Vector<double, N>& direction,
+            Hit& hit,
+            double maxDistance = numeric_limits<double>::infinity()
+        ) const;
+        /**********************************************************************
+        【函数名称】 FindClosestPoint
+        【函数功能】 求所有面上距给定点最近的点。
+        【参数】
+            point: 给定点。
+            hit: 存放最近的点及其所在的面。
+        【返回值】
+            是否找到，即是否有面。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        bool FindClosestPoint(const Point<N>& point, Hit& hit) const;
+        /**********************************************************************
+        【函数名称】 FindOverlapping
+        【函数功能】 查找包围盒与给定长方体相交的面。
+        【参数】
+            box: 给定长方体。
+        【返回值】
+            按升序排列的面在模型 Faces 中的下标。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        vector<size_t> FindOverlapping(const Tools::Box<N>& box) const;
+
+        // 操作符
+
+        /**********************************************************************
+        【函数名称】 operator=
+        【函数功能】 将另一 Bvh 赋值给自身。
+        【参数】
+            other: 从之取值的 Bvh。
+        【返回值】
+            自身的引用。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Bvh<N>& operator=(const Bvh<N>& other) = default;
+
+    private:
+        // 每个面的顶点坐标个数
+        static constexpr size_t STRIDE { 3 * N };
+
+        // 所有结点
+        vector<Node> m_Nodes;
+        // 按叶结点顺序排列的面的顶点坐标，每个面依次存放 3 个点
+        vector<double> m_Vertices;
+        // 按叶结点顺序排列的面在模型 Faces 中的下标
+        vector<size_t> m_FaceIndices;
+
+        /**********************************************************************
+        【函数名称】 IntersectBox
+        【函数功能】 用平板法求射线进入长方体时的距离。
+        【参数】
+            box: 各维最小值在 Vertex1 的长方体。
+            origin: 射线起点的坐标。
+            inverse: 单位方向各分量的倒数。
+            maxDistance: 最远距离。
+            entry: 相交时存放进入长方体时的距离，起点在内部时为 0。
+        【返回值】
+            射线在 maxDistance 内是否与长方体相交。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static bool IntersectBox(
+            const Tools::Box<N>& box,
+            const double* origin,
+            const double* inverse,
+            double maxDistance,
+            double& entry
+        );
+        /**********************************************************************
+        【函数名称】 IntersectTriangle
+        【函数功能】 用 Möller–Trumbore 算法求 3 维射线与三角形的交点。
+        【参数】
+            triangle: 三角形 3 个顶点的坐标。
+            origin: 射线起点的坐标。
+            direction: 射线单位方向的分量。
+            distance: 相交时存放交点到起点的距离。
+        【返回值】
+            射线是否与三角形相交。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static bool IntersectTriangle(
+            const double* triangle,
+            const double* origin,
+            const double* direction,
+            double& distance
+        );
+        /**********************************************************************
+        【函数名称】 ClosestPointOnTriangle
+        【函数功能】
+            按点在三角形各 Voronoi 区域中的位置，求三角形上距给定点最近的点。
+            只用到内积，适用于任意维数。
+        【参数】
+            triangle: 三角形 3 个顶点的坐标。
+            point: 给定点的坐标。
+            result: 存放最近点的坐标。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static void ClosestPointOnTriangle(
+            const double* triangle,
+            const double* point,
+            double* result
+        );
+};
+
+}
+
+}
+
+#include "Bvh.tpp"
\ No newline at end of file
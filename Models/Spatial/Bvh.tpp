@@ -0,0 +1,699 @@
+/*************************************************************************
+【文件名】 Bvh.tpp
+【功能模块和目的】 为 Bvh.hpp 提供实现。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <numeric>
+#include <utility>
+#include <vector>
+#include "../Core/Face.hpp"
+#include "../Core/Model.hpp"
+#include "../Core/Point.hpp"
+#include "../Core/Vector.hpp"
+#include "../Tools/Box.hpp"
+#include "Bvh.hpp"
+using namespace std;
+
+namespace C3w {
+
+namespace Spatial {
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 为模型中的所有面构建 Bvh。
+【参数】
+    model: 要建立索引的模型。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+Bvh<N>::Bvh(const Model<N>& model) {
+    auto count = model.Faces.Count();
+    if (count == 0) {
+        return;
+    }
+    // 每个面的包围盒（前 N 个为最小值，后 N 个为最大值）与中心
+    vector<double> faceBounds(count * 2 * N);
+    vector<double> centers(count * N);
+    for (size_t i = 0; i < count; i++) {
+        double* lower = &faceBounds[i * 2 * N];
+        double* upper = lower + N;
+        fill(lower, upper, numeric_limits<double>::infinity());
+        fill(upper, upper + N, -numeric_limits<double>::infinity());
+        for (auto& point: model.Faces[i].Points) {
+            auto coords = point.GetData();
+            for (size_t axis = 0; axis < N; axis++) {
+                lower[axis] = min(lower[axis], coords[axis]);
+                upper[axis] = max(upper[axis], coords[axis]);
+            }
+        }
+        for (size_t axis = 0; axis < N; axis++) {
+            centers[i * N + axis] = (lower[axis] + upper[axis]) * 0.5;
+        }
+    }
+    // 叶结点顺序，构建过程中原地划分
+    vector<size_t> order(count);
+    iota(order.begin(), order.end(), size_t(0));
+
+    // 由各维最小值与最大值求表面积，与 Box::GetSurfaceArea 相同
+    auto getArea = [](const double* lower, const double* upper) {
+        double area = 0;
+        for (size_t i = 0; i < N; i++) {
+            double face = 2;
+            for (size_t j = 0; j < N; j++) {
+                if (j != i) {
+                    face *= upper[j] - lower[j];
+                }
+            }
+            area += face;
+        }
+        return area;
+    };
+    // 将一个面的包围盒并入 bounds
+    auto expand = [&](double* bounds, size_t face) {
+        const double* source = &faceBounds[face * 2 * N];
+        for (size_t axis = 0; axis < N; axis++) {
+            bounds[axis] = min(bounds[axis], source[axis]);
+            bounds[N + axis] = max(bounds[N + axis], source[N + axis]);
+        }
+    };
+    auto makeEmpty = [](double* bounds) {
+        fill(bounds, bounds + N, numeric_limits<double>::infinity());
+        fill(bounds + N, bounds + 2 * N, -numeric_limits<double>::infinity());
+    };
+    // 求叶结点顺序中一段面的结点
+    auto makeNode = [&](size_t first, size_t size) {
+        array<double, 2 * N> bounds;
+        makeEmpty(bounds.data());
+        for (size_t k = first; k < first + size; k++) {
+            expand(bounds.data(), order[k]);
+        }
+        array<double, N> lower;
+        array<double, N> upper;
+        copy(bounds.begin(), bounds.begin() + N, lower.begin());
+        copy(bounds.begin() + N, bounds.end(), upper.begin());
+        return Node {
+            Tools::Box<N>(Point<N>(lower), Point<N>(upper)),
+            first,
+            size
+        };
+    };
+
+    m_Nodes.reserve(2 * count - 1);
+    m_Nodes.push_back(makeNode(0, count));
+    vector<size_t> pending { 0 };
+    while (!pending.empty()) {
+        size_t index = pending.back();
+        pending.pop_back();
+        size_t first = m_Nodes[index].First;
+        size_t size = m_Nodes[index].Count;
+        if (size <= 1) {
+            continue;
+        }
+        // 面中心的范围
+        array<double, N> centerLower;
+        array<double, N> centerUpper;
+        centerLower.fill(numeric_limits<double>::infinity());
+        centerUpper.fill(-numeric_limits<double>::infinity());
+        for (size_t k = first; k < first + size; k++) {
+            const double* center = &centers[order[k] * N];
+            for (size_t axis = 0; axis < N; axis++) {
+                centerLower[axis] = min(centerLower[axis], center[axis]);
+                centerUpper[axis] = max(centerUpper[axis], center[axis]);
+            }
+        }
+        double parentArea = m_Nodes[index].Bounds.GetSurfaceArea();
+        // 遍历一次结点的代价与求交一次的代价相当
+        double bestCost = numeric_limits<double>::infinity();
+        size_t bestAxis = N;
+        size_t bestBin = 0;
+        for (size_t axis = 0; axis < N; axis++) {
+            double extent = centerUpper[axis] - centerLower[axis];
+            if (!(extent > 0)) {
+                continue;
+            }
+            double scale = BIN_COUNT / extent;
+            array<size_t, BIN_COUNT> binCounts;
+            binCounts.fill(0);
+            array<array<double, 2 * N>, BIN_COUNT> binBounds;
+            for (auto& bounds: binBounds) {
+                makeEmpty(bounds.data());
+            }
+            for (size_t k = first; k < first + size; k++) {
+                auto face = order[k];
+                auto bin = min(
+                    size_t((centers[face * N + axis] - centerLower[axis]) * scale),
+                    BIN_COUNT - 1
+                );
+                binCounts[bin]++;
+                expand(binBounds[bin].data(), face);
+            }
+            // 从左向右累积，leftAreas[b] 为前 b + 1 个桶的表面积
+            array<double, BIN_COUNT> leftAreas;
+            array<size_t, BIN_COUNT> leftCounts;
+            array<double, 2 * N> running;
+            makeEmpty(running.data());
+            size_t runningCount = 0;
+            for (size_t b = 0; b + 1 < BIN_COUNT; b++) {
+                for (size_t axis2 = 0; axis2 < N; axis2++) {
+                    running[axis2] = min(running[axis2], binBounds[b][axis2]);
+                    running[N + axis2] = max(
+                        running[N + axis2],
+                        binBounds[b][N + axis2]
+                    );
+                }
+                runningCount += binCounts[b];
+                leftCounts[b] = runningCount;
+                leftAreas[b] = runningCount == 0 ?
+                    0 : getArea(running.data(), running.data() + N);
+            }
+            // 从右向左累积，在桶 b 之前划分
+            makeEmpty(running.data());
+            runningCount = 0;
+            for (size_t b = BIN_COUNT - 1; b > 0; b--) {
+                for (size_t axis2 = 0; axis2 < N; axis2++) {
+                    running[axis2] = min(running[axis2], binBounds[b][axis2]);
+                    running[N + axis2] = max(
+                        running[N + axis2],
+                        binBounds[b][N + axis2]
+                    );
+                }
+                runningCount += binCounts[b];
+                if (runningCount == 0 || leftCounts[b - 1] == 0) {
+                    continue;
+                }
+                double cost = parentArea +
+                    leftAreas[b - 1] * leftCounts[b - 1] +
+                    getArea(running.data(), running.data() + N) * runningCount;
+                if (cost < bestCost) {
+                    bestCost = cost;
+                    bestAxis = axis;
+                    bestBin = b;
+                }
+            }
+        }
+        size_t leftSize;
+        if (bestAxis == N) {
+            // 所有面中心重合，无法按位置划分
+            if (size <= MAX_LEAF_SIZE) {
+                continue;
+            }
+            leftSize = size / 2;
+        }
+        else {
+            if (size <= MAX_LEAF_SIZE && parentArea * size <= bestCost) {
+                continue;
+            }
+            double lower = centerLower[bestAxis];
+            double scale =
+                BIN_COUNT / (centerUpper[bestAxis] - centerLower[bestAxis]);
+            auto middle = partition(
+                order.begin() + first,
+                order.begin() + first + size,
+                [&](size_t face) {
+                    return min(
+                        size_t((centers[face * N + bestAxis] - lower) * scale),
+                        BIN_COUNT - 1
+                    ) < bestBin;
+                }
+            );
+            leftSize = middle - (order.begin() + first);
+        }
+        size_t left = m_Nodes.size();
+        m_Nodes.push_back(makeNode(first, leftSize));
+        m_Nodes.push_back(makeNode(first + leftSize, size - leftSize));
+        m_Nodes[index].First = left;
+        m_Nodes[index].Count = 0;
+        pending.push_back(left);
+        pending.push_back(left + 1);
+    }
+
+    m_FaceIndices = move(order);
+    m_Vertices.resize(count * STRIDE);
+    for (size_t k = 0; k < count; k++) {
+        double* target = &m_Vertices[k * STRIDE];
+        for (auto& point: model.Faces[m_FaceIndices[k]].Points) {
+            auto coords = point.GetData();
+            copy(coords, coords + N, target);
+            target += N;
+        }
+    }
+}
+
+/**********************************************************************
+【函数名称】 Count
+【函数功能】 获取建立索引的面的个数。
+【参数】 无
+【返回值】
+    面的个数。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+size_t Bvh<N>::Count() const {
+    return m_FaceIndices.size();
+}
+
+/**********************************************************************
+【函数名称】 GetNodes
+【函数功能】 获取所有结点，下标 0 为根结点。
+【参数】 无
+【返回值】
+    结点数组的常引用。没有面时为空。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+const vector<typename Bvh<N>::Node>& Bvh<N>::GetNodes() const {
+    return m_Nodes;
+}
+
+/**********************************************************************
+【函数名称】 GetBoundingBox
+【函数功能】 获取能包含所有面的最小长方体。
+【参数】 无
+【返回值】
+    根结点的包围盒。没有面时两个顶点都为原点。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+Tools::Box<N> Bvh<N>::GetBoundingBox() const {
+    if (m_Nodes.empty()) {
+        return Tools::Box<N>(Point<N>::Origin, Point<N>::Origin);
+    }
+    return m_Nodes.front().Bounds;
+}
+
+/**********************************************************************
+【函数名称】 Intersect
+【函数功能】
+    求射线与面的第一个交点，仅适用于 3 维。
+    射线的方向为 0 向量时视为不相交。
+【参数】
+    origin: 射线起点。
+    direction: 射线方向，不必为单位向量。
+    hit: 相交时存放最近的交点。
+    maxDistance: 只考虑到起点距离不超过此值的交点。
+【返回值】
+    射线是否与某个面相交。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+bool Bvh<N>::Intersect(
+    const Point<N>& origin,
+    const Vector<double, N>& direction,
+    Hit& hit,
+    double maxDistance
+) const {
+    static_assert(N == 3, "Ray intersection is only defined in 3 dimensions.");
+    double length = direction.Module();
+    if (m_Nodes.empty() || !(length > 0)) {
+        return false;
+    }
+    auto start = origin.GetData();
+    auto components = direction.GetData();
+    array<double, N> unit;
+    array<double, N> inverse;
+    for (size_t axis = 0; axis < N; axis++) {
+        unit[axis] = components[axis] / length;
+        inverse[axis] = 1.0 / unit[axis];
+    }
+    double best = maxDistance;
+    size_t bestFace = Count();
+    double entry;
+    if (!IntersectBox(m_Nodes[0].Bounds, start, inverse.data(), best, entry)) {
+        return false;
+    }
+    // 待访问的结点及射线进入其包围盒时的距离
+    vector<pair<size_t, double>> pending { { 0, entry } };
+    while (!pending.empty()) {
+        auto current = pending.back();
+        pending.pop_back();
+        if (current.second > best) {
+            continue;
+        }
+        const Node& node = m_Nodes[current.first];
+        if (node.Count > 0) {
+            for (size_t k = node.First; k < node.First + node.Count; k++) {
+                double distance;
+                if (IntersectTriangle(
+                        &m_Vertices[k * STRIDE],
+                        start,
+                        unit.data(),
+                        distance
+                    ) && distance <= best) {
+                    best = distance;
+                    bestFace = k;
+                }
+            }
+            continue;
+        }
+        double leftEntry;
+        double rightEntry;
+        bool isLeftHit = IntersectBox(
+            m_Nodes[node.First].Bounds, start, inverse.data(), best, leftEntry
+        );
+        bool isRightHit = IntersectBox(
+            m_Nodes[node.First + 1].Bounds, start, inverse.data(), best, rightEntry
+        );
+        // 先压入较远的子结点，使较近的先被访问
+        if (isLeftHit && isRightHit && leftEntry < rightEntry) {
+            pending.push_back({ node.First + 1, rightEntry });
+            pending.push_back({ node.First, leftEntry });
+        }
+        else {
+            if (isLeftHit) {
+                pending.push_back({ node.First, leftEntry });
+            }
+            if (isRightHit) {
+                pending.push_back({ node.First + 1, rightEntry });
+            }
+        }
+    }
+    if (bestFace == Count()) {
+        return false;
+    }
+    array<double, N> position;
+    for (size_t axis = 0; axis < N; axis++) {
+        position[axis] = start[axis] + unit[axis] * best;
+    }
+    hit.FaceIndex = m_FaceIndices[bestFace];
+    hit.Distance = best;
+    hit.Position = Point<N>(position);
+    return true;
+}
+
+/**********************************************************************
+【函数名称】 FindClosestPoint
+【函数功能】 求所有面上距给定点最近的点。
+【参数】
+    point: 给定点。
+    hit: 存放最近的点及其所在的面。
+【返回值】
+    是否找到，即是否有面。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+bool Bvh<N>::FindClosestPoint(const Point<N>& point, Hit& hit) const {
+    if (m_Nodes.empty()) {
+        return false;
+    }
+    auto coords = point.GetData();
+    double best = numeric_limits<double>::infinity();
+    size_t bestFace = 0;
+    array<double, N> bestPosition;
+    array<double, N> candidate;
+    // 待访问的结点及查询点到其包围盒距离的平方
+    vector<pair<size_t, double>> pending {
+        { 0, m_Nodes[0].Bounds.SquaredDistanceTo(point) }
+    };
+    while (!pending.empty()) {
+        auto current = pending.back();
+        pending.pop_back();
+        if (current.second >= best) {
+            continue;
+        }
+        const Node& node = m_Nodes[current.first];
+        if (node.Count > 0) {
+            for (size_t k = node.First; k < node.First + node.Count; k++) {
+                ClosestPointOnTriangle(
+                    &m_Vertices[k * STRIDE],
+                    coords,
+                    candidate.data()
+                );
+                double distance = 0;
+                for (size_t axis = 0; axis < N; axis++) {
+                    double delta = candidate[axis] - coords[axis];
+                    distance += delta * delta;
+                }
+                if (distance < best) {
+                    best = distance;
+                    bestFace = k;
+                    bestPosition = candidate;
+                }
+            }
+            continue;
+        }
+        double left = m_Nodes[node.First].Bounds.SquaredDistanceTo(point);
+        double right = m_Nodes[node.First + 1].Bounds.SquaredDistanceTo(point);
+        if (left < right) {
+            pending.push_back({ node.First + 1, right });
+            pending.push_back({ node.First, left });
+        }
+        else {
+            pending.push_back({ node.First, left });
+            pending.push_back({ node.First + 1, right });
+        }
+    }
+    hit.FaceIndex = m_FaceIndices[bestFace];
+    hit.Distance = sqrt(best);
+    hit.Position = Point<N>(bestPosition);
+    return true;
+}
+
+/**********************************************************************
+【函数名称】 FindOverlapping
+【函数功能】 查找包围盒与给定长方体相交的面。
+【参数】
+    box: 给定长方体。
+【返回值】
+    按升序排列的面在模型 Faces 中的下标。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+vector<size_t> Bvh<N>::FindOverlapping(const Tools::Box<N>& box) const {
+    vector<size_t> result;
+    if (m_Nodes.empty()) {
+        return result;
+    }
+    array<double, N> lower;
+    array<double, N> upper;
+    auto vertex1 = box.Vertex1.GetData();
+    auto vertex2 = box.Vertex2.GetData();
+    for (size_t axis = 0; axis < N; axis++) {
+        lower[axis] = min(vertex1[axis], vertex2[axis]);
+        upper[axis] = max(vertex1[axis], vertex2[axis]);
+    }
+    vector<size_t> pending { 0 };
+    while (!pending.empty()) {
+        const Node& node = m_Nodes[pending.back()];
+        pending.pop_back();
+        if (!node.Bounds.Overlaps(box)) {
+            continue;
+        }
+        if (node.Count == 0) {
+            pending.push_back(node.First);
+            pending.push_back(node.First + 1);
+            continue;
+        }
+        for (size_t k = node.First; k < node.First + node.Count; k++) {
+            const double* triangle = &m_Vertices[k * STRIDE];
+            bool isOverlapping = true;
+            for (size_t axis = 0; isOverlapping && axis < N; axis++) {
+                double faceLower = min(
+                    min(triangle[axis], triangle[N + axis]),
+                    triangle[2 * N + axis]
+                );
+                double faceUpper = max(
+                    max(triangle[axis], triangle[N + axis]),
+                    triangle[2 * N + axis]
+                );
+                isOverlapping =
+                    faceUpper >= lower[axis] && faceLower <= upper[axis];
+            }
+            if (isOverlapping) {
+                result.push_back(m_FaceIndices[k]);
+            }
+        }
+    }
+    sort(result.begin(), result.end());
+    return result;
+}
+
+/**********************************************************************
+【函数名称】 IntersectBox
+【函数功能】 用平板法求射线进入长方体时的距离。
+【参数】
+    box: 各维最小值在 Vertex1 的长方体。
+    origin: 射线起点的坐标。
+    inverse: 单位方向各分量的倒数。
+    maxDistance: 最远距离。
+    entry: 相交时存放进入长方体时的距离，起点在内部时为 0。
+【返回值】
+    射线在 maxDistance 内是否与长方体相交。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+bool Bvh<N>::IntersectBox(
+    const Tools::Box<N>& box,
+    const double* origin,
+    const double* inverse,
+    double maxDistance,
+    double& entry
+) {
+    auto lower = box.Vertex1.GetData();
+    auto upper = box.Vertex2.GetData();
+    double entryDistance = 0;
+    double exitDistance = maxDistance;
+    for (size_t axis = 0; axis < N; axis++) {
+        double t1 = (lower[axis] - origin[axis]) * inverse[axis];
+        double t2 = (upper[axis] - origin[axis]) * inverse[axis];
+        // 起点恰在平板边界且方向平行时 t 为 NaN，fmin/fmax 会忽略它
+        entryDistance = fmax(entryDistance, fmin(t1, t2));
+        exitDistance = fmin(exitDistance, fmax(t1, t2));
+    }
+    entry = entryDistance;
+    return entryDistance <= exitDistance;
+}
+
+/**********************************************************************
+【函数名称】 IntersectTriangle
+【函数功能】 用 Möller–Trumbore 算法求 3 维射线与三角形的交点。
+【参数】
+    triangle: 三角形 3 个顶点的坐标。
+    origin: 射线起点的坐标。
+    direction: 射线单位方向的分量。
+    distance: 相交时存放交点到起点的距离。
+【返回值】
+    射线是否与三角形相交。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+bool Bvh<N>::IntersectTriangle(
+    const double* triangle,
+    const double* origin,
+    const double* direction,
+    double& distance
+) {
+    const double* v0 = triangle;
+    const double* v1 = triangle + N;
+    const double* v2 = triangle + 2 * N;
+    double edge1[3] = { v1[0] - v0[0], v1[1] - v0[1], v1[2] - v0[2] };
+    double edge2[3] = { v2[0] - v0[0], v2[1] - v0[1], v2[2] - v0[2] };
+    double p[3] = {
+        direction[1] * edge2[2] - direction[2] * edge2[1],
+        direction[2] * edge2[0] - direction[0] * edge2[2],
+        direction[0] * edge2[1] - direction[1] * edge2[0]
+    };
+    double determinant = edge1[0] * p[0] + edge1[1] * p[1] + edge1[2] * p[2];
+    // 射线与三角形所在平面平行
+    if (determinant == 0) {
+        return false;
+    }
+    double inverse = 1.0 / determinant;
+    double s[3] = { origin[0] - v0[0], origin[1] - v0[1], origin[2] - v0[2] };
+    double u = (s[0] * p[0] + s[1] * p[1] + s[2] * p[2]) * inverse;
+    if (u < 0 || u > 1) {
+        return false;
+    }
+    double q[3] = {
+        s[1] * edge1[2] - s[2] * edge1[1],
+        s[2] * edge1[0] - s[0] * edge1[2],
+        s[0] * edge1[1] - s[1] * edge1[0]
+    };
+    double v = (direction[0] * q[0] + direction[1] * q[1] + direction[2] * q[2])
+        * inverse;
+    if (v < 0 || u + v > 1) {
+        return false;
+    }
+    double t = (edge2[0] * q[0] + edge2[1] * q[1] + edge2[2] * q[2]) * inverse;
+    if (t < 0) {
+        return false;
+    }
+    distance = t;
+    return true;
+}
+
+/**********************************************************************
+【函数名称】 ClosestPointOnTriangle
+【函数功能】
+    按点在三角形各 Voronoi 区域中的位置，求三角形上距给定点最近的点。
+    只用到内积，适用于任意维数。
+【参数】
+    triangle: 三角形 3 个顶点的坐标。
+    point: 给定点的坐标。
+    result: 存放最近点的坐标。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void Bvh<N>::ClosestPointOnTriangle(
+    const double* triangle,
+    const double* point,
+    double* result
+) {
+    const double* a = triangle;
+    const double* b = triangle + N;
+    const double* c = triangle + 2 * N;
+    double d1 = 0;
+    double d2 = 0;
+    double d3 = 0;
+    double d4 = 0;
+    double d5 = 0;
+    double d6 = 0;
+    for (size_t axis = 0; axis < N; axis++) {
+        double ab = b[axis] - a[axis];
+        double ac = c[axis] - a[axis];
+        double ap = point[axis] - a[axis];
+        double bp = point[axis] - b[axis];
+        double cp = point[axis] - c[axis];
+        d1 += ab * ap;
+        d2 += ac * ap;
+        d3 += ab * bp;
+        d4 += ac * bp;
+        d5 += ab * cp;
+        d6 += ac * cp;
+    }
+    // 按 result = a + v * ab + w * ac 写出结果
+    auto assign = [&](double v, double w) {
+        for (size_t axis = 0; axis < N; axis++) {
+            result[axis] = a[axis] +
+                v * (b[axis] - a[axis]) + w * (c[axis] - a[axis]);
+        }
+    };
+    // 顶点 a 区域
+    if (d1 <= 0 && d2 <= 0) {
+        assign(0, 0);
+        return;
+    }
+    // 顶点 b 区域
+    if (d3 >= 0 && d4 <= d3) {
+        assign(1, 0);
+        return;
+    }
+    // 边 ab 区域
+    double vc = d1 * d4 - d3 * d2;
+    if (vc <= 0 && d1 >= 0 && d3 <= 0) {
+        assign(d1 / (d1 - d3), 0);
+        return;
+    }
+    // 顶点 c 区域
+    if (d6 >= 0 && d5 <= d6) {
+        assign(0, 1);
+        return;
+    }
+    // 边 ac 区域
+    double vb = d5 * d2 - d1 * d6;
+    if (vb <= 0 && d2 >= 0 && d6 <= 0) {
+        assign(0, d2 / (d2 - d6));
+        return;
+    }
+    // 边 bc 区域
+    double va = d3 * d6 - d5 * d4;
+    if (va <= 0 && (d4 - d3) >= 0 && (d5 - d6) >= 0) {
+        double w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+        assign(1 - w, w);
+        return;
+    }
+    // 三角形内部
+    double denominator = 1.0 / (va + vb + vc);
+    assign(vb * denominator, vc * denominator);
+}
+
+}
+
+}
\ No newline at end of file
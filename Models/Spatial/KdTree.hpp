@@ -0,0 +1,284 @@
+/*************************************************************************
+【文件名】 KdTree.hpp
+【功能模块和目的】 KdTree 类为 N 维点集建立 k-d 树，加速邻近点查询。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include "../Core/Model.hpp"
+#include "../Core/Point.hpp"
+#include "../Tools/Box.hpp"
+using namespace std;
+
+namespace C3w {
+
+namespace Spatial {
+
+/*************************************************************************
+【类名】 KdTree
+【功能】
+    为 N 维点集建立 k-d 树。每个点有一个固定的下标，查询返回下标。
+    构建时在每个结点上取坐标跨度最大的维，用 nth_element 按中位数划分，
+    复杂度为 O(V log V)；树按数组隐式存储，区间 [b, e) 的划分点位于
+    中间位置，结点不超过 LEAF_SIZE 个点时为叶结点。
+    添加、修改、删除点不立即调整树：修改过的点暂存在待处理表中逐个比较，
+    树中原来的位置作废；待处理或作废的点过多时自动重新构建。
+【接口说明】
+    添加/修改/删除点，重新构建，
+    查询给定半径内的点、最近的 k 个点、给定长方体内的点。
+    所有查询只比较距离的平方。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+template <size_t N>
+class KdTree final {
+    public:
+        // 成员
+
+        // 维数
+        static constexpr size_t Dimension { N };
+        // 叶结点最多容纳的点数
+        static constexpr size_t LEAF_SIZE { 8 };
+        // 待处理点数不超过此值时不因待处理点过多而重新构建
+        static constexpr size_t MIN_PENDING_COUNT { 256 };
+
+        // 构造函数
+
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 初始化不含任何点的 KdTree 类型实例。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        KdTree();
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 为一组点构建 k-d 树，点的下标即其在数组中的下标。
+        【参数】
+            points: 要建立索引的点，可以重复。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        explicit KdTree(const vector<Point<N>>& points);
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】
+            为模型中的所有点构建 k-d 树，
+            点的下标即其在 Model::CollectPoints 结果中的下标。
+        【参数】
+            model: 要建立索引的模型。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        explicit KdTree(const Model<N>& model);
+        /**********************************************************************
+        【函数名称】 拷贝构造函数
+        【函数功能】 使用另一 KdTree 初始化 KdTree 类型实例。
+        【参数】
+            other: 另一 KdTree 实例。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        KdTree(const KdTree<N>& other) = default;
+
+        // 属性
+
+        /**********************************************************************
+        【函数名称】 Count
+        【函数功能】 获取点的个数，不含已删除的点。
+        【参数】 无
+        【返回值】
+            点的个数。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        size_t Count() const;
+        /**********************************************************************
+        【函数名称】 Contains
+        【函数功能】 判断下标是否对应一个未删除的点。
+        【参数】
+            index: 点的下标。
+        【返回值】
+            下标是否有效。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        bool Contains(size_t index) const;
+        /**********************************************************************
+        【函数名称】 GetPoint
+        【函数功能】 获取指定下标的点，下标无效时抛出 IndexOverflowException。
+        【参数】
+            index: 点的下标。
+        【返回值】
+            对应的点。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Point<N> GetPoint(size_t index) const;
+
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 Add
+        【函数功能】 添加一个点，优先复用已删除的点的下标。
+        【参数】
+            point: 要添加的点。
+        【返回值】
+            新点的下标。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        size_t Add(const Point<N>& point);
+        /**********************************************************************
+        【函数名称】 Set
+        【函数功能】 修改一个点，下标无效时抛出 IndexOverflowException。
+        【参数】
+            index: 点的下标。
+            point: 修改后的点。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void Set(size_t index, const Point<N>& point);
+        /**********************************************************************
+        【函数名称】 Remove
+        【函数功能】 删除一个点，下标无效时抛出 IndexOverflowException。
+        【参数】
+            index: 点的下标。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void Remove(size_t index);
+        /**********************************************************************
+        【函数名称】 Rebuild
+        【函数功能】 用所有未删除的点重新构建树，清空待处理表。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void Rebuild();
+        /**********************************************************************
+        【函数名称】 FindInRadius
+        【函数功能】 查找到给定点的距离不超过半径的点。
+        【参数】
+            center: 给定点。
+            radius: 半径，为负时结果为空。
+        【返回值】
+            按升序排列的点的下标。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        vector<size_t> FindInRadius(const Point<N>& center, double radius) const;
+        /**********************************************************************
+        【函数名称】 FindNearest
+        【函数功能】 查找距给定点最近的若干个点。
+        【参数】
+            point: 给定点。
+            count: 要查找的个数，超过点数时返回所有点。
+        【返回值】
+            按距离升序排列的点的下标，距离相同时下标小的在前。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        vector<size_t> FindNearest(const Point<N>& point, size_t count) const;
+        /**********************************************************************
+        【函数名称】 FindInBox
+        【函数功能】 查找位于给定长方体内（含边界）的点。
+        【参数】
+            box: 给定长方体。
+        【返回值】
+            按升序排列的点的下标。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        vector<size_t> FindInBox(const Tools::Box<N>& box) const;
+
+        // 操作符
+
+        /**********************************************************************
+        【函数名称】 operator=
+        【函数功能】 将另一 KdTree 赋值给自身。
+        【参数】
+            other: 从之取值的 KdTree。
+        【返回值】
+            自身的引用。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        KdTree<N>& operator=(const KdTree<N>& other) = default;
+
+    private:
+        // 点的状态
+        enum class State : unsigned char {
+            // 已删除
+            REMOVED,
+            // 位于树中
+            INDEXED,
+            // 位于待处理表中
+            PENDING
+        };
+
+        /**********************************************************************
+        【类名】 Entry
+        【功能】 树中的一个位置，坐标与下标相邻存放，划分时一起移动。
+        【接口说明】 点的坐标与下标。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        struct Entry {
+            // 建树时点的坐标，点被修改后不更新
+            double Coordinates[N];
+            // 点的下标
+            size_t Index;
+        };
+
+        // 按下标排列的点的坐标，每个点 N 个
+        vector<double> m_Points;
+        // 按下标排列的点的状态
+        vector<State> m_States;
+        // 已删除的点的下标，供 Add 复用
+        vector<size_t> m_FreeIndices;
+        // 按树中顺序排列的位置，重新构建时复用已分配的空间
+        vector<Entry> m_Tree;
+        // 按树中顺序排列的划分维，只对内部结点的划分点有意义
+        vector<unsigned char> m_Axes;
+        // 待处理的点的下标
+        vector<size_t> m_Pending;
+        // 树中已作废的位置个数
+        size_t m_StaleCount;
+        // 未删除的点的个数
+        size_t m_Count;
+
+        /**********************************************************************
+        【函数名称】 CheckIndex
+        【函数功能】 下标不对应未删除的点时抛出 IndexOverflowException。
+        【参数】
+            index: 点的下标。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void CheckIndex(size_t index) const;
+        /**********************************************************************
+        【函数名称】 RebuildIfNeeded
+        【函数功能】
+            待处理点数超过 MIN_PENDING_COUNT 与树中点数的 1/64 中较大者，
+            或作废的位置超过树中点数的 1/4 时重新构建。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void RebuildIfNeeded();
+        /**********************************************************************
+        【函数名称】 GetSquaredDistance
+        【函数功能】 求两组坐标之间距离的平方。
+        【参数】
+            first: 第一组坐标。
+            second: 第二组坐标。
+        【返回值】
+            距离的平方。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static double GetSquaredDistance(
+            const double* first,
+            const double* second
+        );
+};
+
+}
+
+}
+
+#include "KdTree.tpp"
\ No newline at end of file
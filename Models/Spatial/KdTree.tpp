@@ -0,0 +1,560 @@
+/*************************************************************************
+【文件名】 KdTree.tpp
+【功能模块和目的】 为 KdTree.hpp 提供实现。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+#include "../Core/Errors.hpp"
+#include "../Core/Model.hpp"
+#include "../Core/Point.hpp"
+#include "../Tools/Box.hpp"
+#include "KdTree.hpp"
+using namespace std;
+using namespace C3w::Errors;
+
+namespace C3w {
+
+namespace Spatial {
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 初始化不含任何点的 KdTree 类型实例。
+【参数】 无
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+KdTree<N>::KdTree(): m_StaleCount(0), m_Count(0) {
+}
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 为一组点构建 k-d 树，点的下标即其在数组中的下标。
+【参数】
+    points: 要建立索引的点，可以重复。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+KdTree<N>::KdTree(const vector<Point<N>>& points): KdTree() {
+    m_Points.reserve(points.size() * N);
+    for (auto& point: points) {
+        m_Points.insert(m_Points.end(), point.GetData(), point.GetData() + N);
+    }
+    m_States.assign(points.size(), State::PENDING);
+    m_Count = points.size();
+    Rebuild();
+}
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】
+    为模型中的所有点构建 k-d 树，
+    点的下标即其在 Model::CollectPoints 结果中的下标。
+【参数】
+    model: 要建立索引的模型。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+KdTree<N>::KdTree(const Model<N>& model): KdTree() {
+    auto points = model.CollectPoints();
+    m_Points.reserve(points.Count() * N);
+    for (auto& point: points) {
+        m_Points.insert(m_Points.end(), point.GetData(), point.GetData() + N);
+    }
+    m_States.assign(points.Count(), State::PENDING);
+    m_Count = points.Count();
+    Rebuild();
+}
+
+/**********************************************************************
+【函数名称】 Count
+【函数功能】 获取点的个数，不含已删除的点。
+【参数】 无
+【返回值】
+    点的个数。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+size_t KdTree<N>::Count() const {
+    return m_Count;
+}
+
+/**********************************************************************
+【函数名称】 Contains
+【函数功能】 判断下标是否对应一个未删除的点。
+【参数】
+    index: 点的下标。
+【返回值】
+    下标是否有效。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+bool KdTree<N>::Contains(size_t index) const {
+    return index < m_States.size() && m_States[index] != State::REMOVED;
+}
+
+/**********************************************************************
+【函数名称】 GetPoint
+【函数功能】 获取指定下标的点，下标无效时抛出 IndexOverflowException。
+【参数】
+    index: 点的下标。
+【返回值】
+    对应的点。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+Point<N> KdTree<N>::GetPoint(size_t index) const {
+    CheckIndex(index);
+    array<double, N> coordinates;
+    copy(&m_Points[index * N], &m_Points[index * N] + N, coordinates.begin());
+    return Point<N>(coordinates);
+}
+
+/**********************************************************************
+【函数名称】 Add
+【函数功能】 添加一个点，优先复用已删除的点的下标。
+【参数】
+    point: 要添加的点。
+【返回值】
+    新点的下标。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+size_t KdTree<N>::Add(const Point<N>& point) {
+    size_t index;
+    if (!m_FreeIndices.empty()) {
+        index = m_FreeIndices.back();
+        m_FreeIndices.pop_back();
+        copy(point.GetData(), point.GetData() + N, &m_Points[index * N]);
+        m_States[index] = State::PENDING;
+    }
+    else {
+        index = m_States.size();
+        m_Points.insert(m_Points.end(), point.GetData(), point.GetData() + N);
+        m_States.push_back(State::PENDING);
+    }
+    m_Pending.push_back(index);
+    m_Count++;
+    RebuildIfNeeded();
+    return index;
+}
+
+/**********************************************************************
+【函数名称】 Set
+【函数功能】 修改一个点，下标无效时抛出 IndexOverflowException。
+【参数】
+    index: 点的下标。
+    point: 修改后的点。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void KdTree<N>::Set(size_t index, const Point<N>& point) {
+    CheckIndex(index);
+    copy(point.GetData(), point.GetData() + N, &m_Points[index * N]);
+    // 树中的坐标不更新，原来的位置作废
+    if (m_States[index] == State::INDEXED) {
+        m_States[index] = State::PENDING;
+        m_Pending.push_back(index);
+        m_StaleCount++;
+        RebuildIfNeeded();
+    }
+}
+
+/**********************************************************************
+【函数名称】 Remove
+【函数功能】 删除一个点，下标无效时抛出 IndexOverflowException。
+【参数】
+    index: 点的下标。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void KdTree<N>::Remove(size_t index) {
+    CheckIndex(index);
+    if (m_States[index] == State::INDEXED) {
+        m_StaleCount++;
+    }
+    else {
+        auto position = find(m_Pending.begin(), m_Pending.end(), index);
+        *position = m_Pending.back();
+        m_Pending.pop_back();
+    }
+    m_States[index] = State::REMOVED;
+    m_FreeIndices.push_back(index);
+    m_Count--;
+    RebuildIfNeeded();
+}
+
+/**********************************************************************
+【函数名称】 Rebuild
+【函数功能】 用所有未删除的点重新构建树，清空待处理表。
+【参数】 无
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void KdTree<N>::Rebuild() {
+    m_Tree.clear();
+    m_Tree.reserve(m_Count);
+    for (size_t i = 0; i < m_States.size(); i++) {
+        if (m_States[i] == State::REMOVED) {
+            continue;
+        }
+        Entry entry;
+        copy(&m_Points[i * N], &m_Points[i * N] + N, entry.Coordinates);
+        entry.Index = i;
+        m_Tree.push_back(entry);
+        m_States[i] = State::INDEXED;
+    }
+    auto count = m_Tree.size();
+    m_Axes.assign(count, 0);
+    vector<pair<size_t, size_t>> ranges;
+    if (count > LEAF_SIZE) {
+        ranges.push_back({ 0, count });
+    }
+    while (!ranges.empty()) {
+        size_t begin = ranges.back().first;
+        size_t end = ranges.back().second;
+        ranges.pop_back();
+        // 取坐标跨度最大的维
+        array<double, N> lower;
+        array<double, N> upper;
+        copy(m_Tree[begin].Coordinates, m_Tree[begin].Coordinates + N,
+            lower.begin());
+        upper = lower;
+        for (size_t k = begin + 1; k < end; k++) {
+            for (size_t axis = 0; axis < N; axis++) {
+                lower[axis] = min(lower[axis], m_Tree[k].Coordinates[axis]);
+                upper[axis] = max(upper[axis], m_Tree[k].Coordinates[axis]);
+            }
+        }
+        size_t splitAxis = 0;
+        for (size_t axis = 1; axis < N; axis++) {
+            if (upper[axis] - lower[axis] >
+                upper[splitAxis] - lower[splitAxis]) {
+                splitAxis = axis;
+            }
+        }
+        // 左侧坐标不大于划分点，右侧不小于划分点
+        size_t middle = begin + (end - begin) / 2;
+        nth_element(
+            m_Tree.begin() + begin,
+            m_Tree.begin() + middle,
+            m_Tree.begin() + end,
+            [splitAxis](const Entry& left, const Entry& right) {
+                return left.Coordinates[splitAxis] <
+                    right.Coordinates[splitAxis];
+            }
+        );
+        m_Axes[middle] = static_cast<unsigned char>(splitAxis);
+        if (middle - begin > LEAF_SIZE) {
+            ranges.push_back({ begin, middle });
+        }
+        if (end - middle - 1 > LEAF_SIZE) {
+            ranges.push_back({ middle + 1, end });
+        }
+    }
+    m_Pending.clear();
+    m_StaleCount = 0;
+}
+
+/**********************************************************************
+【函数名称】 FindInRadius
+【函数功能】 查找到给定点的距离不超过半径的点。
+【参数】
+    center: 给定点。
+    radius: 半径，为负时结果为空。
+【返回值】
+    按升序排列的点的下标。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+vector<size_t> KdTree<N>::FindInRadius(
+    const Point<N>& center,
+    double radius
+) const {
+    vector<size_t> result;
+    if (!(radius >= 0)) {
+        return result;
+    }
+    double limit = radius * radius;
+    auto target = center.GetData();
+    auto visit = [&](size_t position) {
+        auto& entry = m_Tree[position];
+        if (m_States[entry.Index] == State::INDEXED &&
+            GetSquaredDistance(entry.Coordinates, target) <= limit) {
+            result.push_back(entry.Index);
+        }
+    };
+    vector<pair<size_t, size_t>> ranges;
+    if (!m_Tree.empty()) {
+        ranges.push_back({ 0, m_Tree.size() });
+    }
+    while (!ranges.empty()) {
+        size_t begin = ranges.back().first;
+        size_t end = ranges.back().second;
+        ranges.pop_back();
+        if (end - begin <= LEAF_SIZE) {
+            for (size_t k = begin; k < end; k++) {
+                visit(k);
+            }
+            continue;
+        }
+        size_t middle = begin + (end - begin) / 2;
+        visit(middle);
+        auto axis = m_Axes[middle];
+        double delta = target[axis] - m_Tree[middle].Coordinates[axis];
+        bool isCrossing = delta * delta <= limit;
+        if (delta <= 0 || isCrossing) {
+            ranges.push_back({ begin, middle });
+        }
+        if (delta >= 0 || isCrossing) {
+            ranges.push_back({ middle + 1, end });
+        }
+    }
+    for (auto index: m_Pending) {
+        if (GetSquaredDistance(&m_Points[index * N], target) <= limit) {
+            result.push_back(index);
+        }
+    }
+    sort(result.begin(), result.end());
+    return result;
+}
+
+/**********************************************************************
+【函数名称】 FindNearest
+【函数功能】 查找距给定点最近的若干个点。
+【参数】
+    point: 给定点。
+    count: 要查找的个数，超过点数时返回所有点。
+【返回值】
+    按距离升序排列的点的下标，距离相同时下标小的在前。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+vector<size_t> KdTree<N>::FindNearest(
+    const Point<N>& point,
+    size_t count
+) const {
+    auto target = point.GetData();
+    // 以（距离的平方，下标）为键的大根堆，堆顶为当前第 count 近的点
+    vector<pair<double, size_t>> heap;
+    heap.reserve(min(count, m_Count));
+    auto consider = [&](const double* coordinates, size_t index) {
+        pair<double, size_t> candidate(
+            GetSquaredDistance(coordinates, target),
+            index
+        );
+        if (heap.size() < count) {
+            heap.push_back(candidate);
+            push_heap(heap.begin(), heap.end());
+        }
+        else if (candidate < heap.front()) {
+            pop_heap(heap.begin(), heap.end());
+            heap.back() = candidate;
+            push_heap(heap.begin(), heap.end());
+        }
+    };
+    auto visit = [&](const Entry& entry) {
+        if (m_States[entry.Index] == State::INDEXED) {
+            consider(entry.Coordinates, entry.Index);
+        }
+    };
+    // 距离平方超过此值的区间不可能改变结果
+    auto getLimit = [&]() {
+        return heap.size() < count ?
+            numeric_limits<double>::infinity() : heap.front().first;
+    };
+    if (count > 0) {
+        for (auto index: m_Pending) {
+            consider(&m_Points[index * N], index);
+        }
+    }
+    // 区间及其中的点到给定点距离平方的下界
+    struct Range {
+        size_t Begin;
+        size_t End;
+        double Bound;
+    };
+    vector<Range> ranges;
+    if (count > 0 && !m_Tree.empty()) {
+        ranges.push_back({ 0, m_Tree.size(), 0 });
+    }
+    while (!ranges.empty()) {
+        auto range = ranges.back();
+        ranges.pop_back();
+        if (range.Bound > getLimit()) {
+            continue;
+        }
+        if (range.End - range.Begin <= LEAF_SIZE) {
+            for (size_t k = range.Begin; k < range.End; k++) {
+                visit(m_Tree[k]);
+            }
+            continue;
+        }
+        size_t middle = range.Begin + (range.End - range.Begin) / 2;
+        visit(m_Tree[middle]);
+        auto axis = m_Axes[middle];
+        double delta = target[axis] - m_Tree[middle].Coordinates[axis];
+        Range left { range.Begin, middle, range.Bound };
+        Range right { middle + 1, range.End, range.Bound };
+        // 先压入远侧，使近侧先被访问
+        if (delta <= 0) {
+            right.Bound = max(range.Bound, delta * delta);
+            ranges.push_back(right);
+            ranges.push_back(left);
+        }
+        else {
+            left.Bound = max(range.Bound, delta * delta);
+            ranges.push_back(left);
+            ranges.push_back(right);
+        }
+    }
+    sort_heap(heap.begin(), heap.end());
+    vector<size_t> result;
+    result.reserve(heap.size());
+    for (auto& item: heap) {
+        result.push_back(item.second);
+    }
+    return result;
+}
+
+/**********************************************************************
+【函数名称】 FindInBox
+【函数功能】 查找位于给定长方体内（含边界）的点。
+【参数】
+    box: 给定长方体。
+【返回值】
+    按升序排列的点的下标。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+vector<size_t> KdTree<N>::FindInBox(const Tools::Box<N>& box) const {
+    array<double, N> lower;
+    array<double, N> upper;
+    for (size_t axis = 0; axis < N; axis++) {
+        lower[axis] = min(box.Vertex1[axis], box.Vertex2[axis]);
+        upper[axis] = max(box.Vertex1[axis], box.Vertex2[axis]);
+    }
+    auto isInside = [&](const double* coordinates) {
+        for (size_t axis = 0; axis < N; axis++) {
+            if (coordinates[axis] < lower[axis] ||
+                coordinates[axis] > upper[axis]) {
+                return false;
+            }
+        }
+        return true;
+    };
+    vector<size_t> result;
+    auto visit = [&](size_t position) {
+        auto& entry = m_Tree[position];
+        if (m_States[entry.Index] == State::INDEXED &&
+            isInside(entry.Coordinates)) {
+            result.push_back(entry.Index);
+        }
+    };
+    vector<pair<size_t, size_t>> ranges;
+    if (!m_Tree.empty()) {
+        ranges.push_back({ 0, m_Tree.size() });
+    }
+    while (!ranges.empty()) {
+        size_t begin = ranges.back().first;
+        size_t end = ranges.back().second;
+        ranges.pop_back();
+        if (end - begin <= LEAF_SIZE) {
+            for (size_t k = begin; k < end; k++) {
+                visit(k);
+            }
+            continue;
+        }
+        size_t middle = begin + (end - begin) / 2;
+        visit(middle);
+        auto axis = m_Axes[middle];
+        double split = m_Tree[middle].Coordinates[axis];
+        if (lower[axis] <= split) {
+            ranges.push_back({ begin, middle });
+        }
+        if (upper[axis] >= split) {
+            ranges.push_back({ middle + 1, end });
+        }
+    }
+    for (auto index: m_Pending) {
+        if (isInside(&m_Points[index * N])) {
+            result.push_back(index);
+        }
+    }
+    sort(result.begin(), result.end());
+    return result;
+}
+
+/**********************************************************************
+【函数名称】 CheckIndex
+【函数功能】 下标不对应未删除的点时抛出 IndexOverflowException。
+【参数】
+    index: 点的下标。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void KdTree<N>::CheckIndex(size_t index) const {
+    if (!Contains(index)) {
+        throw IndexOverflowException();
+    }
+}
+
+/**********************************************************************
+【函数名称】 RebuildIfNeeded
+【函数功能】
+    待处理点数超过 MIN_PENDING_COUNT 与树中点数的 1/64 中较大者，
+    或作废的位置超过树中点数的 1/4 时重新构建。
+【参数】 无
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void KdTree<N>::RebuildIfNeeded() {
+    auto treeSize = m_Tree.size();
+    size_t pendingLimit = MIN_PENDING_COUNT;
+    if (treeSize / 64 > pendingLimit) {
+        pendingLimit = treeSize / 64;
+    }
+    if (m_Pending.size() > pendingLimit || m_StaleCount > treeSize / 4) {
+        Rebuild();
+    }
+}
+
+/**********************************************************************
+【函数名称】 GetSquaredDistance
+【函数功能】 求两组坐标之间距离的平方。
+【参数】
+    first: 第一组坐标。
+    second: 第二组坐标。
+【返回值】
+    距离的平方。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+double KdTree<N>::GetSquaredDistance(
+    const double* first,
+    const double* second
+) {
+    double result = 0;
+    for (size_t axis = 0; axis < N; axis++) {
+        double delta = first[axis] - second[axis];
+        result += delta * delta;
+    }
+    return result;
+}
+
+}
+
+}
\ No newline at end of file
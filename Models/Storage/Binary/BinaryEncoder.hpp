@@ -0,0 +1,153 @@
+/*************************************************************************
+【文件名】 BinaryEncoder.hpp
+【功能模块和目的】 BinaryEncoder 类定义了流式导出 .c3wb 文件的编码器。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include "../ModelEncoder.hpp"
+#include "../StatisticsVisitor.hpp"
+using namespace std;
+using namespace C3w;
+using namespace C3w::Storage;
+
+namespace C3w {
+
+namespace Storage {
+
+namespace Binary {
+
+/*************************************************************************
+【类名】 BinaryEncoder
+【功能】
+    将模型内容编码为 .c3wb 的顶点、线段与面数组，
+    三段分别追加到临时文件中，只占用常数大小的内存。
+    文件头中的数量与名称、外接长方体要到最后才能确定，
+    因此 Finish 时先写出 BinaryModelFile::WriteHeader，再依次拷入三段。
+    外接长方体由 StatisticsVisitor 按元素中的点统计，
+    与经由 IndexedModel 导出的结果一致。
+【接口说明】 实现 ModelEncoder 的接口。禁止复制 / 拷贝。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+template <size_t N>
+class BinaryEncoder final: public ModelEncoder<N> {
+    public:
+        // 内嵌类型
+
+        using typename ModelEncoder<N>::Kind;
+        using typename ModelEncoder<N>::Batch;
+        using typename ModelEncoder<N>::Chunk;
+
+        // 构造函数
+
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】
+            以二进制模式创建或清空指定的文件。
+            如果文件无法打开抛出 FileOpenException。
+        【参数】
+            path: 文件所在路径。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        BinaryEncoder(const string& path);
+        // 禁止拷贝
+        BinaryEncoder(const BinaryEncoder<N>&) = delete;
+
+        // 析构函数
+
+        /**********************************************************************
+        【函数名称】 析构函数
+        【函数功能】 关闭并删除临时文件。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        ~BinaryEncoder();
+
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 Encode
+        【函数功能】
+            将一批内容编码为 .c3wb 数组中的一段。
+            顶点数超过 uint32_t 的范围时抛出 IndexOverflowException。
+        【参数】
+            batch: 一批内容。
+            chunk: 被赋值为编码后的字节块，名称不产生字节。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void Encode(const Batch& batch, Chunk& chunk) override;
+        /**********************************************************************
+        【函数名称】 Write
+        【函数功能】 将字节块追加到所属段的临时文件中。
+        【参数】
+            chunk: 编码后的字节块。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void Write(const Chunk& chunk) override;
+        /**********************************************************************
+        【函数名称】 Finish
+        【函数功能】 写出文件头并拷入各段，关闭文件。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void Finish() override;
+
+        // 操作符
+
+        // 禁止赋值
+        BinaryEncoder<N>& operator=(const BinaryEncoder<N>&) = delete;
+
+    private:
+        // 段的编号
+        static const size_t VERTEX_SECTION { 0 };
+        static const size_t LINE_SECTION { 1 };
+        static const size_t FACE_SECTION { 2 };
+        // 拷贝临时文件时每次读取的字节数
+        static const size_t COPY_BLOCK_SIZE { 1 << 20 };
+
+        // 输出的文件
+        ofstream m_Stream;
+        // 各段的临时文件，尚无内容时为空，仅在写入线程中使用
+        array<FILE*, 3> m_Sections;
+        // 模型名称，仅在编码线程中使用
+        string m_Name;
+        // 顶点数，仅在编码线程中使用
+        uint64_t m_VertexCount { 0 };
+        // 元素数与外接长方体，仅在编码线程中使用
+        StatisticsVisitor<N> m_Statistics;
+
+        /**********************************************************************
+        【函数名称】 EncodeIndices
+        【函数功能】 将顶点下标编码为 uint32_t 数组。
+        【参数】
+            indices: 每个元素的顶点下标。
+            bytes: 被赋值为编码后的字节。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        template <size_t M>
+        static void EncodeIndices(
+            const vector<array<size_t, M>>& indices,
+            string& bytes
+        );
+};
+
+}
+
+}
+
+}
+
+#include "BinaryEncoder.tpp"
\ No newline at end of file
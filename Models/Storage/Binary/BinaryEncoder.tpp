@@ -0,0 +1,222 @@
+/*************************************************************************
+【文件名】 BinaryEncoder.tpp
+【功能模块和目的】 为 BinaryEncoder.hpp 提供实现。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <vector>
+#include "../../Core/Errors.hpp"
+#include "../../Tools/BufferedWriter.hpp"
+#include "BinaryEncoder.hpp"
+#include "BinaryModelFile.hpp"
+using namespace std;
+using namespace C3w;
+using namespace C3w::Errors;
+
+namespace C3w {
+
+namespace Storage {
+
+namespace Binary {
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】
+    以二进制模式创建或清空指定的文件。
+    如果文件无法打开抛出 FileOpenException。
+【参数】
+    path: 文件所在路径。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+BinaryEncoder<N>::BinaryEncoder(const string& path):
+    m_Stream(path, ios::out | ios::trunc | ios::binary) {
+    m_Sections.fill(nullptr);
+    if (!m_Stream.is_open()) {
+        throw FileOpenException();
+    }
+}
+
+/**********************************************************************
+【函数名称】 析构函数
+【函数功能】 关闭并删除临时文件。
+【参数】 无
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+BinaryEncoder<N>::~BinaryEncoder() {
+    // tmpfile 创建的文件在关闭时自动删除
+    for (auto file: m_Sections) {
+        if (file != nullptr) {
+            fclose(file);
+        }
+    }
+}
+
+/**********************************************************************
+【函数名称】 Encode
+【函数功能】
+    将一批内容编码为 .c3wb 数组中的一段。
+    顶点数超过 uint32_t 的范围时抛出 IndexOverflowException。
+【参数】
+    batch: 一批内容。
+    chunk: 被赋值为编码后的字节块，名称不产生字节。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void BinaryEncoder<N>::Encode(const Batch& batch, Chunk& chunk) {
+    chunk.Bytes.clear();
+    switch (batch.Type) {
+        case Kind::NAME:
+            m_Name = batch.Name;
+            chunk.Section = VERTEX_SECTION;
+            break;
+        case Kind::VERTICES:
+            // 与 IndexedModel 相同，下标须能以 uint32_t 存储
+            if (
+                m_VertexCount + batch.Vertices.size() >
+                numeric_limits<uint32_t>::max()
+            ) {
+                throw IndexOverflowException();
+            }
+            m_VertexCount += batch.Vertices.size();
+            chunk.Section = VERTEX_SECTION;
+            chunk.Bytes.resize(batch.Vertices.size() * N * sizeof(double));
+            for (size_t i = 0; i < batch.Vertices.size(); i++) {
+                for (size_t j = 0; j < N; j++) {
+                    double coordinate = batch.Vertices[i][j];
+                    memcpy(
+                        &chunk.Bytes[(i * N + j) * sizeof(double)],
+                        &coordinate,
+                        sizeof(coordinate)
+                    );
+                }
+            }
+            break;
+        case Kind::LINES:
+            m_Statistics.VisitLines(batch.Lines, batch.LineIndices);
+            chunk.Section = LINE_SECTION;
+            EncodeIndices(batch.LineIndices, chunk.Bytes);
+            break;
+        case Kind::FACES:
+            m_Statistics.VisitFaces(batch.Faces, batch.FaceIndices);
+            chunk.Section = FACE_SECTION;
+            EncodeIndices(batch.FaceIndices, chunk.Bytes);
+            break;
+    }
+}
+
+/**********************************************************************
+【函数名称】 Write
+【函数功能】 将字节块追加到所属段的临时文件中。
+【参数】
+    chunk: 编码后的字节块。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void BinaryEncoder<N>::Write(const Chunk& chunk) {
+    auto& file = m_Sections[chunk.Section];
+    if (file == nullptr) {
+        file = tmpfile();
+        if (file == nullptr) {
+            throw FileOpenException();
+        }
+    }
+    if (
+        fwrite(chunk.Bytes.data(), 1, chunk.Bytes.size(), file) !=
+        chunk.Bytes.size()
+    ) {
+        throw FileOpenException();
+    }
+}
+
+/**********************************************************************
+【函数名称】 Finish
+【函数功能】 写出文件头并拷入各段，关闭文件。
+【参数】 无
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void BinaryEncoder<N>::Finish() {
+    {
+        Tools::BufferedWriter writer(m_Stream);
+        BinaryModelFile<N>::WriteHeader(
+            writer,
+            m_Name,
+            m_VertexCount,
+            m_Statistics.GetLineCount(),
+            m_Statistics.GetFaceCount(),
+            m_Statistics.GetBoundingBox()
+        );
+        writer.Flush();
+    }
+    vector<char> block(COPY_BLOCK_SIZE);
+    for (auto file: m_Sections) {
+        if (file == nullptr) {
+            continue;
+        }
+        if (fflush(file) != 0) {
+            throw FileOpenException();
+        }
+        rewind(file);
+        size_t count;
+        while ((count = fread(block.data(), 1, block.size(), file)) > 0) {
+            m_Stream.write(block.data(), count);
+        }
+        if (ferror(file) != 0) {
+            throw FileOpenException();
+        }
+    }
+    m_Stream.close();
+    if (!m_Stream) {
+        throw FileOpenException();
+    }
+}
+
+/**********************************************************************
+【函数名称】 EncodeIndices
+【函数功能】 将顶点下标编码为 uint32_t 数组。
+【参数】
+    indices: 每个元素的顶点下标。
+    bytes: 被赋值为编码后的字节。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+template <size_t M>
+void BinaryEncoder<N>::EncodeIndices(
+    const vector<array<size_t, M>>& indices,
+    string& bytes
+) {
+    bytes.resize(indices.size() * M * sizeof(uint32_t));
+    for (size_t i = 0; i < indices.size(); i++) {
+        for (size_t j = 0; j < M; j++) {
+            // 顶点数已限制在 uint32_t 范围内，下标不会截断
+            auto index = static_cast<uint32_t>(indices[i][j]);
+            memcpy(
+                &bytes[(i * M + j) * sizeof(uint32_t)],
+                &index,
+                sizeof(index)
+            );
+        }
+    }
+}
+
+}
+
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,82 @@
+/*************************************************************************
+【文件名】 BinaryExporter.hpp
+【功能模块和目的】 BinaryExporter 类定义了一个 .c3wb 文件的导出器。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <fstream>
+#include <memory>
+#include <string>
+#include "../ExporterBase.hpp"
+#include "../ModelEncoder.hpp"
+#include "../../Core/Model.hpp"
+using namespace std;
+using namespace C3w;
+using namespace C3w::Storage;
+
+namespace C3w {
+
+namespace Storage {
+
+namespace Binary {
+
+/*************************************************************************
+【类名】 BinaryExporter
+【功能】 定义一个 N 维 .c3wb 文件的导出器。
+【接口说明】 导出至指定的文件，或创建流式导出的 BinaryEncoder。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+template <size_t N>
+class BinaryExporter: public ExporterBase<N> {
+    protected:
+        /**********************************************************************
+        【函数名称】 InnerExportFile
+        【函数功能】
+            以二进制模式打开文件并导出模型。
+            如果文件无法打开抛出 FileOpenException。
+        【参数】 
+            path: 文件所在路径。
+            model: 模型的常引用。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void InnerExportFile(
+            const string& path,
+            const Model<N>& model
+        ) const override;
+        /**********************************************************************
+        【函数名称】 InnerExport
+        【函数功能】 导出指定模型到文件流中。
+        【参数】 
+            stream: 以二进制模式打开的文件流。
+            model: 模型的常引用。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void InnerExport(ofstream& stream, const Model<N>& model) const override;
+        /**********************************************************************
+        【函数名称】 InnerCreateEncoder
+        【函数功能】
+            创建流式导出到指定文件的 BinaryEncoder。
+            如果文件无法打开抛出 FileOpenException。
+        【参数】
+            path: 文件所在路径。
+        【返回值】
+            编码器。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        unique_ptr<ModelEncoder<N>> InnerCreateEncoder(
+            const string& path
+        ) const override;
+};
+
+}
+
+}
+
+}
+
+#include "BinaryExporter.tpp"
\ No newline at end of file
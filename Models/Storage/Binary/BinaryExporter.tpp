@@ -0,0 +1,91 @@
+/*************************************************************************
+【文件名】 BinaryExporter.tpp
+【功能模块和目的】 为 BinaryExporter.hpp 提供实现。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#include <cstddef>
+#include <fstream>
+#include <memory>
+#include <string>
+#include "../../Core/Errors.hpp"
+#include "../../Core/IndexedModel.hpp"
+#include "../../Core/Model.hpp"
+#include "BinaryEncoder.hpp"
+#include "BinaryExporter.hpp"
+#include "BinaryModelFile.hpp"
+using namespace std;
+using namespace C3w;
+using namespace C3w::Errors;
+
+namespace C3w {
+
+namespace Storage {
+
+namespace Binary {
+
+/**********************************************************************
+【函数名称】 InnerExportFile
+【函数功能】
+    以二进制模式打开文件并导出模型。
+    如果文件无法打开抛出 FileOpenException。
+【参数】 
+    path: 文件所在路径。
+    model: 模型的常引用。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void BinaryExporter<N>::InnerExportFile(
+    const string& path,
+    const Model<N>& model
+) const {
+    ofstream stream(path, ios::out | ios::trunc | ios::binary);
+    if (!stream.is_open()) {
+        throw FileOpenException();
+    }
+    InnerExport(stream, model);
+}
+
+/**********************************************************************
+【函数名称】 InnerExport
+【函数功能】 导出指定模型到文件流中。
+【参数】 
+    stream: 以二进制模式打开的文件流。
+    model: 模型的常引用。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void BinaryExporter<N>::InnerExport(
+    ofstream& stream,
+    const Model<N>& model
+) const {
+    IndexedModel<N> indexed(model);
+    indexed.ReleaseLookup();
+    BinaryModelFile<N>::Write(stream, indexed);
+}
+
+/**********************************************************************
+【函数名称】 InnerCreateEncoder
+【函数功能】
+    创建流式导出到指定文件的 BinaryEncoder。
+    如果文件无法打开抛出 FileOpenException。
+【参数】
+    path: 文件所在路径。
+【返回值】
+    编码器。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+unique_ptr<ModelEncoder<N>> BinaryExporter<N>::InnerCreateEncoder(
+    const string& path
+) const {
+    return unique_ptr<ModelEncoder<N>>(new BinaryEncoder<N>(path));
+}
+
+}
+
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,100 @@
+/*************************************************************************
+【文件名】 BinaryImporter.hpp
+【功能模块和目的】 BinaryImporter 类定义了一个 .c3wb 文件的导入器。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <fstream>
+#include <string>
+#include "../ImporterBase.hpp"
+#include "../ModelBatcher.hpp"
+#include "../../Core/Model.hpp"
+#include "BinaryModelFile.hpp"
+using namespace std;
+using namespace C3w;
+using namespace C3w::Storage;
+
+namespace C3w {
+
+namespace Storage {
+
+namespace Binary {
+
+/*************************************************************************
+【类名】 BinaryImporter
+【功能】
+    定义一个 N 维 .c3wb 文件的导入器。
+    文件被映射到内存，顶点与下标直接从映射区域读取，无需逐个解析文本。
+    流式导入时直接从映射区域逐批送出，不在内存中复制顶点表。
+【接口说明】 导入指定的文件，或流式地读取指定的文件。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+template <size_t N>
+class BinaryImporter: public ImporterBase<N> {
+    protected:
+        /**********************************************************************
+        【函数名称】 InnerImportFile
+        【函数功能】
+            将文件映射到内存后导入到模型中。
+            如果文件无法打开抛出 FileOpenException。
+        【参数】 
+            path: 文件所在路径。
+            model: 模型的可变引用。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void InnerImportFile(
+            const string& path,
+            Model<N>& model
+        ) const override;
+        /**********************************************************************
+        【函数名称】 InnerImport
+        【函数功能】 导入指定文件流到模型中。
+        【参数】 
+            stream: 以二进制模式打开的文件流。
+            model: 模型的可变引用。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void InnerImport(ifstream& stream, Model<N>& model) const override;
+        /**********************************************************************
+        【函数名称】 InnerStreamFile
+        【函数功能】
+            将文件映射到内存后按文件顺序送出顶点、线段与面。
+            如果文件无法打开抛出 FileOpenException。
+        【参数】
+            path: 文件所在路径。
+            batcher: 将内容分批交给访问者的 ModelBatcher。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void InnerStreamFile(
+            const string& path,
+            ModelBatcher<N>& batcher
+        ) const override;
+
+    private:
+        /**********************************************************************
+        【函数名称】 AddTo
+        【函数功能】
+            将已校验的文件内容添加到模型中。
+            有重复元素时抛出 CollectionException。
+        【参数】 
+            file: 已打开的 .c3wb 文件。
+            model: 模型的可变引用。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static void AddTo(const BinaryModelFile<N>& file, Model<N>& model);
+};
+
+}
+
+}
+
+}
+
+#include "BinaryImporter.tpp"
\ No newline at end of file
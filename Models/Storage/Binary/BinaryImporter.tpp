@@ -0,0 +1,160 @@
+/*************************************************************************
+【文件名】 BinaryImporter.tpp
+【功能模块和目的】 为 BinaryImporter.hpp 提供实现。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include "../../Core/Face.hpp"
+#include "../../Core/Line.hpp"
+#include "../../Core/Model.hpp"
+#include "../../Core/Point.hpp"
+#include "BinaryImporter.hpp"
+#include "BinaryModelFile.hpp"
+#include "../ModelBatcher.hpp"
+using namespace std;
+using namespace C3w;
+
+namespace C3w {
+
+namespace Storage {
+
+namespace Binary {
+
+/**********************************************************************
+【函数名称】 InnerImportFile
+【函数功能】
+    将文件映射到内存后导入到模型中。
+    如果文件无法打开抛出 FileOpenException。
+【参数】 
+    path: 文件所在路径。
+    model: 模型的可变引用。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void BinaryImporter<N>::InnerImportFile(
+    const string& path,
+    Model<N>& model
+) const {
+    BinaryModelFile<N> file(path);
+    AddTo(file, model);
+}
+
+/**********************************************************************
+【函数名称】 InnerImport
+【函数功能】 导入指定文件流到模型中。
+【参数】 
+    stream: 以二进制模式打开的文件流。
+    model: 模型的可变引用。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void BinaryImporter<N>::InnerImport(ifstream& stream, Model<N>& model) const {
+    vector<char> buffer {
+        istreambuf_iterator<char>(stream),
+        istreambuf_iterator<char>()
+    };
+    BinaryModelFile<N> file(move(buffer));
+    AddTo(file, model);
+}
+
+/**********************************************************************
+【函数名称】 InnerStreamFile
+【函数功能】
+    将文件映射到内存后按文件顺序送出顶点、线段与面。
+    如果文件无法打开抛出 FileOpenException。
+【参数】
+    path: 文件所在路径。
+    batcher: 将内容分批交给访问者的 ModelBatcher。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void BinaryImporter<N>::InnerStreamFile(
+    const string& path,
+    ModelBatcher<N>& batcher
+) const {
+    // 映射区域由操作系统按需换入换出，不计入需要常驻的内存
+    BinaryModelFile<N> file(path);
+    batcher.AddName(file.GetName());
+    for (size_t i = 0; i < file.GetVertexCount(); i++) {
+        batcher.AddVertex(file.GetVertex(i));
+    }
+    const uint32_t* lines = file.GetLineData();
+    for (size_t i = 0; i < file.GetLineCount(); i++) {
+        array<size_t, 2> indices { { lines[i * 2], lines[i * 2 + 1] } };
+        batcher.AddLine(
+            Line<N> { file.GetVertex(indices[0]), file.GetVertex(indices[1]) },
+            indices
+        );
+    }
+    const uint32_t* faces = file.GetFaceData();
+    for (size_t i = 0; i < file.GetFaceCount(); i++) {
+        array<size_t, 3> indices {
+            { faces[i * 3], faces[i * 3 + 1], faces[i * 3 + 2] }
+        };
+        batcher.AddFace(
+            Face<N> {
+                file.GetVertex(indices[0]),
+                file.GetVertex(indices[1]),
+                file.GetVertex(indices[2])
+            },
+            indices
+        );
+    }
+}
+
+/**********************************************************************
+【函数名称】 AddTo
+【函数功能】
+    将已校验的文件内容添加到模型中。
+    有重复元素时抛出 CollectionException。
+【参数】 
+    file: 已打开的 .c3wb 文件。
+    model: 模型的可变引用。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void BinaryImporter<N>::AddTo(
+    const BinaryModelFile<N>& file,
+    Model<N>& model
+) {
+    // 顶点只构造一次，元素由下标直接取用
+    vector<Point<N>> points(file.GetVertexCount());
+    for (size_t i = 0; i < points.size(); i++) {
+        points[i] = file.GetVertex(i);
+    }
+    model.Name = file.GetName();
+    // 元素个数已知，一次性预留元素与索引的空间
+    model.Lines.Reserve(model.Lines.Count() + file.GetLineCount());
+    model.Faces.Reserve(model.Faces.Count() + file.GetFaceCount());
+    const uint32_t* lines = file.GetLineData();
+    for (size_t i = 0; i < file.GetLineCount(); i++) {
+        model.Lines.Add(
+            Line<N> { points[lines[i * 2]], points[lines[i * 2 + 1]] }
+        );
+    }
+    const uint32_t* faces = file.GetFaceData();
+    for (size_t i = 0; i < file.GetFaceCount(); i++) {
+        model.Faces.Add(Face<N> {
+            points[faces[i * 3]],
+            points[faces[i * 3 + 1]],
+            points[faces[i * 3 + 2]]
+        });
+    }
+}
+
+}
+
+}
+
+}
\ No newline at end of file
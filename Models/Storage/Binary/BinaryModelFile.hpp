@@ -0,0 +1,291 @@
+/*************************************************************************
+【文件名】 BinaryModelFile.hpp
+【功能模块和目的】 BinaryModelFile 类定义了 .c3wb 二进制模型文件的布局与读写。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "../../Core/IndexedModel.hpp"
+#include "../../Tools/Box.hpp"
+#include "../../Tools/BufferedWriter.hpp"
+#include "../../Tools/MappedFile.hpp"
+using namespace std;
+using namespace C3w;
+
+namespace C3w {
+
+namespace Storage {
+
+namespace Binary {
+
+/*************************************************************************
+【类名】 BinaryModelFile
+【功能】
+    定义 N 维 .c3wb 二进制模型文件的布局，并提供零拷贝的只读视图。
+    文件依次为：48 字节的文件头、名称（补齐到 8 字节）、
+    外接长方体的 2N 个 double、紧密排列的 N 维顶点坐标、
+    每条线段 2 个 uint32_t 下标、每个面 3 个 uint32_t 下标。
+    各段均按自身类型对齐，映射到内存后可直接作为数组使用。
+    数值以写入方的字节序存储，字节序不同的文件会被拒绝。
+【接口说明】
+    打开映射文件或内存缓冲区，获取名称、数量、外接长方体与各数组，
+    转化为 IndexedModel；将 IndexedModel 写入流；
+    单独写出顶点数组之前的部分，供分段写入的 BinaryEncoder 使用。
+    禁止复制 / 拷贝。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+template <size_t N>
+class BinaryModelFile final {
+    public:
+        // 构造函数
+
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】
+            映射并校验指定的文件。
+            文件无法打开时抛出 FileOpenException，
+            布局无效时抛出 FileFormatException，
+            下标超出顶点数时抛出 IndexOverflowException。
+        【参数】
+            path: 文件所在路径。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        BinaryModelFile(const string& path);
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】
+            接管并校验内存中的文件内容。
+            布局无效时抛出 FileFormatException，
+            下标超出顶点数时抛出 IndexOverflowException。
+        【参数】
+            buffer: 文件的全部内容。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        BinaryModelFile(vector<char> buffer);
+        // 禁止拷贝
+        BinaryModelFile(const BinaryModelFile<N>&) = delete;
+
+        // 属性
+
+        /**********************************************************************
+        【函数名称】 GetName
+        【函数功能】 获取模型的名称。
+        【参数】 无
+        【返回值】
+            模型的名称。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        string GetName() const;
+        /**********************************************************************
+        【函数名称】 GetVertexCount
+        【函数功能】 获取顶点数。
+        【参数】 无
+        【返回值】
+            顶点数。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        size_t GetVertexCount() const;
+        /**********************************************************************
+        【函数名称】 GetLineCount
+        【函数功能】 获取线段数。
+        【参数】 无
+        【返回值】
+            线段数。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        size_t GetLineCount() const;
+        /**********************************************************************
+        【函数名称】 GetFaceCount
+        【函数功能】 获取面数。
+        【参数】 无
+        【返回值】
+            面数。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        size_t GetFaceCount() const;
+        /**********************************************************************
+        【函数名称】 GetBoundingBox
+        【函数功能】 获取文件中记录的外接长方体。
+        【参数】 无
+        【返回值】
+            外接长方体。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Tools::Box<N> GetBoundingBox() const;
+        /**********************************************************************
+        【函数名称】 GetVertexData
+        【函数功能】 获取顶点坐标数组，第 i 个顶点位于 [i * N, i * N + N)。
+        【参数】 无
+        【返回值】
+            指向映射区域的顶点坐标数组，与此对象同生命周期。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        const double* GetVertexData() const;
+        /**********************************************************************
+        【函数名称】 GetLineData
+        【函数功能】 获取线段下标数组，每条线段 2 个从 0 开始的下标。
+        【参数】 无
+        【返回值】
+            指向映射区域的下标数组，与此对象同生命周期。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        const uint32_t* GetLineData() const;
+        /**********************************************************************
+        【函数名称】 GetFaceData
+        【函数功能】 获取面下标数组，每个面 3 个从 0 开始的下标。
+        【参数】 无
+        【返回值】
+            指向映射区域的下标数组，与此对象同生命周期。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        const uint32_t* GetFaceData() const;
+        /**********************************************************************
+        【函数名称】 GetVertex
+        【函数功能】 获取指定下标处的顶点。
+        【参数】
+            index: 顶点下标，须小于顶点数。
+        【返回值】
+            顶点。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Point<N> GetVertex(size_t index) const;
+
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 ToIndexedModel
+        【函数功能】 将文件内容整体复制为 IndexedModel，不逐个解析元素。
+        【参数】 无
+        【返回值】
+            对应的 IndexedModel。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        IndexedModel<N> ToIndexedModel() const;
+        /**********************************************************************
+        【函数名称】 Write
+        【函数功能】 将 IndexedModel 以 .c3wb 格式写入二进制流。
+        【参数】
+            stream: 以二进制模式打开的输出流。
+            model: 要写入的模型。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static void Write(ostream& stream, const IndexedModel<N>& model);
+        /**********************************************************************
+        【函数名称】 WriteHeader
+        【函数功能】
+            写出文件头、补齐后的名称与外接长方体，即顶点数组之前的全部内容。
+            之后依次写出各数组即得到完整的文件。
+        【参数】
+            writer: 写入二进制流的格式化器。
+            name: 模型的名称。
+            vertexCount: 顶点数。
+            lineCount: 线段数。
+            faceCount: 面数。
+            box: 外接长方体。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static void WriteHeader(
+            Tools::BufferedWriter& writer,
+            const string& name,
+            uint64_t vertexCount,
+            uint64_t lineCount,
+            uint64_t faceCount,
+            const Tools::Box<N>& box
+        );
+
+        // 操作符
+
+        // 禁止赋值
+        BinaryModelFile<N>& operator=(const BinaryModelFile<N>&) = delete;
+
+    private:
+        /**********************************************************************
+        【类名】 Header
+        【功能】 .c3wb 文件头。
+        【接口说明】 简单数据类型，无函数。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        struct Header {
+            // 魔数 "C3WB"
+            char Magic[4];
+            // 字节序标记，以写入方的字节序存储 BYTE_ORDER_MARK
+            uint32_t ByteOrderMark;
+            // 格式版本
+            uint32_t Version;
+            // 维数
+            uint32_t Dimension;
+            // 顶点数
+            uint64_t VertexCount;
+            // 线段数
+            uint64_t LineCount;
+            // 面数
+            uint64_t FaceCount;
+            // 名称的字节数
+            uint64_t NameLength;
+        };
+
+        // 字节序标记
+        static const uint32_t BYTE_ORDER_MARK { 0x01020304 };
+        // 格式版本
+        static const uint32_t VERSION { 1 };
+
+        // 映射的文件，从内存缓冲区构造时为空
+        unique_ptr<Tools::MappedFile> m_File;
+        // 内存缓冲区，从映射文件构造时为空
+        vector<char> m_Buffer;
+        // 文件头
+        const Header* m_Header { nullptr };
+        // 名称的首地址
+        const char* m_Name { nullptr };
+        // 外接长方体的坐标
+        const double* m_BoundingBox { nullptr };
+        // 顶点坐标
+        const double* m_Vertices { nullptr };
+        // 线段下标
+        const uint32_t* m_Lines { nullptr };
+        // 面下标
+        const uint32_t* m_Faces { nullptr };
+
+        /**********************************************************************
+        【函数名称】 Load
+        【函数功能】
+            校验文件内容并定位各段。
+            布局无效时抛出 FileFormatException，
+            下标超出顶点数时抛出 IndexOverflowException。
+        【参数】
+            data: 文件内容的首地址，须按 8 字节对齐。
+            size: 文件的字节数。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void Load(const char* data, size_t size);
+        /**********************************************************************
+        【函数名称】 GetPaddedLength
+        【函数功能】 将字节数向上补齐到 8 的倍数。
+        【参数】
+            length: 原字节数。
+        【返回值】
+            补齐后的字节数。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static uint64_t GetPaddedLength(uint64_t length);
+};
+
+}
+
+}
+
+}
+
+#include "BinaryModelFile.tpp"
\ No newline at end of file
@@ -0,0 +1,426 @@
+/*************************************************************************
+【文件名】 BinaryModelFile.tpp
+【功能模块和目的】 为 BinaryModelFile.hpp 提供实现。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "../../Core/Errors.hpp"
+#include "../../Core/IndexedModel.hpp"
+#include "../../Core/Point.hpp"
+#include "../../Tools/Box.hpp"
+#include "../../Tools/BufferedWriter.hpp"
+#include "../../Tools/MappedFile.hpp"
+#include "BinaryModelFile.hpp"
+using namespace std;
+using namespace C3w;
+using namespace C3w::Errors;
+
+namespace C3w {
+
+namespace Storage {
+
+namespace Binary {
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】
+    映射并校验指定的文件。
+    文件无法打开时抛出 FileOpenException，
+    布局无效时抛出 FileFormatException，
+    下标超出顶点数时抛出 IndexOverflowException。
+【参数】
+    path: 文件所在路径。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+BinaryModelFile<N>::BinaryModelFile(const string& path)
+    : m_File(new Tools::MappedFile(path)) {
+    Load(m_File->GetData(), m_File->GetSize());
+}
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】
+    接管并校验内存中的文件内容。
+    布局无效时抛出 FileFormatException，
+    下标超出顶点数时抛出 IndexOverflowException。
+【参数】
+    buffer: 文件的全部内容。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+BinaryModelFile<N>::BinaryModelFile(vector<char> buffer)
+    : m_Buffer(move(buffer)) {
+    // vector 的存储由 operator new 分配，满足 double 的对齐要求
+    Load(m_Buffer.data(), m_Buffer.size());
+}
+
+/**********************************************************************
+【函数名称】 GetName
+【函数功能】 获取模型的名称。
+【参数】 无
+【返回值】
+    模型的名称。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+string BinaryModelFile<N>::GetName() const {
+    return string(m_Name, m_Header->NameLength);
+}
+
+/**********************************************************************
+【函数名称】 GetVertexCount
+【函数功能】 获取顶点数。
+【参数】 无
+【返回值】
+    顶点数。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+size_t BinaryModelFile<N>::GetVertexCount() const {
+    return m_Header->VertexCount;
+}
+
+/**********************************************************************
+【函数名称】 GetLineCount
+【函数功能】 获取线段数。
+【参数】 无
+【返回值】
+    线段数。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+size_t BinaryModelFile<N>::GetLineCount() const {
+    return m_Header->LineCount;
+}
+
+/**********************************************************************
+【函数名称】 GetFaceCount
+【函数功能】 获取面数。
+【参数】 无
+【返回值】
+    面数。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+size_t BinaryModelFile<N>::GetFaceCount() const {
+    return m_Header->FaceCount;
+}
+
+/**********************************************************************
+【函数名称】 GetBoundingBox
+【函数功能】 获取文件中记录的外接长方体。
+【参数】 无
+【返回值】
+    外接长方体。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+Tools::Box<N> BinaryModelFile<N>::GetBoundingBox() const {
+    Point<N> vertex1;
+    Point<N> vertex2;
+    for (size_t i = 0; i < N; i++) {
+        vertex1[i] = m_BoundingBox[i];
+        vertex2[i] = m_BoundingBox[N + i];
+    }
+    return Tools::Box<N>(vertex1, vertex2);
+}
+
+/**********************************************************************
+【函数名称】 GetVertexData
+【函数功能】 获取顶点坐标数组，第 i 个顶点位于 [i * N, i * N + N)。
+【参数】 无
+【返回值】
+    指向映射区域的顶点坐标数组，与此对象同生命周期。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+const double* BinaryModelFile<N>::GetVertexData() const {
+    return m_Vertices;
+}
+
+/**********************************************************************
+【函数名称】 GetLineData
+【函数功能】 获取线段下标数组，每条线段 2 个从 0 开始的下标。
+【参数】 无
+【返回值】
+    指向映射区域的下标数组，与此对象同生命周期。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+const uint32_t* BinaryModelFile<N>::GetLineData() const {
+    return m_Lines;
+}
+
+/**********************************************************************
+【函数名称】 GetFaceData
+【函数功能】 获取面下标数组，每个面 3 个从 0 开始的下标。
+【参数】 无
+【返回值】
+    指向映射区域的下标数组，与此对象同生命周期。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+const uint32_t* BinaryModelFile<N>::GetFaceData() const {
+    return m_Faces;
+}
+
+/**********************************************************************
+【函数名称】 GetVertex
+【函数功能】 获取指定下标处的顶点。
+【参数】
+    index: 顶点下标，须小于顶点数。
+【返回值】
+    顶点。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+Point<N> BinaryModelFile<N>::GetVertex(size_t index) const {
+    Point<N> point;
+    const double* coordinates = m_Vertices + index * N;
+    for (size_t i = 0; i < N; i++) {
+        point[i] = coordinates[i];
+    }
+    return point;
+}
+
+/**********************************************************************
+【函数名称】 ToIndexedModel
+【函数功能】 将文件内容整体复制为 IndexedModel，不逐个解析元素。
+【参数】 无
+【返回值】
+    对应的 IndexedModel。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+IndexedModel<N> BinaryModelFile<N>::ToIndexedModel() const {
+    typedef typename IndexedModel<N>::LineIndices LineIndices;
+    typedef typename IndexedModel<N>::FaceIndices FaceIndices;
+    static_assert(
+        sizeof(LineIndices) == 2 * sizeof(uint32_t) &&
+        sizeof(FaceIndices) == 3 * sizeof(uint32_t),
+        "index arrays must be tightly packed."
+    );
+    vector<Point<N>> vertices(GetVertexCount());
+    for (size_t i = 0; i < vertices.size(); i++) {
+        vertices[i] = GetVertex(i);
+    }
+    vector<LineIndices> lines(GetLineCount());
+    if (!lines.empty()) {
+        memcpy(lines.data(), m_Lines, lines.size() * sizeof(LineIndices));
+    }
+    vector<FaceIndices> faces(GetFaceCount());
+    if (!faces.empty()) {
+        memcpy(faces.data(), m_Faces, faces.size() * sizeof(FaceIndices));
+    }
+    return IndexedModel<N>(
+        GetName(),
+        move(vertices),
+        move(lines),
+        move(faces)
+    );
+}
+
+/**********************************************************************
+【函数名称】 Write
+【函数功能】 将 IndexedModel 以 .c3wb 格式写入二进制流。
+【参数】
+    stream: 以二进制模式打开的输出流。
+    model: 要写入的模型。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void BinaryModelFile<N>::Write(ostream& stream, const IndexedModel<N>& model) {
+    Tools::BufferedWriter writer(stream);
+    WriteHeader(
+        writer,
+        model.Name,
+        model.GetVertices().size(),
+        model.GetLineIndices().size(),
+        model.GetFaceIndices().size(),
+        model.GetBoundingBox()
+    );
+    for (auto& point: model.GetVertices()) {
+        for (size_t i = 0; i < N; i++) {
+            double coordinate = point[i];
+            writer.Write(
+                reinterpret_cast<const char*>(&coordinate),
+                sizeof(coordinate)
+            );
+        }
+    }
+    // 下标数组与文件中的布局相同，整块写出
+    auto& lines = model.GetLineIndices();
+    writer.Write(
+        reinterpret_cast<const char*>(lines.data()),
+        lines.size() * sizeof(lines[0])
+    );
+    auto& faces = model.GetFaceIndices();
+    writer.Write(
+        reinterpret_cast<const char*>(faces.data()),
+        faces.size() * sizeof(faces[0])
+    );
+    writer.Flush();
+}
+
+/**********************************************************************
+【函数名称】 WriteHeader
+【函数功能】
+    写出文件头、补齐后的名称与外接长方体，即顶点数组之前的全部内容。
+    之后依次写出各数组即得到完整的文件。
+【参数】
+    writer: 写入二进制流的格式化器。
+    name: 模型的名称。
+    vertexCount: 顶点数。
+    lineCount: 线段数。
+    faceCount: 面数。
+    box: 外接长方体。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void BinaryModelFile<N>::WriteHeader(
+    Tools::BufferedWriter& writer,
+    const string& name,
+    uint64_t vertexCount,
+    uint64_t lineCount,
+    uint64_t faceCount,
+    const Tools::Box<N>& box
+) {
+    Header header;
+    memcpy(header.Magic, "C3WB", sizeof(header.Magic));
+    header.ByteOrderMark = BYTE_ORDER_MARK;
+    header.Version = VERSION;
+    header.Dimension = static_cast<uint32_t>(N);
+    header.VertexCount = vertexCount;
+    header.LineCount = lineCount;
+    header.FaceCount = faceCount;
+    header.NameLength = name.size();
+
+    writer.Write(reinterpret_cast<const char*>(&header), sizeof(header));
+    writer.Write(name);
+    static const char PADDING[8] {};
+    writer.Write(PADDING, GetPaddedLength(header.NameLength) - header.NameLength);
+
+    for (auto vertex: { box.Vertex1, box.Vertex2 }) {
+        for (size_t i = 0; i < N; i++) {
+            double coordinate = vertex[i];
+            writer.Write(
+                reinterpret_cast<const char*>(&coordinate),
+                sizeof(coordinate)
+            );
+        }
+    }
+}
+
+/**********************************************************************
+【函数名称】 Load
+【函数功能】
+    校验文件内容并定位各段。
+    布局无效时抛出 FileFormatException，
+    下标超出顶点数时抛出 IndexOverflowException。
+【参数】
+    data: 文件内容的首地址，须按 8 字节对齐。
+    size: 文件的字节数。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void BinaryModelFile<N>::Load(const char* data, size_t size) {
+    static_assert(N > 0, "dimension must be positive.");
+    static_assert(sizeof(Header) == 48, "header must be 48 bytes.");
+    if (size < sizeof(Header)) {
+        throw FileFormatException();
+    }
+    m_Header = reinterpret_cast<const Header*>(data);
+    if (
+        memcmp(m_Header->Magic, "C3WB", sizeof(m_Header->Magic)) != 0 ||
+        m_Header->ByteOrderMark != BYTE_ORDER_MARK ||
+        m_Header->Version != VERSION ||
+        m_Header->Dimension != N ||
+        m_Header->VertexCount > numeric_limits<uint32_t>::max()
+    ) {
+        throw FileFormatException();
+    }
+
+    // 每段先与剩余字节数比较再相乘，伪造的数量不会导致溢出
+    uint64_t remaining = size - sizeof(Header);
+    const char* cursor = data + sizeof(Header);
+    if (m_Header->NameLength > remaining) {
+        throw FileFormatException();
+    }
+    uint64_t nameLength = GetPaddedLength(m_Header->NameLength);
+    if (nameLength > remaining) {
+        throw FileFormatException();
+    }
+    m_Name = cursor;
+    cursor += nameLength;
+    remaining -= nameLength;
+
+    const uint64_t segments[4][2] {
+        { 2, N * sizeof(double) },
+        { m_Header->VertexCount, N * sizeof(double) },
+        { m_Header->LineCount, 2 * sizeof(uint32_t) },
+        { m_Header->FaceCount, 3 * sizeof(uint32_t) }
+    };
+    const char* starts[4];
+    for (size_t i = 0; i < 4; i++) {
+        if (segments[i][0] > remaining / segments[i][1]) {
+            throw FileFormatException();
+        }
+        starts[i] = cursor;
+        cursor += segments[i][0] * segments[i][1];
+        remaining -= segments[i][0] * segments[i][1];
+    }
+    if (remaining != 0) {
+        throw FileFormatException();
+    }
+    m_BoundingBox = reinterpret_cast<const double*>(starts[0]);
+    m_Vertices = reinterpret_cast<const double*>(starts[1]);
+    m_Lines = reinterpret_cast<const uint32_t*>(starts[2]);
+    m_Faces = reinterpret_cast<const uint32_t*>(starts[3]);
+
+    uint64_t vertexCount = m_Header->VertexCount;
+    for (uint64_t i = 0; i < m_Header->LineCount * 2; i++) {
+        if (m_Lines[i] >= vertexCount) {
+            throw IndexOverflowException();
+        }
+    }
+    for (uint64_t i = 0; i < m_Header->FaceCount * 3; i++) {
+        if (m_Faces[i] >= vertexCount) {
+            throw IndexOverflowException();
+        }
+    }
+}
+
+/**********************************************************************
+【函数名称】 GetPaddedLength
+【函数功能】 将字节数向上补齐到 8 的倍数。
+【参数】
+    length: 原字节数。
+【返回值】
+    补齐后的字节数。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+uint64_t BinaryModelFile<N>::GetPaddedLength(uint64_t length) {
+    return (length + 7) / 8 * 8;
+}
+
+}
+
+}
+
+}
\ No newline at end of file
@@ -8,8 +8,10 @@
 
 #include <cstddef>
 #include <fstream>
+#include <memory>
 #include <string>
 #include "../Core/Model.hpp"
+#include "ModelEncoder.hpp"
 using namespace std;
 using namespace C3w;
 
@@ -20,7 +22,8 @@ namespace Storage {
 /*************************************************************************
 【类名】 ExporterBase
 【功能】 定义一个抽象的导出器。
-【接口说明】 导出至指定的文件。
+【接口说明】
+    导出至指定的文件；或创建编码器，在不构造 Model 的情况下流式导出。
 【开发者及日期】 赵一彤 2024/7/24
 *************************************************************************/
 template <size_t N>
@@ -37,12 +40,40 @@ class ExporterBase {
         【返回值】 无
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        void Export(string path, const Model<N>& model) const;
+        void Export(const string& path, const Model<N>& model) const;
+        /**********************************************************************
+        【函数名称】 CreateEncoder
+        【函数功能】
+            创建流式导出到指定文件的编码器，文件随即被创建或清空。
+            如果文件无法打开抛出 FileOpenException。
+        【参数】
+            path: 文件所在路径。
+        【返回值】
+            编码器，只能使用一次。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        unique_ptr<ModelEncoder<N>> CreateEncoder(const string& path) const;
 
         // 虚析构函数
         virtual ~ExporterBase() = default;
 
     protected:
+        /**********************************************************************
+        【函数名称】 InnerExportFile
+        【函数功能】
+            导出指定模型到文件中。默认以文本模式打开文件流并调用 InnerExport，
+            子类可以重写以使用其他方式写入文件。
+            如果文件无法打开抛出 FileOpenException。
+        【参数】 
+            path: 文件所在路径。
+            model: 模型的常引用。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        virtual void InnerExportFile(
+            const string& path,
+            const Model<N>& model
+        ) const;
         /**********************************************************************
         【函数名称】 InnerExport
         【函数功能】 导出指定模型到文件流中。
@@ -56,6 +87,102 @@ class ExporterBase {
             ofstream& stream,
             const Model<N>& model
         ) const = 0;
+        /**********************************************************************
+        【函数名称】 InnerCreateEncoder
+        【函数功能】
+            创建流式导出到指定文件的编码器。
+            默认的编码器把内容收集为 Model，结束时调用 Export，
+            占用的内存与模型大小成正比；子类应重写以直接编码。
+            如果文件无法打开抛出 FileOpenException。
+        【参数】
+            path: 文件所在路径。
+        【返回值】
+            编码器。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        virtual unique_ptr<ModelEncoder<N>> InnerCreateEncoder(
+            const string& path
+        ) const;
+
+    private:
+        /**********************************************************************
+        【类名】 ModelCollector
+        【功能】 默认的编码器，把内容收集为 Model，结束时由导出器一次导出。
+        【接口说明】 实现 ModelEncoder 的接口。禁止复制 / 拷贝。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        class ModelCollector final: public ModelEncoder<N> {
+            public:
+                // 构造函数
+
+                /**************************************************************
+                【函数名称】 构造函数
+                【函数功能】
+                    使用导出器与文件路径初始化 ModelCollector 类型实例，
+                    并清空目标文件。文件无法打开时抛出 FileOpenException。
+                【参数】
+                    exporter: 最终导出模型的导出器，须比此对象存活更久。
+                    path: 文件所在路径。
+                【返回值】 无
+                【开发者及日期】 赵一彤 2026/10/17
+                **************************************************************/
+                ModelCollector(
+                    const ExporterBase<N>& exporter,
+                    const string& path
+                );
+                // 禁止拷贝
+                ModelCollector(const ModelCollector&) = delete;
+
+                // 操作
+
+                /**************************************************************
+                【函数名称】 Encode
+                【函数功能】
+                    将一批内容加入模型，不产生字节。
+                    元素重复时抛出 CollectionException。
+                【参数】
+                    batch: 一批内容。
+                    chunk: 被赋值为空的字节块。
+                【返回值】 无
+                【开发者及日期】 赵一彤 2026/10/17
+                **************************************************************/
+                void Encode(
+                    const typename ModelEncoder<N>::Batch& batch,
+                    typename ModelEncoder<N>::Chunk& chunk
+                ) override;
+                /**************************************************************
+                【函数名称】 Write
+                【函数功能】 不做任何事。
+                【参数】
+                    chunk: 编码后的字节块。
+                【返回值】 无
+                【开发者及日期】 赵一彤 2026/10/17
+                **************************************************************/
+                void Write(
+                    const typename ModelEncoder<N>::Chunk& chunk
+                ) override;
+                /**************************************************************
+                【函数名称】 Finish
+                【函数功能】 导出收集到的模型。
+                【参数】 无
+                【返回值】 无
+                【开发者及日期】 赵一彤 2026/10/17
+                **************************************************************/
+                void Finish() override;
+
+                // 操作符
+
+                // 禁止赋值
+                ModelCollector& operator=(const ModelCollector&) = delete;
+
+            private:
+                // 最终导出模型的导出器
+                const ExporterBase<N>& m_Exporter;
+                // 文件所在路径
+                string m_Path;
+                // 收集到的模型
+                Model<N> m_Model;
+        };
 };
 
 }
@@ -6,9 +6,12 @@
 
 #include <cstddef>
 #include <fstream>
+#include <memory>
 #include <string>
+#include "../Core/Errors.hpp"
 #include "../Core/Model.hpp"
 #include "ExporterBase.hpp"
+#include "ModelEncoder.hpp"
 using namespace std;
 using namespace C3w;
 using namespace C3w::Errors;
@@ -27,7 +30,48 @@ namespace Storage {
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <size_t N>
-void ExporterBase<N>::Export(string path, const Model<N>& model) const {
+void ExporterBase<N>::Export(
+    const string& path,
+    const Model<N>& model
+) const {
+    InnerExportFile(path, model);
+}
+
+/**********************************************************************
+【函数名称】 CreateEncoder
+【函数功能】
+    创建流式导出到指定文件的编码器，文件随即被创建或清空。
+    如果文件无法打开抛出 FileOpenException。
+【参数】
+    path: 文件所在路径。
+【返回值】
+    编码器，只能使用一次。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+unique_ptr<ModelEncoder<N>> ExporterBase<N>::CreateEncoder(
+    const string& path
+) const {
+    return InnerCreateEncoder(path);
+}
+
+/**********************************************************************
+【函数名称】 InnerExportFile
+【函数功能】
+    导出指定模型到文件中。默认以文本模式打开文件流并调用 InnerExport，
+    子类可以重写以使用其他方式写入文件。
+    如果文件无法打开抛出 FileOpenException。
+【参数】 
+    path: 文件所在路径。
+    model: 模型的常引用。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void ExporterBase<N>::InnerExportFile(
+    const string& path,
+    const Model<N>& model
+) const {
     ofstream stream(path, ios::trunc);
     if (!stream.is_open()) {
         throw FileOpenException();
@@ -41,6 +85,113 @@ void ExporterBase<N>::Export(string path, const Model<N>& model) const {
     }
 }
 
+/**********************************************************************
+【函数名称】 InnerCreateEncoder
+【函数功能】
+    创建流式导出到指定文件的编码器。
+    默认的编码器把内容收集为 Model，结束时调用 Export，
+    占用的内存与模型大小成正比；子类应重写以直接编码。
+    如果文件无法打开抛出 FileOpenException。
+【参数】
+    path: 文件所在路径。
+【返回值】
+    编码器。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+unique_ptr<ModelEncoder<N>> ExporterBase<N>::InnerCreateEncoder(
+    const string& path
+) const {
+    return unique_ptr<ModelEncoder<N>>(new ModelCollector(*this, path));
+}
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】
+    使用导出器与文件路径初始化 ModelCollector 类型实例，
+    并清空目标文件。文件无法打开时抛出 FileOpenException。
+【参数】
+    exporter: 最终导出模型的导出器，须比此对象存活更久。
+    path: 文件所在路径。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+ExporterBase<N>::ModelCollector::ModelCollector(
+    const ExporterBase<N>& exporter,
+    const string& path
+): m_Exporter(exporter), m_Path(path) {
+    // 与直接编码的编码器一致，尽早发现无法写入的路径
+    ofstream stream(path, ios::trunc);
+    if (!stream.is_open()) {
+        throw FileOpenException();
+    }
+}
+
+/**********************************************************************
+【函数名称】 Encode
+【函数功能】
+    将一批内容加入模型，不产生字节。
+    元素重复时抛出 CollectionException。
+【参数】
+    batch: 一批内容。
+    chunk: 被赋值为空的字节块。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void ExporterBase<N>::ModelCollector::Encode(
+    const typename ModelEncoder<N>::Batch& batch,
+    typename ModelEncoder<N>::Chunk& chunk
+) {
+    using Kind = typename ModelEncoder<N>::Kind;
+    chunk.Section = 0;
+    chunk.Bytes.clear();
+    switch (batch.Type) {
+        case Kind::NAME:
+            m_Model.Name = batch.Name;
+            break;
+        case Kind::LINES:
+            for (auto& line: batch.Lines) {
+                m_Model.Lines.Add(line);
+            }
+            break;
+        case Kind::FACES:
+            for (auto& face: batch.Faces) {
+                m_Model.Faces.Add(face);
+            }
+            break;
+        default:
+            // 顶点已包含在元素中
+            break;
+    }
+}
+
+/**********************************************************************
+【函数名称】 Write
+【函数功能】 不做任何事。
+【参数】
+    chunk: 编码后的字节块。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void ExporterBase<N>::ModelCollector::Write(
+    const typename ModelEncoder<N>::Chunk& /* chunk */
+) {}
+
+/**********************************************************************
+【函数名称】 Finish
+【函数功能】 导出收集到的模型。
+【参数】 无
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void ExporterBase<N>::ModelCollector::Finish() {
+    m_Exporter.Export(m_Path, m_Model);
+}
+
 }
 
 }
\ No newline at end of file
@@ -10,6 +10,8 @@
 #include <fstream>
 #include <string>
 #include "../Core/Model.hpp"
+#include "ModelBatcher.hpp"
+#include "ModelVisitor.hpp"
 using namespace std;
 using namespace C3w;
 
@@ -20,7 +22,9 @@ namespace Storage {
 /*************************************************************************
 【类名】 ImporterBase
 【功能】 定义一个抽象的导入器。
-【接口说明】 导入指定的文件。
+【接口说明】
+    导入指定的文件，可选在导入后焊接相近的点；
+    或以固定大小的批次将文件内容流式地交给访问者。
 【开发者及日期】 赵一彤 2024/7/24
 *************************************************************************/
 template <size_t N>
@@ -38,12 +42,77 @@ class ImporterBase {
         【返回值】 无
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
-        void Import(string path, Model<N>& model) const;
+        void Import(const string& path, Model<N>& model) const;
+        /**********************************************************************
+        【函数名称】 SetWeldTolerance
+        【函数功能】
+            设置导入后焊接点的距离，见 Model::Weld。
+            不为正数时不焊接，默认为 0。
+        【参数】
+            epsilon: 焊接的距离。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void SetWeldTolerance(double epsilon);
+        /**********************************************************************
+        【函数名称】 GetWeldTolerance
+        【函数功能】 获取导入后焊接点的距离。
+        【参数】 无
+        【返回值】
+            焊接的距离，不为正数时不焊接。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        double GetWeldTolerance() const;
+        /**********************************************************************
+        【函数名称】 Stream
+        【函数功能】
+            将指定文件的内容按批交给访问者，不构造 Model，
+            支持流式读取的子类占用的内存与文件大小无关。
+            不焊接，也不检查重复元素，元素按文件中的顺序送达。
+            异常与 Import 相同，出错时访问者已收到出错位置之前的部分内容。
+        【参数】
+            path: 文件所在路径。
+            visitor: 接收内容的访问者。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void Stream(const string& path, ModelVisitor<N>& visitor) const;
+        /**********************************************************************
+        【函数名称】 SetBatchSize
+        【函数功能】 设置 Stream 每批的最大元素个数，为 0 时视为 1。
+        【参数】
+            count: 每批的最大元素个数。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void SetBatchSize(size_t count);
+        /**********************************************************************
+        【函数名称】 GetBatchSize
+        【函数功能】 获取 Stream 每批的最大元素个数。
+        【参数】 无
+        【返回值】
+            每批的最大元素个数。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        size_t GetBatchSize() const;
 
         // 虚析构函数
         virtual ~ImporterBase() = default;
 
     protected:
+        /**********************************************************************
+        【函数名称】 InnerImportFile
+        【函数功能】
+            导入指定文件到模型中。默认以文件流打开文件并调用 InnerImport，
+            子类可以重写以使用其他方式读取文件。
+            如果文件无法打开抛出 FileOpenException。
+        【参数】 
+            path: 文件所在路径。
+            model: 模型的可变引用。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        virtual void InnerImportFile(const string& path, Model<N>& model) const;
         /**********************************************************************
         【函数名称】 InnerImport
         【函数功能】 导入指定文件流到模型中。
@@ -54,6 +123,32 @@ class ImporterBase {
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
         virtual void InnerImport(ifstream& stream, Model<N>& model) const = 0;
+        /**********************************************************************
+        【函数名称】 InnerStreamFile
+        【函数功能】
+            将指定文件的内容逐个添加到 batcher 中。
+            默认先用 InnerImportFile 导入完整的模型再逐个送出，
+            每条线段与每个面的点各自作为新的顶点，内存不受限；
+            子类可以重写以边读边送出。
+        【参数】
+            path: 文件所在路径。
+            batcher: 将内容分批交给访问者的 ModelBatcher。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        virtual void InnerStreamFile(
+            const string& path,
+            ModelBatcher<N>& batcher
+        ) const;
+
+    private:
+        // Stream 默认每批的最大元素个数
+        static const size_t DEFAULT_BATCH_SIZE { 4096 };
+
+        // 导入后焊接点的距离，不为正数时不焊接
+        double m_WeldTolerance { 0 };
+        // Stream 每批的最大元素个数
+        size_t m_BatchSize { DEFAULT_BATCH_SIZE };
 };
 
 }
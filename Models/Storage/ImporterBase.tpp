@@ -4,12 +4,15 @@
 【开发者及日期】 赵一彤 2024/7/24
 *************************************************************************/
 
+#include <array>
 #include <cstddef>
 #include <fstream>
 #include <string>
 #include "../Core/Errors.hpp"
 #include "../Core/Model.hpp"
 #include "ImporterBase.hpp"
+#include "ModelBatcher.hpp"
+#include "ModelVisitor.hpp"
 using namespace std;
 using namespace C3w;
 using namespace C3w::Errors;
@@ -20,7 +23,7 @@ namespace Storage {
 
 /**********************************************************************
 【函数名称】 Import
-【函数功能】 导入指定文件到模型中。
+【函数功能】 导入指定文件到模型中。设置了焊接距离时随后焊接模型。
 【参数】 
     path: 文件所在路径。
     model: 模型的可变引用。
@@ -28,7 +31,107 @@ namespace Storage {
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <size_t N>
-void ImporterBase<N>::Import(string path, Model<N>& model) const {
+void ImporterBase<N>::Import(const string& path, Model<N>& model) const {
+    InnerImportFile(path, model);
+    if (m_WeldTolerance > 0) {
+        model.Weld(m_WeldTolerance);
+    }
+}
+
+/**********************************************************************
+【函数名称】 SetWeldTolerance
+【函数功能】
+    设置导入后焊接点的距离，见 Model::Weld。
+    不为正数时不焊接，默认为 0。
+【参数】
+    epsilon: 焊接的距离。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void ImporterBase<N>::SetWeldTolerance(double epsilon) {
+    m_WeldTolerance = epsilon;
+}
+
+/**********************************************************************
+【函数名称】 GetWeldTolerance
+【函数功能】 获取导入后焊接点的距离。
+【参数】 无
+【返回值】
+    焊接的距离，不为正数时不焊接。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+double ImporterBase<N>::GetWeldTolerance() const {
+    return m_WeldTolerance;
+}
+
+/**********************************************************************
+【函数名称】 Stream
+【函数功能】
+    将指定文件的内容按批交给访问者，不构造 Model，
+    支持流式读取的子类占用的内存与文件大小无关。
+    不焊接，也不检查重复元素，元素按文件中的顺序送达。
+    异常与 Import 相同，出错时访问者已收到出错位置之前的部分内容。
+【参数】
+    path: 文件所在路径。
+    visitor: 接收内容的访问者。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void ImporterBase<N>::Stream(
+    const string& path,
+    ModelVisitor<N>& visitor
+) const {
+    ModelBatcher<N> batcher(visitor, m_BatchSize);
+    InnerStreamFile(path, batcher);
+    batcher.Finish();
+}
+
+/**********************************************************************
+【函数名称】 SetBatchSize
+【函数功能】 设置 Stream 每批的最大元素个数，为 0 时视为 1。
+【参数】
+    count: 每批的最大元素个数。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void ImporterBase<N>::SetBatchSize(size_t count) {
+    m_BatchSize = count == 0 ? 1 : count;
+}
+
+/**********************************************************************
+【函数名称】 GetBatchSize
+【函数功能】 获取 Stream 每批的最大元素个数。
+【参数】 无
+【返回值】
+    每批的最大元素个数。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+size_t ImporterBase<N>::GetBatchSize() const {
+    return m_BatchSize;
+}
+
+/**********************************************************************
+【函数名称】 InnerImportFile
+【函数功能】
+    导入指定文件到模型中。默认以文件流打开文件并调用 InnerImport，
+    子类可以重写以使用其他方式读取文件。
+    如果文件无法打开抛出 FileOpenException。
+【参数】 
+    path: 文件所在路径。
+    model: 模型的可变引用。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void ImporterBase<N>::InnerImportFile(
+    const string& path,
+    Model<N>& model
+) const {
     ifstream stream(path, ios::in);
     if (!stream.is_open()) {
         throw FileOpenException();
@@ -42,6 +145,46 @@ void ImporterBase<N>::Import(string path, Model<N>& model) const {
     }
 }
 
+/**********************************************************************
+【函数名称】 InnerStreamFile
+【函数功能】
+    将指定文件的内容逐个添加到 batcher 中。
+    默认先用 InnerImportFile 导入完整的模型再逐个送出，
+    每条线段与每个面的点各自作为新的顶点，内存不受限；
+    子类可以重写以边读边送出。
+【参数】
+    path: 文件所在路径。
+    batcher: 将内容分批交给访问者的 ModelBatcher。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void ImporterBase<N>::InnerStreamFile(
+    const string& path,
+    ModelBatcher<N>& batcher
+) const {
+    Model<N> model;
+    InnerImportFile(path, model);
+    batcher.AddName(model.Name);
+    for (auto& line: model.Lines) {
+        size_t first = batcher.GetVertexCount();
+        for (auto& point: line.Points) {
+            batcher.AddVertex(point);
+        }
+        batcher.AddLine(line, array<size_t, 2> { { first, first + 1 } });
+    }
+    for (auto& face: model.Faces) {
+        size_t first = batcher.GetVertexCount();
+        for (auto& point: face.Points) {
+            batcher.AddVertex(point);
+        }
+        batcher.AddFace(
+            face,
+            array<size_t, 3> { { first, first + 1, first + 2 } }
+        );
+    }
+}
+
 }
 
 }
\ No newline at end of file
@@ -0,0 +1,168 @@
+/*************************************************************************
+【文件名】 ModelBatcher.hpp
+【功能模块和目的】 ModelBatcher 类将逐个产生的模型内容分批交给访问者。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "../Core/Face.hpp"
+#include "../Core/Line.hpp"
+#include "../Core/Point.hpp"
+#include "ModelVisitor.hpp"
+using namespace std;
+using namespace C3w;
+
+namespace C3w {
+
+namespace Storage {
+
+/*************************************************************************
+【类名】 ModelBatcher
+【功能】
+    导入器逐个添加解析出的顶点、线段与面，
+    每种内容攒满一批后交给 ModelVisitor，随后清空复用。
+    送出线段或面之前总是先送出尚未送出的顶点，
+    保证访问者收到元素时其引用的顶点都已送达。
+【接口说明】
+    添加名称、顶点、线段与面，获取已添加的顶点数，结束并送出剩余内容。
+    禁止复制 / 拷贝。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+template <size_t N>
+class ModelBatcher final {
+    public:
+        // 构造函数
+
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 使用访问者与批大小初始化 ModelBatcher 类型实例。
+        【参数】
+            visitor: 接收内容的访问者。
+            batchSize: 每批的最大元素个数，为 0 时视为 1。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        ModelBatcher(ModelVisitor<N>& visitor, size_t batchSize);
+        // 禁止拷贝
+        ModelBatcher(const ModelBatcher<N>&) = delete;
+
+        // 属性
+
+        /**********************************************************************
+        【函数名称】 GetVertexCount
+        【函数功能】 获取已添加的顶点数，即下一个顶点的下标。
+        【参数】 无
+        【返回值】
+            已添加的顶点数。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        size_t GetVertexCount() const;
+
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 AddName
+        【函数功能】 立即将模型名称交给访问者。
+        【参数】
+            name: 模型名称。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void AddName(const string& name);
+        /**********************************************************************
+        【函数名称】 AddVertex
+        【函数功能】 添加一个顶点，其下标为添加前的 GetVertexCount()。
+        【参数】
+            vertex: 顶点。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void AddVertex(const Point<N>& vertex);
+        /**********************************************************************
+        【函数名称】 AddLine
+        【函数功能】 添加一条线段。
+        【参数】
+            line: 线段。
+            indices: 两个端点的顶点下标，须小于 GetVertexCount()。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void AddLine(const Line<N>& line, const array<size_t, 2>& indices);
+        /**********************************************************************
+        【函数名称】 AddFace
+        【函数功能】 添加一个面。
+        【参数】
+            face: 面。
+            indices: 三个顶点的顶点下标，须小于 GetVertexCount()。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void AddFace(const Face<N>& face, const array<size_t, 3>& indices);
+        /**********************************************************************
+        【函数名称】 Finish
+        【函数功能】 送出剩余的顶点、线段与面，并通知访问者结束。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void Finish();
+
+        // 操作符
+
+        // 禁止赋值
+        ModelBatcher<N>& operator=(const ModelBatcher<N>&) = delete;
+
+    private:
+        // 接收内容的访问者
+        ModelVisitor<N>& m_Visitor;
+        // 每批的最大元素个数
+        size_t m_BatchSize;
+        // 已送出的顶点数
+        size_t m_SentVertexCount { 0 };
+        // 尚未送出的顶点
+        vector<Point<N>> m_Vertices;
+        // 尚未送出的线段
+        vector<Line<N>> m_Lines;
+        // 尚未送出的线段的顶点下标
+        vector<array<size_t, 2>> m_LineIndices;
+        // 尚未送出的面
+        vector<Face<N>> m_Faces;
+        // 尚未送出的面的顶点下标
+        vector<array<size_t, 3>> m_FaceIndices;
+
+        /**********************************************************************
+        【函数名称】 FlushVertices
+        【函数功能】 送出尚未送出的顶点。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void FlushVertices();
+        /**********************************************************************
+        【函数名称】 FlushLines
+        【函数功能】 先送出顶点，再送出尚未送出的线段。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void FlushLines();
+        /**********************************************************************
+        【函数名称】 FlushFaces
+        【函数功能】 先送出顶点，再送出尚未送出的面。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void FlushFaces();
+};
+
+}
+
+}
+
+#include "ModelBatcher.tpp"
\ No newline at end of file
@@ -0,0 +1,190 @@
+/*************************************************************************
+【文件名】 ModelBatcher.tpp
+【功能模块和目的】 为 ModelBatcher.hpp 提供实现。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "../Core/Face.hpp"
+#include "../Core/Line.hpp"
+#include "../Core/Point.hpp"
+#include "ModelBatcher.hpp"
+#include "ModelVisitor.hpp"
+using namespace std;
+using namespace C3w;
+
+namespace C3w {
+
+namespace Storage {
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 使用访问者与批大小初始化 ModelBatcher 类型实例。
+【参数】
+    visitor: 接收内容的访问者。
+    batchSize: 每批的最大元素个数，为 0 时视为 1。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+ModelBatcher<N>::ModelBatcher(ModelVisitor<N>& visitor, size_t batchSize):
+    m_Visitor(visitor), m_BatchSize(batchSize == 0 ? 1 : batchSize) {}
+
+/**********************************************************************
+【函数名称】 GetVertexCount
+【函数功能】 获取已添加的顶点数，即下一个顶点的下标。
+【参数】 无
+【返回值】
+    已添加的顶点数。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+size_t ModelBatcher<N>::GetVertexCount() const {
+    return m_SentVertexCount + m_Vertices.size();
+}
+
+/**********************************************************************
+【函数名称】 AddName
+【函数功能】 立即将模型名称交给访问者。
+【参数】
+    name: 模型名称。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void ModelBatcher<N>::AddName(const string& name) {
+    m_Visitor.VisitName(name);
+}
+
+/**********************************************************************
+【函数名称】 AddVertex
+【函数功能】 添加一个顶点，其下标为添加前的 GetVertexCount()。
+【参数】
+    vertex: 顶点。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void ModelBatcher<N>::AddVertex(const Point<N>& vertex) {
+    m_Vertices.push_back(vertex);
+    if (m_Vertices.size() == m_BatchSize) {
+        FlushVertices();
+    }
+}
+
+/**********************************************************************
+【函数名称】 AddLine
+【函数功能】 添加一条线段。
+【参数】
+    line: 线段。
+    indices: 两个端点的顶点下标，须小于 GetVertexCount()。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void ModelBatcher<N>::AddLine(
+    const Line<N>& line,
+    const array<size_t, 2>& indices
+) {
+    m_Lines.push_back(line);
+    m_LineIndices.push_back(indices);
+    if (m_Lines.size() == m_BatchSize) {
+        FlushLines();
+    }
+}
+
+/**********************************************************************
+【函数名称】 AddFace
+【函数功能】 添加一个面。
+【参数】
+    face: 面。
+    indices: 三个顶点的顶点下标，须小于 GetVertexCount()。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void ModelBatcher<N>::AddFace(
+    const Face<N>& face,
+    const array<size_t, 3>& indices
+) {
+    m_Faces.push_back(face);
+    m_FaceIndices.push_back(indices);
+    if (m_Faces.size() == m_BatchSize) {
+        FlushFaces();
+    }
+}
+
+/**********************************************************************
+【函数名称】 Finish
+【函数功能】 送出剩余的顶点、线段与面，并通知访问者结束。
+【参数】 无
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void ModelBatcher<N>::Finish() {
+    FlushVertices();
+    FlushLines();
+    FlushFaces();
+    m_Visitor.VisitEnd();
+}
+
+/**********************************************************************
+【函数名称】 FlushVertices
+【函数功能】 送出尚未送出的顶点。
+【参数】 无
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void ModelBatcher<N>::FlushVertices() {
+    if (m_Vertices.empty()) {
+        return;
+    }
+    m_Visitor.VisitVertices(m_SentVertexCount, m_Vertices);
+    m_SentVertexCount += m_Vertices.size();
+    m_Vertices.clear();
+}
+
+/**********************************************************************
+【函数名称】 FlushLines
+【函数功能】 先送出顶点，再送出尚未送出的线段。
+【参数】 无
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void ModelBatcher<N>::FlushLines() {
+    if (m_Lines.empty()) {
+        return;
+    }
+    FlushVertices();
+    m_Visitor.VisitLines(m_Lines, m_LineIndices);
+    m_Lines.clear();
+    m_LineIndices.clear();
+}
+
+/**********************************************************************
+【函数名称】 FlushFaces
+【函数功能】 先送出顶点，再送出尚未送出的面。
+【参数】 无
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void ModelBatcher<N>::FlushFaces() {
+    if (m_Faces.empty()) {
+        return;
+    }
+    FlushVertices();
+    m_Visitor.VisitFaces(m_Faces, m_FaceIndices);
+    m_Faces.clear();
+    m_FaceIndices.clear();
+}
+
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,474 @@
+/*************************************************************************
+【文件名】 ModelConverter.hpp
+【功能模块和目的】 ModelConverter 类以多线程流水线流式地转换模型文件格式。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include "ExporterBase.hpp"
+#include "ImporterBase.hpp"
+#include "ModelEncoder.hpp"
+#include "ModelVisitor.hpp"
+#include "../Tools/BoundedQueue.hpp"
+using namespace std;
+using namespace C3w;
+
+namespace C3w {
+
+namespace Storage {
+
+/*************************************************************************
+【类名】 ModelConverter
+【功能】
+    在不构造 Model 的情况下将模型文件转换为另一格式，
+    导入器与导出器由 StorageFactory 按扩展名查找。
+    转换分为四个阶段，各在一个线程中运行，相邻阶段以有界队列相连：
+    解析（ImporterBase::Stream）、顶点去重、编码（ModelEncoder::Encode）、
+    写入（ModelEncoder::Write）。队列满时上游等待，
+    因此占用的内存只取决于批大小、队列容量与去重窗口，与文件大小无关。
+    去重在最近的若干个不同顶点中进行，窗口满时清空重来，
+    相距很远的重复顶点可能被保留，但输出总是有效的模型文件。
+    与 ControllerBase::ScanModel 一样不检查重复的线段与面，原样输出。
+    任一阶段出错时所有队列被关闭，各阶段尽快退出，
+    半成品的目标文件被删除，异常原样抛出。
+【接口说明】
+    设置批大小、队列容量、去重窗口与进度回调，执行转换并获取报告。
+    禁止复制 / 拷贝。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+template <size_t N>
+class ModelConverter final {
+    public:
+        // 内嵌类型
+
+        /**********************************************************************
+        【类名】 Progress
+        【功能】 转换的进度。
+        【接口说明】 简单数据类型，无函数。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        struct Progress {
+            // 已读取的顶点数
+            size_t VertexCount;
+            // 去重后输出的顶点数
+            size_t UniqueVertexCount;
+            // 已输出的线段数
+            size_t LineCount;
+            // 已输出的面数
+            size_t FaceCount;
+            // 已写入的编码字节数
+            uint64_t ByteCount;
+            // 经过的秒数
+            double Seconds;
+        };
+
+        /**********************************************************************
+        【类名】 StageTiming
+        【功能】 一个阶段的耗时。
+        【接口说明】 简单数据类型，无函数。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        struct StageTiming {
+            // 工作的秒数
+            double BusySeconds;
+            // 等待上游或下游队列的秒数
+            double WaitSeconds;
+        };
+
+        /**********************************************************************
+        【类名】 Report
+        【功能】
+            转换完成后的报告。等待时间长的阶段受相邻阶段拖累，
+            工作时间最长的阶段决定了总耗时。
+        【接口说明】 简单数据类型，无函数。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        struct Report {
+            // 最终的进度
+            Progress Totals;
+            // 解析阶段的耗时
+            StageTiming Parse;
+            // 去重阶段的耗时
+            StageTiming Dedupe;
+            // 编码阶段的耗时
+            StageTiming Encode;
+            // 写入阶段的耗时
+            StageTiming Write;
+        };
+
+        // 成员
+
+        // 默认的队列容量
+        static const size_t DEFAULT_QUEUE_CAPACITY { 16 };
+        // 默认的去重窗口大小
+        static const size_t DEFAULT_DEDUPE_CAPACITY { 1 << 18 };
+
+        // 构造函数
+
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】
+            按扩展名查找源文件的导入器与目标文件的导出器。
+            找不到时抛出 StorageFactoryLookupException。
+        【参数】
+            source: 源文件路径。
+            target: 目标文件路径。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        ModelConverter(const string& source, const string& target);
+        // 禁止拷贝
+        ModelConverter(const ModelConverter<N>&) = delete;
+
+        // 属性
+
+        /**********************************************************************
+        【函数名称】 SetBatchSize
+        【函数功能】 设置每批的最大元素个数，为 0 时视为 1。
+        【参数】
+            count: 每批的最大元素个数。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void SetBatchSize(size_t count);
+        /**********************************************************************
+        【函数名称】 GetBatchSize
+        【函数功能】 获取每批的最大元素个数。
+        【参数】 无
+        【返回值】
+            每批的最大元素个数。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        size_t GetBatchSize() const;
+        /**********************************************************************
+        【函数名称】 SetQueueCapacity
+        【函数功能】 设置相邻阶段间最多积压的批数，为 0 时视为 1。
+        【参数】
+            capacity: 最多积压的批数。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void SetQueueCapacity(size_t capacity);
+        /**********************************************************************
+        【函数名称】 GetQueueCapacity
+        【函数功能】 获取相邻阶段间最多积压的批数。
+        【参数】 无
+        【返回值】
+            最多积压的批数。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        size_t GetQueueCapacity() const;
+        /**********************************************************************
+        【函数名称】 SetDedupeCapacity
+        【函数功能】 设置去重时记住的不同顶点数，为 0 时视为 1。
+        【参数】
+            capacity: 去重窗口大小。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void SetDedupeCapacity(size_t capacity);
+        /**********************************************************************
+        【函数名称】 GetDedupeCapacity
+        【函数功能】 获取去重时记住的不同顶点数。
+        【参数】 无
+        【返回值】
+            去重窗口大小。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        size_t GetDedupeCapacity() const;
+        /**********************************************************************
+        【函数名称】 SetProgressHandler
+        【函数功能】
+            设置进度回调。回调在写入线程中被调用，
+            转换期间大约每隔 PROGRESS_INTERVAL 秒一次，完成时再调用一次。
+        【参数】
+            handler: 进度回调，为空时不报告进度。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void SetProgressHandler(const function<void(const Progress&)>& handler);
+
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 Convert
+        【函数功能】
+            执行转换。源文件与目标文件相同时抛出 FileOpenException；
+            其余错误与导入、导出时相同，出错时目标文件被删除。
+        【参数】 无
+        【返回值】
+            转换的报告。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Report Convert() const;
+
+        // 操作符
+
+        // 禁止赋值
+        ModelConverter<N>& operator=(const ModelConverter<N>&) = delete;
+
+    private:
+        // 内嵌类型
+
+        using Kind = typename ModelEncoder<N>::Kind;
+        using Batch = typename ModelEncoder<N>::Batch;
+        using Chunk = typename ModelEncoder<N>::Chunk;
+
+        /**********************************************************************
+        【类名】 Pipeline
+        【功能】 一次转换中各阶段共享的队列、状态与计数。
+        【接口说明】 以队列容量构造，其余为公开成员。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        struct Pipeline {
+            /******************************************************************
+            【函数名称】 构造函数
+            【函数功能】 以队列容量初始化 Pipeline 类型实例并开始计时。
+            【参数】
+                capacity: 每个队列的容量。
+            【返回值】 无
+            【开发者及日期】 赵一彤 2026/10/17
+            ******************************************************************/
+            explicit Pipeline(size_t capacity);
+
+            // 解析阶段到去重阶段
+            Tools::BoundedQueue<Batch> Parsed;
+            // 去重阶段到编码阶段
+            Tools::BoundedQueue<Batch> Deduped;
+            // 编码阶段到写入阶段
+            Tools::BoundedQueue<Chunk> Encoded;
+            // 是否有阶段出错
+            atomic<bool> IsFailed;
+            // 已读取的顶点数
+            atomic<size_t> VertexCount;
+            // 去重后输出的顶点数
+            atomic<size_t> UniqueVertexCount;
+            // 已输出的线段数
+            atomic<size_t> LineCount;
+            // 已输出的面数
+            atomic<size_t> FaceCount;
+            // 已写入的编码字节数
+            atomic<uint64_t> ByteCount;
+            // 开始的时刻
+            chrono::steady_clock::time_point Start;
+        };
+
+        /**********************************************************************
+        【类名】 BatchPusher
+        【功能】 解析阶段的访问者，把收到的每批内容复制后放入队列。
+        【接口说明】 实现 ModelVisitor 的接口。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        class BatchPusher final: public ModelVisitor<N> {
+            public:
+                // 构造函数
+
+                /**************************************************************
+                【函数名称】 构造函数
+                【函数功能】 使用流水线与解析阶段的耗时初始化 BatchPusher。
+                【参数】
+                    pipeline: 流水线。
+                    timing: 解析阶段的耗时，累计等待时间。
+                【返回值】 无
+                【开发者及日期】 赵一彤 2026/10/17
+                **************************************************************/
+                BatchPusher(Pipeline& pipeline, StageTiming& timing);
+
+                // 操作
+
+                /**************************************************************
+                【函数名称】 VisitName
+                【函数功能】 放入模型名称。
+                【参数】
+                    name: 模型名称。
+                【返回值】 无
+                【开发者及日期】 赵一彤 2026/10/17
+                **************************************************************/
+                void VisitName(const string& name) override;
+                /**************************************************************
+                【函数名称】 VisitVertices
+                【函数功能】 放入一批顶点。
+                【参数】
+                    firstIndex: 本批首个顶点在文件中的下标。
+                    vertices: 本批顶点。
+                【返回值】 无
+                【开发者及日期】 赵一彤 2026/10/17
+                **************************************************************/
+                void VisitVertices(
+                    size_t firstIndex,
+                    const vector<Point<N>>& vertices
+                ) override;
+                /**************************************************************
+                【函数名称】 VisitLines
+                【函数功能】 放入一批线段。
+                【参数】
+                    lines: 本批线段。
+                    indices: 每条线段两个端点在文件中的顶点下标。
+                【返回值】 无
+                【开发者及日期】 赵一彤 2026/10/17
+                **************************************************************/
+                void VisitLines(
+                    const vector<Line<N>>& lines,
+                    const vector<array<size_t, 2>>& indices
+                ) override;
+                /**************************************************************
+                【函数名称】 VisitFaces
+                【函数功能】 放入一批面。
+                【参数】
+                    faces: 本批面。
+                    indices: 每个面三个顶点在文件中的顶点下标。
+                【返回值】 无
+                【开发者及日期】 赵一彤 2026/10/17
+                **************************************************************/
+                void VisitFaces(
+                    const vector<Face<N>>& faces,
+                    const vector<array<size_t, 3>>& indices
+                ) override;
+
+            private:
+                // 流水线
+                Pipeline& m_Pipeline;
+                // 解析阶段的耗时
+                StageTiming& m_Timing;
+
+                /**************************************************************
+                【函数名称】 Push
+                【函数功能】
+                    放入一批内容并累计等待时间。
+                    队列已被关闭时抛出 Aborted，结束导入。
+                【参数】
+                    batch: 一批内容。
+                【返回值】 无
+                【开发者及日期】 赵一彤 2026/10/17
+                **************************************************************/
+                void Push(Batch&& batch);
+        };
+
+        /**********************************************************************
+        【类名】 Aborted
+        【功能】 下游已关闭队列时用于结束解析阶段，不是错误。
+        【接口说明】 简单数据类型，无函数。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        struct Aborted {};
+
+        // 阶段数
+        static const size_t STAGE_COUNT { 4 };
+        // 去重阶段保留在内存中的下标映射个数
+        static const size_t REMAP_MEMORY_COUNT { 1 << 20 };
+        // 报告进度的间隔秒数
+        static constexpr double PROGRESS_INTERVAL { 0.5 };
+
+        // 源文件路径
+        string m_Source;
+        // 目标文件路径
+        string m_Target;
+        // 源文件的导入器
+        unique_ptr<ImporterBase<N>> m_pImporter;
+        // 目标文件的导出器
+        unique_ptr<ExporterBase<N>> m_pExporter;
+        // 队列容量
+        size_t m_QueueCapacity { DEFAULT_QUEUE_CAPACITY };
+        // 去重窗口大小
+        size_t m_DedupeCapacity { DEFAULT_DEDUPE_CAPACITY };
+        // 进度回调
+        function<void(const Progress&)> m_ProgressHandler;
+
+        /**********************************************************************
+        【函数名称】 RunParse
+        【函数功能】 解析阶段：流式导入源文件，将各批内容放入 Parsed。
+        【参数】
+            pipeline: 流水线。
+            timing: 本阶段的耗时。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void RunParse(Pipeline& pipeline, StageTiming& timing) const;
+        /**********************************************************************
+        【函数名称】 RunDedupe
+        【函数功能】
+            去重阶段：在窗口内合并相同的顶点，
+            将元素的顶点下标改写为输出中的下标，放入 Deduped。
+        【参数】
+            pipeline: 流水线。
+            timing: 本阶段的耗时。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void RunDedupe(Pipeline& pipeline, StageTiming& timing) const;
+        /**********************************************************************
+        【函数名称】 RunEncode
+        【函数功能】 编码阶段：将各批内容编码为字节块，放入 Encoded。
+        【参数】
+            pipeline: 流水线。
+            encoder: 编码器。
+            timing: 本阶段的耗时。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void RunEncode(
+            Pipeline& pipeline,
+            ModelEncoder<N>& encoder,
+            StageTiming& timing
+        ) const;
+        /**********************************************************************
+        【函数名称】 RunWrite
+        【函数功能】
+            写入阶段：写入各字节块并定期报告进度，
+            没有阶段出错时完成输出。
+        【参数】
+            pipeline: 流水线。
+            encoder: 编码器。
+            timing: 本阶段的耗时。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void RunWrite(
+            Pipeline& pipeline,
+            ModelEncoder<N>& encoder,
+            StageTiming& timing
+        ) const;
+        /**********************************************************************
+        【函数名称】 Abort
+        【函数功能】 标记出错并关闭所有队列，使各阶段尽快退出。
+        【参数】
+            pipeline: 流水线。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static void Abort(Pipeline& pipeline);
+        /**********************************************************************
+        【函数名称】 GetProgress
+        【函数功能】 获取流水线当前的进度。
+        【参数】
+            pipeline: 流水线。
+        【返回值】
+            当前的进度。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static Progress GetProgress(const Pipeline& pipeline);
+        /**********************************************************************
+        【函数名称】 GetSeconds
+        【函数功能】 获取自某一时刻起经过的秒数。
+        【参数】
+            since: 起始时刻。
+        【返回值】
+            经过的秒数。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static double GetSeconds(chrono::steady_clock::time_point since);
+};
+
+}
+
+}
+
+#include "ModelConverter.tpp"
\ No newline at end of file
@@ -0,0 +1,612 @@
+/*************************************************************************
+【文件名】 ModelConverter.tpp
+【功能模块和目的】 为 ModelConverter.hpp 提供实现。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "../Core/Errors.hpp"
+#include "../Core/Face.hpp"
+#include "../Core/Line.hpp"
+#include "../Core/Point.hpp"
+#include "../Tools/BoundedQueue.hpp"
+#include "../Tools/Parallel.hpp"
+#include "../Tools/SpillVector.hpp"
+#include "ExporterBase.hpp"
+#include "ImporterBase.hpp"
+#include "ModelConverter.hpp"
+#include "ModelEncoder.hpp"
+#include "StorageFactory.hpp"
+using namespace std;
+using namespace C3w;
+using namespace C3w::Errors;
+
+namespace C3w {
+
+namespace Storage {
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】
+    按扩展名查找源文件的导入器与目标文件的导出器。
+    找不到时抛出 StorageFactoryLookupException。
+【参数】
+    source: 源文件路径。
+    target: 目标文件路径。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+ModelConverter<N>::ModelConverter(const string& source, const string& target):
+    m_Source(source),
+    m_Target(target),
+    m_pImporter(StorageFactory::GetImporter<N>(source)),
+    m_pExporter(StorageFactory::GetExporter<N>(target)) {}
+
+/**********************************************************************
+【函数名称】 SetBatchSize
+【函数功能】 设置每批的最大元素个数，为 0 时视为 1。
+【参数】
+    count: 每批的最大元素个数。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void ModelConverter<N>::SetBatchSize(size_t count) {
+    m_pImporter->SetBatchSize(count);
+}
+
+/**********************************************************************
+【函数名称】 GetBatchSize
+【函数功能】 获取每批的最大元素个数。
+【参数】 无
+【返回值】
+    每批的最大元素个数。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+size_t ModelConverter<N>::GetBatchSize() const {
+    return m_pImporter->GetBatchSize();
+}
+
+/**********************************************************************
+【函数名称】 SetQueueCapacity
+【函数功能】 设置相邻阶段间最多积压的批数，为 0 时视为 1。
+【参数】
+    capacity: 最多积压的批数。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void ModelConverter<N>::SetQueueCapacity(size_t capacity) {
+    m_QueueCapacity = capacity == 0 ? 1 : capacity;
+}
+
+/**********************************************************************
+【函数名称】 GetQueueCapacity
+【函数功能】 获取相邻阶段间最多积压的批数。
+【参数】 无
+【返回值】
+    最多积压的批数。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+size_t ModelConverter<N>::GetQueueCapacity() const {
+    return m_QueueCapacity;
+}
+
+/**********************************************************************
+【函数名称】 SetDedupeCapacity
+【函数功能】 设置去重时记住的不同顶点数，为 0 时视为 1。
+【参数】
+    capacity: 去重窗口大小。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void ModelConverter<N>::SetDedupeCapacity(size_t capacity) {
+    m_DedupeCapacity = capacity == 0 ? 1 : capacity;
+}
+
+/**********************************************************************
+【函数名称】 GetDedupeCapacity
+【函数功能】 获取去重时记住的不同顶点数。
+【参数】 无
+【返回值】
+    去重窗口大小。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+size_t ModelConverter<N>::GetDedupeCapacity() const {
+    return m_DedupeCapacity;
+}
+
+/**********************************************************************
+【函数名称】 SetProgressHandler
+【函数功能】
+    设置进度回调。回调在写入线程中被调用，
+    转换期间大约每隔 PROGRESS_INTERVAL 秒一次，完成时再调用一次。
+【参数】
+    handler: 进度回调，为空时不报告进度。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void ModelConverter<N>::SetProgressHandler(
+    const function<void(const Progress&)>& handler
+) {
+    m_ProgressHandler = handler;
+}
+
+/**********************************************************************
+【函数名称】 Convert
+【函数功能】
+    执行转换。源文件与目标文件相同时抛出 FileOpenException；
+    其余错误与导入、导出时相同，出错时目标文件被删除。
+【参数】 无
+【返回值】
+    转换的报告。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+typename ModelConverter<N>::Report ModelConverter<N>::Convert() const {
+    // 创建编码器时目标文件即被清空，不能再读取源文件
+    if (m_Source == m_Target) {
+        throw FileOpenException();
+    }
+    auto pEncoder = m_pExporter->CreateEncoder(m_Target);
+    Pipeline pipeline(m_QueueCapacity);
+    Report report {};
+    try {
+        Tools::Parallel::For(STAGE_COUNT, [&](size_t stage) {
+            try {
+                switch (stage) {
+                    case 0:
+                        RunParse(pipeline, report.Parse);
+                        break;
+                    case 1:
+                        RunDedupe(pipeline, report.Dedupe);
+                        break;
+                    case 2:
+                        RunEncode(pipeline, *pEncoder, report.Encode);
+                        break;
+                    default:
+                        RunWrite(pipeline, *pEncoder, report.Write);
+                        break;
+                }
+            }
+            catch (...) {
+                Abort(pipeline);
+                throw;
+            }
+        });
+    }
+    catch (...) {
+        // 先关闭编码器持有的文件，再删除半成品
+        pEncoder.reset();
+        remove(m_Target.c_str());
+        throw;
+    }
+    report.Totals = GetProgress(pipeline);
+    return report;
+}
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 以队列容量初始化 Pipeline 类型实例并开始计时。
+【参数】
+    capacity: 每个队列的容量。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+ModelConverter<N>::Pipeline::Pipeline(size_t capacity):
+    Parsed(capacity),
+    Deduped(capacity),
+    Encoded(capacity),
+    IsFailed(false),
+    VertexCount(0),
+    UniqueVertexCount(0),
+    LineCount(0),
+    FaceCount(0),
+    ByteCount(0),
+    Start(chrono::steady_clock::now()) {}
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 使用流水线与解析阶段的耗时初始化 BatchPusher。
+【参数】
+    pipeline: 流水线。
+    timing: 解析阶段的耗时，累计等待时间。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+ModelConverter<N>::BatchPusher::BatchPusher(
+    Pipeline& pipeline,
+    StageTiming& timing
+): m_Pipeline(pipeline), m_Timing(timing) {}
+
+/**********************************************************************
+【函数名称】 VisitName
+【函数功能】 放入模型名称。
+【参数】
+    name: 模型名称。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void ModelConverter<N>::BatchPusher::VisitName(const string& name) {
+    Batch batch;
+    batch.Type = Kind::NAME;
+    batch.Name = name;
+    Push(move(batch));
+}
+
+/**********************************************************************
+【函数名称】 VisitVertices
+【函数功能】 放入一批顶点。
+【参数】
+    firstIndex: 本批首个顶点在文件中的下标。
+    vertices: 本批顶点。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void ModelConverter<N>::BatchPusher::VisitVertices(
+    size_t firstIndex,
+    const vector<Point<N>>& vertices
+) {
+    Batch batch;
+    batch.Type = Kind::VERTICES;
+    batch.FirstIndex = firstIndex;
+    batch.Vertices = vertices;
+    m_Pipeline.VertexCount += vertices.size();
+    Push(move(batch));
+}
+
+/**********************************************************************
+【函数名称】 VisitLines
+【函数功能】 放入一批线段。
+【参数】
+    lines: 本批线段。
+    indices: 每条线段两个端点在文件中的顶点下标。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void ModelConverter<N>::BatchPusher::VisitLines(
+    const vector<Line<N>>& lines,
+    const vector<array<size_t, 2>>& indices
+) {
+    Batch batch;
+    batch.Type = Kind::LINES;
+    batch.Lines = lines;
+    batch.LineIndices = indices;
+    Push(move(batch));
+}
+
+/**********************************************************************
+【函数名称】 VisitFaces
+【函数功能】 放入一批面。
+【参数】
+    faces: 本批面。
+    indices: 每个面三个顶点在文件中的顶点下标。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void ModelConverter<N>::BatchPusher::VisitFaces(
+    const vector<Face<N>>& faces,
+    const vector<array<size_t, 3>>& indices
+) {
+    Batch batch;
+    batch.Type = Kind::FACES;
+    batch.Faces = faces;
+    batch.FaceIndices = indices;
+    Push(move(batch));
+}
+
+/**********************************************************************
+【函数名称】 Push
+【函数功能】
+    放入一批内容并累计等待时间。
+    队列已被关闭时抛出 Aborted，结束导入。
+【参数】
+    batch: 一批内容。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void ModelConverter<N>::BatchPusher::Push(Batch&& batch) {
+    auto start = chrono::steady_clock::now();
+    bool isPushed = m_Pipeline.Parsed.Push(move(batch));
+    m_Timing.WaitSeconds += GetSeconds(start);
+    if (!isPushed) {
+        throw Aborted();
+    }
+}
+
+/**********************************************************************
+【函数名称】 RunParse
+【函数功能】 解析阶段：流式导入源文件，将各批内容放入 Parsed。
+【参数】
+    pipeline: 流水线。
+    timing: 本阶段的耗时。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void ModelConverter<N>::RunParse(
+    Pipeline& pipeline,
+    StageTiming& timing
+) const {
+    auto start = chrono::steady_clock::now();
+    BatchPusher pusher(pipeline, timing);
+    try {
+        m_pImporter->Stream(m_Source, pusher);
+    }
+    catch (Aborted) {
+        // 下游已出错，错误由出错的阶段报告
+    }
+    pipeline.Parsed.Close();
+    timing.BusySeconds = GetSeconds(start) - timing.WaitSeconds;
+}
+
+/**********************************************************************
+【函数名称】 RunDedupe
+【函数功能】
+    去重阶段：在窗口内合并相同的顶点，
+    将元素的顶点下标改写为输出中的下标，放入 Deduped。
+【参数】
+    pipeline: 流水线。
+    timing: 本阶段的耗时。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void ModelConverter<N>::RunDedupe(
+    Pipeline& pipeline,
+    StageTiming& timing
+) const {
+    auto start = chrono::steady_clock::now();
+    // 最近出现的不同顶点及其输出下标，满时清空，内存有上限
+    unordered_map<Point<N>, size_t> window;
+    // 文件中的顶点下标到输出下标的映射，超出部分写入临时文件。
+    // 出现第一个重复顶点之前两者相同，只记录相同部分的长度，
+    // 没有重复顶点的文件不必查表
+    Tools::SpillVector<size_t> remap(REMAP_MEMORY_COUNT);
+    size_t identityCount = 0;
+    auto map = [&remap, &identityCount](size_t index) {
+        return index < identityCount ?
+            index : remap.Get(index - identityCount);
+    };
+    size_t uniqueCount = 0;
+    Batch batch;
+    while (true) {
+        auto waitStart = chrono::steady_clock::now();
+        bool isPopped = pipeline.Parsed.Pop(batch);
+        timing.WaitSeconds += GetSeconds(waitStart);
+        if (!isPopped || pipeline.IsFailed) {
+            break;
+        }
+        switch (batch.Type) {
+            case Kind::NAME:
+                break;
+            case Kind::VERTICES: {
+                vector<Point<N>> unique;
+                for (auto& point: batch.Vertices) {
+                    size_t index;
+                    auto found = window.find(point);
+                    if (found != window.end()) {
+                        index = found->second;
+                    }
+                    else {
+                        if (window.size() >= m_DedupeCapacity) {
+                            window.clear();
+                        }
+                        index = uniqueCount++;
+                        window.emplace(point, index);
+                        unique.push_back(point);
+                    }
+                    if (remap.Count() == 0 && index == identityCount) {
+                        identityCount++;
+                    }
+                    else {
+                        remap.Add(index);
+                    }
+                }
+                batch.FirstIndex = uniqueCount - unique.size();
+                batch.Vertices = move(unique);
+                pipeline.UniqueVertexCount = uniqueCount;
+                break;
+            }
+            case Kind::LINES:
+                for (auto& indices: batch.LineIndices) {
+                    for (auto& index: indices) {
+                        index = map(index);
+                    }
+                }
+                pipeline.LineCount += batch.Lines.size();
+                break;
+            case Kind::FACES:
+                for (auto& indices: batch.FaceIndices) {
+                    for (auto& index: indices) {
+                        index = map(index);
+                    }
+                }
+                pipeline.FaceCount += batch.Faces.size();
+                break;
+        }
+        if (batch.Type == Kind::VERTICES && batch.Vertices.empty()) {
+            continue;
+        }
+        waitStart = chrono::steady_clock::now();
+        bool isPushed = pipeline.Deduped.Push(move(batch));
+        timing.WaitSeconds += GetSeconds(waitStart);
+        if (!isPushed) {
+            break;
+        }
+    }
+    pipeline.Deduped.Close();
+    timing.BusySeconds = GetSeconds(start) - timing.WaitSeconds;
+}
+
+/**********************************************************************
+【函数名称】 RunEncode
+【函数功能】 编码阶段：将各批内容编码为字节块，放入 Encoded。
+【参数】
+    pipeline: 流水线。
+    encoder: 编码器。
+    timing: 本阶段的耗时。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void ModelConverter<N>::RunEncode(
+    Pipeline& pipeline,
+    ModelEncoder<N>& encoder,
+    StageTiming& timing
+) const {
+    auto start = chrono::steady_clock::now();
+    Batch batch;
+    while (true) {
+        auto waitStart = chrono::steady_clock::now();
+        bool isPopped = pipeline.Deduped.Pop(batch);
+        timing.WaitSeconds += GetSeconds(waitStart);
+        if (!isPopped || pipeline.IsFailed) {
+            break;
+        }
+        Chunk chunk;
+        encoder.Encode(batch, chunk);
+        if (chunk.Bytes.empty()) {
+            continue;
+        }
+        waitStart = chrono::steady_clock::now();
+        bool isPushed = pipeline.Encoded.Push(move(chunk));
+        timing.WaitSeconds += GetSeconds(waitStart);
+        if (!isPushed) {
+            break;
+        }
+    }
+    pipeline.Encoded.Close();
+    timing.BusySeconds = GetSeconds(start) - timing.WaitSeconds;
+}
+
+/**********************************************************************
+【函数名称】 RunWrite
+【函数功能】
+    写入阶段：写入各字节块并定期报告进度，
+    没有阶段出错时完成输出。
+【参数】
+    pipeline: 流水线。
+    encoder: 编码器。
+    timing: 本阶段的耗时。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void ModelConverter<N>::RunWrite(
+    Pipeline& pipeline,
+    ModelEncoder<N>& encoder,
+    StageTiming& timing
+) const {
+    auto start = chrono::steady_clock::now();
+    double lastReport = 0;
+    Chunk chunk;
+    while (true) {
+        auto waitStart = chrono::steady_clock::now();
+        bool isPopped = pipeline.Encoded.Pop(chunk);
+        timing.WaitSeconds += GetSeconds(waitStart);
+        if (!isPopped || pipeline.IsFailed) {
+            break;
+        }
+        encoder.Write(chunk);
+        pipeline.ByteCount += chunk.Bytes.size();
+        if (m_ProgressHandler) {
+            auto seconds = GetSeconds(pipeline.Start);
+            if (seconds - lastReport >= PROGRESS_INTERVAL) {
+                lastReport = seconds;
+                m_ProgressHandler(GetProgress(pipeline));
+            }
+        }
+    }
+    // 上游出错时先设置标记再关闭队列，此处一定能看到
+    if (!pipeline.IsFailed) {
+        encoder.Finish();
+        if (m_ProgressHandler) {
+            m_ProgressHandler(GetProgress(pipeline));
+        }
+    }
+    timing.BusySeconds = GetSeconds(start) - timing.WaitSeconds;
+}
+
+/**********************************************************************
+【函数名称】 Abort
+【函数功能】 标记出错并关闭所有队列，使各阶段尽快退出。
+【参数】
+    pipeline: 流水线。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void ModelConverter<N>::Abort(Pipeline& pipeline) {
+    pipeline.IsFailed = true;
+    pipeline.Parsed.Close();
+    pipeline.Deduped.Close();
+    pipeline.Encoded.Close();
+}
+
+/**********************************************************************
+【函数名称】 GetProgress
+【函数功能】 获取流水线当前的进度。
+【参数】
+    pipeline: 流水线。
+【返回值】
+    当前的进度。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+typename ModelConverter<N>::Progress ModelConverter<N>::GetProgress(
+    const Pipeline& pipeline
+) {
+    Progress progress;
+    progress.VertexCount = pipeline.VertexCount;
+    progress.UniqueVertexCount = pipeline.UniqueVertexCount;
+    progress.LineCount = pipeline.LineCount;
+    progress.FaceCount = pipeline.FaceCount;
+    progress.ByteCount = pipeline.ByteCount;
+    progress.Seconds = GetSeconds(pipeline.Start);
+    return progress;
+}
+
+/**********************************************************************
+【函数名称】 GetSeconds
+【函数功能】 获取自某一时刻起经过的秒数。
+【参数】
+    since: 起始时刻。
+【返回值】
+    经过的秒数。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+double ModelConverter<N>::GetSeconds(chrono::steady_clock::time_point since) {
+    return chrono::duration<double>(
+        chrono::steady_clock::now() - since
+    ).count();
+}
+
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,384 @@
+/*************************************************************************
+【文件名】 ModelDelta.hpp
+【功能模块和目的】 ModelDelta 类描述模型相对于基准文件的差异，用于增量保存。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "../Core/Face.hpp"
+#include "../Core/Line.hpp"
+#include "../Core/Model.hpp"
+#include "../Tools/BufferedWriter.hpp"
+using namespace std;
+using namespace C3w;
+
+namespace C3w {
+
+namespace Storage {
+
+/*************************************************************************
+【类名】 ModelDelta
+【功能】
+    以基准文件中元素的下标描述 N 维模型与基准文件的差异，
+    保存在基准文件旁的差异文件中，基准文件不被改写。
+    线段与面各为一列片段，每个片段先复制基准文件中连续的一段元素，
+    再接若干个新的元素，依次拼接即得到模型，元素顺序与模型相同。
+    被删除的元素不出现在任何片段中，修改过的元素作为新的元素保存，
+    因此差异的大小只与改变的元素数有关，与模型大小无关。
+    差异文件依次为：80 字节的文件头、线段的片段与新线段、
+    面的片段与新面，各段均为 8 字节的整数或 double，
+    数值以写入方的字节序存储，字节序不同的文件会被拒绝。
+【接口说明】
+    由模型及其元素在基准文件中的下标计算差异，读写差异文件，
+    将差异应用到从基准文件导入的模型上，获取差异文件的大小。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+template <size_t N>
+class ModelDelta final {
+    public:
+        // 内嵌类型
+
+        /**********************************************************************
+        【类名】 Segment
+        【功能】 差异中的一个片段。
+        【接口说明】 简单数据类型，无函数。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        struct Segment {
+            // 复制的第一个元素在基准文件中的下标
+            uint64_t First;
+            // 复制的元素个数
+            uint64_t Count;
+            // 之后新元素的个数
+            uint64_t AddedCount;
+        };
+
+        // 元素不与基准文件中的任何元素相同时的下标
+        static const size_t NO_ORIGIN { SIZE_MAX };
+
+        // 构造函数
+
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】
+            计算模型相对于基准文件的差异，
+            元素在基准文件中的下标不连续处开始新的片段。
+        【参数】
+            model: 模型。
+            lineOrigins: 每个线段槽位中的元素在基准文件中的下标，
+                与基准文件中的元素不同时为 NO_ORIGIN。
+            faceOrigins: 每个面槽位中的元素在基准文件中的下标，
+                与基准文件中的元素不同时为 NO_ORIGIN。
+            baseSize: 基准文件的字节数，载入时用于确认基准文件未被替换。
+            baseFingerprint: 基准文件内容的指纹，用途同 baseSize。
+            baseLineCount: 基准文件中的线段数。
+            baseFaceCount: 基准文件中的面数。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        ModelDelta(
+            const Model<N>& model,
+            const vector<size_t>& lineOrigins,
+            const vector<size_t>& faceOrigins,
+            uint64_t baseSize,
+            uint64_t baseFingerprint,
+            uint64_t baseLineCount,
+            uint64_t baseFaceCount
+        );
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】
+            读取并校验差异文件。
+            文件无法打开时抛出 FileOpenException，
+            布局无效时抛出 FileFormatException。
+        【参数】
+            path: 差异文件所在路径。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        ModelDelta(const string& path);
+
+        // 属性
+
+        /**********************************************************************
+        【函数名称】 GetBaseSize
+        【函数功能】 获取计算差异时基准文件的字节数。
+        【参数】 无
+        【返回值】
+            基准文件的字节数。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        uint64_t GetBaseSize() const;
+        /**********************************************************************
+        【函数名称】 GetBaseFingerprint
+        【函数功能】 获取计算差异时基准文件内容的指纹。
+        【参数】 无
+        【返回值】
+            基准文件内容的指纹。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        uint64_t GetBaseFingerprint() const;
+        /**********************************************************************
+        【函数名称】 IsEmpty
+        【函数功能】 判断模型是否与基准文件完全相同。
+        【参数】 无
+        【返回值】
+            模型与基准文件完全相同时返回 true。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        bool IsEmpty() const;
+        /**********************************************************************
+        【函数名称】 GetFileSize
+        【函数功能】 获取写出的差异文件的字节数，不实际写出。
+        【参数】 无
+        【返回值】
+            差异文件的字节数。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        uint64_t GetFileSize() const;
+
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 Write
+        【函数功能】
+            写出差异文件。先写入同目录下的临时文件再替换原文件，
+            写入中途失败时原有的差异文件保持不变。
+            文件无法写入时抛出 FileOpenException。
+        【参数】
+            path: 差异文件所在路径。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void Write(const string& path) const;
+        /**********************************************************************
+        【函数名称】 Apply
+        【函数功能】
+            将差异应用到从基准文件导入的模型上，
+            同时得到每个元素在基准文件中的下标。
+            复制部分递增且中间插入的新元素不多时原地修补，
+            修改过的元素原位替换，只有删除时才整体移动一次；
+            否则重新拼接全部元素。
+            模型与计算差异时的基准文件元素数不同、片段越界、
+            新元素退化或拼接后有重复元素时抛出 FileFormatException，
+            此时模型可能已被部分修补，应丢弃，
+            控制器因此只在临时导入的模型上应用差异。
+        【参数】
+            model: 从基准文件导入的模型，之后为差异所描述的模型。
+            lineOrigins: 返回每个线段在基准文件中的下标。
+            faceOrigins: 返回每个面在基准文件中的下标。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void Apply(
+            Model<N>& model,
+            vector<size_t>& lineOrigins,
+            vector<size_t>& faceOrigins
+        ) const;
+        /**********************************************************************
+        【函数名称】 GetPath
+        【函数功能】 获取基准文件旁差异文件的路径。
+        【参数】
+            basePath: 基准文件所在路径。
+        【返回值】
+            差异文件所在路径。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static string GetPath(const string& basePath);
+
+    private:
+        /**********************************************************************
+        【类名】 Header
+        【功能】 差异文件头。
+        【接口说明】 简单数据类型，无函数。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        struct Header {
+            // 魔数 "C3WD"
+            char Magic[4];
+            // 字节序标记，以写入方的字节序存储 BYTE_ORDER_MARK
+            uint32_t ByteOrderMark;
+            // 格式版本
+            uint32_t Version;
+            // 维数
+            uint32_t Dimension;
+            // 基准文件的字节数
+            uint64_t BaseSize;
+            // 基准文件内容的指纹
+            uint64_t BaseFingerprint;
+            // 基准文件中的线段数
+            uint64_t BaseLineCount;
+            // 基准文件中的面数
+            uint64_t BaseFaceCount;
+            // 线段的片段数
+            uint64_t LineSegmentCount;
+            // 新线段数
+            uint64_t AddedLineCount;
+            // 面的片段数
+            uint64_t FaceSegmentCount;
+            // 新面数
+            uint64_t AddedFaceCount;
+        };
+
+        // 字节序标记
+        static const uint32_t BYTE_ORDER_MARK { 0x01020304 };
+        // 格式版本
+        static const uint32_t VERSION { 2 };
+        // 原地修补时最多在中间插入的新元素数，每次插入移动其后的全部元素
+        static const size_t MAX_PATCH_INSERT_COUNT { 64 };
+
+        // 基准文件的字节数
+        uint64_t m_BaseSize { 0 };
+        // 基准文件内容的指纹
+        uint64_t m_BaseFingerprint { 0 };
+        // 基准文件中的线段数
+        uint64_t m_BaseLineCount { 0 };
+        // 基准文件中的面数
+        uint64_t m_BaseFaceCount { 0 };
+        // 线段的片段
+        vector<Segment> m_LineSegments;
+        // 新线段，按出现的顺序排列
+        vector<Line<N>> m_AddedLines;
+        // 面的片段
+        vector<Segment> m_FaceSegments;
+        // 新面，按出现的顺序排列
+        vector<Face<N>> m_AddedFaces;
+
+        /**********************************************************************
+        【函数名称】 Split
+        【函数功能】 按元素在基准文件中的下标将一个元素集合分为片段。
+        【参数】
+            elements: 元素集合。
+            origins: 每个槽位中的元素在基准文件中的下标。
+            segments: 返回片段。
+            added: 返回新元素。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        template <typename E>
+        static void Split(
+            const HashedSet<E>& elements,
+            const vector<size_t>& origins,
+            vector<Segment>& segments,
+            vector<E>& added
+        );
+        /**********************************************************************
+        【函数名称】 Check
+        【函数功能】
+            检查片段是否在基准文件的范围内且新元素数相符，
+            不符时抛出 FileFormatException。
+        【参数】
+            segments: 片段。
+            addedCount: 新元素数。
+            baseCount: 基准文件中该类元素的个数。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static void Check(
+            const vector<Segment>& segments,
+            uint64_t addedCount,
+            uint64_t baseCount
+        );
+        /**********************************************************************
+        【函数名称】 GetOrigins
+        【函数功能】 获取按片段拼接后每个元素在基准文件中的下标。
+        【参数】
+            segments: 已检查的片段。
+        【返回值】
+            每个元素在基准文件中的下标，新元素为 NO_ORIGIN。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static vector<size_t> GetOrigins(const vector<Segment>& segments);
+        /**********************************************************************
+        【函数名称】 TryPatch
+        【函数功能】
+            在基准元素集合上原地应用一类元素的差异。
+            复制部分不递增、中间插入的新元素超过 MAX_PATCH_INSERT_COUNT
+            或新元素与基准文件中的元素相同时不做修改并返回 false；
+            新元素之间重复时抛出 FileFormatException。
+        【参数】
+            elements: 从基准文件导入的元素集合。
+            segments: 已检查的片段。
+            added: 新元素。
+        【返回值】
+            是否已原地应用。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        template <typename E>
+        static bool TryPatch(
+            HashedSet<E>& elements,
+            const vector<Segment>& segments,
+            const vector<E>& added
+        );
+        /**********************************************************************
+        【函数名称】 Join
+        【函数功能】
+            按片段拼接基准文件中的元素与新元素，
+            有重复元素时抛出 FileFormatException。
+        【参数】
+            base: 从基准文件导入的元素集合，不改变。
+            segments: 已检查的片段。
+            added: 新元素。
+        【返回值】
+            拼接得到的元素集合。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        template <typename E>
+        static HashedSet<E> Join(
+            const HashedSet<E>& base,
+            const vector<Segment>& segments,
+            const vector<E>& added
+        );
+        /**********************************************************************
+        【函数名称】 WriteSection
+        【函数功能】 写出一类元素的片段与新元素的坐标。
+        【参数】
+            writer: 写入二进制流的格式化器。
+            segments: 片段。
+            added: 新元素。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        template <typename E>
+        static void WriteSection(
+            Tools::BufferedWriter& writer,
+            const vector<Segment>& segments,
+            const vector<E>& added
+        );
+        /**********************************************************************
+        【函数名称】 ReadSection
+        【函数功能】
+            读取一类元素的片段与新元素，并移动读取位置。
+            长度不足时抛出 FileFormatException，
+            新元素退化时抛出 CollectionException。
+        【参数】
+            cursor: 读取位置。
+            remaining: 剩余的字节数。
+            segmentCount: 片段数。
+            addedCount: 新元素数。
+            segments: 返回片段。
+            added: 返回新元素。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        template <size_t S, typename E>
+        static void ReadSection(
+            const char*& cursor,
+            uint64_t& remaining,
+            uint64_t segmentCount,
+            uint64_t addedCount,
+            vector<Segment>& segments,
+            vector<E>& added
+        );
+};
+
+}
+
+}
+
+#include "ModelDelta.tpp"
\ No newline at end of file
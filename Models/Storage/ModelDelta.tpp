@@ -0,0 +1,643 @@
+/*************************************************************************
+【文件名】 ModelDelta.tpp
+【功能模块和目的】 为 ModelDelta.hpp 提供实现。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "../Containers/FixedSet.hpp"
+#include "../Containers/HashedSet.hpp"
+#include "../Core/Element.hpp"
+#include "../Core/Errors.hpp"
+#include "../Core/Face.hpp"
+#include "../Core/Line.hpp"
+#include "../Core/Model.hpp"
+#include "../Core/Point.hpp"
+#include "../Tools/BufferedWriter.hpp"
+#include "../Tools/MappedFile.hpp"
+#include "ModelDelta.hpp"
+using namespace std;
+using namespace C3w;
+using namespace C3w::Containers;
+using namespace C3w::Errors;
+
+namespace C3w {
+
+namespace Storage {
+
+template <size_t N>
+const size_t ModelDelta<N>::NO_ORIGIN;
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】
+    计算模型相对于基准文件的差异，
+    元素在基准文件中的下标不连续处开始新的片段。
+【参数】
+    model: 模型。
+    lineOrigins: 每个线段槽位中的元素在基准文件中的下标，
+        与基准文件中的元素不同时为 NO_ORIGIN。
+    faceOrigins: 每个面槽位中的元素在基准文件中的下标，
+        与基准文件中的元素不同时为 NO_ORIGIN。
+    baseSize: 基准文件的字节数，载入时用于确认基准文件未被替换。
+    baseFingerprint: 基准文件内容的指纹，用途同 baseSize。
+    baseLineCount: 基准文件中的线段数。
+    baseFaceCount: 基准文件中的面数。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+ModelDelta<N>::ModelDelta(
+    const Model<N>& model,
+    const vector<size_t>& lineOrigins,
+    const vector<size_t>& faceOrigins,
+    uint64_t baseSize,
+    uint64_t baseFingerprint,
+    uint64_t baseLineCount,
+    uint64_t baseFaceCount
+): m_BaseSize(baseSize),
+    m_BaseFingerprint(baseFingerprint),
+    m_BaseLineCount(baseLineCount),
+    m_BaseFaceCount(baseFaceCount) {
+    Split(model.Lines, lineOrigins, m_LineSegments, m_AddedLines);
+    Split(model.Faces, faceOrigins, m_FaceSegments, m_AddedFaces);
+}
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】
+    读取并校验差异文件。
+    文件无法打开时抛出 FileOpenException，
+    布局无效时抛出 FileFormatException。
+【参数】
+    path: 差异文件所在路径。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+ModelDelta<N>::ModelDelta(const string& path) {
+    static_assert(sizeof(Header) == 80, "header must be 80 bytes.");
+    Tools::MappedFile file(path);
+    uint64_t remaining = file.GetSize();
+    if (remaining < sizeof(Header)) {
+        throw FileFormatException();
+    }
+    Header header;
+    memcpy(&header, file.GetData(), sizeof(Header));
+    if (
+        memcmp(header.Magic, "C3WD", sizeof(header.Magic)) != 0 ||
+        header.ByteOrderMark != BYTE_ORDER_MARK ||
+        header.Version != VERSION ||
+        header.Dimension != N
+    ) {
+        throw FileFormatException();
+    }
+    m_BaseSize = header.BaseSize;
+    m_BaseFingerprint = header.BaseFingerprint;
+    m_BaseLineCount = header.BaseLineCount;
+    m_BaseFaceCount = header.BaseFaceCount;
+
+    const char* cursor = file.GetData() + sizeof(Header);
+    remaining -= sizeof(Header);
+    try {
+        ReadSection<2>(
+            cursor, remaining,
+            header.LineSegmentCount, header.AddedLineCount,
+            m_LineSegments, m_AddedLines
+        );
+        ReadSection<3>(
+            cursor, remaining,
+            header.FaceSegmentCount, header.AddedFaceCount,
+            m_FaceSegments, m_AddedFaces
+        );
+    }
+    // 新元素的顶点重合
+    catch (CollectionException) {
+        throw FileFormatException();
+    }
+    if (remaining != 0) {
+        throw FileFormatException();
+    }
+}
+
+/**********************************************************************
+【函数名称】 GetBaseSize
+【函数功能】 获取计算差异时基准文件的字节数。
+【参数】 无
+【返回值】
+    基准文件的字节数。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+uint64_t ModelDelta<N>::GetBaseSize() const {
+    return m_BaseSize;
+}
+
+/**********************************************************************
+【函数名称】 GetBaseFingerprint
+【函数功能】 获取计算差异时基准文件内容的指纹。
+【参数】 无
+【返回值】
+    基准文件内容的指纹。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+uint64_t ModelDelta<N>::GetBaseFingerprint() const {
+    return m_BaseFingerprint;
+}
+
+/**********************************************************************
+【函数名称】 IsEmpty
+【函数功能】 判断模型是否与基准文件完全相同。
+【参数】 无
+【返回值】
+    模型与基准文件完全相同时返回 true。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+bool ModelDelta<N>::IsEmpty() const {
+    // 相同时每类元素至多一个片段，复制基准文件中的全部元素
+    auto isWhole = [](const vector<Segment>& segments, uint64_t count) {
+        if (segments.empty()) {
+            return count == 0;
+        }
+        return segments.size() == 1 &&
+            segments[0].First == 0 &&
+            segments[0].Count == count &&
+            segments[0].AddedCount == 0;
+    };
+    return isWhole(m_LineSegments, m_BaseLineCount) &&
+        isWhole(m_FaceSegments, m_BaseFaceCount);
+}
+
+/**********************************************************************
+【函数名称】 GetFileSize
+【函数功能】 获取写出的差异文件的字节数，不实际写出。
+【参数】 无
+【返回值】
+    差异文件的字节数。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+uint64_t ModelDelta<N>::GetFileSize() const {
+    uint64_t segmentCount = m_LineSegments.size() + m_FaceSegments.size();
+    uint64_t coordinateCount =
+        (m_AddedLines.size() * 2 + m_AddedFaces.size() * 3) * N;
+    return sizeof(Header) +
+        segmentCount * sizeof(Segment) +
+        coordinateCount * sizeof(double);
+}
+
+/**********************************************************************
+【函数名称】 Write
+【函数功能】
+    写出差异文件。先写入同目录下的临时文件再替换原文件，
+    写入中途失败时原有的差异文件保持不变。
+    文件无法写入时抛出 FileOpenException。
+【参数】
+    path: 差异文件所在路径。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void ModelDelta<N>::Write(const string& path) const {
+    static_assert(sizeof(Segment) == 24, "segment must be 24 bytes.");
+    Header header;
+    memcpy(header.Magic, "C3WD", sizeof(header.Magic));
+    header.ByteOrderMark = BYTE_ORDER_MARK;
+    header.Version = VERSION;
+    header.Dimension = static_cast<uint32_t>(N);
+    header.BaseSize = m_BaseSize;
+    header.BaseFingerprint = m_BaseFingerprint;
+    header.BaseLineCount = m_BaseLineCount;
+    header.BaseFaceCount = m_BaseFaceCount;
+    header.LineSegmentCount = m_LineSegments.size();
+    header.AddedLineCount = m_AddedLines.size();
+    header.FaceSegmentCount = m_FaceSegments.size();
+    header.AddedFaceCount = m_AddedFaces.size();
+
+    auto temporary = path + ".tmp";
+    ofstream stream(temporary, ios::out | ios::binary | ios::trunc);
+    if (!stream) {
+        throw FileOpenException();
+    }
+    Tools::BufferedWriter writer(stream);
+    writer.Write(reinterpret_cast<const char*>(&header), sizeof(header));
+    WriteSection(writer, m_LineSegments, m_AddedLines);
+    WriteSection(writer, m_FaceSegments, m_AddedFaces);
+    writer.Flush();
+    stream.close();
+    if (!stream) {
+        remove(temporary.c_str());
+        throw FileOpenException();
+    }
+    // Windows 上 rename 不覆盖已有的文件
+    if (rename(temporary.c_str(), path.c_str()) != 0) {
+        remove(path.c_str());
+        if (rename(temporary.c_str(), path.c_str()) != 0) {
+            remove(temporary.c_str());
+            throw FileOpenException();
+        }
+    }
+}
+
+/**********************************************************************
+【函数名称】 Apply
+【函数功能】
+    将差异应用到从基准文件导入的模型上，
+    同时得到每个元素在基准文件中的下标。
+    模型与计算差异时的基准文件元素数不同、片段越界、
+    新元素退化或拼接后有重复元素时抛出 FileFormatException，
+    此时模型可能已被部分修补，应丢弃，
+    控制器因此只在临时导入的模型上应用差异。
+【参数】
+    model: 从基准文件导入的模型，之后为差异所描述的模型。
+    lineOrigins: 返回每个线段在基准文件中的下标。
+    faceOrigins: 返回每个面在基准文件中的下标。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void ModelDelta<N>::Apply(
+    Model<N>& model,
+    vector<size_t>& lineOrigins,
+    vector<size_t>& faceOrigins
+) const {
+    if (model.Lines.Count() != m_BaseLineCount ||
+        model.Faces.Count() != m_BaseFaceCount) {
+        throw FileFormatException();
+    }
+    Check(m_LineSegments, m_AddedLines.size(), m_BaseLineCount);
+    Check(m_FaceSegments, m_AddedFaces.size(), m_BaseFaceCount);
+    if (!TryPatch(model.Lines, m_LineSegments, m_AddedLines)) {
+        model.Lines = Join(model.Lines, m_LineSegments, m_AddedLines);
+    }
+    if (!TryPatch(model.Faces, m_FaceSegments, m_AddedFaces)) {
+        model.Faces = Join(model.Faces, m_FaceSegments, m_AddedFaces);
+    }
+    lineOrigins = GetOrigins(m_LineSegments);
+    faceOrigins = GetOrigins(m_FaceSegments);
+}
+
+/**********************************************************************
+【函数名称】 GetPath
+【函数功能】 获取基准文件旁差异文件的路径。
+【参数】
+    basePath: 基准文件所在路径。
+【返回值】
+    差异文件所在路径。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+string ModelDelta<N>::GetPath(const string& basePath) {
+    return basePath + ".delta";
+}
+
+/**********************************************************************
+【函数名称】 Split
+【函数功能】 按元素在基准文件中的下标将一个元素集合分为片段。
+【参数】
+    elements: 元素集合。
+    origins: 每个槽位中的元素在基准文件中的下标。
+    segments: 返回片段。
+    added: 返回新元素。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+template <typename E>
+void ModelDelta<N>::Split(
+    const HashedSet<E>& elements,
+    const vector<size_t>& origins,
+    vector<Segment>& segments,
+    vector<E>& added
+) {
+    segments.clear();
+    added.clear();
+    for (auto it = elements.begin(); it != elements.end(); ++it) {
+        auto origin = origins[it.GetSlot()];
+        if (origin == NO_ORIGIN) {
+            if (segments.empty()) {
+                segments.push_back({ 0, 0, 0 });
+            }
+            segments.back().AddedCount++;
+            added.push_back(*it);
+            continue;
+        }
+        // 紧接上一片段复制部分的元素并入该片段
+        if (!segments.empty() &&
+            segments.back().AddedCount == 0 &&
+            segments.back().First + segments.back().Count == origin) {
+            segments.back().Count++;
+        }
+        else {
+            segments.push_back({ origin, 1, 0 });
+        }
+    }
+}
+
+/**********************************************************************
+【函数名称】 Check
+【函数功能】
+    检查片段是否在基准文件的范围内且新元素数相符，
+    不符时抛出 FileFormatException。
+【参数】
+    segments: 片段。
+    addedCount: 新元素数。
+    baseCount: 基准文件中该类元素的个数。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void ModelDelta<N>::Check(
+    const vector<Segment>& segments,
+    uint64_t addedCount,
+    uint64_t baseCount
+) {
+    // 每段都不超过尚未用去的数量，累加不会回绕
+    uint64_t copied = 0;
+    uint64_t addedTotal = 0;
+    for (auto& segment: segments) {
+        if (segment.First > baseCount ||
+            segment.Count > baseCount - segment.First ||
+            segment.Count > baseCount - copied ||
+            segment.AddedCount > addedCount - addedTotal) {
+            throw FileFormatException();
+        }
+        copied += segment.Count;
+        addedTotal += segment.AddedCount;
+    }
+    if (addedTotal != addedCount) {
+        throw FileFormatException();
+    }
+}
+
+/**********************************************************************
+【函数名称】 GetOrigins
+【函数功能】 获取按片段拼接后每个元素在基准文件中的下标。
+【参数】
+    segments: 已检查的片段。
+【返回值】
+    每个元素在基准文件中的下标，新元素为 NO_ORIGIN。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+vector<size_t> ModelDelta<N>::GetOrigins(const vector<Segment>& segments) {
+    size_t total = 0;
+    for (auto& segment: segments) {
+        total += segment.Count + segment.AddedCount;
+    }
+    vector<size_t> origins;
+    origins.reserve(total);
+    for (auto& segment: segments) {
+        for (size_t i = 0; i < segment.Count; i++) {
+            origins.push_back(segment.First + i);
+        }
+        origins.insert(origins.end(), segment.AddedCount, NO_ORIGIN);
+    }
+    return origins;
+}
+
+/**********************************************************************
+【函数名称】 TryPatch
+【函数功能】
+    在基准元素集合上原地应用一类元素的差异。
+    复制部分不递增、中间插入的新元素超过 MAX_PATCH_INSERT_COUNT
+    或新元素与基准文件中的元素相同时不做修改并返回 false；
+    新元素之间重复时抛出 FileFormatException。
+【参数】
+    elements: 从基准文件导入的元素集合。
+    segments: 已检查的片段。
+    added: 新元素。
+【返回值】
+    是否已原地应用。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+template <typename E>
+bool ModelDelta<N>::TryPatch(
+    HashedSet<E>& elements,
+    const vector<Segment>& segments,
+    const vector<E>& added
+) {
+    // 片段 i 的新元素先顶替其复制部分之后、下一片段之前被删除的元素，
+    // 顶替不完的删除，多出的插入
+    uint64_t count = elements.Count();
+    uint64_t end = 0;
+    size_t insertCount = 0;
+    for (size_t i = 0; i < segments.size(); i++) {
+        if (segments[i].First < end) {
+            return false;
+        }
+        end = segments[i].First + segments[i].Count;
+        auto limit = i + 1 < segments.size() ? segments[i + 1].First : count;
+        if (limit < end) {
+            return false;
+        }
+        if (i + 1 < segments.size() && segments[i].AddedCount > limit - end) {
+            insertCount += segments[i].AddedCount - (limit - end);
+        }
+    }
+    if (insertCount > MAX_PATCH_INSERT_COUNT) {
+        return false;
+    }
+    for (auto& element: added) {
+        if (elements.Contains(element)) {
+            return false;
+        }
+    }
+    vector<bool> isKept(count, true);
+    bool hasRemoved = false;
+    auto first = segments.empty() ? count : segments.front().First;
+    for (uint64_t i = 0; i < first; i++) {
+        isKept[i] = false;
+        hasRemoved = true;
+    }
+    auto next = added.begin();
+    for (size_t i = 0; i < segments.size(); i++) {
+        end = segments[i].First + segments[i].Count;
+        auto limit = i + 1 < segments.size() ? segments[i + 1].First : count;
+        auto paired = min(segments[i].AddedCount, limit - end);
+        for (uint64_t j = 0; j < paired; j++) {
+            if (!elements.TrySet(end + j, *next++)) {
+                throw FileFormatException();
+            }
+        }
+        for (auto j = end + paired; j < limit; j++) {
+            isKept[j] = false;
+            hasRemoved = true;
+        }
+        next += segments[i].AddedCount - paired;
+    }
+    if (hasRemoved) {
+        elements.Retain(isKept);
+    }
+    // 删除后下标已连续，按最终位置依次插入多出的新元素，末尾的直接追加
+    elements.Reserve(elements.Count() + (added.end() - next));
+    uint64_t position = 0;
+    next = added.begin();
+    for (size_t i = 0; i < segments.size(); i++) {
+        end = segments[i].First + segments[i].Count;
+        auto limit = i + 1 < segments.size() ? segments[i + 1].First : count;
+        auto paired = min(segments[i].AddedCount, limit - end);
+        position += segments[i].Count + paired;
+        next += paired;
+        for (auto j = paired; j < segments[i].AddedCount; j++) {
+            auto isAdded = position == elements.Count() ?
+                elements.TryAdd(*next) : elements.TryInsert(position, *next);
+            next++;
+            if (!isAdded) {
+                throw FileFormatException();
+            }
+            position++;
+        }
+    }
+    return true;
+}
+
+/**********************************************************************
+【函数名称】 Join
+【函数功能】
+    按片段拼接基准文件中的元素与新元素，
+    有重复元素时抛出 FileFormatException。
+【参数】
+    base: 从基准文件导入的元素集合，不改变。
+    segments: 已检查的片段。
+    added: 新元素。
+【返回值】
+    拼接得到的元素集合。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+template <typename E>
+HashedSet<E> ModelDelta<N>::Join(
+    const HashedSet<E>& base,
+    const vector<Segment>& segments,
+    const vector<E>& added
+) {
+    size_t total = added.size();
+    for (auto& segment: segments) {
+        total += segment.Count;
+    }
+    vector<E> elements;
+    elements.reserve(total);
+    auto next = added.begin();
+    for (auto& segment: segments) {
+        for (size_t i = 0; i < segment.Count; i++) {
+            elements.push_back(base[segment.First + i]);
+        }
+        for (size_t i = 0; i < segment.AddedCount; i++) {
+            elements.push_back(*next++);
+        }
+    }
+    try {
+        return HashedSet<E>(move(elements));
+    }
+    catch (CollectionException) {
+        throw FileFormatException();
+    }
+}
+
+/**********************************************************************
+【函数名称】 WriteSection
+【函数功能】 写出一类元素的片段与新元素的坐标。
+【参数】
+    writer: 写入二进制流的格式化器。
+    segments: 片段。
+    added: 新元素。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+template <typename E>
+void ModelDelta<N>::WriteSection(
+    Tools::BufferedWriter& writer,
+    const vector<Segment>& segments,
+    const vector<E>& added
+) {
+    writer.Write(
+        reinterpret_cast<const char*>(segments.data()),
+        segments.size() * sizeof(Segment)
+    );
+    for (auto& element: added) {
+        for (auto& point: element.Points) {
+            for (size_t i = 0; i < N; i++) {
+                double coordinate = point[i];
+                writer.Write(
+                    reinterpret_cast<const char*>(&coordinate),
+                    sizeof(coordinate)
+                );
+            }
+        }
+    }
+}
+
+/**********************************************************************
+【函数名称】 ReadSection
+【函数功能】
+    读取一类元素的片段与新元素，并移动读取位置。
+    长度不足时抛出 FileFormatException，
+    新元素退化时抛出 CollectionException。
+【参数】
+    cursor: 读取位置。
+    remaining: 剩余的字节数。
+    segmentCount: 片段数。
+    addedCount: 新元素数。
+    segments: 返回片段。
+    added: 返回新元素。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+template <size_t S, typename E>
+void ModelDelta<N>::ReadSection(
+    const char*& cursor,
+    uint64_t& remaining,
+    uint64_t segmentCount,
+    uint64_t addedCount,
+    vector<Segment>& segments,
+    vector<E>& added
+) {
+    // 用除法比较数量，避免乘积溢出
+    if (segmentCount > remaining / sizeof(Segment)) {
+        throw FileFormatException();
+    }
+    segments.resize(segmentCount);
+    if (segmentCount != 0) {
+        memcpy(segments.data(), cursor, segmentCount * sizeof(Segment));
+    }
+    cursor += segmentCount * sizeof(Segment);
+    remaining -= segmentCount * sizeof(Segment);
+
+    const size_t elementSize = S * N * sizeof(double);
+    if (addedCount > remaining / elementSize) {
+        throw FileFormatException();
+    }
+    added.clear();
+    added.reserve(addedCount);
+    for (uint64_t i = 0; i < addedCount; i++) {
+        array<Point<N>, S> points;
+        for (size_t j = 0; j < S; j++) {
+            for (size_t k = 0; k < N; k++) {
+                double coordinate;
+                memcpy(&coordinate, cursor, sizeof(coordinate));
+                points[j][k] = coordinate;
+                cursor += sizeof(coordinate);
+            }
+        }
+        added.push_back(E(Element<N, S>(FixedSet<Point<N>, S>(points))));
+    }
+    remaining -= addedCount * elementSize;
+}
+
+}
+
+}
\ No newline at end of file
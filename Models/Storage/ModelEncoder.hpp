@@ -0,0 +1,138 @@
+/*************************************************************************
+【文件名】 ModelEncoder.hpp
+【功能模块和目的】 ModelEncoder 类定义了流式导出时将模型内容编码为字节的编码器。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "../Core/Face.hpp"
+#include "../Core/Line.hpp"
+#include "../Core/Point.hpp"
+using namespace std;
+using namespace C3w;
+
+namespace C3w {
+
+namespace Storage {
+
+/*************************************************************************
+【类名】 ModelEncoder
+【功能】
+    定义流式导出时的编码器，由 ExporterBase::CreateEncoder 创建，
+    供 ModelConverter 在不构造 Model 的情况下转换格式。
+    编码与写入分为两步，可以在两个线程中流水进行：
+    Encode 按内容顺序在同一线程中被调用，把一批内容编码为字节块；
+    Write 与 Finish 在另一线程中按相同顺序被调用，把字节块写入目标。
+    Encode 与 Write 不共享可变状态；Finish 在所有 Encode 与 Write
+    完成之后调用，可以读取两者留下的状态。
+【接口说明】 编码一批内容，写入一个字节块，完成输出。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+template <size_t N>
+class ModelEncoder {
+    public:
+        // 内嵌类型
+
+        /**********************************************************************
+        【类名】 Kind
+        【功能】 一批内容的类别。
+        【接口说明】 枚举。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        enum class Kind {
+            // 模型名称
+            NAME,
+            // 顶点
+            VERTICES,
+            // 线段
+            LINES,
+            // 面
+            FACES
+        };
+
+        /**********************************************************************
+        【类名】 Batch
+        【功能】
+            一批同类的模型内容，与 ModelVisitor 收到的一次调用对应。
+            顶点下标从 0 开始，引用的顶点总是已经先于元素出现。
+        【接口说明】 简单数据类型，无函数。只有与 Type 对应的成员有意义。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        struct Batch {
+            // 内容的类别
+            Kind Type;
+            // 模型名称
+            string Name;
+            // 本批首个顶点的下标
+            size_t FirstIndex;
+            // 顶点
+            vector<Point<N>> Vertices;
+            // 线段
+            vector<Line<N>> Lines;
+            // 每条线段两个端点的顶点下标
+            vector<array<size_t, 2>> LineIndices;
+            // 面
+            vector<Face<N>> Faces;
+            // 每个面三个顶点的顶点下标
+            vector<array<size_t, 3>> FaceIndices;
+        };
+
+        /**********************************************************************
+        【类名】 Chunk
+        【功能】 编码后的一块字节，以及它所属的输出段。
+        【接口说明】 简单数据类型，无函数。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        struct Chunk {
+            // 所属输出段的编号，含义由编码器决定
+            size_t Section;
+            // 编码后的字节
+            string Bytes;
+        };
+
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 Encode
+        【函数功能】
+            将一批内容编码为字节块。字节为空的块无需写入。
+            内容超出格式的限制时抛出相应的异常。
+        【参数】
+            batch: 一批内容。
+            chunk: 被赋值为编码后的字节块。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        virtual void Encode(const Batch& batch, Chunk& chunk) = 0;
+        /**********************************************************************
+        【函数名称】 Write
+        【函数功能】 写入一个字节块。写入失败时抛出 FileOpenException。
+        【参数】
+            chunk: 编码后的字节块。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        virtual void Write(const Chunk& chunk) = 0;
+        /**********************************************************************
+        【函数名称】 Finish
+        【函数功能】
+            所有字节块写入后完成输出。写入失败时抛出 FileOpenException。
+            出错中止时不会被调用，目标文件的内容此时没有意义。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        virtual void Finish() = 0;
+
+        // 虚析构函数
+        virtual ~ModelEncoder() = default;
+};
+
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,106 @@
+/*************************************************************************
+【文件名】 ModelVisitor.hpp
+【功能模块和目的】 ModelVisitor 类定义了流式导入时接收模型内容的访问者。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "../Core/Face.hpp"
+#include "../Core/Line.hpp"
+#include "../Core/Point.hpp"
+using namespace std;
+using namespace C3w;
+
+namespace C3w {
+
+namespace Storage {
+
+/*************************************************************************
+【类名】 ModelVisitor
+【功能】
+    定义流式导入时接收模型内容的访问者，见 ImporterBase::Stream。
+    顶点、线段与面按固定大小分批送达，每批处理完后即被丢弃，
+    访问者只需保留自己的累计结果，占用的内存与模型大小无关。
+    线段与面同时附带其顶点在文件中的下标（从 0 开始），
+    引用的顶点总是已经先于元素送达，可用于格式转换与过滤后重新导出。
+【接口说明】
+    接收名称、一批顶点、一批线段、一批面，以及结束通知。
+    所有函数默认什么都不做，子类只重写关心的部分。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+template <size_t N>
+class ModelVisitor {
+    public:
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 VisitName
+        【函数功能】 接收模型名称。可能被调用多次，以最后一次为准。
+        【参数】
+            name: 模型名称。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        virtual void VisitName(const string& name);
+        /**********************************************************************
+        【函数名称】 VisitVertices
+        【函数功能】 接收一批按文件顺序排列的顶点。
+        【参数】
+            firstIndex: 本批首个顶点在文件中的下标。
+            vertices: 本批顶点。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        virtual void VisitVertices(
+            size_t firstIndex,
+            const vector<Point<N>>& vertices
+        );
+        /**********************************************************************
+        【函数名称】 VisitLines
+        【函数功能】 接收一批按文件顺序排列的线段。
+        【参数】
+            lines: 本批线段。
+            indices: 每条线段两个端点在文件中的顶点下标。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        virtual void VisitLines(
+            const vector<Line<N>>& lines,
+            const vector<array<size_t, 2>>& indices
+        );
+        /**********************************************************************
+        【函数名称】 VisitFaces
+        【函数功能】 接收一批按文件顺序排列的面。
+        【参数】
+            faces: 本批面。
+            indices: 每个面三个顶点在文件中的顶点下标。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        virtual void VisitFaces(
+            const vector<Face<N>>& faces,
+            const vector<array<size_t, 3>>& indices
+        );
+        /**********************************************************************
+        【函数名称】 VisitEnd
+        【函数功能】 所有内容都已送达时被调用一次。出错时不会被调用。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        virtual void VisitEnd();
+
+        // 虚析构函数
+        virtual ~ModelVisitor() = default;
+};
+
+}
+
+}
+
+#include "ModelVisitor.tpp"
\ No newline at end of file
@@ -0,0 +1,90 @@
+/*************************************************************************
+【文件名】 ModelVisitor.tpp
+【功能模块和目的】 为 ModelVisitor.hpp 提供实现。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "../Core/Face.hpp"
+#include "../Core/Line.hpp"
+#include "../Core/Point.hpp"
+#include "ModelVisitor.hpp"
+using namespace std;
+using namespace C3w;
+
+namespace C3w {
+
+namespace Storage {
+
+/**********************************************************************
+【函数名称】 VisitName
+【函数功能】 接收模型名称。默认什么都不做。
+【参数】
+    name: 模型名称。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void ModelVisitor<N>::VisitName(const string& /* name */) {}
+
+/**********************************************************************
+【函数名称】 VisitVertices
+【函数功能】 接收一批按文件顺序排列的顶点。默认什么都不做。
+【参数】
+    firstIndex: 本批首个顶点在文件中的下标。
+    vertices: 本批顶点。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void ModelVisitor<N>::VisitVertices(
+    size_t /* firstIndex */,
+    const vector<Point<N>>& /* vertices */
+) {}
+
+/**********************************************************************
+【函数名称】 VisitLines
+【函数功能】 接收一批按文件顺序排列的线段。默认什么都不做。
+【参数】
+    lines: 本批线段。
+    indices: 每条线段两个端点在文件中的顶点下标。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void ModelVisitor<N>::VisitLines(
+    const vector<Line<N>>& /* lines */,
+    const vector<array<size_t, 2>>& /* indices */
+) {}
+
+/**********************************************************************
+【函数名称】 VisitFaces
+【函数功能】 接收一批按文件顺序排列的面。默认什么都不做。
+【参数】
+    faces: 本批面。
+    indices: 每个面三个顶点在文件中的顶点下标。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void ModelVisitor<N>::VisitFaces(
+    const vector<Face<N>>& /* faces */,
+    const vector<array<size_t, 3>>& /* indices */
+) {}
+
+/**********************************************************************
+【函数名称】 VisitEnd
+【函数功能】 所有内容都已送达时被调用一次。默认什么都不做。
+【参数】 无
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void ModelVisitor<N>::VisitEnd() {}
+
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,128 @@
+/*************************************************************************
+【文件名】 ObjEncoder.cpp
+【功能模块和目的】 为 ObjEncoder.hpp 提供实现。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include "../../Core/Errors.hpp"
+#include "ObjEncoder.hpp"
+using namespace std;
+using namespace C3w;
+using namespace C3w::Errors;
+using namespace C3w::Storage;
+
+namespace C3w {
+
+namespace Storage {
+
+namespace Obj {
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】
+    创建或清空指定的文件。
+    如果文件无法打开抛出 FileOpenException。
+【参数】
+    path: 文件所在路径。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+ObjEncoder::ObjEncoder(const string& path):
+    m_Stream(path, ios::trunc),
+    m_Writer(m_Text) {
+    if (!m_Stream.is_open()) {
+        throw FileOpenException();
+    }
+}
+
+/**********************************************************************
+【函数名称】 Encode
+【函数功能】 将一批内容编码为 .obj 文本。
+【参数】
+    batch: 一批内容。
+    chunk: 被赋值为编码后的文本。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+void ObjEncoder::Encode(const Batch& batch, Chunk& chunk) {
+    switch (batch.Type) {
+        case Kind::NAME:
+            m_Writer.Write("g ", 2);
+            m_Writer.Write(batch.Name);
+            m_Writer.Write('\n');
+            break;
+        case Kind::VERTICES:
+            for (auto& point: batch.Vertices) {
+                m_Writer.Write('v');
+                for (size_t i = 0; i < 3; i++) {
+                    m_Writer.Write("  ", 2);
+                    m_Writer.WriteDouble(point[i]);
+                }
+                m_Writer.Write('\n');
+            }
+            break;
+        case Kind::LINES:
+            for (auto& indices: batch.LineIndices) {
+                m_Writer.Write('l');
+                for (auto index: indices) {
+                    m_Writer.Write("  ", 2);
+                    m_Writer.WriteUnsigned(uint64_t(index) + 1);
+                }
+                m_Writer.Write('\n');
+            }
+            break;
+        case Kind::FACES:
+            for (auto& indices: batch.FaceIndices) {
+                m_Writer.Write('f');
+                for (auto index: indices) {
+                    m_Writer.Write("  ", 2);
+                    m_Writer.WriteUnsigned(uint64_t(index) + 1);
+                }
+                m_Writer.Write('\n');
+            }
+            break;
+    }
+    m_Writer.Flush();
+    chunk.Section = 0;
+    chunk.Bytes = m_Text.str();
+    m_Text.str(string());
+}
+
+/**********************************************************************
+【函数名称】 Write
+【函数功能】 将文本追加到文件中。写入失败时抛出 FileOpenException。
+【参数】
+    chunk: 编码后的文本。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+void ObjEncoder::Write(const Chunk& chunk) {
+    m_Stream.write(chunk.Bytes.data(), chunk.Bytes.size());
+    if (!m_Stream) {
+        throw FileOpenException();
+    }
+}
+
+/**********************************************************************
+【函数名称】 Finish
+【函数功能】 刷新并关闭文件。写入失败时抛出 FileOpenException。
+【参数】 无
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+void ObjEncoder::Finish() {
+    m_Stream.close();
+    if (!m_Stream) {
+        throw FileOpenException();
+    }
+}
+
+}
+
+}
+
+}
\ No newline at end of file
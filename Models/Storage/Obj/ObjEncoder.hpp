@@ -0,0 +1,98 @@
+/*************************************************************************
+【文件名】 ObjEncoder.hpp
+【功能模块和目的】 ObjEncoder 类定义了流式导出 .obj 文件的编码器。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#pragma once
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include "../ModelEncoder.hpp"
+#include "../../Tools/BufferedWriter.hpp"
+using namespace std;
+using namespace C3w;
+using namespace C3w::Storage;
+
+namespace C3w {
+
+namespace Storage {
+
+namespace Obj {
+
+/*************************************************************************
+【类名】 ObjEncoder
+【功能】
+    将模型内容按与 ObjExporter 相同的格式编码为 .obj 文本，
+    并按顺序追加到文件中。顶点按收到的顺序输出，下标从 1 开始。
+【接口说明】 实现 ModelEncoder 的接口。禁止复制 / 拷贝。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+class ObjEncoder final: public ModelEncoder<3> {
+    public:
+        // 构造函数
+
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】
+            创建或清空指定的文件。
+            如果文件无法打开抛出 FileOpenException。
+        【参数】
+            path: 文件所在路径。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        ObjEncoder(const string& path);
+        // 禁止拷贝
+        ObjEncoder(const ObjEncoder&) = delete;
+
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 Encode
+        【函数功能】 将一批内容编码为 .obj 文本。
+        【参数】
+            batch: 一批内容。
+            chunk: 被赋值为编码后的文本。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void Encode(const Batch& batch, Chunk& chunk) override;
+        /**********************************************************************
+        【函数名称】 Write
+        【函数功能】 将文本追加到文件中。写入失败时抛出 FileOpenException。
+        【参数】
+            chunk: 编码后的文本。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void Write(const Chunk& chunk) override;
+        /**********************************************************************
+        【函数名称】 Finish
+        【函数功能】 刷新并关闭文件。写入失败时抛出 FileOpenException。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void Finish() override;
+
+        // 操作符
+
+        // 禁止赋值
+        ObjEncoder& operator=(const ObjEncoder&) = delete;
+
+    private:
+        // 输出的文件，仅在写入线程中使用
+        ofstream m_Stream;
+        // 编码文本的缓冲，仅在编码线程中使用
+        ostringstream m_Text;
+        // 向 m_Text 写入的格式化器
+        Tools::BufferedWriter m_Writer;
+};
+
+}
+
+}
+
+}
\ No newline at end of file
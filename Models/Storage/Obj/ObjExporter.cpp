@@ -4,12 +4,20 @@
 【开发者及日期】 赵一彤 2024/7/24
 *************************************************************************/
 
+#include <cstddef>
+#include <cstdint>
 #include <fstream>
+#include <memory>
+#include <string>
+#include "../../Core/IndexedModel.hpp"
 #include "../../Core/Model.hpp"
+#include "ObjEncoder.hpp"
 #include "ObjExporter.hpp"
+#include "../../Tools/BufferedWriter.hpp"
 using namespace std;
 using namespace C3w;
 using namespace C3w::Storage;
+using namespace C3w::Tools;
 
 namespace C3w {
 
@@ -30,33 +38,59 @@ void ObjExporter::InnerExport(
     ofstream& stream,
     const Model<3>& model
 ) const {
-    stream << "g " << model.Name << endl;
-    
-    auto points = model.CollectPoints();
-    for (auto& point: points) {
-        stream << "v";
-        stream << "  " << point[0];
-        stream << "  " << point[1];
-        stream << "  " << point[2] << endl;
+    // 先转化为索引形式，顶点下标直接可得，整个导出为线性复杂度
+    IndexedModel<3> indexed(model);
+    indexed.ReleaseLookup();
+
+    // 攒满大块缓冲区后再写入，不再逐行 endl 刷新
+    BufferedWriter writer(stream);
+    writer.Write("g ", 2);
+    writer.Write(model.Name);
+    writer.Write('\n');
+    for (auto& point: indexed.GetVertices()) {
+        writer.Write('v');
+        for (size_t i = 0; i < 3; i++) {
+            writer.Write("  ", 2);
+            writer.WriteDouble(point[i]);
+        }
+        writer.Write('\n');
     }
 
-    for (auto& line: model.Lines) {
-        stream << "l";
-        for (auto& point: line.Points) {
-            stream << "  ";
-            stream << points.FindIndex(point) + 1;
+    for (auto& indices: indexed.GetLineIndices()) {
+        writer.Write('l');
+        for (auto index: indices) {
+            writer.Write("  ", 2);
+            writer.WriteUnsigned(uint64_t(index) + 1);
         }
-        stream << endl;
+        writer.Write('\n');
     }
 
-    for (auto& face: model.Faces) {
-        stream << "f";
-        for (auto& point: face.Points) {
-            stream << "  ";
-            stream << points.FindIndex(point) + 1;
+    for (auto& indices: indexed.GetFaceIndices()) {
+        writer.Write('f');
+        for (auto index: indices) {
+            writer.Write("  ", 2);
+            writer.WriteUnsigned(uint64_t(index) + 1);
         }
-        stream << endl;
+        writer.Write('\n');
     }
+    writer.Flush();
+}
+
+/**********************************************************************
+【函数名称】 InnerCreateEncoder
+【函数功能】
+    创建流式导出到指定文件的 ObjEncoder。
+    如果文件无法打开抛出 FileOpenException。
+【参数】
+    path: 文件所在路径。
+【返回值】
+    编码器。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+unique_ptr<ModelEncoder<3>> ObjExporter::InnerCreateEncoder(
+    const string& path
+) const {
+    return unique_ptr<ModelEncoder<3>>(new ObjEncoder(path));
 }
 
 }
@@ -7,7 +7,10 @@
 #pragma once
 
 #include <fstream>
+#include <memory>
+#include <string>
 #include "../ExporterBase.hpp"
+#include "../ModelEncoder.hpp"
 #include "../../Core/Model.hpp"
 using namespace std;
 using namespace C3w;
@@ -22,7 +25,7 @@ namespace Obj {
 /*************************************************************************
 【类名】 ObjExporter
 【功能】 定义一个 .obj 文件的导出器。
-【接口说明】 导出至指定的文件。
+【接口说明】 导出至指定的文件，或创建流式导出的 ObjEncoder。
 【开发者及日期】 赵一彤 2024/7/24
 *************************************************************************/
 class ObjExporter: public ExporterBase<3> {
@@ -40,6 +43,20 @@ class ObjExporter: public ExporterBase<3> {
             ofstream& stream, 
             const Model<3>& model
         ) const override;
+        /**********************************************************************
+        【函数名称】 InnerCreateEncoder
+        【函数功能】
+            创建流式导出到指定文件的 ObjEncoder。
+            如果文件无法打开抛出 FileOpenException。
+        【参数】
+            path: 文件所在路径。
+        【返回值】
+            编码器。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        unique_ptr<ModelEncoder<3>> InnerCreateEncoder(
+            const string& path
+        ) const override;
 };
 
 }
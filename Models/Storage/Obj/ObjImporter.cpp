@@ -4,19 +4,21 @@
 【开发者及日期】 赵一彤 2024/7/24
 *************************************************************************/
 
+#include <cstddef>
 #include <fstream>
-#include <sstream>
+#include <iterator>
 #include <string>
-#include <vector>
 #include "ObjImporter.hpp"
+#include "ObjParser.hpp"
 #include "../../Core/Errors.hpp"
 #include "../../Core/Model.hpp"
-#include "../../Core/Point.hpp"
-#include "../../Core/Line.hpp"
-#include "../../Core/Face.hpp"
+#include "../ModelBatcher.hpp"
+#include "../../Tools/MappedFile.hpp"
+#include "../../Tools/Parallel.hpp"
 using namespace std;
 using namespace C3w;
 using namespace C3w::Errors;
+using namespace C3w::Tools;
 
 namespace C3w {
 
@@ -24,6 +26,42 @@ namespace Storage {
 
 namespace Obj {
 
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 使用解析线程数初始化 ObjImporter 类型实例。
+【参数】
+    threadCount: 解析所用的线程数，为 0 时使用全部硬件线程。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+ObjImporter::ObjImporter(size_t threadCount): m_ThreadCount(
+    threadCount == 0 ? Parallel::GetDefaultThreadCount() : threadCount
+) {}
+
+/**********************************************************************
+【函数名称】 InnerImportFile
+【函数功能】
+    将文件映射到内存后原地解析到模型中。
+    如果文件无法打开抛出 FileOpenException。
+【参数】 
+    path: 文件所在路径。
+    model: 模型的可变引用。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+void ObjImporter::InnerImportFile(
+    const string& path,
+    Model<3>& model
+) const {
+    MappedFile file(path);
+    ObjParser::ParseParallel(
+        file.GetData(),
+        file.GetData() + file.GetSize(),
+        model,
+        m_ThreadCount
+    );
+}
+
 /**********************************************************************
 【函数名称】 InnerImport
 【函数功能】 导入指定文件流到模型中。
@@ -34,77 +72,40 @@ namespace Obj {
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 void ObjImporter::InnerImport(ifstream& stream, Model<3>& model) const {
-    vector<Point<3>> points;
-    while (!stream.eof()) {
-        string line;
-        getline(stream, line);
-        if (line.empty()) continue;
-
-        istringstream lineStream(line);
+    // 流无法映射，一次性读入后同样交给 ObjParser 解析
+    string buffer {
+        istreambuf_iterator<char>(stream),
+        istreambuf_iterator<char>()
+    };
+    ObjParser::ParseParallel(
+        buffer.data(),
+        buffer.data() + buffer.size(),
+        model,
+        m_ThreadCount
+    );
+}
 
-        char kind;
-        lineStream >> kind;
-        switch (kind) {
-            case '#': {
-                break;
-            }
-            case 'g': {
-                lineStream.ignore();
-                getline(lineStream, model.Name);
-                break;
-            }
-            case 'v': {
-                double x;
-                double y;
-                double z;
-                lineStream >> x >> y >> z;
-                if (lineStream.bad()) {
-                    throw FileFormatException();
-                }
-                points.push_back(Point<3> { x, y, z });
-                break;
-            }
-            case 'l': {
-                double p1;
-                double p2;
-                lineStream >> p1 >> p2;
-                if (lineStream.bad()) {
-                    throw FileFormatException();
-                }
-                if (
-                    (p1 == 0 || p1 > points.size()) ||
-                    (p2 == 0 || p2 > points.size())
-                ) {
-                    throw IndexOverflowException();
-                }
-                model.Lines.Add(Line<3> { points[p1-1], points[p2-1] });
-                break;
-            }
-            case 'f': {
-                double p1;
-                double p2;
-                double p3;
-                lineStream >> p1 >> p2 >> p3;
-                if (lineStream.bad()) {
-                    throw FileFormatException();
-                }
-                if (
-                    (p1 == 0 || p1 > points.size()) ||
-                    (p2 == 0 || p2 > points.size()) ||
-                    (p3 == 0 || p3 > points.size())
-                ) {
-                    throw IndexOverflowException();
-                }
-                model.Faces.Add(
-                    Face<3> { points[p1-1], points[p2-1], points[p3-1] }
-                );
-                break;
-            }
-            default: {
-                throw FileFormatException();
-            }
-        }
+/**********************************************************************
+【函数名称】 InnerStreamFile
+【函数功能】
+    逐块读取文件，由 ObjParser::ParseStream 边解析边送出内容。
+    如果文件无法打开抛出 FileOpenException。
+【参数】
+    path: 文件所在路径。
+    batcher: 将内容分批交给访问者的 ModelBatcher。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+void ObjImporter::InnerStreamFile(
+    const string& path,
+    ModelBatcher<3>& batcher
+) const {
+    // 与映射文件时一样按原始字节读取，不转换换行符
+    ifstream stream(path, ios::in | ios::binary);
+    if (!stream.is_open()) {
+        throw FileOpenException();
     }
+    ObjParser::ParseStream(stream, batcher);
 }
 
 }
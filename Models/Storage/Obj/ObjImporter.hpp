@@ -6,8 +6,11 @@
 
 #pragma once
 
+#include <cstddef>
 #include <fstream>
+#include <string>
 #include "../ImporterBase.hpp"
+#include "../ModelBatcher.hpp"
 #include "../../Core/Model.hpp"
 using namespace std;
 using namespace C3w;
@@ -21,12 +24,43 @@ namespace Obj {
 
 /*************************************************************************
 【类名】 ObjImporter
-【功能】 定义一个 .obj 文件的导入器。
-【接口说明】 导入指定的文件。
+【功能】
+    定义一个 .obj 文件的导入器。
+    文件被映射到内存中，由 ObjParser 原地、多线程地解析。
+    流式导入时逐块读取文件，占用的内存与文件大小无关。
+【接口说明】 导入指定的文件，或流式地读取指定的文件。
 【开发者及日期】 赵一彤 2024/7/24
 *************************************************************************/
 class ObjImporter: public ImporterBase<3> {
+    public:
+        // 构造函数
+
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 使用解析线程数初始化 ObjImporter 类型实例。
+        【参数】
+            threadCount: 解析所用的线程数，为 0 时使用全部硬件线程。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        ObjImporter(size_t threadCount = 0);
+
     protected:
+        /**********************************************************************
+        【函数名称】 InnerImportFile
+        【函数功能】
+            将文件映射到内存后原地解析到模型中。
+            如果文件无法打开抛出 FileOpenException。
+        【参数】 
+            path: 文件所在路径。
+            model: 模型的可变引用。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void InnerImportFile(
+            const string& path,
+            Model<3>& model
+        ) const override;
         /**********************************************************************
         【函数名称】 InnerImport
         【函数功能】 导入指定文件流到模型中。
@@ -37,6 +71,25 @@ class ObjImporter: public ImporterBase<3> {
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
         void InnerImport(ifstream& stream, Model<3>& model) const override;
+        /**********************************************************************
+        【函数名称】 InnerStreamFile
+        【函数功能】
+            逐块读取文件，由 ObjParser::ParseStream 边解析边送出内容。
+            如果文件无法打开抛出 FileOpenException。
+        【参数】
+            path: 文件所在路径。
+            batcher: 将内容分批交给访问者的 ModelBatcher。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void InnerStreamFile(
+            const string& path,
+            ModelBatcher<3>& batcher
+        ) const override;
+
+    private:
+        // 解析所用的线程数
+        size_t m_ThreadCount;
 };
 
 }
@@ -0,0 +1,848 @@
+/*************************************************************************
+【文件名】 ObjParser.cpp
+【功能模块和目的】 为 ObjParser.hpp 提供实现。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <istream>
+#include <limits>
+#include <string>
+#include <vector>
+#include "ObjParser.hpp"
+#include "../../Core/Errors.hpp"
+#include "../../Core/Face.hpp"
+#include "../../Core/Line.hpp"
+#include "../../Core/Model.hpp"
+#include "../../Core/Point.hpp"
+#include "../../Tools/Parallel.hpp"
+#include "../../Tools/SpillVector.hpp"
+#include "../ModelBatcher.hpp"
+using namespace std;
+using namespace C3w;
+using namespace C3w::Errors;
+using namespace C3w::Tools;
+
+namespace C3w {
+
+namespace Storage {
+
+namespace Obj {
+
+// 可精确表示的十的幂
+static const double POWERS_OF_TEN[] {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+    1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+    1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+// uint64_t 能无损容纳的十进制位数
+static const int MAX_MANTISSA_DIGITS { 19 };
+
+// 小于此字节数的缓冲区不值得多线程解析
+static const size_t MIN_PARALLEL_SIZE { 1 << 20 };
+
+// 流式解析时每次从流中读取的字节数
+static const size_t STREAM_BLOCK_SIZE { 1 << 20 };
+
+/**********************************************************************
+【函数名称】 Parse
+【函数功能】
+    解析 [begin, end) 中的 .obj 文本到模型中。
+    格式错误时抛出带行号的 FileFormatException，
+    顶点下标无效时抛出带行号的 IndexOverflowException，
+    有重复元素时抛出 CollectionException。
+    出错时模型中保留出错位置之前的元素。
+【参数】
+    begin: 缓冲区首地址。
+    end: 缓冲区尾后地址。
+    model: 模型的可变引用。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+void ObjParser::Parse(const char* begin, const char* end, Model<3>& model) {
+    // 预先数出记录个数，避免逐个添加时反复扩容与重建索引
+    size_t vertexCount;
+    size_t lineCount;
+    size_t faceCount;
+    CountRecords(begin, end, vertexCount, lineCount, faceCount);
+    model.Lines.Reserve(model.Lines.Count() + lineCount);
+    model.Faces.Reserve(model.Faces.Count() + faceCount);
+    vector<Point<3>> points;
+    points.reserve(vertexCount);
+    size_t lineNumber = 0;
+    ParseLines(begin, end, model, points, lineNumber);
+}
+
+/**********************************************************************
+【函数名称】 ParseParallel
+【函数功能】
+    在换行处将缓冲区分块，多线程解析并构造元素、计算哈希值，
+    再按文件顺序合并到模型中。哈希索引只有一个，
+    合并时的去重与插入仍是串行的，但不再计算哈希值。
+    结果与异常（包括行号及出错时模型的状态）都与 Parse 完全一致：
+    合并第一个出错的块之前的各块后，只串行解析该块以定位错误。
+【参数】
+    begin: 缓冲区首地址。
+    end: 缓冲区尾后地址。
+    model: 模型的可变引用。
+    threadCount: 线程数，为 1 或缓冲区较小时直接调用 Parse。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+void ObjParser::ParseParallel(
+    const char* begin,
+    const char* end,
+    Model<3>& model,
+    size_t threadCount
+) {
+    size_t size = end - begin;
+    if (threadCount <= 1 || size < MIN_PARALLEL_SIZE) {
+        Parse(begin, end, model);
+        return;
+    }
+
+    // 在名义分界之后的第一个换行处切分
+    vector<Chunk> chunks(threadCount);
+    const char* chunkBegin = begin;
+    for (size_t i = 0; i < threadCount; i++) {
+        const char* chunkEnd = end;
+        if (i + 1 < threadCount) {
+            chunkEnd = begin + size / threadCount * (i + 1);
+            if (chunkEnd < chunkBegin) {
+                chunkEnd = chunkBegin;
+            }
+            chunkEnd = FindLineEnd(chunkEnd, end);
+            if (chunkEnd != end) {
+                ++chunkEnd;
+            }
+        }
+        chunks[i].Begin = chunkBegin;
+        chunks[i].End = chunkEnd;
+        chunks[i].RequiredVertexCount = 0;
+        chunks[i].LineCount = 0;
+        chunks[i].IsFailed = false;
+        chunkBegin = chunkEnd;
+    }
+    Parallel::For(chunks.size(), [&chunks](size_t i) {
+        ParseChunk(chunks[i]);
+    });
+
+    // 前缀和：每块的顶点编号接在之前所有块之后，找到第一个出错的块
+    size_t vertexCount = 0;
+    size_t failed = chunks.size();
+    for (size_t i = 0; i < chunks.size(); i++) {
+        auto& chunk = chunks[i];
+        if (chunk.IsFailed || chunk.RequiredVertexCount > vertexCount) {
+            failed = i;
+            break;
+        }
+        vertexCount += chunk.Vertices.size();
+    }
+    vector<Point<3>> points;
+    points.reserve(vertexCount);
+    for (size_t i = 0; i < failed; i++) {
+        auto& vertices = chunks[i].Vertices;
+        points.insert(points.end(), vertices.begin(), vertices.end());
+        vector<Point<3>>().swap(vertices);
+    }
+    Parallel::For(failed, [&chunks, &points](size_t i) {
+        BuildElements(chunks[i], points);
+    });
+    if (failed == chunks.size()) {
+        vector<Point<3>>().swap(points);
+    }
+
+    // 各块的元素个数已知，合并前一次性预留元素与索引的空间
+    size_t lineCount = model.Lines.Count();
+    size_t faceCount = model.Faces.Count();
+    for (size_t i = 0; i < failed; i++) {
+        lineCount += chunks[i].Lines.size();
+        faceCount += chunks[i].Faces.size();
+    }
+    model.Lines.Reserve(lineCount);
+    model.Faces.Reserve(faceCount);
+
+    // 按文件顺序合并，重复元素在与串行解析相同的位置抛出异常
+    size_t lineNumber = 0;
+    for (size_t i = 0; i < failed; i++) {
+        auto& chunk = chunks[i];
+        size_t line = 0;
+        size_t face = 0;
+        for (auto& entry: chunk.Entries) {
+            switch (entry.Kind) {
+                case 'g': {
+                    const char* name = chunk.Begin + entry.Values[0];
+                    model.Name.assign(name, name + entry.Values[1]);
+                    break;
+                }
+                case 'l': {
+                    if (!model.Lines.TryAddHashed(
+                        move(chunk.Lines[line]), chunk.LineHashes[line]
+                    )) {
+                        throw CollectionException();
+                    }
+                    line++;
+                    break;
+                }
+                case 'f': {
+                    if (!model.Faces.TryAddHashed(
+                        move(chunk.Faces[face]), chunk.FaceHashes[face]
+                    )) {
+                        throw CollectionException();
+                    }
+                    face++;
+                    break;
+                }
+            }
+        }
+        lineNumber += chunk.LineCount;
+        // 合并完的块立即释放，峰值内存只多出一块的元素
+        vector<Entry>().swap(chunk.Entries);
+        vector<Line<3>>().swap(chunk.Lines);
+        vector<Face<3>>().swap(chunk.Faces);
+        vector<size_t>().swap(chunk.LineHashes);
+        vector<size_t>().swap(chunk.FaceHashes);
+    }
+
+    // 出错的块之前的内容已合并，从该块开头串行解析即得到同一个异常
+    if (failed < chunks.size()) {
+        auto& chunk = chunks[failed];
+        ParseLines(chunk.Begin, chunk.End, model, points, lineNumber);
+        // 两处对错误的判定一致，不会执行到这里
+        throw FileFormatException(lineNumber);
+    }
+}
+
+/**********************************************************************
+【函数名称】 ParseStream
+【函数功能】
+    逐块读取输入流中的 .obj 文本，将顶点、线段与面
+    依次添加到 batcher 中，不构造 Model，也不检查重复元素。
+    顶点表存放在 SpillVector 中，超出内存上限的部分写入临时文件，
+    占用的内存与文件大小无关。
+    格式错误、下标无效与点重合时的异常及行号与 Parse 相同，
+    读取失败时抛出 FileOpenException。
+【参数】
+    stream: 已经打开的输入流。
+    batcher: 将内容分批交给访问者的 ModelBatcher。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+void ObjParser::ParseStream(istream& stream, ModelBatcher<3>& batcher) {
+    SpillVector<Point<3>> points;
+    vector<char> buffer(STREAM_BLOCK_SIZE);
+    // 缓冲区开头上一块留下的不完整行的字节数
+    size_t carried = 0;
+    size_t lineNumber = 0;
+    bool isEnd = false;
+    while (!isEnd) {
+        // 一行比整个缓冲区还长时扩大缓冲区
+        if (carried == buffer.size()) {
+            buffer.resize(buffer.size() * 2);
+        }
+        stream.read(buffer.data() + carried, buffer.size() - carried);
+        if (stream.bad()) {
+            throw FileOpenException();
+        }
+        size_t size = carried + static_cast<size_t>(stream.gcount());
+        isEnd = !stream;
+        const char* begin = buffer.data();
+        const char* end = begin + size;
+        // 只解析到最后一个换行符为止，剩余部分留给下一块
+        const char* blockEnd = end;
+        if (!isEnd) {
+            while (blockEnd != begin && blockEnd[-1] != '\n') {
+                --blockEnd;
+            }
+        }
+        ParseBlock(begin, blockEnd, points, batcher, lineNumber);
+        carried = end - blockEnd;
+        memmove(buffer.data(), blockEnd, carried);
+    }
+}
+
+/**********************************************************************
+【函数名称】 ParseRecord
+【函数功能】 解析 [it, lineEnd) 中的一行记录。
+【参数】
+    it: 行首地址。
+    lineEnd: 行尾地址，不含换行符。
+    record: 被赋值为解析结果。
+【返回值】
+    是否没有格式错误。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+bool ObjParser::ParseRecord(
+    const char* it,
+    const char* lineEnd,
+    Record& record
+) {
+    SkipSpaces(it, lineEnd);
+    if (it == lineEnd) {
+        record.Kind = '\0';
+        return true;
+    }
+    record.Kind = *it++;
+    // 与原先的流式导入一致，忽略行尾多余的内容
+    switch (record.Kind) {
+        case '#': {
+            record.Kind = '\0';
+            return true;
+        }
+        case 'g': {
+            if (it != lineEnd && IsSpace(*it)) {
+                ++it;
+            }
+            const char* nameEnd = lineEnd;
+            if (nameEnd != it && *(nameEnd - 1) == '\r') {
+                --nameEnd;
+            }
+            record.NameBegin = it;
+            record.NameEnd = nameEnd;
+            return true;
+        }
+        case 'v': {
+            return
+                ScanDouble(it, lineEnd, record.Coordinates[0]) &&
+                ScanDouble(it, lineEnd, record.Coordinates[1]) &&
+                ScanDouble(it, lineEnd, record.Coordinates[2]);
+        }
+        case 'l': {
+            return
+                ScanIndex(it, lineEnd, record.Indices[0]) &&
+                ScanIndex(it, lineEnd, record.Indices[1]);
+        }
+        case 'f': {
+            return
+                ScanIndex(it, lineEnd, record.Indices[0]) &&
+                ScanIndex(it, lineEnd, record.Indices[1]) &&
+                ScanIndex(it, lineEnd, record.Indices[2]);
+        }
+        default: {
+            return false;
+        }
+    }
+}
+
+/**********************************************************************
+【函数名称】 ParseLines
+【函数功能】
+    逐行解析 [begin, end) 中的 .obj 文本到模型中，
+    异常与 Parse 相同。
+【参数】
+    begin: 首行的首地址。
+    end: 尾后地址。
+    model: 模型的可变引用。
+    points: 之前读到的全部顶点，会追加本段的顶点。
+    lineNumber: 之前的行数，会被增加本段的行数。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+void ObjParser::ParseLines(
+    const char* begin,
+    const char* end,
+    Model<3>& model,
+    vector<Point<3>>& points,
+    size_t& lineNumber
+) {
+    Record record;
+    const char* it = begin;
+    while (it != end) {
+        const char* lineEnd = FindLineEnd(it, end);
+        lineNumber++;
+        if (!ParseRecord(it, lineEnd, record)) {
+            throw FileFormatException(lineNumber);
+        }
+        it = lineEnd == end ? end : lineEnd + 1;
+        switch (record.Kind) {
+            case 'g': {
+                model.Name.assign(record.NameBegin, record.NameEnd);
+                break;
+            }
+            case 'v': {
+                points.push_back(Point<3> {
+                    record.Coordinates[0],
+                    record.Coordinates[1],
+                    record.Coordinates[2]
+                });
+                break;
+            }
+            case 'l':
+            case 'f': {
+                size_t count = record.Kind == 'l' ? 2 : 3;
+                for (size_t i = 0; i < count; i++) {
+                    if (
+                        record.Indices[i] == 0 ||
+                        record.Indices[i] > points.size()
+                    ) {
+                        throw IndexOverflowException(lineNumber);
+                    }
+                }
+                auto& indices = record.Indices;
+                if (record.Kind == 'l') {
+                    model.Lines.Add(
+                        Line<3> { points[indices[0] - 1], points[indices[1] - 1] }
+                    );
+                }
+                else {
+                    model.Faces.Add(Face<3> {
+                        points[indices[0] - 1],
+                        points[indices[1] - 1],
+                        points[indices[2] - 1]
+                    });
+                }
+                break;
+            }
+        }
+    }
+}
+
+/**********************************************************************
+【函数名称】 ParseChunk
+【函数功能】
+    解析一块文本中的记录并计数行数，不检查下标是否超出顶点总数，
+    只记录块前至少需要多少个顶点。遇到错误时标记并停止。
+【参数】
+    chunk: 要解析的块。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+void ObjParser::ParseChunk(Chunk& chunk) {
+    Record record;
+    const char* it = chunk.Begin;
+    while (it != chunk.End) {
+        const char* lineEnd = FindLineEnd(it, chunk.End);
+        chunk.LineCount++;
+        if (!ParseRecord(it, lineEnd, record)) {
+            chunk.IsFailed = true;
+            return;
+        }
+        it = lineEnd == chunk.End ? chunk.End : lineEnd + 1;
+        switch (record.Kind) {
+            case 'g': {
+                chunk.Entries.push_back(Entry { 'g', {
+                    static_cast<uint64_t>(record.NameBegin - chunk.Begin),
+                    static_cast<uint64_t>(record.NameEnd - record.NameBegin),
+                    0
+                } });
+                break;
+            }
+            case 'v': {
+                chunk.Vertices.push_back(Point<3> {
+                    record.Coordinates[0],
+                    record.Coordinates[1],
+                    record.Coordinates[2]
+                });
+                break;
+            }
+            case 'l':
+            case 'f': {
+                size_t count = record.Kind == 'l' ? 2 : 3;
+                Entry entry { record.Kind, { 0, 0, 0 } };
+                for (size_t i = 0; i < count; i++) {
+                    auto index = record.Indices[i];
+                    if (index == 0) {
+                        chunk.IsFailed = true;
+                        return;
+                    }
+                    // 超出块内已有顶点的下标须由之前的块提供
+                    auto local = chunk.Vertices.size();
+                    if (index > local) {
+                        chunk.RequiredVertexCount = max(
+                            chunk.RequiredVertexCount,
+                            index - local
+                        );
+                    }
+                    entry.Values[i] = index;
+                }
+                chunk.Entries.push_back(entry);
+                break;
+            }
+        }
+    }
+}
+
+/**********************************************************************
+【函数名称】 BuildElements
+【函数功能】 由块中的记录与全部顶点构造线段与面，并计算其哈希值。
+【参数】
+    chunk: 已解析且下标有效的块。
+    points: 全部顶点。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+void ObjParser::BuildElements(
+    Chunk& chunk,
+    const vector<Point<3>>& points
+) {
+    size_t lineCount = 0;
+    for (auto& entry: chunk.Entries) {
+        lineCount += entry.Kind == 'l';
+    }
+    chunk.Lines.reserve(lineCount);
+    chunk.Faces.reserve(chunk.Entries.size() - lineCount);
+    chunk.LineHashes.reserve(lineCount);
+    chunk.FaceHashes.reserve(chunk.Entries.size() - lineCount);
+    for (auto& entry: chunk.Entries) {
+        auto& indices = entry.Values;
+        if (entry.Kind == 'l') {
+            chunk.Lines.push_back(
+                Line<3> { points[indices[0] - 1], points[indices[1] - 1] }
+            );
+            chunk.LineHashes.push_back(hash<Line<3>>()(chunk.Lines.back()));
+        }
+        else if (entry.Kind == 'f') {
+            chunk.Faces.push_back(Face<3> {
+                points[indices[0] - 1],
+                points[indices[1] - 1],
+                points[indices[2] - 1]
+            });
+            chunk.FaceHashes.push_back(hash<Face<3>>()(chunk.Faces.back()));
+        }
+    }
+}
+
+/**********************************************************************
+【函数名称】 ParseBlock
+【函数功能】
+    解析 [begin, end) 中的完整行，将内容添加到 batcher 中，
+    顶点同时追加到 points 以供后续的线段与面引用。
+【参数】
+    begin: 块首地址。
+    end: 块尾后地址，最后一行可以没有换行符。
+    points: 已读到的全部顶点。
+    batcher: 将内容分批交给访问者的 ModelBatcher。
+    lineNumber: 块前的行数，会被增加块中的行数。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+void ObjParser::ParseBlock(
+    const char* begin,
+    const char* end,
+    SpillVector<Point<3>>& points,
+    ModelBatcher<3>& batcher,
+    size_t& lineNumber
+) {
+    Record record;
+    const char* it = begin;
+    while (it != end) {
+        const char* lineEnd = FindLineEnd(it, end);
+        lineNumber++;
+        if (!ParseRecord(it, lineEnd, record)) {
+            throw FileFormatException(lineNumber);
+        }
+        it = lineEnd == end ? end : lineEnd + 1;
+        switch (record.Kind) {
+            case 'g': {
+                batcher.AddName(string(record.NameBegin, record.NameEnd));
+                break;
+            }
+            case 'v': {
+                Point<3> point {
+                    record.Coordinates[0],
+                    record.Coordinates[1],
+                    record.Coordinates[2]
+                };
+                points.Add(point);
+                batcher.AddVertex(point);
+                break;
+            }
+            case 'l':
+            case 'f': {
+                size_t count = record.Kind == 'l' ? 2 : 3;
+                // 文件中的下标从 1 开始，送出的下标从 0 开始
+                array<size_t, 3> indices;
+                for (size_t i = 0; i < count; i++) {
+                    if (
+                        record.Indices[i] == 0 ||
+                        record.Indices[i] > points.Count()
+                    ) {
+                        throw IndexOverflowException(lineNumber);
+                    }
+                    indices[i] = static_cast<size_t>(record.Indices[i] - 1);
+                }
+                if (record.Kind == 'l') {
+                    batcher.AddLine(
+                        Line<3> {
+                            points.Get(indices[0]),
+                            points.Get(indices[1])
+                        },
+                        array<size_t, 2> { { indices[0], indices[1] } }
+                    );
+                }
+                else {
+                    batcher.AddFace(
+                        Face<3> {
+                            points.Get(indices[0]),
+                            points.Get(indices[1]),
+                            points.Get(indices[2])
+                        },
+                        indices
+                    );
+                }
+                break;
+            }
+        }
+    }
+}
+
+/**********************************************************************
+【函数名称】 CountRecords
+【函数功能】
+    粗略统计 [begin, end) 中顶点、线段与面记录的个数，
+    只看每行的首个非空白字符，用作预留空间的提示。
+【参数】
+    begin: 缓冲区首地址。
+    end: 缓冲区尾后地址。
+    vertexCount: 被赋值为顶点记录的个数。
+    lineCount: 被赋值为线段记录的个数。
+    faceCount: 被赋值为面记录的个数。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+void ObjParser::CountRecords(
+    const char* begin,
+    const char* end,
+    size_t& vertexCount,
+    size_t& lineCount,
+    size_t& faceCount
+) {
+    vertexCount = 0;
+    lineCount = 0;
+    faceCount = 0;
+    const char* it = begin;
+    while (it != end) {
+        const char* lineEnd = FindLineEnd(it, end);
+        SkipSpaces(it, lineEnd);
+        if (lineEnd - it >= 2 && IsSpace(it[1])) {
+            switch (*it) {
+                case 'v': {
+                    vertexCount++;
+                    break;
+                }
+                case 'l': {
+                    lineCount++;
+                    break;
+                }
+                case 'f': {
+                    faceCount++;
+                    break;
+                }
+            }
+        }
+        it = lineEnd == end ? end : lineEnd + 1;
+    }
+}
+
+/**********************************************************************
+【函数名称】 IsSpace
+【函数功能】 判断字符是否为行内空白（不含换行符）。
+【参数】
+    c: 要判断的字符。
+【返回值】
+    是否为行内空白。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+bool ObjParser::IsSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+/**********************************************************************
+【函数名称】 SkipSpaces
+【函数功能】 跳过行内空白。
+【参数】
+    it: 当前位置，会被移动到第一个非空白字符处。
+    end: 行尾地址。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+void ObjParser::SkipSpaces(const char*& it, const char* end) {
+    while (it != end && IsSpace(*it)) {
+        ++it;
+    }
+}
+
+/**********************************************************************
+【函数名称】 FindLineEnd
+【函数功能】 查找当前行的换行符。
+【参数】
+    it: 当前位置。
+    end: 缓冲区尾后地址。
+【返回值】
+    换行符的地址，没有换行符时为 end。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+const char* ObjParser::FindLineEnd(const char* it, const char* end) {
+    auto found = static_cast<const char*>(memchr(it, '\n', end - it));
+    return found == nullptr ? end : found;
+}
+
+/**********************************************************************
+【函数名称】 ScanDouble
+【函数功能】
+    跳过行内空白并扫描一个十进制浮点数。
+    有效数字不超过 2^53 且十的幂次不超过 22 时直接计算，
+    结果已是正确舍入；否则退回 strtod。
+【参数】
+    it: 当前位置，成功时会被移动到数字之后。
+    end: 行尾地址。
+    value: 成功时被赋值为扫描到的数。
+【返回值】
+    是否成功扫描到一个完整的数。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+bool ObjParser::ScanDouble(const char*& it, const char* end, double& value) {
+    SkipSpaces(it, end);
+    const char* start = it;
+    const char* cursor = it;
+    bool isNegative = false;
+    if (cursor != end && (*cursor == '+' || *cursor == '-')) {
+        isNegative = *cursor == '-';
+        ++cursor;
+    }
+
+    uint64_t mantissa = 0;
+    int digitCount = 0;
+    int exponent = 0;
+    bool hasDigits = false;
+    bool isTruncated = false;
+    while (cursor != end && *cursor >= '0' && *cursor <= '9') {
+        hasDigits = true;
+        if (digitCount < MAX_MANTISSA_DIGITS) {
+            mantissa = mantissa * 10 + (*cursor - '0');
+            digitCount += mantissa != 0;
+        }
+        else {
+            isTruncated = true;
+            exponent++;
+        }
+        ++cursor;
+    }
+    if (cursor != end && *cursor == '.') {
+        ++cursor;
+        while (cursor != end && *cursor >= '0' && *cursor <= '9') {
+            hasDigits = true;
+            if (digitCount < MAX_MANTISSA_DIGITS) {
+                mantissa = mantissa * 10 + (*cursor - '0');
+                digitCount += mantissa != 0;
+                exponent--;
+            }
+            else {
+                isTruncated = true;
+            }
+            ++cursor;
+        }
+    }
+    if (!hasDigits) {
+        return false;
+    }
+    if (cursor != end && (*cursor == 'e' || *cursor == 'E')) {
+        ++cursor;
+        bool isExponentNegative = false;
+        if (cursor != end && (*cursor == '+' || *cursor == '-')) {
+            isExponentNegative = *cursor == '-';
+            ++cursor;
+        }
+        if (cursor == end || *cursor < '0' || *cursor > '9') {
+            return false;
+        }
+        int written = 0;
+        while (cursor != end && *cursor >= '0' && *cursor <= '9') {
+            // 超出范围的指数交给 strtod 处理，这里只防止溢出
+            if (written < 100000) {
+                written = written * 10 + (*cursor - '0');
+            }
+            ++cursor;
+        }
+        exponent += isExponentNegative ? -written : written;
+    }
+    if (cursor != end && !IsSpace(*cursor)) {
+        return false;
+    }
+    it = cursor;
+
+    if (
+        !isTruncated &&
+        mantissa <= (uint64_t(1) << 53) &&
+        exponent >= -22 && exponent <= 22
+    ) {
+        // 两个操作数都能精确表示，一次运算的结果是正确舍入的
+        double result = static_cast<double>(mantissa);
+        if (exponent < 0) {
+            result /= POWERS_OF_TEN[-exponent];
+        }
+        else {
+            result *= POWERS_OF_TEN[exponent];
+        }
+        value = isNegative ? -result : result;
+        return true;
+    }
+
+    // 罕见情况，复制到栈上的缓冲区后交给 strtod
+    size_t length = cursor - start;
+    char buffer[64];
+    if (length < sizeof(buffer)) {
+        memcpy(buffer, start, length);
+        buffer[length] = '\0';
+        value = strtod(buffer, nullptr);
+    }
+    else {
+        value = strtod(string(start, cursor).c_str(), nullptr);
+    }
+    return true;
+}
+
+/**********************************************************************
+【函数名称】 ScanIndex
+【函数功能】
+    跳过行内空白并扫描一个从 1 开始的顶点下标。
+    负数（相对下标）与超出 64 位范围的数视为无效下标 0。
+【参数】
+    it: 当前位置，成功时会被移动到数字之后。
+    end: 行尾地址。
+    index: 成功时被赋值为扫描到的下标。
+【返回值】
+    是否成功扫描到一个完整的整数。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+bool ObjParser::ScanIndex(const char*& it, const char* end, uint64_t& index) {
+    SkipSpaces(it, end);
+    const char* cursor = it;
+    // 不支持相对下标
+    bool isNegative = cursor != end && *cursor == '-';
+    if (isNegative) {
+        ++cursor;
+    }
+    uint64_t value = 0;
+    bool hasDigits = false;
+    bool isOverflowed = false;
+    while (cursor != end && *cursor >= '0' && *cursor <= '9') {
+        hasDigits = true;
+        if (value > (numeric_limits<uint64_t>::max() - 9) / 10) {
+            isOverflowed = true;
+        }
+        else {
+            value = value * 10 + (*cursor - '0');
+        }
+        ++cursor;
+    }
+    if (!hasDigits || (cursor != end && !IsSpace(*cursor))) {
+        return false;
+    }
+    it = cursor;
+    index = isNegative || isOverflowed ? 0 : value;
+    return true;
+}
+
+}
+
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,334 @@
+/*************************************************************************
+【文件名】 ObjParser.hpp
+【功能模块和目的】 ObjParser 类在内存中的字符缓冲区上直接解析 .obj 文件。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <vector>
+#include "../../Core/Face.hpp"
+#include "../../Core/Line.hpp"
+#include "../../Core/Model.hpp"
+#include "../../Core/Point.hpp"
+#include "../../Tools/SpillVector.hpp"
+#include "../ModelBatcher.hpp"
+using namespace std;
+using namespace C3w;
+
+namespace C3w {
+
+namespace Storage {
+
+namespace Obj {
+
+/*************************************************************************
+【类名】 ObjParser
+【功能】
+    静态类，在内存中的字符缓冲区上原地解析 .obj 文件。
+    支持 v、l、f、g 与 # 记录，数字由手写的扫描器解析，
+    不依赖 locale，也不为每一行分配内存。
+【接口说明】
+    串行或多线程地解析缓冲区到模型中；
+    或逐块读取输入流，将内容流式地交给 ModelBatcher。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+class ObjParser final {
+    public:
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 Parse
+        【函数功能】
+            解析 [begin, end) 中的 .obj 文本到模型中。
+            格式错误时抛出带行号的 FileFormatException，
+            顶点下标无效时抛出带行号的 IndexOverflowException，
+            有重复元素时抛出 CollectionException。
+            出错时模型中保留出错位置之前的元素。
+        【参数】
+            begin: 缓冲区首地址。
+            end: 缓冲区尾后地址。
+            model: 模型的可变引用。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static void Parse(const char* begin, const char* end, Model<3>& model);
+        /**********************************************************************
+        【函数名称】 ParseParallel
+        【函数功能】
+            在换行处将缓冲区分块，多线程解析并构造元素、计算哈希值，
+            再按文件顺序合并到模型中。哈希索引只有一个，
+            合并时的去重与插入仍是串行的，但不再计算哈希值。
+            结果与异常（包括行号及出错时模型的状态）都与 Parse 完全一致：
+            合并第一个出错的块之前的各块后，只串行解析该块以定位错误。
+        【参数】
+            begin: 缓冲区首地址。
+            end: 缓冲区尾后地址。
+            model: 模型的可变引用。
+            threadCount: 线程数，为 1 或缓冲区较小时直接调用 Parse。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static void ParseParallel(
+            const char* begin,
+            const char* end,
+            Model<3>& model,
+            size_t threadCount
+        );
+        /**********************************************************************
+        【函数名称】 ParseStream
+        【函数功能】
+            逐块读取输入流中的 .obj 文本，将顶点、线段与面
+            依次添加到 batcher 中，不构造 Model，也不检查重复元素。
+            顶点表存放在 SpillVector 中，超出内存上限的部分写入临时文件，
+            占用的内存与文件大小无关。
+            格式错误、下标无效与点重合时的异常及行号与 Parse 相同，
+            读取失败时抛出 FileOpenException。
+        【参数】
+            stream: 已经打开的输入流。
+            batcher: 将内容分批交给访问者的 ModelBatcher。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static void ParseStream(istream& stream, ModelBatcher<3>& batcher);
+
+    private:
+        /**********************************************************************
+        【类名】 Record
+        【功能】 存储一行记录的解析结果。
+        【接口说明】 简单数据类型，无函数。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        struct Record {
+            // 记录类型：'v'、'l'、'f' 或 'g'，空行与注释为 '\0'
+            char Kind;
+            // 顶点的坐标
+            double Coordinates[3];
+            // 线段/面的顶点下标，从 1 开始，无效的下标为 0
+            uint64_t Indices[3];
+            // 模型名称的首地址
+            const char* NameBegin;
+            // 模型名称的尾后地址
+            const char* NameEnd;
+        };
+
+        /**********************************************************************
+        【类名】 Entry
+        【功能】 按文件顺序存储一块中的线段、面与名称记录。
+        【接口说明】 简单数据类型，无函数。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        struct Entry {
+            // 记录类型：'l'、'f' 或 'g'
+            char Kind;
+            // 线段/面为顶点下标；名称为相对块首的偏移与长度
+            uint64_t Values[3];
+        };
+
+        /**********************************************************************
+        【类名】 Chunk
+        【功能】 存储一块文本及其解析结果。
+        【接口说明】 简单数据类型，无函数。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        struct Chunk {
+            // 块的首地址
+            const char* Begin;
+            // 块的尾后地址
+            const char* End;
+            // 块中的顶点
+            vector<Point<3>> Vertices;
+            // 块中的线段、面与名称记录
+            vector<Entry> Entries;
+            // 由记录构造的线段
+            vector<Line<3>> Lines;
+            // 由记录构造的面
+            vector<Face<3>> Faces;
+            // 每条线段的哈希值
+            vector<size_t> LineHashes;
+            // 每个面的哈希值
+            vector<size_t> FaceHashes;
+            // 块中已解析的行数
+            uint64_t LineCount;
+            // 下标超出块内已有顶点数的最大值，要求块前至少有这么多顶点
+            uint64_t RequiredVertexCount;
+            // 块内是否有格式错误或无效下标
+            bool IsFailed;
+        };
+
+        /**********************************************************************
+        【函数名称】 ParseRecord
+        【函数功能】 解析 [it, lineEnd) 中的一行记录。
+        【参数】
+            it: 行首地址。
+            lineEnd: 行尾地址，不含换行符。
+            record: 被赋值为解析结果。
+        【返回值】
+            是否没有格式错误。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static bool ParseRecord(
+            const char* it,
+            const char* lineEnd,
+            Record& record
+        );
+        /**********************************************************************
+        【函数名称】 ParseLines
+        【函数功能】
+            逐行解析 [begin, end) 中的 .obj 文本到模型中，
+            异常与 Parse 相同。
+        【参数】
+            begin: 首行的首地址。
+            end: 尾后地址。
+            model: 模型的可变引用。
+            points: 之前读到的全部顶点，会追加本段的顶点。
+            lineNumber: 之前的行数，会被增加本段的行数。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static void ParseLines(
+            const char* begin,
+            const char* end,
+            Model<3>& model,
+            vector<Point<3>>& points,
+            size_t& lineNumber
+        );
+        /**********************************************************************
+        【函数名称】 ParseChunk
+        【函数功能】
+            解析一块文本中的记录并计数行数，不检查下标是否超出顶点总数，
+            只记录块前至少需要多少个顶点。遇到错误时标记并停止。
+        【参数】
+            chunk: 要解析的块。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static void ParseChunk(Chunk& chunk);
+        /**********************************************************************
+        【函数名称】 BuildElements
+        【函数功能】 由块中的记录与全部顶点构造线段与面，并计算其哈希值。
+        【参数】
+            chunk: 已解析且下标有效的块。
+            points: 全部顶点。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static void BuildElements(
+            Chunk& chunk,
+            const vector<Point<3>>& points
+        );
+        /**********************************************************************
+        【函数名称】 ParseBlock
+        【函数功能】
+            解析 [begin, end) 中的完整行，将内容添加到 batcher 中，
+            顶点同时追加到 points 以供后续的线段与面引用。
+        【参数】
+            begin: 块首地址。
+            end: 块尾后地址，最后一行可以没有换行符。
+            points: 已读到的全部顶点。
+            batcher: 将内容分批交给访问者的 ModelBatcher。
+            lineNumber: 块前的行数，会被增加块中的行数。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static void ParseBlock(
+            const char* begin,
+            const char* end,
+            Tools::SpillVector<Point<3>>& points,
+            ModelBatcher<3>& batcher,
+            size_t& lineNumber
+        );
+        /**********************************************************************
+        【函数名称】 CountRecords
+        【函数功能】
+            粗略统计 [begin, end) 中顶点、线段与面记录的个数，
+            只看每行的首个非空白字符，用作预留空间的提示。
+        【参数】
+            begin: 缓冲区首地址。
+            end: 缓冲区尾后地址。
+            vertexCount: 被赋值为顶点记录的个数。
+            lineCount: 被赋值为线段记录的个数。
+            faceCount: 被赋值为面记录的个数。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static void CountRecords(
+            const char* begin,
+            const char* end,
+            size_t& vertexCount,
+            size_t& lineCount,
+            size_t& faceCount
+        );
+        /**********************************************************************
+        【函数名称】 IsSpace
+        【函数功能】 判断字符是否为行内空白（不含换行符）。
+        【参数】
+            c: 要判断的字符。
+        【返回值】
+            是否为行内空白。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static bool IsSpace(char c);
+        /**********************************************************************
+        【函数名称】 SkipSpaces
+        【函数功能】 跳过行内空白。
+        【参数】
+            it: 当前位置，会被移动到第一个非空白字符处。
+            end: 行尾地址。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static void SkipSpaces(const char*& it, const char* end);
+        /**********************************************************************
+        【函数名称】 FindLineEnd
+        【函数功能】 查找当前行的换行符。
+        【参数】
+            it: 当前位置。
+            end: 缓冲区尾后地址。
+        【返回值】
+            换行符的地址，没有换行符时为 end。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static const char* FindLineEnd(const char* it, const char* end);
+        /**********************************************************************
+        【函数名称】 ScanDouble
+        【函数功能】
+            跳过行内空白并扫描一个十进制浮点数。
+            有效数字不超过 2^53 且十的幂次不超过 22 时直接计算，
+            结果已是正确舍入；否则退回 strtod。
+        【参数】
+            it: 当前位置，成功时会被移动到数字之后。
+            end: 行尾地址。
+            value: 成功时被赋值为扫描到的数。
+        【返回值】
+            是否成功扫描到一个完整的数。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static bool ScanDouble(const char*& it, const char* end, double& value);
+        /**********************************************************************
+        【函数名称】 ScanIndex
+        【函数功能】
+            跳过行内空白并扫描一个从 1 开始的顶点下标。
+            负数（相对下标）与超出 64 位范围的数视为无效下标 0。
+        【参数】
+            it: 当前位置，成功时会被移动到数字之后。
+            end: 行尾地址。
+            index: 成功时被赋值为扫描到的下标。
+        【返回值】
+            是否成功扫描到一个完整的整数。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static bool ScanIndex(const char*& it, const char* end, uint64_t& index);
+
+        // 静态类，隐藏构造函数。
+        ObjParser();
+};
+
+}
+
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,158 @@
+/*************************************************************************
+【文件名】 StatisticsVisitor.hpp
+【功能模块和目的】 StatisticsVisitor 类在流式导入时累计模型的统计量。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <vector>
+#include "../Core/Face.hpp"
+#include "../Core/Line.hpp"
+#include "../Core/Point.hpp"
+#include "../Tools/Box.hpp"
+#include "../Tools/CompensatedSum.hpp"
+#include "ModelVisitor.hpp"
+using namespace std;
+using namespace C3w;
+
+namespace C3w {
+
+namespace Storage {
+
+/*************************************************************************
+【类名】 StatisticsVisitor
+【功能】
+    作为 ModelVisitor 逐批累计线段数、面数、线段总长度、面总面积，
+    以及元素中所有点每一维坐标的最值，只占用常数大小的内存。
+    总长度与总面积与 ModelStatistics 一样使用补偿求和，按相同顺序累加，
+    对没有重复元素的文件，结果与导入后 ModelStatistics 的结果相同。
+【接口说明】 获取线段数、面数、总长度、总面积与外接长方体。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+template <size_t N>
+class StatisticsVisitor final: public ModelVisitor<N> {
+    public:
+        // 构造函数
+
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 初始化空模型的统计量。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        StatisticsVisitor();
+
+        // 属性
+
+        /**********************************************************************
+        【函数名称】 GetLineCount
+        【函数功能】 获取已收到的线段数。
+        【参数】 无
+        【返回值】
+            线段数。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        size_t GetLineCount() const;
+        /**********************************************************************
+        【函数名称】 GetFaceCount
+        【函数功能】 获取已收到的面数。
+        【参数】 无
+        【返回值】
+            面数。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        size_t GetFaceCount() const;
+        /**********************************************************************
+        【函数名称】 GetTotalLineLength
+        【函数功能】 获取已收到的线段的总长度。
+        【参数】 无
+        【返回值】
+            线段总长度。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        double GetTotalLineLength() const;
+        /**********************************************************************
+        【函数名称】 GetTotalFaceArea
+        【函数功能】 获取已收到的面的总面积。
+        【参数】 无
+        【返回值】
+            面总面积。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        double GetTotalFaceArea() const;
+        /**********************************************************************
+        【函数名称】 GetBoundingBox
+        【函数功能】 获取能包含已收到的所有元素的最小长方体。
+        【参数】 无
+        【返回值】
+            外接长方体。没有元素时两个顶点都为原点，
+            与 ModelStatistics::GetBoundingBox 一致。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Tools::Box<N> GetBoundingBox() const;
+
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 VisitLines
+        【函数功能】 将一批线段计入统计量。
+        【参数】
+            lines: 本批线段。
+            indices: 每条线段两个端点的顶点下标，不使用。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void VisitLines(
+            const vector<Line<N>>& lines,
+            const vector<array<size_t, 2>>& indices
+        ) override;
+        /**********************************************************************
+        【函数名称】 VisitFaces
+        【函数功能】 将一批面计入统计量。
+        【参数】
+            faces: 本批面。
+            indices: 每个面三个顶点的顶点下标，不使用。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void VisitFaces(
+            const vector<Face<N>>& faces,
+            const vector<array<size_t, 3>>& indices
+        ) override;
+
+    private:
+        // 线段数
+        size_t m_LineCount { 0 };
+        // 面数
+        size_t m_FaceCount { 0 };
+        // 线段总长度
+        Tools::CompensatedSum m_LineLength;
+        // 面总面积
+        Tools::CompensatedSum m_FaceArea;
+        // 是否已收到过点
+        bool m_HasPoint { false };
+        // 每一维坐标的最小值
+        Point<N> m_Minimum;
+        // 每一维坐标的最大值
+        Point<N> m_Maximum;
+
+        /**********************************************************************
+        【函数名称】 AddPoint
+        【函数功能】 用一个点更新每一维坐标的最值。
+        【参数】
+            point: 元素中的点。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void AddPoint(const Point<N>& point);
+};
+
+}
+
+}
+
+#include "StatisticsVisitor.tpp"
\ No newline at end of file
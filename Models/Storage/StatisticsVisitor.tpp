@@ -0,0 +1,175 @@
+/*************************************************************************
+【文件名】 StatisticsVisitor.tpp
+【功能模块和目的】 为 StatisticsVisitor.hpp 提供实现。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#include <array>
+#include <cstddef>
+#include <vector>
+#include "../Core/Face.hpp"
+#include "../Core/Line.hpp"
+#include "../Core/Point.hpp"
+#include "../Tools/Box.hpp"
+#include "StatisticsVisitor.hpp"
+using namespace std;
+using namespace C3w;
+
+namespace C3w {
+
+namespace Storage {
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 初始化空模型的统计量。
+【参数】 无
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+StatisticsVisitor<N>::StatisticsVisitor() {}
+
+/**********************************************************************
+【函数名称】 GetLineCount
+【函数功能】 获取已收到的线段数。
+【参数】 无
+【返回值】
+    线段数。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+size_t StatisticsVisitor<N>::GetLineCount() const {
+    return m_LineCount;
+}
+
+/**********************************************************************
+【函数名称】 GetFaceCount
+【函数功能】 获取已收到的面数。
+【参数】 无
+【返回值】
+    面数。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+size_t StatisticsVisitor<N>::GetFaceCount() const {
+    return m_FaceCount;
+}
+
+/**********************************************************************
+【函数名称】 GetTotalLineLength
+【函数功能】 获取已收到的线段的总长度。
+【参数】 无
+【返回值】
+    线段总长度。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+double StatisticsVisitor<N>::GetTotalLineLength() const {
+    return m_LineLength.Get();
+}
+
+/**********************************************************************
+【函数名称】 GetTotalFaceArea
+【函数功能】 获取已收到的面的总面积。
+【参数】 无
+【返回值】
+    面总面积。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+double StatisticsVisitor<N>::GetTotalFaceArea() const {
+    return m_FaceArea.Get();
+}
+
+/**********************************************************************
+【函数名称】 GetBoundingBox
+【函数功能】 获取能包含已收到的所有元素的最小长方体。
+【参数】 无
+【返回值】
+    外接长方体。没有元素时两个顶点都为原点，
+    与 ModelStatistics::GetBoundingBox 一致。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+Tools::Box<N> StatisticsVisitor<N>::GetBoundingBox() const {
+    if (!m_HasPoint) {
+        return Tools::Box<N>(Point<N>::Origin, Point<N>::Origin);
+    }
+    return Tools::Box<N>(m_Minimum, m_Maximum);
+}
+
+/**********************************************************************
+【函数名称】 VisitLines
+【函数功能】 将一批线段计入统计量。
+【参数】
+    lines: 本批线段。
+    indices: 每条线段两个端点的顶点下标，不使用。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void StatisticsVisitor<N>::VisitLines(
+    const vector<Line<N>>& lines,
+    const vector<array<size_t, 2>>& /* indices */
+) {
+    m_LineCount += lines.size();
+    for (auto& line: lines) {
+        m_LineLength.Add(line.GetLength());
+        for (auto& point: line.Points) {
+            AddPoint(point);
+        }
+    }
+}
+
+/**********************************************************************
+【函数名称】 VisitFaces
+【函数功能】 将一批面计入统计量。
+【参数】
+    faces: 本批面。
+    indices: 每个面三个顶点的顶点下标，不使用。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void StatisticsVisitor<N>::VisitFaces(
+    const vector<Face<N>>& faces,
+    const vector<array<size_t, 3>>& /* indices */
+) {
+    m_FaceCount += faces.size();
+    for (auto& face: faces) {
+        m_FaceArea.Add(face.GetArea());
+        for (auto& point: face.Points) {
+            AddPoint(point);
+        }
+    }
+}
+
+/**********************************************************************
+【函数名称】 AddPoint
+【函数功能】 用一个点更新每一维坐标的最值。
+【参数】
+    point: 元素中的点。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void StatisticsVisitor<N>::AddPoint(const Point<N>& point) {
+    if (!m_HasPoint) {
+        m_Minimum = point;
+        m_Maximum = point;
+        m_HasPoint = true;
+        return;
+    }
+    for (size_t axis = 0; axis < N; axis++) {
+        if (point[axis] < m_Minimum[axis]) {
+            m_Minimum[axis] = point[axis];
+        }
+        if (point[axis] > m_Maximum[axis]) {
+            m_Maximum[axis] = point[axis];
+        }
+    }
+}
+
+}
+
+}
\ No newline at end of file
@@ -72,7 +72,7 @@ class StorageFactory final {
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
         template <size_t N>
-        static unique_ptr<ImporterBase<N>> GetImporter(string path);
+        static unique_ptr<ImporterBase<N>> GetImporter(const string& path);
         /**********************************************************************
         【函数名称】 GetExporter
         【函数功能】 根据维数与文件路径获取导出器。
@@ -83,7 +83,7 @@ class StorageFactory final {
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
         template <size_t N>
-        static unique_ptr<ExporterBase<N>> GetExporter(string path);
+        static unique_ptr<ExporterBase<N>> GetExporter(const string& path);
         
     private:
         /**********************************************************************
@@ -104,6 +104,19 @@ class StorageFactory final {
         // 导入/导出器表
         static unordered_multimap<string, const Pair> m_Map;
 
+        /**********************************************************************
+        【函数名称】 RegisterDimension
+        【函数功能】
+            注册与维数无关的内置导入/导出器（.c3wb）。
+            每个维数只在首次查找时注册一次。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        template <size_t N>
+        static void RegisterDimension();
+
+
         // 静态类，隐藏构造函数。
         StorageFactory();
 };
@@ -11,6 +11,8 @@
 #include <type_traits>
 #include "ImporterBase.hpp"
 #include "ExporterBase.hpp"
+#include "Binary/BinaryExporter.hpp"
+#include "Binary/BinaryImporter.hpp"
 #include "../Core/Errors.hpp"
 #include "StorageFactory.hpp"
 using namespace std;
@@ -72,7 +74,10 @@ typename enable_if<
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <size_t N>
-unique_ptr<ImporterBase<N>> StorageFactory::GetImporter(string path) {
+unique_ptr<ImporterBase<N>> StorageFactory::GetImporter(
+    const string& path
+) {
+    RegisterDimension<N>();
     string extension = "";
     size_t dotpos = path.find_last_of('.');
     if (dotpos != string::npos) {
@@ -99,7 +104,10 @@ unique_ptr<ImporterBase<N>> StorageFactory::GetImporter(string path) {
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 template <size_t N>
-unique_ptr<ExporterBase<N>> StorageFactory::GetExporter(string path) {
+unique_ptr<ExporterBase<N>> StorageFactory::GetExporter(
+    const string& path
+) {
+    RegisterDimension<N>();
     string extension = "";
     size_t dotpos = path.find_last_of('.');
     if (dotpos != string::npos) {
@@ -116,6 +124,27 @@ unique_ptr<ExporterBase<N>> StorageFactory::GetExporter(string path) {
     throw StorageFactoryLookupException();
 }
 
+/**********************************************************************
+【函数名称】 RegisterDimension
+【函数功能】
+    注册与维数无关的内置导入/导出器（.c3wb）。
+    每个维数只在首次查找时注册一次。
+【参数】 无
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+void StorageFactory::RegisterDimension() {
+    // 局部静态变量的初始化是线程安全的，且只进行一次
+    static const bool isRegistered = (
+        Register<N, Binary::BinaryImporter<N>, Binary::BinaryExporter<N>>(
+            ".c3wb"
+        ),
+        true
+    );
+    (void)isRegistered;
+}
+
 }
 
 }
\ No newline at end of file
@@ -0,0 +1,102 @@
+/*************************************************************************
+【文件名】 BoundedQueue.hpp
+【功能模块和目的】 BoundedQueue 类定义了一个容量有限的线程安全队列。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+using namespace std;
+
+namespace C3w {
+
+namespace Tools {
+
+/*************************************************************************
+【类名】 BoundedQueue
+【功能】
+    容量有限的线程安全先进先出队列，用于连接流水线中相邻的阶段。
+    队列满时生产者阻塞，空时消费者阻塞，
+    因此无论上下游速度如何，积压的元素数都不超过容量。
+【接口说明】
+    放入、取出元素，关闭队列。关闭后不能再放入，
+    已有的元素仍可取出，取完后取出操作返回 false。禁止复制 / 拷贝。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+template <typename T>
+class BoundedQueue final {
+    public:
+        // 构造函数
+
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 使用容量初始化空的 BoundedQueue 类型实例。
+        【参数】
+            capacity: 最多容纳的元素个数，为 0 时视为 1。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        explicit BoundedQueue(size_t capacity);
+        // 禁止拷贝
+        BoundedQueue(const BoundedQueue<T>&) = delete;
+
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 Push
+        【函数功能】 放入一个元素，队列满时等待。
+        【参数】
+            value: 要放入的元素，成功时被取走内容。
+        【返回值】
+            是否放入成功，队列已关闭时为 false。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        bool Push(T&& value);
+        /**********************************************************************
+        【函数名称】 Pop
+        【函数功能】 取出最早放入的元素，队列空且未关闭时等待。
+        【参数】
+            value: 成功时被赋值为取出的元素。
+        【返回值】
+            是否取出成功，队列已关闭且为空时为 false。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        bool Pop(T& value);
+        /**********************************************************************
+        【函数名称】 Close
+        【函数功能】 关闭队列，唤醒所有等待的生产者与消费者。可以重复调用。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void Close();
+
+        // 操作符
+
+        // 禁止赋值
+        BoundedQueue<T>& operator=(const BoundedQueue<T>&) = delete;
+
+    private:
+        // 最多容纳的元素个数
+        size_t m_Capacity;
+        // 队列中的元素
+        deque<T> m_Items;
+        // 是否已关闭
+        bool m_IsClosed { false };
+        // 保护以上成员的互斥量
+        mutex m_Mutex;
+        // 队列不再满或被关闭时通知生产者
+        condition_variable m_NotFull;
+        // 队列不再空或被关闭时通知消费者
+        condition_variable m_NotEmpty;
+};
+
+}
+
+}
+
+#include "BoundedQueue.tpp"
\ No newline at end of file
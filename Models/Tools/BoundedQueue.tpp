@@ -0,0 +1,98 @@
+/*************************************************************************
+【文件名】 BoundedQueue.tpp
+【功能模块和目的】 为 BoundedQueue.hpp 提供实现。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <utility>
+#include "BoundedQueue.hpp"
+using namespace std;
+
+namespace C3w {
+
+namespace Tools {
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 使用容量初始化空的 BoundedQueue 类型实例。
+【参数】
+    capacity: 最多容纳的元素个数，为 0 时视为 1。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+BoundedQueue<T>::BoundedQueue(size_t capacity):
+    m_Capacity(capacity == 0 ? 1 : capacity) {}
+
+/**********************************************************************
+【函数名称】 Push
+【函数功能】 放入一个元素，队列满时等待。
+【参数】
+    value: 要放入的元素，成功时被取走内容。
+【返回值】
+    是否放入成功，队列已关闭时为 false。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+bool BoundedQueue<T>::Push(T&& value) {
+    unique_lock<mutex> lock(m_Mutex);
+    m_NotFull.wait(lock, [this]() {
+        return m_IsClosed || m_Items.size() < m_Capacity;
+    });
+    if (m_IsClosed) {
+        return false;
+    }
+    m_Items.push_back(move(value));
+    lock.unlock();
+    m_NotEmpty.notify_one();
+    return true;
+}
+
+/**********************************************************************
+【函数名称】 Pop
+【函数功能】 取出最早放入的元素，队列空且未关闭时等待。
+【参数】
+    value: 成功时被赋值为取出的元素。
+【返回值】
+    是否取出成功，队列已关闭且为空时为 false。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+bool BoundedQueue<T>::Pop(T& value) {
+    unique_lock<mutex> lock(m_Mutex);
+    m_NotEmpty.wait(lock, [this]() {
+        return m_IsClosed || !m_Items.empty();
+    });
+    if (m_Items.empty()) {
+        return false;
+    }
+    value = move(m_Items.front());
+    m_Items.pop_front();
+    lock.unlock();
+    m_NotFull.notify_one();
+    return true;
+}
+
+/**********************************************************************
+【函数名称】 Close
+【函数功能】 关闭队列，唤醒所有等待的生产者与消费者。可以重复调用。
+【参数】 无
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+void BoundedQueue<T>::Close() {
+    {
+        lock_guard<mutex> lock(m_Mutex);
+        m_IsClosed = true;
+    }
+    m_NotFull.notify_all();
+    m_NotEmpty.notify_all();
+}
+
+}
+
+}
\ No newline at end of file
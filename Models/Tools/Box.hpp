@@ -67,6 +67,18 @@ class Box final {
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
         static Box<N> GetBoundingBoxOf(const DynamicSet<Point<N>>& points);
+        /**********************************************************************
+        【函数名称】 GetBoundingBoxOf
+        【函数功能】 获取可以容纳迭代器中所有点的最小长方体。
+        【参数】 
+            begin: 指向首个点的迭代器。
+            end: 指向最后一个点之后的迭代器。
+        【返回值】
+            可以容纳所有给定点的最小长方体。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        template <typename It>
+        static Box<N> GetBoundingBoxOf(It begin, It end);
 
         // 属性
 
@@ -79,6 +91,35 @@ class Box final {
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
         double GetVolume() const;
+        /**********************************************************************
+        【函数名称】 GetSurfaceArea
+        【函数功能】 计算自身的表面积，即所有 N - 1 维面的体积之和。
+        【参数】 无
+        【返回值】
+            长方体表面积。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        double GetSurfaceArea() const;
+        /**********************************************************************
+        【函数名称】 SquaredDistanceTo
+        【函数功能】 求点到长方体（含内部）最近距离的平方，点在内部时为 0。
+        【参数】
+            point: 给定点。
+        【返回值】
+            最近距离的平方。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        double SquaredDistanceTo(const Point<N>& point) const;
+        /**********************************************************************
+        【函数名称】 Overlaps
+        【函数功能】 判断自身与另一长方体是否相交，边界相接也算相交。
+        【参数】
+            other: 另一长方体。
+        【返回值】
+            两长方体是否相交。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        bool Overlaps(const Box<N>& other) const;
 
         // 操作
 
@@ -103,6 +144,17 @@ class Box final {
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
         static bool IsEqual(const Box<N>& left, const Box<N>& right);
+        /**********************************************************************
+        【函数名称】 Merge
+        【函数功能】 获取能同时容纳两个长方体的最小长方体。
+        【参数】
+            left: 第一个长方体。
+            right: 第二个长方体。
+        【返回值】
+            两个长方体的外接长方体，两个顶点分别为各维的最小与最大值。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static Box<N> Merge(const Box<N>& left, const Box<N>& right);
 
         // 操作符
 
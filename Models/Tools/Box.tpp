@@ -43,26 +43,42 @@ Box<N>::Box(const Point<N>& vertex1, const Point<N>& vertex2)
 **********************************************************************/
 template <size_t N>
 Box<N> Box<N>::GetBoundingBoxOf(const DynamicSet<Point<N>>& points) {
-    if (points.Count() == 0) {
+    return GetBoundingBoxOf(points.begin(), points.end());
+}
+
+/**********************************************************************
+【函数名称】 GetBoundingBoxOf
+【函数功能】 获取可以容纳迭代器中所有点的最小长方体。
+【参数】 
+    begin: 指向首个点的迭代器。
+    end: 指向最后一个点之后的迭代器。
+【返回值】
+    可以容纳所有给定点的最小长方体。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+template <typename It>
+Box<N> Box<N>::GetBoundingBoxOf(It begin, It end) {
+    if (begin == end) {
         return Box<N>(Point<N>::Origin, Point<N>::Origin);
     }
-    array<double, N> max_coords;
-    max_coords.fill(numeric_limits<double>::max());
-    array<double, N> min_coords;
-    max_coords.fill(numeric_limits<double>::min());
-    Point<N> vertex1(max_coords);
-    Point<N> vertex2(min_coords);
-    for (auto& point: points) {
+    array<double, N> minCoords;
+    minCoords.fill(numeric_limits<double>::max());
+    array<double, N> maxCoords;
+    maxCoords.fill(numeric_limits<double>::lowest());
+    for (auto it = begin; it != end; ++it) {
+        const Point<N>& point = *it;
+        auto data = point.GetData();
         for (size_t i = 0; i < N; i++) {
-            if (point[i] < vertex1[i]) {
-                vertex1[i] = point[i];
+            if (data[i] < minCoords[i]) {
+                minCoords[i] = data[i];
             }
-            if (point[i] > vertex2[i]) {
-                vertex2[i] = point[i];
+            if (data[i] > maxCoords[i]) {
+                maxCoords[i] = data[i];
             }
         }
     }
-    return Box<N>(vertex1, vertex2);
+    return Box<N>(Point<N>(minCoords), Point<N>(maxCoords));
 }
 
 /**********************************************************************
@@ -82,6 +98,82 @@ double Box<N>::GetVolume() const {
     return volume;
 }
 
+/**********************************************************************
+【函数名称】 GetSurfaceArea
+【函数功能】 计算自身的表面积，即所有 N - 1 维面的体积之和。
+【参数】 无
+【返回值】
+    长方体表面积。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+double Box<N>::GetSurfaceArea() const {
+    double area = 0;
+    for (size_t i = 0; i < N; i++) {
+        // 垂直于第 i 维的一对面
+        double face = 2;
+        for (size_t j = 0; j < N; j++) {
+            if (j != i) {
+                face *= fabs(Vertex1[j] - Vertex2[j]);
+            }
+        }
+        area += face;
+    }
+    return area;
+}
+
+/**********************************************************************
+【函数名称】 SquaredDistanceTo
+【函数功能】 求点到长方体（含内部）最近距离的平方，点在内部时为 0。
+【参数】
+    point: 给定点。
+【返回值】
+    最近距离的平方。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+double Box<N>::SquaredDistanceTo(const Point<N>& point) const {
+    auto coords = point.GetData();
+    auto vertex1 = Vertex1.GetData();
+    auto vertex2 = Vertex2.GetData();
+    double distance = 0;
+    for (size_t i = 0; i < N; i++) {
+        double lower = fmin(vertex1[i], vertex2[i]);
+        double upper = fmax(vertex1[i], vertex2[i]);
+        double delta = 0;
+        if (coords[i] < lower) {
+            delta = lower - coords[i];
+        }
+        else if (coords[i] > upper) {
+            delta = coords[i] - upper;
+        }
+        distance += delta * delta;
+    }
+    return distance;
+}
+
+/**********************************************************************
+【函数名称】 Overlaps
+【函数功能】 判断自身与另一长方体是否相交，边界相接也算相交。
+【参数】
+    other: 另一长方体。
+【返回值】
+    两长方体是否相交。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+bool Box<N>::Overlaps(const Box<N>& other) const {
+    for (size_t i = 0; i < N; i++) {
+        if (fmax(Vertex1[i], Vertex2[i]) <
+            fmin(other.Vertex1[i], other.Vertex2[i]) ||
+            fmax(other.Vertex1[i], other.Vertex2[i]) <
+            fmin(Vertex1[i], Vertex2[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
 /**********************************************************************
 【函数名称】 IsEqual
 【函数功能】 判断自身和另一元素是否相等。
@@ -111,6 +203,33 @@ bool Box<N>::IsEqual(const Box<N>& left, const Box<N>& right) {
     return left.Vertex1 == right.Vertex1 && left.Vertex2 == right.Vertex2;
 }
 
+/**********************************************************************
+【函数名称】 Merge
+【函数功能】 获取能同时容纳两个长方体的最小长方体。
+【参数】
+    left: 第一个长方体。
+    right: 第二个长方体。
+【返回值】
+    两个长方体的外接长方体，两个顶点分别为各维的最小与最大值。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <size_t N>
+Box<N> Box<N>::Merge(const Box<N>& left, const Box<N>& right) {
+    array<double, N> minCoords;
+    array<double, N> maxCoords;
+    for (size_t i = 0; i < N; i++) {
+        minCoords[i] = fmin(
+            fmin(left.Vertex1[i], left.Vertex2[i]),
+            fmin(right.Vertex1[i], right.Vertex2[i])
+        );
+        maxCoords[i] = fmax(
+            fmax(left.Vertex1[i], left.Vertex2[i]),
+            fmax(right.Vertex1[i], right.Vertex2[i])
+        );
+    }
+    return Box<N>(Point<N>(minCoords), Point<N>(maxCoords));
+}
+
 /**********************************************************************
 【函数名称】 operator==
 【函数功能】 判断自身和另一长方体是否相等。
@@ -0,0 +1,242 @@
+/*************************************************************************
+【文件名】 BufferedWriter.cpp
+【功能模块和目的】 为 BufferedWriter.hpp 提供实现。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "BufferedWriter.hpp"
+using namespace std;
+
+namespace C3w {
+
+namespace Tools {
+
+// 可精确表示的十的幂
+static const double POWERS_OF_TEN[] {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+    1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+    1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+// 能被 double 精确表示的整数上界
+static const double MAX_EXACT_INTEGER { 9007199254740992.0 };
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 使用输出流与缓冲区大小初始化 BufferedWriter 类型实例。
+【参数】
+    stream: 要写入的流，生命周期须长于此对象。
+    capacity: 缓冲区的字节数。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+BufferedWriter::BufferedWriter(ostream& stream, size_t capacity)
+    : m_Stream(stream), m_Buffer(
+        capacity < MAX_DOUBLE_LENGTH ? size_t(MAX_DOUBLE_LENGTH) : capacity
+    ) {}
+
+/**********************************************************************
+【函数名称】 析构函数
+【函数功能】 写出缓冲区中剩余的内容。
+【参数】 无
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+BufferedWriter::~BufferedWriter() {
+    Flush();
+}
+
+/**********************************************************************
+【函数名称】 Write
+【函数功能】 写入一个字符。
+【参数】
+    c: 要写入的字符。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+void BufferedWriter::Write(char c) {
+    *Reserve(1) = c;
+    m_Length++;
+}
+
+/**********************************************************************
+【函数名称】 Write
+【函数功能】 写入一段字符。
+【参数】
+    data: 字符的首地址，length 为 0 时可以为空。
+    length: 字符数。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+void BufferedWriter::Write(const char* data, size_t length) {
+    // 空的 vector 的 data() 可能为空，不能交给 memcpy
+    if (length == 0) {
+        return;
+    }
+    // 比缓冲区还长的内容直接写入流
+    if (length > m_Buffer.size()) {
+        Flush();
+        m_Stream.write(data, length);
+        return;
+    }
+    memcpy(Reserve(length), data, length);
+    m_Length += length;
+}
+
+/**********************************************************************
+【函数名称】 Write
+【函数功能】 写入一个字符串。
+【参数】
+    text: 要写入的字符串。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+void BufferedWriter::Write(const string& text) {
+    Write(text.data(), text.size());
+}
+
+/**********************************************************************
+【函数名称】 WriteUnsigned
+【函数功能】 以十进制写入一个无符号整数。
+【参数】
+    value: 要写入的整数。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+void BufferedWriter::WriteUnsigned(uint64_t value) {
+    // uint64_t 最多 20 位
+    char digits[20];
+    size_t count = 0;
+    do {
+        digits[count++] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value != 0);
+    char* out = Reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        out[i] = digits[count - 1 - i];
+    }
+    m_Length += count;
+}
+
+/**********************************************************************
+【函数名称】 WriteDouble
+【函数功能】 以能精确还原的最短形式写入一个浮点数。
+【参数】
+    value: 要写入的浮点数。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+void BufferedWriter::WriteDouble(double value) {
+    m_Length += FormatDouble(value, Reserve(MAX_DOUBLE_LENGTH));
+}
+
+/**********************************************************************
+【函数名称】 Flush
+【函数功能】 将缓冲区中的内容写入流并清空缓冲区。
+【参数】 无
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+void BufferedWriter::Flush() {
+    if (m_Length != 0) {
+        m_Stream.write(m_Buffer.data(), m_Length);
+        m_Length = 0;
+    }
+}
+
+/**********************************************************************
+【函数名称】 FormatDouble
+【函数功能】
+    将浮点数格式化为能精确还原的最短形式。
+    能以不超过 2^53 的整数除以 10 的幂精确表示的数使用定点形式，
+    否则使用 %.15g 至 %.17g 中最短的、经 strtod 能还原的形式。
+【参数】
+    value: 要格式化的浮点数。
+    buffer: 至少有 MAX_DOUBLE_LENGTH 字节的缓冲区，不以 '\0' 结尾。
+【返回值】
+    写入的字符数。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+size_t BufferedWriter::FormatDouble(double value, char* buffer) {
+    size_t length = 0;
+    if (value == 0) {
+        if (signbit(value)) {
+            buffer[length++] = '-';
+        }
+        buffer[length++] = '0';
+        return length;
+    }
+
+    double magnitude = fabs(value);
+    // 定点形式已排除了不超过 15 位有效数字的所有写法时，从 16 位开始尝试
+    int minPrecision = 15;
+    for (int places = 0; isfinite(value) && places <= 22; places++) {
+        double scaled = nearbyint(magnitude * POWERS_OF_TEN[places]);
+        if (scaled > MAX_EXACT_INTEGER) {
+            minPrecision = 16;
+            break;
+        }
+        // 与导入器的快速路径是同一次正确舍入的除法，因此能精确还原
+        if (scaled / POWERS_OF_TEN[places] != magnitude) {
+            continue;
+        }
+        char digits[24];
+        size_t count = 0;
+        auto integer = static_cast<uint64_t>(scaled);
+        while (integer != 0 || count <= static_cast<size_t>(places)) {
+            digits[count++] = static_cast<char>('0' + integer % 10);
+            integer /= 10;
+        }
+        if (value < 0) {
+            buffer[length++] = '-';
+        }
+        for (size_t i = count; i > 0; i--) {
+            if (i == static_cast<size_t>(places)) {
+                buffer[length++] = '.';
+            }
+            buffer[length++] = digits[i - 1];
+        }
+        return length;
+    }
+
+    // 有效数字过多或数量级过大/过小，交给 snprintf
+    char text[MAX_DOUBLE_LENGTH + 8];
+    for (int precision = minPrecision; precision <= 17; precision++) {
+        int written = snprintf(text, sizeof(text), "%.*g", precision, value);
+        if (precision == 17 || strtod(text, nullptr) == value) {
+            length = static_cast<size_t>(written);
+            break;
+        }
+    }
+    memcpy(buffer, text, length);
+    return length;
+}
+
+/**********************************************************************
+【函数名称】 Reserve
+【函数功能】 确保缓冲区中至少还有指定的空闲字节，不足时先写出。
+【参数】
+    length: 需要的空闲字节数，不超过缓冲区大小。
+【返回值】
+    空闲区域的首地址。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+char* BufferedWriter::Reserve(size_t length) {
+    if (m_Buffer.size() - m_Length < length) {
+        Flush();
+    }
+    return m_Buffer.data() + m_Length;
+}
+
+}
+
+}
\ No newline at end of file
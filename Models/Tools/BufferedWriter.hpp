@@ -0,0 +1,161 @@
+/*************************************************************************
+【文件名】 BufferedWriter.hpp
+【功能模块和目的】 BufferedWriter 类将文本攒入大块缓冲区后批量写入输出流。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+using namespace std;
+
+namespace C3w {
+
+namespace Tools {
+
+/*************************************************************************
+【类名】 BufferedWriter
+【功能】
+    将字符、整数与浮点数格式化到大块缓冲区中，缓冲区满时一次性写入流。
+    浮点数以能精确还原的最短形式输出。
+【接口说明】 写入字符/字符串/整数/浮点数，刷新缓冲区。禁止复制 / 拷贝。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+class BufferedWriter final {
+    public:
+        // 常量
+
+        // 默认缓冲区大小
+        static constexpr size_t DEFAULT_CAPACITY { 1 << 20 };
+        // 一个浮点数格式化后的最大长度
+        static constexpr size_t MAX_DOUBLE_LENGTH { 32 };
+
+        // 构造函数
+
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 使用输出流与缓冲区大小初始化 BufferedWriter 类型实例。
+        【参数】
+            stream: 要写入的流，生命周期须长于此对象。
+            capacity: 缓冲区的字节数。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        BufferedWriter(ostream& stream, size_t capacity = DEFAULT_CAPACITY);
+        // 禁止拷贝
+        BufferedWriter(const BufferedWriter&) = delete;
+
+        // 析构函数
+
+        /**********************************************************************
+        【函数名称】 析构函数
+        【函数功能】 写出缓冲区中剩余的内容。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        ~BufferedWriter();
+
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 Write
+        【函数功能】 写入一个字符。
+        【参数】
+            c: 要写入的字符。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void Write(char c);
+        /**********************************************************************
+        【函数名称】 Write
+        【函数功能】 写入一段字符。
+        【参数】
+            data: 字符的首地址，length 为 0 时可以为空。
+            length: 字符数。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void Write(const char* data, size_t length);
+        /**********************************************************************
+        【函数名称】 Write
+        【函数功能】 写入一个字符串。
+        【参数】
+            text: 要写入的字符串。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void Write(const string& text);
+        /**********************************************************************
+        【函数名称】 WriteUnsigned
+        【函数功能】 以十进制写入一个无符号整数。
+        【参数】
+            value: 要写入的整数。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void WriteUnsigned(uint64_t value);
+        /**********************************************************************
+        【函数名称】 WriteDouble
+        【函数功能】 以能精确还原的最短形式写入一个浮点数。
+        【参数】
+            value: 要写入的浮点数。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void WriteDouble(double value);
+        /**********************************************************************
+        【函数名称】 Flush
+        【函数功能】 将缓冲区中的内容写入流并清空缓冲区。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void Flush();
+        /**********************************************************************
+        【函数名称】 FormatDouble
+        【函数功能】
+            将浮点数格式化为能精确还原的最短形式。
+            能以不超过 2^53 的整数除以 10 的幂精确表示的数使用定点形式，
+            否则使用 %.15g 至 %.17g 中最短的、经 strtod 能还原的形式。
+        【参数】
+            value: 要格式化的浮点数。
+            buffer: 至少有 MAX_DOUBLE_LENGTH 字节的缓冲区，不以 '\0' 结尾。
+        【返回值】
+            写入的字符数。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static size_t FormatDouble(double value, char* buffer);
+
+        // 操作符
+
+        // 禁止赋值
+        BufferedWriter& operator=(const BufferedWriter&) = delete;
+
+    private:
+        // 要写入的流
+        ostream& m_Stream;
+        // 缓冲区
+        vector<char> m_Buffer;
+        // 缓冲区中已使用的字节数
+        size_t m_Length { 0 };
+
+        /**********************************************************************
+        【函数名称】 Reserve
+        【函数功能】 确保缓冲区中至少还有指定的空闲字节，不足时先写出。
+        【参数】
+            length: 需要的空闲字节数，不超过缓冲区大小。
+        【返回值】
+            空闲区域的首地址。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        char* Reserve(size_t length);
+};
+
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,58 @@
+/*************************************************************************
+【文件名】 CompensatedSum.cpp
+【功能模块和目的】 为 CompensatedSum.hpp 提供实现。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#include <cmath>
+#include "CompensatedSum.hpp"
+using namespace std;
+
+namespace C3w {
+
+namespace Tools {
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 初始化和为 0 的 CompensatedSum 类型实例。
+【参数】 无
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+CompensatedSum::CompensatedSum(): m_Sum(0.0), m_Compensation(0.0) {}
+
+/**********************************************************************
+【函数名称】 Add
+【函数功能】 累加一个数，可以为负。
+【参数】
+    value: 要累加的数。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+void CompensatedSum::Add(double value) {
+    double sum = m_Sum + value;
+    // 较小的加数在相加时丢失的低位
+    if (fabs(m_Sum) >= fabs(value)) {
+        m_Compensation += (m_Sum - sum) + value;
+    }
+    else {
+        m_Compensation += (value - sum) + m_Sum;
+    }
+    m_Sum = sum;
+}
+
+/**********************************************************************
+【函数名称】 Get
+【函数功能】 获取当前的和。
+【参数】 无
+【返回值】
+    补偿后的和。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+double CompensatedSum::Get() const {
+    return m_Sum + m_Compensation;
+}
+
+}
+
+}
\ No newline at end of file
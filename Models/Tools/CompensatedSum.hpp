@@ -0,0 +1,66 @@
+/*************************************************************************
+【文件名】 CompensatedSum.hpp
+【功能模块和目的】 CompensatedSum 类使用补偿求和累加浮点数。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#pragma once
+
+using namespace std;
+
+namespace C3w {
+
+namespace Tools {
+
+/*************************************************************************
+【类名】 CompensatedSum
+【功能】
+    使用 Neumaier 补偿求和累加浮点数，反复加减后误差仍不随次数累积。
+    ModelStatistics 与流式统计共用，二者对同一组元素得到相同的和。
+【接口说明】 累加一个数，获取当前的和。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+class CompensatedSum final {
+    public:
+        // 构造函数
+
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 初始化和为 0 的 CompensatedSum 类型实例。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        CompensatedSum();
+
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 Add
+        【函数功能】 累加一个数，可以为负。
+        【参数】
+            value: 要累加的数。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void Add(double value);
+        /**********************************************************************
+        【函数名称】 Get
+        【函数功能】 获取当前的和。
+        【参数】 无
+        【返回值】
+            补偿后的和。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        double Get() const;
+
+    private:
+        // 累加的和
+        double m_Sum;
+        // 丢失的低位部分
+        double m_Compensation;
+};
+
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,60 @@
+/*************************************************************************
+【文件名】 Formattable.hpp
+【功能模块和目的】 以非虚的方式为带有 ToString 的类型提供流插入。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#pragma once
+
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include "Representable.hpp"
+using namespace std;
+
+namespace C3w {
+
+namespace Tools {
+
+/*************************************************************************
+【类名】 IsFormattable
+【功能】
+    判断类型是否有返回 string 的常成员函数 ToString，
+    且不派生自 Representable。这样的类型不需要虚函数表，
+    如 Vector、Point 与 Element，ToString 按静态类型调用。
+【接口说明】 继承于 true_type 或 false_type。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+template <typename T, typename = void>
+struct IsFormattable: false_type {};
+template <typename T>
+struct IsFormattable<
+    T,
+    typename enable_if<
+        is_same<decltype(declval<const T&>().ToString()), string>::value
+    >::type
+>: integral_constant<bool, !is_base_of<Representable, T>::value> {};
+
+}
+
+/**********************************************************************
+【函数名称】 operator<<
+【函数功能】
+    将满足 IsFormattable 的对象插入到输出流中。
+    定义在 C3w 命名空间中，通过实参依赖查找对其中的所有类型生效。
+【参数】
+    stream: 要插入的流。
+    value: 要插入的对象。
+【返回值】
+    输出流的引用。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+typename enable_if<Tools::IsFormattable<T>::value, ostream&>::type
+operator<<(ostream& stream, const T& value) {
+    stream << value.ToString();
+    return stream;
+}
+
+}
\ No newline at end of file
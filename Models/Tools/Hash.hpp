@@ -0,0 +1,90 @@
+/*************************************************************************
+【文件名】 Hash.hpp
+【功能模块和目的】 提供组合哈希值与计算字节串哈希值的工具函数。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+using namespace std;
+
+namespace C3w {
+
+namespace Tools {
+
+/**********************************************************************
+【函数名称】 MixHash
+【函数功能】 打散一个哈希值的各个比特（splitmix64 的终结步骤）。
+【参数】
+    value: 原始哈希值。
+【返回值】
+    打散后的哈希值。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+inline size_t MixHash(size_t value) {
+    uint64_t x = static_cast<uint64_t>(value);
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return static_cast<size_t>(x);
+}
+
+/**********************************************************************
+【函数名称】 CombineHash
+【函数功能】 将一个哈希值按顺序组合进已有的哈希值。
+【参数】
+    seed: 已有的哈希值。
+    value: 要组合的哈希值。
+【返回值】
+    组合后的哈希值。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+inline size_t CombineHash(size_t seed, size_t value) {
+    return MixHash(seed ^ (value + 0x9e3779b97f4a7c15ULL + (seed << 6)));
+}
+
+/**********************************************************************
+【函数名称】 HashBytes
+【函数功能】
+    计算一段字节的 64 位哈希值，用作文件内容的指纹。
+    按 8 字节的字读取，结果与机器的字节序有关。
+【参数】
+    data: 字节的首地址，size 为 0 时可以为空。
+    size: 字节数。
+【返回值】
+    字节串的哈希值。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+inline uint64_t HashBytes(const char* data, size_t size) {
+    static const uint64_t MULTIPLIER { 0x9e3779b97f4a7c15ULL };
+    // 四路互不依赖，乘法的延迟可以重叠
+    uint64_t lanes[4] { 1, 2, 3, 4 };
+    size_t i = 0;
+    for (; i + sizeof(lanes) <= size; i += sizeof(lanes)) {
+        for (size_t j = 0; j < 4; j++) {
+            uint64_t word;
+            memcpy(&word, data + i + j * sizeof(word), sizeof(word));
+            lanes[j] = (lanes[j] ^ word) * MULTIPLIER;
+            lanes[j] ^= lanes[j] >> 29;
+        }
+    }
+    // 不足 32 字节的尾部逐字节并入第一路
+    for (; i < size; i++) {
+        lanes[0] = (lanes[0] ^ static_cast<unsigned char>(data[i])) *
+            MULTIPLIER;
+    }
+    size_t hash = MixHash(size);
+    for (auto lane: lanes) {
+        hash = CombineHash(hash, static_cast<size_t>(lane));
+    }
+    return static_cast<uint64_t>(hash);
+}
+
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,173 @@
+/*************************************************************************
+【文件名】 MappedFile.cpp
+【功能模块和目的】 为 MappedFile.hpp 提供实现。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#include <cstddef>
+#include <string>
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#include "../Core/Errors.hpp"
+#include "MappedFile.hpp"
+using namespace std;
+using namespace C3w::Errors;
+
+namespace C3w {
+
+namespace Tools {
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】
+    映射指定的文件。如果文件无法打开或映射抛出 FileOpenException。
+【参数】
+    path: 文件所在路径。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+MappedFile::MappedFile(const string& path) {
+#ifdef _WIN32
+    HANDLE file = CreateFileA(
+        path.c_str(),
+        GENERIC_READ,
+        FILE_SHARE_READ,
+        nullptr,
+        OPEN_EXISTING,
+        FILE_FLAG_SEQUENTIAL_SCAN,
+        nullptr
+    );
+    if (file == INVALID_HANDLE_VALUE) {
+        throw FileOpenException();
+    }
+    m_File = file;
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size)) {
+        Close();
+        throw FileOpenException();
+    }
+    m_Size = static_cast<size_t>(size.QuadPart);
+    // 长度为 0 的文件无法映射
+    if (m_Size == 0) {
+        return;
+    }
+    m_Mapping = CreateFileMappingA(
+        file, nullptr, PAGE_READONLY, 0, 0, nullptr
+    );
+    if (m_Mapping == nullptr) {
+        Close();
+        throw FileOpenException();
+    }
+    m_Data = static_cast<const char*>(
+        MapViewOfFile(m_Mapping, FILE_MAP_READ, 0, 0, 0)
+    );
+    if (m_Data == nullptr) {
+        Close();
+        throw FileOpenException();
+    }
+#else
+    m_Descriptor = open(path.c_str(), O_RDONLY);
+    if (m_Descriptor < 0) {
+        throw FileOpenException();
+    }
+    struct stat info;
+    if (fstat(m_Descriptor, &info) != 0 || !S_ISREG(info.st_mode)) {
+        Close();
+        throw FileOpenException();
+    }
+    m_Size = static_cast<size_t>(info.st_size);
+    // 长度为 0 的文件无法映射
+    if (m_Size == 0) {
+        return;
+    }
+    void* data = mmap(
+        nullptr, m_Size, PROT_READ, MAP_PRIVATE, m_Descriptor, 0
+    );
+    if (data == MAP_FAILED) {
+        Close();
+        throw FileOpenException();
+    }
+    m_Data = static_cast<const char*>(data);
+    // 导入器按顺序读取，提示内核预读
+    madvise(data, m_Size, MADV_SEQUENTIAL);
+#endif
+}
+
+/**********************************************************************
+【函数名称】 析构函数
+【函数功能】 解除映射并关闭文件。
+【参数】 无
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+MappedFile::~MappedFile() {
+    Close();
+}
+
+/**********************************************************************
+【函数名称】 GetData
+【函数功能】 获取映射区域的首地址。空文件返回 nullptr。
+【参数】 无
+【返回值】
+    映射区域的首地址。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+const char* MappedFile::GetData() const {
+    return m_Data;
+}
+
+/**********************************************************************
+【函数名称】 GetSize
+【函数功能】 获取文件的字节数。
+【参数】 无
+【返回值】
+    文件的字节数。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+size_t MappedFile::GetSize() const {
+    return m_Size;
+}
+
+/**********************************************************************
+【函数名称】 Close
+【函数功能】 解除映射并关闭已打开的句柄。
+【参数】 无
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+void MappedFile::Close() {
+#ifdef _WIN32
+    if (m_Data != nullptr) {
+        UnmapViewOfFile(m_Data);
+    }
+    if (m_Mapping != nullptr) {
+        CloseHandle(m_Mapping);
+    }
+    if (m_File != nullptr) {
+        CloseHandle(m_File);
+    }
+    m_Mapping = nullptr;
+    m_File = nullptr;
+#else
+    if (m_Data != nullptr) {
+        munmap(const_cast<char*>(m_Data), m_Size);
+    }
+    if (m_Descriptor >= 0) {
+        close(m_Descriptor);
+    }
+    m_Descriptor = -1;
+#endif
+    m_Data = nullptr;
+    m_Size = 0;
+}
+
+}
+
+}
\ No newline at end of file
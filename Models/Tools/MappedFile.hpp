@@ -0,0 +1,106 @@
+/*************************************************************************
+【文件名】 MappedFile.hpp
+【功能模块和目的】 MappedFile 类将一个文件只读地映射到内存中。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+using namespace std;
+
+namespace C3w {
+
+namespace Tools {
+
+/*************************************************************************
+【类名】 MappedFile
+【功能】
+    将一个文件只读地映射到内存中，析构时解除映射。
+    在 POSIX 系统上使用 mmap，在 Windows 上使用 CreateFileMapping。
+【接口说明】 获取映射后的首地址与字节数。禁止复制 / 拷贝。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+class MappedFile final {
+    public:
+        // 构造函数
+
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】
+            映射指定的文件。如果文件无法打开或映射抛出 FileOpenException。
+        【参数】
+            path: 文件所在路径。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        MappedFile(const string& path);
+        // 禁止拷贝
+        MappedFile(const MappedFile&) = delete;
+
+        // 析构函数
+
+        /**********************************************************************
+        【函数名称】 析构函数
+        【函数功能】 解除映射并关闭文件。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        ~MappedFile();
+
+        // 属性
+
+        /**********************************************************************
+        【函数名称】 GetData
+        【函数功能】 获取映射区域的首地址。空文件返回 nullptr。
+        【参数】 无
+        【返回值】
+            映射区域的首地址。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        const char* GetData() const;
+        /**********************************************************************
+        【函数名称】 GetSize
+        【函数功能】 获取文件的字节数。
+        【参数】 无
+        【返回值】
+            文件的字节数。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        size_t GetSize() const;
+
+        // 操作符
+
+        // 禁止赋值
+        MappedFile& operator=(const MappedFile&) = delete;
+
+    private:
+        // 映射区域的首地址
+        const char* m_Data { nullptr };
+        // 文件的字节数
+        size_t m_Size { 0 };
+#ifdef _WIN32
+        // 文件句柄
+        void* m_File { nullptr };
+        // 映射对象句柄
+        void* m_Mapping { nullptr };
+#else
+        // 文件描述符
+        int m_Descriptor { -1 };
+#endif
+
+        /**********************************************************************
+        【函数名称】 Close
+        【函数功能】 解除映射并关闭已打开的句柄。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void Close();
+};
+
+}
+
+}
\ No newline at end of file
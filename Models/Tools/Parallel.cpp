@@ -0,0 +1,75 @@
+/*************************************************************************
+【文件名】 Parallel.cpp
+【功能模块和目的】 为 Parallel.hpp 提供实现。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <thread>
+#include <vector>
+#include "Parallel.hpp"
+using namespace std;
+
+namespace C3w {
+
+namespace Tools {
+
+/**********************************************************************
+【函数名称】 GetDefaultThreadCount
+【函数功能】 获取默认的线程数，即硬件支持的并发线程数。
+【参数】 无
+【返回值】
+    默认的线程数，至少为 1。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+size_t Parallel::GetDefaultThreadCount() {
+    // 无法检测时 hardware_concurrency 返回 0
+    size_t count = thread::hardware_concurrency();
+    return count == 0 ? 1 : count;
+}
+
+/**********************************************************************
+【函数名称】 For
+【函数功能】
+    为 [0, count) 中的每个下标各启动一个线程执行任务，
+    下标 0 在调用线程上执行。等待全部完成后，
+    如果有任务抛出异常，重新抛出下标最小的任务的异常。
+【参数】
+    count: 任务数。
+    task: 以任务下标为参数的任务。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+void Parallel::For(size_t count, const function<void(size_t)>& task) {
+    vector<exception_ptr> errors(count);
+    auto run = [&task, &errors](size_t index) {
+        try {
+            task(index);
+        }
+        catch (...) {
+            errors[index] = current_exception();
+        }
+    };
+    vector<thread> threads;
+    threads.reserve(count);
+    for (size_t i = 1; i < count; i++) {
+        threads.emplace_back(run, i);
+    }
+    if (count > 0) {
+        run(0);
+    }
+    for (auto& worker: threads) {
+        worker.join();
+    }
+    for (auto& error: errors) {
+        if (error) {
+            rethrow_exception(error);
+        }
+    }
+}
+
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,57 @@
+/*************************************************************************
+【文件名】 Parallel.hpp
+【功能模块和目的】 Parallel 类提供简单的多线程并行工具。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+using namespace std;
+
+namespace C3w {
+
+namespace Tools {
+
+/*************************************************************************
+【类名】 Parallel
+【功能】 静态类，提供简单的多线程并行工具。
+【接口说明】 获取默认线程数，并行执行一组任务。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+class Parallel final {
+    public:
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 GetDefaultThreadCount
+        【函数功能】 获取默认的线程数，即硬件支持的并发线程数。
+        【参数】 无
+        【返回值】
+            默认的线程数，至少为 1。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static size_t GetDefaultThreadCount();
+        /**********************************************************************
+        【函数名称】 For
+        【函数功能】
+            为 [0, count) 中的每个下标各启动一个线程执行任务，
+            下标 0 在调用线程上执行。等待全部完成后，
+            如果有任务抛出异常，重新抛出下标最小的任务的异常。
+        【参数】
+            count: 任务数。
+            task: 以任务下标为参数的任务。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static void For(size_t count, const function<void(size_t)>& task);
+
+    private:
+        // 静态类，隐藏构造函数。
+        Parallel();
+};
+
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,172 @@
+/*************************************************************************
+【文件名】 SpillVector.hpp
+【功能模块和目的】 SpillVector 类定义了一个超出内存上限后写入临时文件的数组。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <type_traits>
+#include <vector>
+using namespace std;
+
+namespace C3w {
+
+namespace Tools {
+
+/*************************************************************************
+【类名】 SpillVector
+【功能】
+    只能在尾部添加的数组，元素类型须可平凡复制。
+    前 memoryCount 个元素存放在内存中，其余元素按页写入临时文件，
+    读取时经由固定页数的直接映射缓存，因此占用的内存有上限，
+    与元素总数无关。流式导入时用作顶点表。
+【接口说明】
+    添加元素，按下标获取元素，获取元素个数。禁止复制 / 拷贝。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+template <typename T>
+class SpillVector final {
+    static_assert(
+        is_trivially_copyable<T>::value,
+        "SpillVector elements must be trivially copyable."
+    );
+
+    public:
+        // 成员
+
+        // 默认保留在内存中的元素个数
+        static const size_t DEFAULT_MEMORY_COUNT { 1 << 22 };
+
+        // 构造函数
+
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】 初始化空的 SpillVector 类型实例。
+        【参数】
+            memoryCount: 保留在内存中的元素个数，其余元素写入临时文件。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        explicit SpillVector(size_t memoryCount = DEFAULT_MEMORY_COUNT);
+        // 禁止拷贝
+        SpillVector(const SpillVector<T>&) = delete;
+
+        // 析构函数
+
+        /**********************************************************************
+        【函数名称】 析构函数
+        【函数功能】 关闭并删除临时文件。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        ~SpillVector();
+
+        // 属性
+
+        /**********************************************************************
+        【函数名称】 Count
+        【函数功能】 获取元素个数。
+        【参数】 无
+        【返回值】
+            已添加的元素个数。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        size_t Count() const;
+
+        // 访问器
+
+        /**********************************************************************
+        【函数名称】 Get
+        【函数功能】
+            获取指定下标处的元素。如果越界抛出 IndexOverflowException，
+            读取临时文件失败时抛出 FileOpenException。
+        【参数】
+            index: 元素下标。
+        【返回值】
+            指定位置元素的副本。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        T Get(size_t index) const;
+
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 Add
+        【函数功能】
+            在尾部添加一个元素。
+            无法创建或写入临时文件时抛出 FileOpenException。
+        【参数】
+            value: 新的元素。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void Add(const T& value);
+
+        // 操作符
+
+        // 禁止赋值
+        SpillVector<T>& operator=(const SpillVector<T>&) = delete;
+
+    private:
+        // 每页的元素个数
+        static const size_t PAGE_SIZE { 4096 };
+        // 缓存的页数
+        static const size_t CACHE_PAGE_COUNT { 64 };
+
+        // 保留在内存中的元素个数
+        size_t m_MemoryCount;
+        // 元素总数
+        size_t m_Count { 0 };
+        // 保留在内存中的元素
+        vector<T> m_Memory;
+        // 尚未写满一页、还没有写入临时文件的元素
+        vector<T> m_Tail;
+        // 临时文件，还没有写出过页时为空
+        FILE* m_File { nullptr };
+        // 已写入临时文件的页数
+        size_t m_PageCount { 0 };
+        // 页缓存，第 i 个槽位存放页号模 CACHE_PAGE_COUNT 为 i 的页
+        mutable vector<T> m_Cache;
+        // 每个槽位中的页号，空槽位为 SIZE_MAX
+        mutable vector<size_t> m_CachedPages;
+
+        /**********************************************************************
+        【函数名称】 WritePage
+        【函数功能】 将写满的尾页追加到临时文件，必要时先创建临时文件。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void WritePage();
+        /**********************************************************************
+        【函数名称】 LoadPage
+        【函数功能】 获取已写出的一页，不在缓存中时从临时文件读入。
+        【参数】
+            page: 页号。
+        【返回值】
+            缓存中该页首个元素的地址。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        const T* LoadPage(size_t page) const;
+        /**********************************************************************
+        【函数名称】 Seek
+        【函数功能】 将临时文件定位到指定字节处，支持超过 2 GB 的偏移。
+        【参数】
+            offset: 相对文件首的字节数。
+        【返回值】
+            是否成功。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        bool Seek(uint64_t offset) const;
+};
+
+}
+
+}
+
+#include "SpillVector.tpp"
\ No newline at end of file
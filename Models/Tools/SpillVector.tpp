@@ -0,0 +1,187 @@
+/*************************************************************************
+【文件名】 SpillVector.tpp
+【功能模块和目的】 为 SpillVector.hpp 提供实现。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+#include "../Core/Errors.hpp"
+#include "SpillVector.hpp"
+using namespace std;
+using namespace C3w::Errors;
+
+namespace C3w {
+
+namespace Tools {
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】 初始化空的 SpillVector 类型实例。
+【参数】
+    memoryCount: 保留在内存中的元素个数，其余元素写入临时文件。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+SpillVector<T>::SpillVector(size_t memoryCount): m_MemoryCount(memoryCount) {}
+
+/**********************************************************************
+【函数名称】 析构函数
+【函数功能】 关闭并删除临时文件。
+【参数】 无
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+SpillVector<T>::~SpillVector() {
+    // tmpfile 创建的文件在关闭时自动删除
+    if (m_File != nullptr) {
+        fclose(m_File);
+    }
+}
+
+/**********************************************************************
+【函数名称】 Count
+【函数功能】 获取元素个数。
+【参数】 无
+【返回值】
+    已添加的元素个数。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+size_t SpillVector<T>::Count() const {
+    return m_Count;
+}
+
+/**********************************************************************
+【函数名称】 Get
+【函数功能】
+    获取指定下标处的元素。如果越界抛出 IndexOverflowException，
+    读取临时文件失败时抛出 FileOpenException。
+【参数】
+    index: 元素下标。
+【返回值】
+    指定位置元素的副本。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+T SpillVector<T>::Get(size_t index) const {
+    if (index >= m_Count) {
+        throw IndexOverflowException();
+    }
+    if (index < m_MemoryCount) {
+        return m_Memory[index];
+    }
+    index -= m_MemoryCount;
+    size_t page = index / PAGE_SIZE;
+    if (page == m_PageCount) {
+        return m_Tail[index % PAGE_SIZE];
+    }
+    return LoadPage(page)[index % PAGE_SIZE];
+}
+
+/**********************************************************************
+【函数名称】 Add
+【函数功能】
+    在尾部添加一个元素。
+    无法创建或写入临时文件时抛出 FileOpenException。
+【参数】
+    value: 新的元素。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+void SpillVector<T>::Add(const T& value) {
+    if (m_Count < m_MemoryCount) {
+        m_Memory.push_back(value);
+    }
+    else {
+        m_Tail.push_back(value);
+        if (m_Tail.size() == PAGE_SIZE) {
+            WritePage();
+        }
+    }
+    m_Count++;
+}
+
+/**********************************************************************
+【函数名称】 WritePage
+【函数功能】 将写满的尾页追加到临时文件，必要时先创建临时文件。
+【参数】 无
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+void SpillVector<T>::WritePage() {
+    if (m_File == nullptr) {
+        m_File = tmpfile();
+        if (m_File == nullptr) {
+            throw FileOpenException();
+        }
+    }
+    // 读取页缓存时会移动文件位置，写入前重新定位到文件尾
+    if (
+        !Seek(static_cast<uint64_t>(m_PageCount) * PAGE_SIZE * sizeof(T)) ||
+        fwrite(m_Tail.data(), sizeof(T), PAGE_SIZE, m_File) != PAGE_SIZE
+    ) {
+        throw FileOpenException();
+    }
+    m_PageCount++;
+    m_Tail.clear();
+}
+
+/**********************************************************************
+【函数名称】 LoadPage
+【函数功能】 获取已写出的一页，不在缓存中时从临时文件读入。
+【参数】
+    page: 页号。
+【返回值】
+    缓存中该页首个元素的地址。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+const T* SpillVector<T>::LoadPage(size_t page) const {
+    if (m_Cache.empty()) {
+        m_Cache.resize(CACHE_PAGE_COUNT * PAGE_SIZE);
+        m_CachedPages.assign(CACHE_PAGE_COUNT, SIZE_MAX);
+    }
+    size_t slot = page % CACHE_PAGE_COUNT;
+    T* data = m_Cache.data() + slot * PAGE_SIZE;
+    if (m_CachedPages[slot] != page) {
+        // 写入的缓冲区需要与读取同步，fseek 会完成这一步
+        if (
+            !Seek(static_cast<uint64_t>(page) * PAGE_SIZE * sizeof(T)) ||
+            fread(data, sizeof(T), PAGE_SIZE, m_File) != PAGE_SIZE
+        ) {
+            m_CachedPages[slot] = SIZE_MAX;
+            throw FileOpenException();
+        }
+        m_CachedPages[slot] = page;
+    }
+    return data;
+}
+
+/**********************************************************************
+【函数名称】 Seek
+【函数功能】 将临时文件定位到指定字节处，支持超过 2 GB 的偏移。
+【参数】
+    offset: 相对文件首的字节数。
+【返回值】
+    是否成功。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+template <typename T>
+bool SpillVector<T>::Seek(uint64_t offset) const {
+#ifdef _WIN32
+    return _fseeki64(m_File, static_cast<__int64>(offset), SEEK_SET) == 0;
+#else
+    return fseeko(m_File, static_cast<off_t>(offset), SEEK_SET) == 0;
+#endif
+}
+
+}
+
+}
\ No newline at end of file
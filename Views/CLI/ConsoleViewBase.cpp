@@ -34,6 +34,10 @@ void ConsoleViewBase::Display() const {
     Output << Palette::FG_GRAY << "Type ? for help." << Palette::CLEAR << endl;
     while (true) {
         string line = Ask(m_Prompt, true);
+        if (!Input) {
+            // 输入已结束
+            break;
+        }
         if (line == "?") {
             ShowHelp();
         }
@@ -41,20 +45,16 @@ void ConsoleViewBase::Display() const {
             break;
         }
         else {
-            bool found = false;
-            for (auto& pair: m_Commands) {
-                if (pair.first == line) {
-                    auto result = pair.second.Handler();
-                    if (result != Result::OK) {
-                        Output << Palette::FG_RED;
-                        Output << "error: " << ResultToString(result); 
-                        Output << Palette::CLEAR << endl;
-                    }
-                    found = true;
-                    break;
+            auto command = m_Commands.find(line);
+            if (command != m_Commands.end()) {
+                auto result = command->second.Handler();
+                if (result != Result::OK) {
+                    Output << Palette::FG_RED;
+                    Output << "error: " << ResultToString(result); 
+                    Output << Palette::CLEAR << endl;
                 }
             }
-            if (!found) {
+            else {
                 Output << Palette::FG_RED;
                 Output << "error: Unrecognized command '" << line << "'."; 
                 Output << Palette::CLEAR << endl;
@@ -71,6 +71,73 @@ void ConsoleViewBase::Display() const {
     }
 }
 
+/**********************************************************************
+【函数名称】 Execute
+【函数功能】
+    执行一行命令，命令名与参数位于同一行，如 "add 0 0 0 1 1 1"。
+    脚本模式下命令所需的值依次从参数中读取，不再询问。
+【参数】
+    line: 命令行。
+【返回值】
+    命令发生的错误。命令不存在时返回 UNKNOWN_COMMAND。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+ConsoleViewBase::Result ConsoleViewBase::Execute(const string& line) const {
+    istringstream stream(line);
+    string name;
+    stream >> name;
+    auto command = m_Commands.find(name);
+    if (command == m_Commands.end()) {
+        return Result::UNKNOWN_COMMAND;
+    }
+    string arguments;
+    getline(stream >> ws, arguments);
+    m_Arguments.clear();
+    m_Arguments.str(arguments);
+    return command->second.Handler();
+}
+
+/**********************************************************************
+【函数名称】 SetScripted
+【函数功能】
+    设置是否处于脚本模式。脚本模式下不输出提示符、选项、
+    成功信息与颜色，命令所需的值从 Execute 的参数中读取。
+【参数】
+    isScripted: 是否处于脚本模式。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+void ConsoleViewBase::SetScripted(bool isScripted) {
+    m_IsScripted = isScripted;
+    SetPlain(isScripted);
+}
+
+/**********************************************************************
+【函数名称】 IsScripted
+【函数功能】 判断是否处于脚本模式。
+【参数】 无
+【返回值】
+    是否处于脚本模式。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+bool ConsoleViewBase::IsScripted() const {
+    return m_IsScripted;
+}
+
+/**********************************************************************
+【函数名称】 SetPlain
+【函数功能】
+    设置输出流是否禁用颜色。记录在输出流上，
+    共用此流的视图均不再输出颜色。
+【参数】
+    isPlain: 是否禁用颜色。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+void ConsoleViewBase::SetPlain(bool isPlain) {
+    Output.iword(GetPlainIndex()) = isPlain ? 1 : 0;
+}
+
 /**********************************************************************
 【函数名称】 构造函数
 【函数功能】 使用控制器与标准输入/输出流初始化 ConsoleViewBase 类型实例。
@@ -109,9 +176,15 @@ ConsoleViewBase::ConsoleViewBase(
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 string ConsoleViewBase::Ask(string prompt, bool trim) const {
-    Output << Palette::FG_BLUE << prompt << Palette::CLEAR;
     string answer;
-    getline(Input, answer);
+    if (m_IsScripted) {
+        // 脚本模式下取出剩余的全部参数
+        getline(m_Arguments, answer);
+    }
+    else {
+        Output << Palette::FG_BLUE << prompt << Palette::CLEAR;
+        getline(Input, answer);
+    }
     if (trim) {
         size_t start = answer.find_first_not_of(" \t\n\r");
         size_t end = answer.find_last_not_of(" \t\n\r");
@@ -123,6 +196,54 @@ string ConsoleViewBase::Ask(string prompt, bool trim) const {
     return answer;
 }
 
+/**********************************************************************
+【函数名称】 AskValues
+【函数功能】
+    询问由空白分隔的若干个值。交互时与 Ask 相同，读入一整行；
+    脚本模式下从参数中取出 count 个值，不足时返回空串。
+【参数】
+    prompt: 询问的提示。
+    count: 值的个数。
+【返回值】
+    以空格分隔的值。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+string ConsoleViewBase::AskValues(string prompt, size_t count) const {
+    if (!m_IsScripted) {
+        return Ask(prompt, true);
+    }
+    string values;
+    string value;
+    for (size_t i = 0; i < count; i++) {
+        if (!(m_Arguments >> value)) {
+            return "";
+        }
+        if (i > 0) {
+            values += ' ';
+        }
+        values += value;
+    }
+    return values;
+}
+
+/**********************************************************************
+【函数名称】 HasMoreValues
+【函数功能】
+    判断脚本模式下当前命令是否还有未读取的参数，
+    用于一行中给出多组值的批量命令。交互时总是返回 false。
+【参数】 无
+【返回值】
+    是否还有未读取的参数。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+bool ConsoleViewBase::HasMoreValues() const {
+    if (!m_IsScripted) {
+        return false;
+    }
+    m_Arguments >> ws;
+    return m_Arguments.peek() != istringstream::traits_type::eof();
+}
+
 /**********************************************************************
 【函数名称】 Choose
 【函数功能】 让用户在选项中做出选择。
@@ -137,19 +258,21 @@ size_t ConsoleViewBase::Select(
     string prompt, 
     const vector<string>& choices
 ) const {
-    Output << Palette::FG_BLUE << prompt << Palette::CLEAR << endl;
-    for (size_t i = 0; i < choices.size(); i++) {
-        Output << i + 1 << ". " << choices[i] << endl;
-    }
-    Output << Palette::FG_BLUE;
-    if (choices.size() == 1) {
-        Output << "[1]: ";
-    }
-    else {
-        Output << "[1~" << choices.size() << "]: ";
+    if (!m_IsScripted) {
+        Output << Palette::FG_BLUE << prompt << Palette::CLEAR << endl;
+        for (size_t i = 0; i < choices.size(); i++) {
+            Output << i + 1 << ". " << choices[i] << endl;
+        }
+        Output << Palette::FG_BLUE;
+        if (choices.size() == 1) {
+            Output << "[1]: ";
+        }
+        else {
+            Output << "[1~" << choices.size() << "]: ";
+        }
+        Output << Palette::CLEAR;
     }
-    Output << Palette::CLEAR;
-    istringstream stream(Ask(""));
+    istringstream stream(AskValues("", 1));
     size_t id;
     stream >> id;
     return stream.bad() ? 0 : id;
@@ -187,9 +310,21 @@ string ConsoleViewBase::ResultToString(Result result) const {
         case Result::ELEMENT_COLLISION: {
             return "Identical element already exists in model.";
         }
+        case Result::TRANSFORM_COLLISION: {
+            return "Transform would merge points or elements.";
+        }
+        case Result::NOTHING_TO_UNDO: {
+            return "There is nothing to undo.";
+        }
+        case Result::NOTHING_TO_REDO: {
+            return "There is nothing to redo.";
+        }
         case Result::INVALID_VALUE: {
             return "Entered value is invalid.";
         }
+        case Result::UNKNOWN_COMMAND: {
+            return "Unrecognized command.";
+        }
         default: {
             return "";
         }
@@ -214,6 +349,38 @@ void ConsoleViewBase::RegisterCommand(
     m_Commands[name] = { handler, help };
 }
 
+/**********************************************************************
+【函数名称】 ShowSuccess
+【函数功能】 显示命令成功的信息，脚本模式下不显示。
+【参数】
+    message: 要显示的信息。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+void ConsoleViewBase::ShowSuccess(const string& message) const {
+    if (!m_IsScripted) {
+        Output << Palette::FG_GREEN << message << Palette::CLEAR << endl;
+    }
+}
+
+/**********************************************************************
+【函数名称】 ShowErrorLine
+【函数功能】
+    读取模型文件失败且控制器给出了出错的行号时显示该行号，
+    供错误信息之外参考；脚本模式下同样显示。
+【参数】
+    path: 读取的文件位置。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+void ConsoleViewBase::ShowErrorLine(const string& path) const {
+    auto line = m_pController->GetErrorLine();
+    if (line > 0) {
+        Output << Palette::FG_GRAY << "Reading '" << path;
+        Output << "' stopped at line " << line << "." << Palette::CLEAR << endl;
+    }
+}
+
 /**********************************************************************
 【函数名称】 ShowHelp
 【函数功能】 显示帮助信息。
@@ -267,9 +434,22 @@ float ConsoleViewBase::Likelihood(string given, string have) {
     return static_cast<float>(numerator) / denominator;
 }
 
+/**********************************************************************
+【函数名称】 GetPlainIndex
+【函数功能】 获取流中记录是否禁用颜色的 iword 下标。
+【参数】 无
+【返回值】
+    iword 下标。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+int ConsoleViewBase::GetPlainIndex() {
+    static const int index = ios_base::xalloc();
+    return index;
+}
+
 /**********************************************************************
 【函数名称】 operator<<
-【函数功能】 将指定的颜色显示到流上。
+【函数功能】 将指定的颜色显示到流上，流已禁用颜色时不输出。
 【参数】
     stream: 要输出的流。
     palette: 要显示的颜色。
@@ -281,7 +461,9 @@ ostream& operator<<(
     ostream& stream, 
     ConsoleViewBase::Palette palette
 ) {
-    stream << "\033[" << static_cast<int>(palette) << "m";
+    if (stream.iword(ConsoleViewBase::GetPlainIndex()) == 0) {
+        stream << "\033[" << static_cast<int>(palette) << "m";
+    }
     return stream;
 }
 
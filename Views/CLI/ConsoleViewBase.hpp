@@ -10,6 +10,7 @@
 #include <iostream>
 #include <map>
 #include <memory>
+#include <sstream>
 #include <string>
 #include <vector>
 #include "../ViewBase.hpp"
@@ -31,6 +32,33 @@ namespace Cli {
 *************************************************************************/
 class ConsoleViewBase: public ViewBase {
     public:
+        // 内嵌类型
+
+        /**********************************************************************
+        【类名】 Result
+        【功能】 一个枚举，用于命令的返回值。
+        【接口说明】 枚举，用于命令的返回值。
+        【开发者及日期】 赵一彤 2024/7/24
+        **********************************************************************/
+        enum class Result: short {
+            // 脚本中的命令不存在
+            UNKNOWN_COMMAND = -2,
+            INVALID_VALUE = -1,
+            // 以下与 ControllerBase::Result 一致
+
+            OK = 0,
+            STORAGE_LOOKUP_ERROR,
+            FILE_OPEN_ERROR,
+            FILE_FORMAT_ERROR,
+            INDEX_OVERFLOW,
+            POINT_INDEX_OVERFLOW,
+            POINT_COLLISION,
+            ELEMENT_COLLISION,
+            TRANSFORM_COLLISION,
+            NOTHING_TO_UNDO,
+            NOTHING_TO_REDO
+        };
+
         // 构造函数
 
         /**********************************************************************
@@ -79,11 +107,55 @@ class ConsoleViewBase: public ViewBase {
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
         void Display() const override;
+        /**********************************************************************
+        【函数名称】 Execute
+        【函数功能】
+            执行一行命令，命令名与参数位于同一行，如 "add 0 0 0 1 1 1"。
+            脚本模式下命令所需的值依次从参数中读取，不再询问。
+        【参数】
+            line: 命令行。
+        【返回值】
+            命令发生的错误。命令不存在时返回 UNKNOWN_COMMAND。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Result Execute(const string& line) const;
+        /**********************************************************************
+        【函数名称】 SetScripted
+        【函数功能】
+            设置是否处于脚本模式。脚本模式下不输出提示符、选项、
+            成功信息与颜色，命令所需的值从 Execute 的参数中读取。
+        【参数】
+            isScripted: 是否处于脚本模式。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        virtual void SetScripted(bool isScripted);
+        /**********************************************************************
+        【函数名称】 IsScripted
+        【函数功能】 判断是否处于脚本模式。
+        【参数】 无
+        【返回值】
+            是否处于脚本模式。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        bool IsScripted() const;
 
     protected:
         // 询问命令时的提示符
         string m_Prompt;
 
+        /**********************************************************************
+        【函数名称】 SetPlain
+        【函数功能】
+            设置输出流是否禁用颜色。记录在输出流上，
+            共用此流的视图均不再输出颜色。
+        【参数】
+            isPlain: 是否禁用颜色。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void SetPlain(bool isPlain);
+
         /**********************************************************************
         【函数名称】 Ask
         【函数功能】 向控制台输出提示符并读入一行。
@@ -96,6 +168,30 @@ class ConsoleViewBase: public ViewBase {
         **********************************************************************/
         string Ask(string prompt, bool trim = false) const;
         /**********************************************************************
+        【函数名称】 AskValues
+        【函数功能】
+            询问由空白分隔的若干个值。交互时与 Ask 相同，读入一整行；
+            脚本模式下从参数中取出 count 个值，不足时返回空串。
+        【参数】
+            prompt: 询问的提示。
+            count: 值的个数。
+        【返回值】
+            以空格分隔的值。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        string AskValues(string prompt, size_t count) const;
+        /**********************************************************************
+        【函数名称】 HasMoreValues
+        【函数功能】
+            判断脚本模式下当前命令是否还有未读取的参数，
+            用于一行中给出多组值的批量命令。交互时总是返回 false。
+        【参数】 无
+        【返回值】
+            是否还有未读取的参数。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        bool HasMoreValues() const;
+        /**********************************************************************
         【函数名称】 Choose
         【函数功能】 让用户在选项中做出选择。
         【参数】
@@ -107,26 +203,6 @@ class ConsoleViewBase: public ViewBase {
         **********************************************************************/
         size_t Select(string prompt, const vector<string>& choices) const;
 
-        /**********************************************************************
-        【类名】 Result
-        【功能】 一个枚举，用于命令的返回值。
-        【接口说明】 枚举，用于命令的返回值。
-        【开发者及日期】 赵一彤 2024/7/24
-        **********************************************************************/
-        enum class Result: short {
-            INVALID_VALUE = -1,
-            // 以下与 ControllerBase::Result 一致
-
-            OK = 0,
-            STORAGE_LOOKUP_ERROR,
-            FILE_OPEN_ERROR,
-            FILE_FORMAT_ERROR,
-            INDEX_OVERFLOW,
-            POINT_INDEX_OVERFLOW,
-            POINT_COLLISION,
-            ELEMENT_COLLISION
-        };
-        
         /**********************************************************************
         【函数名称】 ResultToString
         【函数功能】 将命令返回的结果转化为字符串。
@@ -152,6 +228,26 @@ class ConsoleViewBase: public ViewBase {
             function<Result()> handler,
             string help
         );
+        /**********************************************************************
+        【函数名称】 ShowSuccess
+        【函数功能】 显示命令成功的信息，脚本模式下不显示。
+        【参数】
+            message: 要显示的信息。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void ShowSuccess(const string& message) const;
+        /**********************************************************************
+        【函数名称】 ShowErrorLine
+        【函数功能】
+            读取模型文件失败且控制器给出了出错的行号时显示该行号，
+            供错误信息之外参考；脚本模式下同样显示。
+        【参数】
+            path: 读取的文件位置。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void ShowErrorLine(const string& path) const;
 
         /**********************************************************************
         【类名】 Palette
@@ -187,6 +283,10 @@ class ConsoleViewBase: public ViewBase {
         };
         // 存储命令的表
         map<string, Command> m_Commands;
+        // 是否处于脚本模式
+        bool m_IsScripted {false};
+        // 脚本模式下当前命令尚未读取的参数
+        mutable istringstream m_Arguments;
 
         /**********************************************************************
         【函数名称】 ShowHelp
@@ -207,10 +307,19 @@ class ConsoleViewBase: public ViewBase {
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
         static float Likelihood(string given, string have);
+        /**********************************************************************
+        【函数名称】 GetPlainIndex
+        【函数功能】 获取流中记录是否禁用颜色的 iword 下标。
+        【参数】 无
+        【返回值】
+            iword 下标。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        static int GetPlainIndex();
 
     /**********************************************************************
     【函数名称】 operator<<
-    【函数功能】 将指定的颜色显示到流上。
+    【函数功能】 将指定的颜色显示到流上，流已禁用颜色时不输出。
     【参数】
         stream: 要输出的流。
         palette: 要显示的颜色。
@@ -0,0 +1,201 @@
+/*************************************************************************
+【文件名】 ConvertConsoleView.cpp
+【功能模块和目的】 为 ConvertConsoleView.hpp 文件提供实现。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include "../../Controllers/ControllerBase.hpp"
+#include "ConsoleViewBase.hpp"
+#include "ConvertConsoleView.hpp"
+using namespace std;
+using namespace C3w::Controllers;
+
+namespace C3w {
+
+namespace Views {
+
+namespace Cli {
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】
+    使用控制器、源文件与目标文件路径及标准输入/输出流
+    初始化 ConvertConsoleView 类型实例。由命令行直接运行，
+    显示进度与报告，但输出不带颜色的纯文本。
+【参数】
+    controller: 控制器指针。
+    source: 源文件路径。
+    target: 目标文件路径。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+ConvertConsoleView::ConvertConsoleView(
+    shared_ptr<ControllerBase> controller,
+    const string& source,
+    const string& target
+): ConvertConsoleView(controller, source, target, cin, cout, false) {
+    SetPlain(true);
+}
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】
+    使用控制器、源文件与目标文件路径、指定输入/输出流
+    及打开者是否处于脚本模式初始化 ConvertConsoleView 类型实例。
+【参数】
+    controller: 控制器指针。
+    source: 源文件路径。
+    target: 目标文件路径。
+    input: 输入流。
+    output: 输出流。
+    isScripted: 是否处于脚本模式。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+ConvertConsoleView::ConvertConsoleView(
+    shared_ptr<ControllerBase> controller,
+    const string& source,
+    const string& target,
+    istream& input,
+    ostream& output,
+    bool isScripted
+): ConsoleViewBase(controller, input, output),
+    m_Source(source),
+    m_Target(target) {
+    SetScripted(isScripted);
+}
+
+/**********************************************************************
+【函数名称】 Display
+【函数功能】 执行转换并显示结果。
+【参数】 无
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+void ConvertConsoleView::Display() const {
+    Convert();
+}
+
+/**********************************************************************
+【函数名称】 Convert
+【函数功能】
+    执行转换，显示进度与报告，出错时显示错误。
+    脚本模式下只显示出错的行号，错误由脚本在最后统一报告。
+【参数】 无
+【返回值】
+    转换发生的错误。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+ConsoleViewBase::Result ConvertConsoleView::Convert() const {
+    function<void(const ControllerBase::ConvertProgress&)> handler;
+    if (!IsScripted()) {
+        Output << Palette::FG_GRAY;
+        Output << "Converting '" << m_Source << "' to '" << m_Target;
+        Output << "'..." << Palette::CLEAR << endl;
+        handler = [this](const ControllerBase::ConvertProgress& progress) {
+            PrintProgress(progress);
+        };
+    }
+    ControllerBase::ConvertReport report;
+    auto result = static_cast<Result>(m_pController->ConvertModel(
+        m_Source, m_Target, report, handler
+    ));
+    if (result != Result::OK) {
+        ShowErrorLine(m_Source);
+    }
+    if (IsScripted()) {
+        return result;
+    }
+    if (result != Result::OK) {
+        Output << Palette::FG_RED;
+        Output << "error: " << ResultToString(result);
+        Output << Palette::CLEAR << endl;
+        return result;
+    }
+    Output << Palette::FG_GREEN;
+    Output << "Successfully converted '" << m_Source << "' to '";
+    Output << m_Target << "'." << Palette::CLEAR << endl;
+    PrintReport(report);
+    return result;
+}
+
+/**********************************************************************
+【函数名称】 PrintProgress
+【函数功能】 输出一行进度，在写入线程中被调用。
+【参数】
+    progress: 当前的进度。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+void ConvertConsoleView::PrintProgress(
+    const ControllerBase::ConvertProgress& progress
+) const {
+    // 先格式化再一次输出，不改变 Output 的格式状态
+    ostringstream line;
+    line << fixed << setprecision(1);
+    line << "  " << progress.Seconds << " s: ";
+    line << progress.VertexCount << " vertices read, ";
+    line << progress.UniqueVertexCount << " written, ";
+    line << progress.LineCount << " lines, ";
+    line << progress.FaceCount << " faces, ";
+    line << progress.ByteCount / 1048576.0 << " MiB";
+    Output << Palette::FG_GRAY << line.str() << Palette::CLEAR << endl;
+}
+
+/**********************************************************************
+【函数名称】 PrintReport
+【函数功能】 输出转换的总计与各阶段耗时。
+【参数】
+    report: 转换的报告。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+void ConvertConsoleView::PrintReport(
+    const ControllerBase::ConvertReport& report
+) const {
+    auto& totals = report.Totals;
+    Output << Palette::FG_PURPLE << "Report:" << Palette::CLEAR << endl;
+    Output << Palette::FG_PURPLE << "  Vertices Read:";
+    Output << Palette::CLEAR << "\t";
+    Output << totals.VertexCount << endl;
+    Output << Palette::FG_PURPLE << "  Vertices Written:";
+    Output << Palette::CLEAR << "\t";
+    Output << totals.UniqueVertexCount << endl;
+    Output << Palette::FG_PURPLE << "  Lines Written:";
+    Output << Palette::CLEAR << "\t";
+    Output << totals.LineCount << endl;
+    Output << Palette::FG_PURPLE << "  Faces Written:";
+    Output << Palette::CLEAR << "\t";
+    Output << totals.FaceCount << endl;
+    Output << Palette::FG_PURPLE << "  Bytes Encoded:";
+    Output << Palette::CLEAR << "\t";
+    Output << totals.ByteCount << endl;
+    Output << Palette::FG_PURPLE << "  Total Seconds:";
+    Output << Palette::CLEAR << "\t";
+    Output << totals.Seconds << endl;
+
+    Output << Palette::FG_PURPLE << "Stages (busy / waiting seconds):";
+    Output << Palette::CLEAR << endl;
+    auto printStage = [this](const string& name, double busy, double wait) {
+        ostringstream line;
+        line << fixed << setprecision(3) << busy << " / " << wait;
+        Output << Palette::FG_PURPLE << "  " << name << ":";
+        Output << Palette::CLEAR << "\t\t" << line.str() << endl;
+    };
+    printStage("Parse", report.Parse.BusySeconds, report.Parse.WaitSeconds);
+    printStage("Dedupe", report.Dedupe.BusySeconds, report.Dedupe.WaitSeconds);
+    printStage("Encode", report.Encode.BusySeconds, report.Encode.WaitSeconds);
+    printStage("Write", report.Write.BusySeconds, report.Write.WaitSeconds);
+}
+
+}
+
+}
+
+}
\ No newline at end of file
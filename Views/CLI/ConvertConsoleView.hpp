@@ -0,0 +1,130 @@
+/*************************************************************************
+【文件名】 ConvertConsoleView.hpp
+【功能模块和目的】 ConvertConsoleView 类是流式转换模型文件格式的视图。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#pragma once
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include "../../Controllers/ControllerBase.hpp"
+#include "ConsoleViewBase.hpp"
+using namespace std;
+using namespace C3w::Controllers;
+
+namespace C3w {
+
+namespace Views {
+
+namespace Cli {
+
+/*************************************************************************
+【类名】 ConvertConsoleView
+【功能】
+    将一个模型文件流式转换为另一格式，显示进度与各阶段耗时。
+    不需要交互，既可由 MainConsoleView 的 convert 命令打开，
+    也可由命令行直接运行。
+【接口说明】 继承自 ConsoleViewBase。执行转换并返回是否成功。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+class ConvertConsoleView: public ConsoleViewBase {
+    public:
+        // 构造函数
+
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】
+            使用控制器、源文件与目标文件路径及标准输入/输出流
+            初始化 ConvertConsoleView 类型实例。由命令行直接运行，
+            显示进度与报告，但输出不带颜色的纯文本。
+        【参数】
+            controller: 控制器指针。
+            source: 源文件路径。
+            target: 目标文件路径。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        ConvertConsoleView(
+            shared_ptr<ControllerBase> controller,
+            const string& source,
+            const string& target
+        );
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】
+            使用控制器、源文件与目标文件路径、指定输入/输出流
+            及打开者是否处于脚本模式初始化 ConvertConsoleView 类型实例。
+        【参数】
+            controller: 控制器指针。
+            source: 源文件路径。
+            target: 目标文件路径。
+            input: 输入流。
+            output: 输出流。
+            isScripted: 是否处于脚本模式。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        ConvertConsoleView(
+            shared_ptr<ControllerBase> controller,
+            const string& source,
+            const string& target,
+            istream& input,
+            ostream& output,
+            bool isScripted
+        );
+
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 Display
+        【函数功能】 执行转换并显示结果。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void Display() const override;
+        /**********************************************************************
+        【函数名称】 Convert
+        【函数功能】
+            执行转换，显示进度与报告，出错时显示错误。
+            脚本模式下只显示出错的行号，错误由脚本在最后统一报告。
+        【参数】 无
+        【返回值】
+            转换发生的错误。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Result Convert() const;
+
+    private:
+        // 源文件路径
+        string m_Source;
+        // 目标文件路径
+        string m_Target;
+
+        /**********************************************************************
+        【函数名称】 PrintProgress
+        【函数功能】 输出一行进度，在写入线程中被调用。
+        【参数】
+            progress: 当前的进度。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void PrintProgress(const ControllerBase::ConvertProgress& progress) const;
+        /**********************************************************************
+        【函数名称】 PrintReport
+        【函数功能】 输出转换的总计与各阶段耗时。
+        【参数】
+            report: 转换的报告。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void PrintReport(const ControllerBase::ConvertReport& report) const;
+};
+
+}
+
+}
+
+}
\ No newline at end of file
@@ -4,9 +4,11 @@
 【开发者及日期】 赵一彤 2024/7/24
 *************************************************************************/
 
+#include <array>
 #include <iostream>
 #include <memory>
 #include <sstream>
+#include <string>
 #include <vector>
 #include "ConsoleViewBase.hpp"
 #include "../../Controllers/ControllerBase.hpp"
@@ -72,6 +74,21 @@ FacesConsoleView::FacesConsoleView(
         bind(&FacesConsoleView::CommandRemoveFace, this),
         "Removes a face from model."
     );
+    RegisterCommand(
+        "ray",
+        bind(&FacesConsoleView::CommandCastRay, this),
+        "Finds the first face hit by a ray."
+    );
+    RegisterCommand(
+        "nearest",
+        bind(&FacesConsoleView::CommandFindClosestPoint, this),
+        "Finds the closest point on faces."
+    );
+    RegisterCommand(
+        "inbox",
+        bind(&FacesConsoleView::CommandFindInBox, this),
+        "Lists faces whose bounds overlap a box."
+    );
 }
 
 /**********************************************************************
@@ -112,10 +129,10 @@ ConsoleViewBase::Result FacesConsoleView::CommandListFaces() const {
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 ConsoleViewBase::Result FacesConsoleView::CommandGetFace() const {
-    istringstream stream(Ask("Index of desired face (1~): "));
+    istringstream stream(AskValues("Index of desired face (1~): ", 1));
     size_t index;
     stream >> index;
-    if (stream.bad()) {
+    if (stream.fail()) {
         return Result::INDEX_OVERFLOW;
     }
     vector<string> points;
@@ -141,36 +158,33 @@ ConsoleViewBase::Result FacesConsoleView::CommandGetFace() const {
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 ConsoleViewBase::Result FacesConsoleView::CommandAddFace() const {
-    istringstream first(Ask("1st point (x y z): "));
-    double x1;
-    double y1;
-    double z1;
-    first >> x1 >> y1 >> z1;
-    if (first.bad()) {
-        return Result::INVALID_VALUE;
-    }
-    istringstream second(Ask("2nd point (x y z): "));
-    double x2;
-    double y2;
-    double z2;
-    second >> x2 >> y2 >> z2;
-    if (second.bad()) {
-        return Result::INVALID_VALUE;
-    }
-    istringstream third(Ask("3rd point (x y z): "));
-    double x3;
-    double y3;
-    double z3;
-    third >> x3 >> y3 >> z3;
-    if (third.bad()) {
-        return Result::INVALID_VALUE;
-    }
+    // 脚本中同一行可以依次给出多个面，一次添加
+    vector<array<double, 9>> faces;
+    do {
+        array<double, 9> face;
+        istringstream first(AskValues("1st point (x y z): ", 3));
+        first >> face[0] >> face[1] >> face[2];
+        if (first.fail()) {
+            return Result::INVALID_VALUE;
+        }
+        istringstream second(AskValues("2nd point (x y z): ", 3));
+        second >> face[3] >> face[4] >> face[5];
+        if (second.fail()) {
+            return Result::INVALID_VALUE;
+        }
+        istringstream third(AskValues("3rd point (x y z): ", 3));
+        third >> face[6] >> face[7] >> face[8];
+        if (third.fail()) {
+            return Result::INVALID_VALUE;
+        }
+        faces.push_back(face);
+    } while (HasMoreValues());
+    vector<ControllerBase::Result> results;
     auto result = static_cast<Result>(
-        m_pController->AddFace(x1, y1, z1, x2, y2, z2, x3, y3, z3)
+        m_pController->AddFaces(faces, results)
     );
     if (result == Result::OK) {
-        Output << Palette::FG_GREEN << "Successfully added face.";
-        Output << Palette::CLEAR << endl;
+        ShowSuccess("Successfully added face.");
     }
     return result;
 }
@@ -185,63 +199,208 @@ ConsoleViewBase::Result FacesConsoleView::CommandAddFace() const {
 **********************************************************************/
 ConsoleViewBase::Result FacesConsoleView::CommandModifyFace() const {
     vector<string> choices;
-    for (auto& face: m_pController->GetFaces()) {
-        choices.push_back(face.String);
+    // 脚本模式下不显示选项，无需生成
+    if (!IsScripted()) {
+        for (auto& face: m_pController->GetFaces()) {
+            choices.push_back(face.String);
+        }
     }
-    size_t index = Select("Select a face to modify:", choices);
-    if (index == 0) {
-        return Result::INVALID_VALUE;
+    // 脚本中同一行可以依次给出多项修改，一次执行
+    vector<ControllerBase::PointEdit> edits;
+    do {
+        size_t index = Select("Select a face to modify:", choices);
+        if (index == 0) {
+            return Result::INVALID_VALUE;
+        }
+        vector<string> points;
+        if (!IsScripted()) {
+            auto result = static_cast<Result>(
+                m_pController->GetFacePoints(index - 1, points)
+            );
+            if (result != Result::OK) {
+                return result;
+            }
+        }
+        size_t pointIndex = Select("Select a point to modify:", points);
+        if (pointIndex == 0) {
+            return Result::INVALID_VALUE;
+        }
+        istringstream coords(AskValues("Set point to (x y z): ", 3));
+        double x;
+        double y;
+        double z;
+        coords >> x >> y >> z;
+        if (coords.fail()) {
+            return Result::INVALID_VALUE;
+        }
+        edits.push_back({ index - 1, pointIndex - 1, x, y, z });
+    } while (HasMoreValues());
+    vector<ControllerBase::Result> results;
+    auto result = static_cast<Result>(
+        m_pController->ModifyFaces(edits, results)
+    );
+    if (result == Result::OK) {
+        ShowSuccess(
+            "Successfully modified face #" + to_string(edits[0].Index + 1)
+                + "."
+        );
+    }
+    return result;
+}
+
+/**********************************************************************
+【函数名称】 CommandRemoveFace
+【函数功能】 实现 del 命令。
+【参数】 无
+【返回值】
+    命令发生的错误。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+ConsoleViewBase::Result FacesConsoleView::CommandRemoveFace() const {
+    vector<string> choices;
+    // 脚本模式下不显示选项，无需生成
+    if (!IsScripted()) {
+        for (auto& face: m_pController->GetFaces()) {
+            choices.push_back(face.String);
+        }
     }
-    choices.clear();
+    // 脚本中同一行可以给出多个下标，均指删除前的位置，一次删除
+    vector<size_t> indices;
+    do {
+        size_t index = Select("Select a face to delete:", choices);
+        if (index == 0) {
+            return Result::INVALID_VALUE;
+        }
+        indices.push_back(index - 1);
+    } while (HasMoreValues());
+    vector<ControllerBase::Result> results;
     auto result = static_cast<Result>(
-        m_pController->GetFacePoints(index - 1, choices)
+        m_pController->RemoveFaces(indices, results)
     );
-    if (result != Result::OK) {
-        return result;
+    if (result == Result::OK) {
+        ShowSuccess(
+            "Successfully deleted face #" + to_string(indices[0] + 1) + "."
+        );
+    }
+    return result;
+}
+
+/**********************************************************************
+【函数名称】 CommandCastRay
+【函数功能】 实现 ray 命令。
+【参数】 无
+【返回值】
+    命令发生的错误。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+ConsoleViewBase::Result FacesConsoleView::CommandCastRay() const {
+    istringstream origin(AskValues("Origin (x y z): ", 3));
+    double ox;
+    double oy;
+    double oz;
+    origin >> ox >> oy >> oz;
+    if (origin.fail()) {
+        return Result::INVALID_VALUE;
     }
-    size_t pointIndex = Select("Select a point to modify:", choices);
-    if (pointIndex == 0) {
+    istringstream direction(AskValues("Direction (x y z): ", 3));
+    double dx;
+    double dy;
+    double dz;
+    direction >> dx >> dy >> dz;
+    if (direction.fail()) {
         return Result::INVALID_VALUE;
     }
-    istringstream coords(Ask("Set point to (x y z): "));
+    bool isHit;
+    ControllerBase::FaceQueryResult hit;
+    auto result = static_cast<Result>(
+        m_pController->CastRay(ox, oy, oz, dx, dy, dz, isHit, hit)
+    );
+    if (result == Result::OK) {
+        if (isHit) {
+            Output << Palette::FG_PURPLE << "Hit face #" << hit.FaceIndex + 1;
+            Output << Palette::CLEAR << " at " << hit.Position;
+            Output << ", distance " << hit.Distance << "." << endl;
+        }
+        else {
+            Output << Palette::FG_GRAY << "No face is hit.";
+            Output << Palette::CLEAR << endl;
+        }
+    }
+    return result;
+}
+
+/**********************************************************************
+【函数名称】 CommandFindClosestPoint
+【函数功能】 实现 nearest 命令。
+【参数】 无
+【返回值】
+    命令发生的错误。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+ConsoleViewBase::Result FacesConsoleView::CommandFindClosestPoint() const {
+    istringstream stream(AskValues("Point (x y z): ", 3));
     double x;
     double y;
     double z;
-    coords >> x >> y >> z;
-    if (coords.bad()) {
+    stream >> x >> y >> z;
+    if (stream.fail()) {
         return Result::INVALID_VALUE;
     }
-    result = static_cast<Result>(
-        m_pController->ModifyFace(index - 1, pointIndex - 1, x, y, z)
+    bool isFound;
+    ControllerBase::FaceQueryResult hit;
+    auto result = static_cast<Result>(
+        m_pController->FindClosestFacePoint(x, y, z, isFound, hit)
     );
     if (result == Result::OK) {
-        Output << Palette::FG_GREEN << "Successfully modified face #" << index;
-        Output << "." << Palette::CLEAR << endl;
+        if (isFound) {
+            Output << Palette::FG_PURPLE << "Closest point on face #";
+            Output << hit.FaceIndex + 1 << Palette::CLEAR;
+            Output << " is " << hit.Position;
+            Output << ", distance " << hit.Distance << "." << endl;
+        }
+        else {
+            Output << Palette::FG_GRAY << "Model has no faces.";
+            Output << Palette::CLEAR << endl;
+        }
     }
     return result;
 }
 
 /**********************************************************************
-【函数名称】 CommandRemoveFace
-【函数功能】 实现 del 命令。
+【函数名称】 CommandFindInBox
+【函数功能】 实现 inbox 命令。
 【参数】 无
 【返回值】
     命令发生的错误。
-【开发者及日期】 赵一彤 2024/7/24
+【开发者及日期】 赵一彤 2026/10/17
 **********************************************************************/
-ConsoleViewBase::Result FacesConsoleView::CommandRemoveFace() const {
-    vector<string> choices;
-    for (auto& face: m_pController->GetFaces()) {
-        choices.push_back(face.String);
+ConsoleViewBase::Result FacesConsoleView::CommandFindInBox() const {
+    istringstream first(AskValues("1st vertex (x y z): ", 3));
+    double x1;
+    double y1;
+    double z1;
+    first >> x1 >> y1 >> z1;
+    if (first.fail()) {
+        return Result::INVALID_VALUE;
     }
-    size_t index = Select("Select a face to delete:", choices);
-    if (index == 0) {
+    istringstream second(AskValues("2nd vertex (x y z): ", 3));
+    double x2;
+    double y2;
+    double z2;
+    second >> x2 >> y2 >> z2;
+    if (second.fail()) {
         return Result::INVALID_VALUE;
     }
-    auto result = static_cast<Result>(m_pController->RemoveFace(index - 1));
+    vector<size_t> indices;
+    auto result = static_cast<Result>(
+        m_pController->FindFacesInBox(x1, y1, z1, x2, y2, z2, indices)
+    );
     if (result == Result::OK) {
-        Output << Palette::FG_GREEN << "Successfully deleted face #" << index;
-        Output << "." << Palette::CLEAR << endl;
+        Output << Palette::FG_BLUE << "Faces overlapping box (";
+        Output << indices.size() << "):" << Palette::CLEAR << endl;
+        for (auto index: indices) {
+            Output << "  #" << index + 1 << endl;
+        }
     }
     return result;
 }
@@ -102,6 +102,33 @@ class FacesConsoleView: public ConsoleViewBase {
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
         Result CommandRemoveFace() const;
+        /**********************************************************************
+        【函数名称】 CommandCastRay
+        【函数功能】 实现 ray 命令。
+        【参数】 无
+        【返回值】
+            命令发生的错误。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Result CommandCastRay() const;
+        /**********************************************************************
+        【函数名称】 CommandFindClosestPoint
+        【函数功能】 实现 nearest 命令。
+        【参数】 无
+        【返回值】
+            命令发生的错误。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Result CommandFindClosestPoint() const;
+        /**********************************************************************
+        【函数名称】 CommandFindInBox
+        【函数功能】 实现 inbox 命令。
+        【参数】 无
+        【返回值】
+            命令发生的错误。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Result CommandFindInBox() const;
 };
 
 }
@@ -4,9 +4,11 @@
 【开发者及日期】 赵一彤 2024/7/24
 *************************************************************************/
 
+#include <array>
 #include <iostream>
 #include <memory>
 #include <sstream>
+#include <string>
 #include <vector>
 #include "ConsoleViewBase.hpp"
 #include "../../Controllers/ControllerBase.hpp"
@@ -112,10 +114,10 @@ ConsoleViewBase::Result LinesConsoleView::CommandListLines() const {
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 ConsoleViewBase::Result LinesConsoleView::CommandGetLine() const {
-    istringstream stream(Ask("Index of desired line (1~): "));
+    istringstream stream(AskValues("Index of desired line (1~): ", 1));
     size_t index;
     stream >> index;
-    if (stream.bad()) {
+    if (stream.fail()) {
         return Result::INDEX_OVERFLOW;
     }
     vector<string> points;
@@ -141,28 +143,28 @@ ConsoleViewBase::Result LinesConsoleView::CommandGetLine() const {
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 ConsoleViewBase::Result LinesConsoleView::CommandAddLine() const {
-    istringstream first(Ask("1st point (x y z): "));
-    double x1;
-    double y1;
-    double z1;
-    first >> x1 >> y1 >> z1;
-    if (first.bad()) {
-        return Result::INVALID_VALUE;
-    }
-    istringstream second(Ask("2nd point (x y z): "));
-    double x2;
-    double y2;
-    double z2;
-    second >> x2 >> y2 >> z2;
-    if (second.bad()) {
-        return Result::INVALID_VALUE;
-    }
+    // 脚本中同一行可以依次给出多条线段，一次添加
+    vector<array<double, 6>> lines;
+    do {
+        array<double, 6> line;
+        istringstream first(AskValues("1st point (x y z): ", 3));
+        first >> line[0] >> line[1] >> line[2];
+        if (first.fail()) {
+            return Result::INVALID_VALUE;
+        }
+        istringstream second(AskValues("2nd point (x y z): ", 3));
+        second >> line[3] >> line[4] >> line[5];
+        if (second.fail()) {
+            return Result::INVALID_VALUE;
+        }
+        lines.push_back(line);
+    } while (HasMoreValues());
+    vector<ControllerBase::Result> results;
     auto result = static_cast<Result>(
-        m_pController->AddLine(x1, y1, z1, x2, y2, z2)
+        m_pController->AddLines(lines, results)
     );
     if (result == Result::OK) {
-        Output << Palette::FG_GREEN << "Successfully added line.";
-        Output << Palette::CLEAR << endl;
+        ShowSuccess("Successfully added line.");
     }
     return result;
 }
@@ -177,38 +179,51 @@ ConsoleViewBase::Result LinesConsoleView::CommandAddLine() const {
 **********************************************************************/
 ConsoleViewBase::Result LinesConsoleView::CommandModifyLine() const {
     vector<string> choices;
-    for (auto& line: m_pController->GetLines()) {
-        choices.push_back(line.String);
-    }
-    size_t index = Select("Select a line to modify:", choices);
-    if (index == 0) {
-        return Result::INVALID_VALUE;
+    // 脚本模式下不显示选项，无需生成
+    if (!IsScripted()) {
+        for (auto& line: m_pController->GetLines()) {
+            choices.push_back(line.String);
+        }
     }
-    choices.clear();
+    // 脚本中同一行可以依次给出多项修改，一次执行
+    vector<ControllerBase::PointEdit> edits;
+    do {
+        size_t index = Select("Select a line to modify:", choices);
+        if (index == 0) {
+            return Result::INVALID_VALUE;
+        }
+        vector<string> points;
+        if (!IsScripted()) {
+            auto result = static_cast<Result>(
+                m_pController->GetLinePoints(index - 1, points)
+            );
+            if (result != Result::OK) {
+                return result;
+            }
+        }
+        size_t pointIndex = Select("Select a point to modify:", points);
+        if (pointIndex == 0) {
+            return Result::INVALID_VALUE;
+        }
+        istringstream coords(AskValues("Set point to (x y z): ", 3));
+        double x;
+        double y;
+        double z;
+        coords >> x >> y >> z;
+        if (coords.fail()) {
+            return Result::INVALID_VALUE;
+        }
+        edits.push_back({ index - 1, pointIndex - 1, x, y, z });
+    } while (HasMoreValues());
+    vector<ControllerBase::Result> results;
     auto result = static_cast<Result>(
-        m_pController->GetLinePoints(index - 1, choices)
-    );
-    if (result != Result::OK) {
-        return result;
-    }
-    size_t pointIndex = Select("Select a point to modify:", choices);
-    if (pointIndex == 0) {
-        return Result::INVALID_VALUE;
-    }
-    istringstream coords(Ask("Set point to (x y z): "));
-    double x;
-    double y;
-    double z;
-    coords >> x >> y >> z;
-    if (coords.bad()) {
-        return Result::INVALID_VALUE;
-    }
-    result = static_cast<Result>(
-        m_pController->ModifyLine(index - 1, pointIndex - 1, x, y, z)
+        m_pController->ModifyLines(edits, results)
     );
     if (result == Result::OK) {
-        Output << Palette::FG_GREEN << "Successfully modified line #" << index;
-        Output << "." << Palette::CLEAR << endl;
+        ShowSuccess(
+            "Successfully modified line #" + to_string(edits[0].Index + 1)
+                + "."
+        );
     }
     return result;
 }
@@ -223,17 +238,29 @@ ConsoleViewBase::Result LinesConsoleView::CommandModifyLine() const {
 **********************************************************************/
 ConsoleViewBase::Result LinesConsoleView::CommandRemoveLine() const {
     vector<string> choices;
-    for (auto& line: m_pController->GetLines()) {
-        choices.push_back(line.String);
-    }
-    size_t index = Select("Select a line to delete:", choices);
-    if (index == 0) {
-        return Result::INVALID_VALUE;
+    // 脚本模式下不显示选项，无需生成
+    if (!IsScripted()) {
+        for (auto& line: m_pController->GetLines()) {
+            choices.push_back(line.String);
+        }
     }
-    auto result = static_cast<Result>(m_pController->RemoveLine(index - 1));
+    // 脚本中同一行可以给出多个下标，均指删除前的位置，一次删除
+    vector<size_t> indices;
+    do {
+        size_t index = Select("Select a line to delete:", choices);
+        if (index == 0) {
+            return Result::INVALID_VALUE;
+        }
+        indices.push_back(index - 1);
+    } while (HasMoreValues());
+    vector<ControllerBase::Result> results;
+    auto result = static_cast<Result>(
+        m_pController->RemoveLines(indices, results)
+    );
     if (result == Result::OK) {
-        Output << Palette::FG_GREEN << "Successfully deleted line #" << index;
-        Output << "." << Palette::CLEAR << endl;
+        ShowSuccess(
+            "Successfully deleted line #" + to_string(indices[0] + 1) + "."
+        );
     }
     return result;
 }
@@ -4,10 +4,15 @@
 【开发者及日期】 赵一彤 2024/7/24
 *************************************************************************/
 
+#include <array>
 #include <functional>
 #include <memory>
 #include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
 #include "ConsoleViewBase.hpp"
+#include "ConvertConsoleView.hpp"
 #include "LinesConsoleView.hpp"
 #include "FacesConsoleView.hpp"
 #include "../../Controllers/ControllerBase.hpp"
@@ -46,7 +51,9 @@ MainConsoleView::MainConsoleView(
     shared_ptr<ControllerBase> controller, 
     istream& input, 
     ostream& output
-): ConsoleViewBase(controller, input, output) {
+): ConsoleViewBase(controller, input, output),
+    m_Lines(controller, input, output),
+    m_Faces(controller, input, output) {
     m_Prompt = "#> ";
     RegisterCommand(
         "stat", 
@@ -68,6 +75,56 @@ MainConsoleView::MainConsoleView(
         bind(&MainConsoleView::CommandFacesView, this),
         "Enter Face3D context."
     );
+    RegisterCommand(
+        "transform",
+        bind(&MainConsoleView::CommandTransform, this),
+        "Transform the whole model."
+    );
+    RegisterCommand(
+        "within",
+        bind(&MainConsoleView::CommandFindInRadius, this),
+        "Find points within a radius."
+    );
+    RegisterCommand(
+        "knn",
+        bind(&MainConsoleView::CommandFindNearest, this),
+        "Find the k nearest points."
+    );
+    RegisterCommand(
+        "pbox",
+        bind(&MainConsoleView::CommandFindPointsInBox, this),
+        "Find points inside a box."
+    );
+    RegisterCommand(
+        "weld",
+        bind(&MainConsoleView::CommandWeld, this),
+        "Merge points closer than a tolerance."
+    );
+    RegisterCommand(
+        "diff",
+        bind(&MainConsoleView::CommandDiff, this),
+        "Compare with another model file."
+    );
+    RegisterCommand(
+        "scan",
+        bind(&MainConsoleView::CommandScan, this),
+        "Display statistics of a model file without loading it."
+    );
+    RegisterCommand(
+        "convert",
+        bind(&MainConsoleView::CommandConvert, this),
+        "Convert a model file to another format without loading it."
+    );
+    RegisterCommand(
+        "undo",
+        bind(&MainConsoleView::CommandUndo, this),
+        "Undo the last edit or transform."
+    );
+    RegisterCommand(
+        "redo",
+        bind(&MainConsoleView::CommandRedo, this),
+        "Redo the last undone operation."
+    );
 }
 
 /**********************************************************************
@@ -81,17 +138,32 @@ void MainConsoleView::Display() const {
     auto path = Ask("Enter model path: ", true);
     auto result = static_cast<Result>(m_pController->LoadModel(path));
     if (result != Result::OK) {
+        ShowErrorLine(path);
         Output << Palette::FG_RED;
         Output << "error: " << ResultToString(result); 
         Output << Palette::CLEAR << endl;
         return;
     }
-    Output << Palette::FG_GREEN;
-    Output << "Successfully loaded model '" << m_pController->GetName() << "'.";
-    Output << Palette::CLEAR << endl;
+    ShowSuccess(
+        "Successfully loaded model '" + m_pController->GetName() + "'."
+    );
     ConsoleViewBase::Display();
 }
 
+/**********************************************************************
+【函数名称】 SetScripted
+【函数功能】 设置自身与 lines、faces 子视图是否处于脚本模式。
+【参数】
+    isScripted: 是否处于脚本模式。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+void MainConsoleView::SetScripted(bool isScripted) {
+    ConsoleViewBase::SetScripted(isScripted);
+    m_Lines.SetScripted(isScripted);
+    m_Faces.SetScripted(isScripted);
+}
+
 /**********************************************************************
 【函数名称】 CommandLinesView
 【函数功能】 实现 lines 命令。
@@ -101,7 +173,11 @@ void MainConsoleView::Display() const {
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 ConsoleViewBase::Result MainConsoleView::CommandLinesView() const {
-    LinesConsoleView(m_pController).Display();
+    if (IsScripted()) {
+        // 脚本中的 "lines add ..." 将其余部分交给子视图执行
+        return m_Lines.Execute(Ask("", true));
+    }
+    m_Lines.Display();
     return Result::OK;
 }
 
@@ -114,7 +190,10 @@ ConsoleViewBase::Result MainConsoleView::CommandLinesView() const {
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 ConsoleViewBase::Result MainConsoleView::CommandFacesView() const {
-    FacesConsoleView(m_pController).Display();
+    if (IsScripted()) {
+        return m_Faces.Execute(Ask("", true));
+    }
+    m_Faces.Display();
     return Result::OK;
 }
 
@@ -127,8 +206,390 @@ ConsoleViewBase::Result MainConsoleView::CommandFacesView() const {
 【开发者及日期】 赵一彤 2024/7/24
 **********************************************************************/
 ConsoleViewBase::Result MainConsoleView::CommandShowStatistics() const {
-    auto stat = m_pController->GetStatistics();
-    
+    PrintStatistics(m_pController->GetStatistics());
+    return Result::OK;
+}
+
+/**********************************************************************
+【函数名称】 CommandSaveModel
+【函数功能】 实现 save 命令。
+【参数】 无
+【返回值】
+    命令发生的错误。
+【开发者及日期】 赵一彤 2024/7/24
+**********************************************************************/
+ConsoleViewBase::Result MainConsoleView::CommandSaveModel() const {
+    if (!IsScripted()) {
+        Output << Palette::FG_GRAY;
+        Output << "(Enter nothing to use original file name)";
+        Output << Palette::CLEAR << std::endl;
+    }
+    std::string fileName = Ask("Save to: ", true);
+    auto result = static_cast<Result>(m_pController->SaveModel(fileName));
+    if (result == Result::OK) {
+        ShowSuccess(
+            "Successfully saved model '" + m_pController->GetName() + "'."
+        );
+    }
+    return result;
+}
+
+/**********************************************************************
+【函数名称】 CommandTransform
+【函数功能】 实现 transform 命令。
+【参数】 无
+【返回值】
+    命令发生的错误。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+ConsoleViewBase::Result MainConsoleView::CommandTransform() const {
+    auto kind = Select(
+        "Transform kind: ",
+        { "Move", "Scale about a point", "Affine (x' = Ax + b)" }
+    );
+    Result result;
+    bool isInjective = true;
+    switch (kind) {
+        case 1: {
+            istringstream delta(AskValues("Offset (x y z): ", 3));
+            double x;
+            double y;
+            double z;
+            delta >> x >> y >> z;
+            if (delta.fail()) {
+                return Result::INVALID_VALUE;
+            }
+            result = static_cast<Result>(m_pController->Translate(x, y, z));
+            break;
+        }
+        case 2: {
+            istringstream ref(AskValues("Reference point (x y z): ", 3));
+            double x;
+            double y;
+            double z;
+            ref >> x >> y >> z;
+            if (ref.fail()) {
+                return Result::INVALID_VALUE;
+            }
+            istringstream ratio(AskValues("Ratio: ", 1));
+            double r;
+            ratio >> r;
+            if (ratio.fail()) {
+                return Result::INVALID_VALUE;
+            }
+            result = static_cast<Result>(
+                m_pController->Scale(x, y, z, r, isInjective)
+            );
+            break;
+        }
+        case 3: {
+            array<array<double, 3>, 3> linear;
+            for (size_t i = 0; i < 3; i++) {
+                istringstream row(AskValues(
+                    "Row " + to_string(i + 1) + " of A (a b c): ",
+                    3
+                ));
+                row >> linear[i][0] >> linear[i][1] >> linear[i][2];
+                if (row.fail()) {
+                    return Result::INVALID_VALUE;
+                }
+            }
+            array<double, 3> offset;
+            istringstream delta(AskValues("b (x y z): ", 3));
+            delta >> offset[0] >> offset[1] >> offset[2];
+            if (delta.fail()) {
+                return Result::INVALID_VALUE;
+            }
+            result = static_cast<Result>(
+                m_pController->Transform(linear, offset, isInjective)
+            );
+            break;
+        }
+        default: {
+            return Result::INVALID_VALUE;
+        }
+    }
+    if (result == Result::OK) {
+        ShowSuccess(
+            "Successfully transformed model '" + m_pController->GetName()
+                + "'."
+        );
+        if (!isInjective) {
+            Output << Palette::FG_GRAY;
+            Output << "(Transform is not injective and cannot be undone; ";
+            Output << "undo history was cleared)";
+            Output << Palette::CLEAR << endl;
+        }
+    }
+    return result;
+}
+
+/**********************************************************************
+【函数名称】 CommandFindInRadius
+【函数功能】 实现 within 命令。
+【参数】 无
+【返回值】
+    命令发生的错误。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+ConsoleViewBase::Result MainConsoleView::CommandFindInRadius() const {
+    istringstream center(AskValues("Center (x y z): ", 3));
+    double x;
+    double y;
+    double z;
+    center >> x >> y >> z;
+    if (center.fail()) {
+        return Result::INVALID_VALUE;
+    }
+    istringstream stream(AskValues("Radius: ", 1));
+    double radius;
+    stream >> radius;
+    if (stream.fail() || radius < 0) {
+        return Result::INVALID_VALUE;
+    }
+    vector<ControllerBase::PointQueryResult> points;
+    auto result = static_cast<Result>(
+        m_pController->FindPointsInRadius(x, y, z, radius, points)
+    );
+    if (result == Result::OK) {
+        Output << Palette::FG_BLUE << "Points within radius (";
+        Output << points.size() << "):" << Palette::CLEAR << endl;
+        for (auto& point: points) {
+            Output << "  " << point.Position;
+            Output << ", distance " << point.Distance << endl;
+        }
+    }
+    return result;
+}
+
+/**********************************************************************
+【函数名称】 CommandFindNearest
+【函数功能】 实现 knn 命令。
+【参数】 无
+【返回值】
+    命令发生的错误。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+ConsoleViewBase::Result MainConsoleView::CommandFindNearest() const {
+    istringstream center(AskValues("Point (x y z): ", 3));
+    double x;
+    double y;
+    double z;
+    center >> x >> y >> z;
+    if (center.fail()) {
+        return Result::INVALID_VALUE;
+    }
+    istringstream stream(AskValues("Count: ", 1));
+    size_t count;
+    stream >> count;
+    if (stream.fail()) {
+        return Result::INVALID_VALUE;
+    }
+    vector<ControllerBase::PointQueryResult> points;
+    auto result = static_cast<Result>(
+        m_pController->FindNearestPoints(x, y, z, count, points)
+    );
+    if (result == Result::OK) {
+        Output << Palette::FG_BLUE << "Nearest points (";
+        Output << points.size() << "):" << Palette::CLEAR << endl;
+        for (auto& point: points) {
+            Output << "  " << point.Position;
+            Output << ", distance " << point.Distance << endl;
+        }
+    }
+    return result;
+}
+
+/**********************************************************************
+【函数名称】 CommandFindPointsInBox
+【函数功能】 实现 pbox 命令。
+【参数】 无
+【返回值】
+    命令发生的错误。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+ConsoleViewBase::Result MainConsoleView::CommandFindPointsInBox() const {
+    istringstream first(AskValues("1st vertex (x y z): ", 3));
+    double x1;
+    double y1;
+    double z1;
+    first >> x1 >> y1 >> z1;
+    if (first.fail()) {
+        return Result::INVALID_VALUE;
+    }
+    istringstream second(AskValues("2nd vertex (x y z): ", 3));
+    double x2;
+    double y2;
+    double z2;
+    second >> x2 >> y2 >> z2;
+    if (second.fail()) {
+        return Result::INVALID_VALUE;
+    }
+    vector<string> points;
+    auto result = static_cast<Result>(
+        m_pController->FindPointsInBox(x1, y1, z1, x2, y2, z2, points)
+    );
+    if (result == Result::OK) {
+        Output << Palette::FG_BLUE << "Points inside box (";
+        Output << points.size() << "):" << Palette::CLEAR << endl;
+        for (auto& point: points) {
+            Output << "  " << point << endl;
+        }
+    }
+    return result;
+}
+
+/**********************************************************************
+【函数名称】 CommandWeld
+【函数功能】 实现 weld 命令。
+【参数】 无
+【返回值】
+    命令发生的错误。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+ConsoleViewBase::Result MainConsoleView::CommandWeld() const {
+    istringstream stream(AskValues("Tolerance: ", 1));
+    double epsilon;
+    stream >> epsilon;
+    if (stream.fail() || !(epsilon > 0)) {
+        return Result::INVALID_VALUE;
+    }
+    ControllerBase::WeldResult welded;
+    auto result = static_cast<Result>(m_pController->Weld(epsilon, welded));
+    if (result == Result::OK) {
+        Output << Palette::FG_GREEN;
+        Output << "Welded " << welded.MovedPointCount << " point(s), removed ";
+        Output << welded.RemovedLineCount << " line(s) and ";
+        Output << welded.RemovedFaceCount << " face(s).";
+        Output << Palette::CLEAR << endl;
+    }
+    return result;
+}
+
+/**********************************************************************
+【函数名称】 CommandDiff
+【函数功能】 实现 diff 命令。
+【参数】 无
+【返回值】
+    命令发生的错误。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+ConsoleViewBase::Result MainConsoleView::CommandDiff() const {
+    auto path = Ask("Compare with: ", true);
+    ControllerBase::DiffResult diff;
+    auto result = static_cast<Result>(m_pController->DiffModel(path, diff));
+    if (result == Result::OK) {
+        Output << Palette::FG_BLUE << "Lines (+" << diff.AddedLines.size();
+        Output << " -" << diff.RemovedLines.size() << "):";
+        Output << Palette::CLEAR << endl;
+        for (auto& line: diff.AddedLines) {
+            Output << Palette::FG_GREEN << "  + " << line;
+            Output << Palette::CLEAR << endl;
+        }
+        for (auto& line: diff.RemovedLines) {
+            Output << Palette::FG_RED << "  - " << line;
+            Output << Palette::CLEAR << endl;
+        }
+        Output << Palette::FG_BLUE << "Faces (+" << diff.AddedFaces.size();
+        Output << " -" << diff.RemovedFaces.size() << "):";
+        Output << Palette::CLEAR << endl;
+        for (auto& face: diff.AddedFaces) {
+            Output << Palette::FG_GREEN << "  + " << face;
+            Output << Palette::CLEAR << endl;
+        }
+        for (auto& face: diff.RemovedFaces) {
+            Output << Palette::FG_RED << "  - " << face;
+            Output << Palette::CLEAR << endl;
+        }
+    }
+    else {
+        ShowErrorLine(path);
+    }
+    return result;
+}
+
+/**********************************************************************
+【函数名称】 CommandScan
+【函数功能】 实现 scan 命令。
+【参数】 无
+【返回值】
+    命令发生的错误。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+ConsoleViewBase::Result MainConsoleView::CommandScan() const {
+    auto path = Ask("Scan file: ", true);
+    ControllerBase::Statistics stat;
+    auto result = static_cast<Result>(m_pController->ScanModel(path, stat));
+    if (result == Result::OK) {
+        PrintStatistics(stat);
+    }
+    else {
+        ShowErrorLine(path);
+    }
+    return result;
+}
+
+/**********************************************************************
+【函数名称】 CommandConvert
+【函数功能】 实现 convert 命令。
+【参数】 无
+【返回值】
+    命令发生的错误。交互时转换的错误已由 ConvertConsoleView 显示，
+    返回 OK；脚本模式下返回转换的错误，由脚本统一报告。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+ConsoleViewBase::Result MainConsoleView::CommandConvert() const {
+    auto source = AskValues("Convert from: ", 1);
+    auto target = Ask("Convert to: ", true);
+    auto result = ConvertConsoleView(
+        m_pController, source, target, Input, Output, IsScripted()
+    ).Convert();
+    return IsScripted() ? result : Result::OK;
+}
+
+/**********************************************************************
+【函数名称】 CommandUndo
+【函数功能】 实现 undo 命令。
+【参数】 无
+【返回值】
+    命令发生的错误。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+ConsoleViewBase::Result MainConsoleView::CommandUndo() const {
+    auto result = static_cast<Result>(m_pController->Undo());
+    if (result == Result::OK) {
+        ShowSuccess("Undone.");
+    }
+    return result;
+}
+
+/**********************************************************************
+【函数名称】 CommandRedo
+【函数功能】 实现 redo 命令。
+【参数】 无
+【返回值】
+    命令发生的错误。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+ConsoleViewBase::Result MainConsoleView::CommandRedo() const {
+    auto result = static_cast<Result>(m_pController->Redo());
+    if (result == Result::OK) {
+        ShowSuccess("Redone.");
+    }
+    return result;
+}
+
+/**********************************************************************
+【函数名称】 PrintStatistics
+【函数功能】 输出统计信息，stat 与 scan 命令共用。
+【参数】
+    stat: 要输出的统计信息。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+void MainConsoleView::PrintStatistics(
+    const ControllerBase::Statistics& stat
+) const {
     Output << Palette::FG_PURPLE << "Statistics:" << Palette::CLEAR << endl;
     Output << Palette::FG_PURPLE << "  Total Point Count:";
     Output << Palette::CLEAR << "\t";
@@ -148,30 +609,6 @@ ConsoleViewBase::Result MainConsoleView::CommandShowStatistics() const {
     Output << Palette::FG_PURPLE << "  Bounding Box Volume:";
     Output << Palette::CLEAR << "\t";
     Output << stat.BoundingBoxVolume << std::endl;
-
-    return Result::OK;
-}
-
-/**********************************************************************
-【函数名称】 CommandSaveModel
-【函数功能】 实现 save 命令。
-【参数】 无
-【返回值】
-    命令发生的错误。
-【开发者及日期】 赵一彤 2024/7/24
-**********************************************************************/
-ConsoleViewBase::Result MainConsoleView::CommandSaveModel() const {
-    Output << Palette::FG_GRAY;
-    Output << "(Enter nothing to use original file name)";
-    Output << Palette::CLEAR << std::endl;
-    std::string fileName = Ask("Save to: ", true);
-    auto result = static_cast<Result>(m_pController->SaveModel(fileName));
-    if (result == Result::OK) {
-        Output << Palette::FG_GREEN;
-        Output << "Successfully saved model '" << m_pController->GetName();
-        Output << "'." << Palette::CLEAR << endl;
-    }
-    return result;
 }
 
 }
@@ -8,6 +8,8 @@
 
 #include "../../Controllers/ControllerBase.hpp"
 #include "ConsoleViewBase.hpp"
+#include "FacesConsoleView.hpp"
+#include "LinesConsoleView.hpp"
 using namespace std;
 using namespace C3w::Controllers;
 
@@ -64,8 +66,22 @@ class MainConsoleView: public ConsoleViewBase {
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
         void Display() const override;
+        /**********************************************************************
+        【函数名称】 SetScripted
+        【函数功能】 设置自身与 lines、faces 子视图是否处于脚本模式。
+        【参数】
+            isScripted: 是否处于脚本模式。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void SetScripted(bool isScripted) override;
     
     private:
+        // lines 命令进入的子视图
+        LinesConsoleView m_Lines;
+        // faces 命令进入的子视图
+        FacesConsoleView m_Faces;
+
         /**********************************************************************
         【函数名称】 CommandLinesView
         【函数功能】 实现 lines 命令。
@@ -102,6 +118,106 @@ class MainConsoleView: public ConsoleViewBase {
         【开发者及日期】 赵一彤 2024/7/24
         **********************************************************************/
         Result CommandSaveModel() const;
+        /**********************************************************************
+        【函数名称】 CommandTransform
+        【函数功能】 实现 transform 命令。
+        【参数】 无
+        【返回值】
+            命令发生的错误。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Result CommandTransform() const;
+        /**********************************************************************
+        【函数名称】 CommandFindInRadius
+        【函数功能】 实现 within 命令。
+        【参数】 无
+        【返回值】
+            命令发生的错误。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Result CommandFindInRadius() const;
+        /**********************************************************************
+        【函数名称】 CommandFindNearest
+        【函数功能】 实现 knn 命令。
+        【参数】 无
+        【返回值】
+            命令发生的错误。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Result CommandFindNearest() const;
+        /**********************************************************************
+        【函数名称】 CommandFindPointsInBox
+        【函数功能】 实现 pbox 命令。
+        【参数】 无
+        【返回值】
+            命令发生的错误。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Result CommandFindPointsInBox() const;
+        /**********************************************************************
+        【函数名称】 CommandWeld
+        【函数功能】 实现 weld 命令。
+        【参数】 无
+        【返回值】
+            命令发生的错误。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Result CommandWeld() const;
+        /**********************************************************************
+        【函数名称】 CommandDiff
+        【函数功能】 实现 diff 命令。
+        【参数】 无
+        【返回值】
+            命令发生的错误。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Result CommandDiff() const;
+        /**********************************************************************
+        【函数名称】 CommandScan
+        【函数功能】 实现 scan 命令。
+        【参数】 无
+        【返回值】
+            命令发生的错误。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Result CommandScan() const;
+        /**********************************************************************
+        【函数名称】 CommandConvert
+        【函数功能】 实现 convert 命令。
+        【参数】 无
+        【返回值】
+            命令发生的错误。交互时转换的错误已由 ConvertConsoleView 显示，
+            返回 OK；脚本模式下返回转换的错误，由脚本统一报告。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Result CommandConvert() const;
+        /**********************************************************************
+        【函数名称】 CommandUndo
+        【函数功能】 实现 undo 命令。
+        【参数】 无
+        【返回值】
+            命令发生的错误。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Result CommandUndo() const;
+        /**********************************************************************
+        【函数名称】 CommandRedo
+        【函数功能】 实现 redo 命令。
+        【参数】 无
+        【返回值】
+            命令发生的错误。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        Result CommandRedo() const;
+        /**********************************************************************
+        【函数名称】 PrintStatistics
+        【函数功能】 输出统计信息，stat 与 scan 命令共用。
+        【参数】
+            stat: 要输出的统计信息。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void PrintStatistics(const ControllerBase::Statistics& stat) const;
 };
 
 }
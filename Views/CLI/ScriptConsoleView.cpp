@@ -0,0 +1,185 @@
+/*************************************************************************
+【文件名】 ScriptConsoleView.cpp
+【功能模块和目的】 为 ScriptConsoleView.hpp 文件提供实现。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "../../Controllers/ControllerBase.hpp"
+#include "ConsoleViewBase.hpp"
+#include "MainConsoleView.hpp"
+#include "ScriptConsoleView.hpp"
+using namespace std;
+using namespace C3w::Controllers;
+
+namespace C3w {
+
+namespace Views {
+
+namespace Cli {
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】
+    使用控制器、模型路径及标准输入/输出流
+    初始化 ScriptConsoleView 类型实例，脚本从标准输入读取。
+【参数】
+    controller: 控制器指针。
+    model: 模型文件路径。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+ScriptConsoleView::ScriptConsoleView(
+    shared_ptr<ControllerBase> controller,
+    const string& model
+): ScriptConsoleView(controller, model, cin, cout) {}
+
+/**********************************************************************
+【函数名称】 构造函数
+【函数功能】
+    使用控制器、模型路径及指定输入/输出流
+    初始化 ScriptConsoleView 类型实例，脚本从输入流读取。
+【参数】
+    controller: 控制器指针。
+    model: 模型文件路径。
+    input: 输入流。
+    output: 输出流。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+ScriptConsoleView::ScriptConsoleView(
+    shared_ptr<ControllerBase> controller,
+    const string& model,
+    istream& input,
+    ostream& output
+): ConsoleViewBase(controller, input, output),
+    m_Model(model),
+    m_Main(controller, input, output) {
+    SetScripted(true);
+    m_Main.SetScripted(true);
+}
+
+/**********************************************************************
+【函数名称】 Display
+【函数功能】 执行脚本并显示报告。
+【参数】 无
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+void ScriptConsoleView::Display() const {
+    Run();
+}
+
+/**********************************************************************
+【函数名称】 Run
+【函数功能】 载入模型，执行脚本中的全部命令并显示报告。
+【参数】 无
+【返回值】
+    模型载入成功且全部命令成功时返回 true。
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+bool ScriptConsoleView::Run() const {
+    // 脚本文件未能打开时输入流已处于失败状态
+    auto result = Input ?
+        static_cast<Result>(m_pController->LoadModel(m_Model)) :
+        Result::FILE_OPEN_ERROR;
+    if (result != Result::OK) {
+        ShowErrorLine(m_Model);
+        Output << Palette::FG_RED;
+        Output << "error: " << ResultToString(result);
+        Output << Palette::CLEAR << endl;
+        return false;
+    }
+    size_t commandCount = 0;
+    vector<Failure> failures;
+    auto start = chrono::steady_clock::now();
+    string line;
+    size_t lineNumber = 0;
+    while (getline(Input, line)) {
+        lineNumber++;
+        size_t first = line.find_first_not_of(" \t\r");
+        if (first == string::npos || line[first] == '#') {
+            continue;
+        }
+        size_t last = line.find_last_not_of(" \t\r");
+        auto command = line.substr(first, last - first + 1);
+        if (command == "quit") {
+            break;
+        }
+        commandCount++;
+        result = m_Main.Execute(command);
+        if (result != Result::OK) {
+            failures.push_back({ lineNumber, command, result });
+        }
+    }
+    chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+    PrintReport(commandCount, failures, elapsed.count());
+    return failures.empty();
+}
+
+/**********************************************************************
+【函数名称】 PrintReport
+【函数功能】 输出执行的命令数、耗时与失败的命令。
+【参数】
+    commandCount: 执行的命令数。
+    failures: 失败的命令。
+    seconds: 耗时秒数。
+【返回值】 无
+【开发者及日期】 赵一彤 2026/10/17
+**********************************************************************/
+void ScriptConsoleView::PrintReport(
+    size_t commandCount,
+    const vector<Failure>& failures,
+    double seconds
+) const {
+    Output << Palette::FG_PURPLE << "Report:" << Palette::CLEAR << endl;
+    Output << Palette::FG_PURPLE << "  Commands:";
+    Output << Palette::CLEAR << "\t\t";
+    Output << commandCount << endl;
+    Output << Palette::FG_PURPLE << "  Succeeded:";
+    Output << Palette::CLEAR << "\t\t";
+    Output << commandCount - failures.size() << endl;
+    Output << Palette::FG_PURPLE << "  Failed:";
+    Output << Palette::CLEAR << "\t\t";
+    Output << failures.size() << endl;
+    Output << Palette::FG_PURPLE << "  Total Seconds:";
+    Output << Palette::CLEAR << "\t";
+    Output << seconds << endl;
+    if (failures.empty()) {
+        return;
+    }
+
+    // 按错误汇总后再逐条列出前若干条
+    map<Result, size_t> counts;
+    for (auto& failure: failures) {
+        counts[failure.Error]++;
+    }
+    Output << Palette::FG_RED << "Errors:" << Palette::CLEAR << endl;
+    for (auto& pair: counts) {
+        Output << "  " << pair.second << "\t" << ResultToString(pair.first);
+        Output << endl;
+    }
+    Output << Palette::FG_RED << "Failed commands:" << Palette::CLEAR << endl;
+    for (size_t i = 0; i < failures.size(); i++) {
+        if (i == MAX_LISTED_FAILURE_COUNT) {
+            Output << "  ... and " << failures.size() - i << " more." << endl;
+            break;
+        }
+        Output << "  line " << failures[i].LineNumber << ": ";
+        Output << failures[i].Command << endl;
+        Output << Palette::FG_GRAY << "    ";
+        Output << ResultToString(failures[i].Error);
+        Output << Palette::CLEAR << endl;
+    }
+}
+
+}
+
+}
+
+}
\ No newline at end of file
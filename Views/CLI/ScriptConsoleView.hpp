@@ -0,0 +1,135 @@
+/*************************************************************************
+【文件名】 ScriptConsoleView.hpp
+【功能模块和目的】 ScriptConsoleView 类是不经交互批量执行命令脚本的视图。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+
+#pragma once
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include "../../Controllers/ControllerBase.hpp"
+#include "ConsoleViewBase.hpp"
+#include "MainConsoleView.hpp"
+using namespace std;
+using namespace C3w::Controllers;
+
+namespace C3w {
+
+namespace Views {
+
+namespace Cli {
+
+/*************************************************************************
+【类名】 ScriptConsoleView
+【功能】
+    载入模型后从输入流逐行读取命令并执行，命令名与参数位于同一行，
+    如 "lines add 0 0 0 1 1 1"、"save out.obj"。
+    执行时不输出提示符、选项、成功信息与颜色，
+    全部命令结束后输出一份包含失败行号与原因的报告。
+    空行与以 # 开头的行被忽略，quit 提前结束脚本。
+【接口说明】 继承自 ConsoleViewBase。执行脚本并返回是否全部成功。
+【开发者及日期】 赵一彤 2026/10/17
+*************************************************************************/
+class ScriptConsoleView: public ConsoleViewBase {
+    public:
+        // 构造函数
+
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】
+            使用控制器、模型路径及标准输入/输出流
+            初始化 ScriptConsoleView 类型实例，脚本从标准输入读取。
+        【参数】
+            controller: 控制器指针。
+            model: 模型文件路径。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        ScriptConsoleView(
+            shared_ptr<ControllerBase> controller,
+            const string& model
+        );
+        /**********************************************************************
+        【函数名称】 构造函数
+        【函数功能】
+            使用控制器、模型路径及指定输入/输出流
+            初始化 ScriptConsoleView 类型实例，脚本从输入流读取。
+        【参数】
+            controller: 控制器指针。
+            model: 模型文件路径。
+            input: 输入流。
+            output: 输出流。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        ScriptConsoleView(
+            shared_ptr<ControllerBase> controller,
+            const string& model,
+            istream& input,
+            ostream& output
+        );
+
+        // 操作
+
+        /**********************************************************************
+        【函数名称】 Display
+        【函数功能】 执行脚本并显示报告。
+        【参数】 无
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void Display() const override;
+        /**********************************************************************
+        【函数名称】 Run
+        【函数功能】 载入模型，执行脚本中的全部命令并显示报告。
+        【参数】 无
+        【返回值】
+            模型载入成功且全部命令成功时返回 true。
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        bool Run() const;
+
+    private:
+        // 执行失败的一条命令
+        struct Failure {
+            // 所在行号，从 1 开始
+            size_t LineNumber;
+            // 命令行
+            string Command;
+            // 发生的错误
+            Result Error;
+        };
+
+        // 报告中最多逐条列出的失败命令数
+        static const size_t MAX_LISTED_FAILURE_COUNT { 20 };
+
+        // 模型文件路径
+        string m_Model;
+        // 执行命令的主视图
+        MainConsoleView m_Main;
+
+        /**********************************************************************
+        【函数名称】 PrintReport
+        【函数功能】 输出执行的命令数、耗时与失败的命令。
+        【参数】
+            commandCount: 执行的命令数。
+            failures: 失败的命令。
+            seconds: 耗时秒数。
+        【返回值】 无
+        【开发者及日期】 赵一彤 2026/10/17
+        **********************************************************************/
+        void PrintReport(
+            size_t commandCount,
+            const vector<Failure>& failures,
+            double seconds
+        ) const;
+};
+
+}
+
+}
+
+}
\ No newline at end of file
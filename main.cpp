@@ -1,10 +1,34 @@
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include "Views/CLI/ConvertConsoleView.hpp"
 #include "Views/CLI/MainConsoleView.hpp"
+#include "Views/CLI/ScriptConsoleView.hpp"
 #include "Controllers/CLI/ConsoleController.hpp"
 using namespace C3w::Controllers::Cli;
 using namespace C3w::Views::Cli;
 
-int main() {
+int main(int argc, char* argv[]) {
     auto controller = ConsoleController::GetInstance();
+    // c3w convert <source> <target>：不进入交互，直接转换文件格式
+    if (argc == 4 && strcmp(argv[1], "convert") == 0) {
+        ConvertConsoleView view(controller, argv[2], argv[3]);
+        return view.Convert() == ConvertConsoleView::Result::OK ? 0 : 1;
+    }
+    // c3w script <model> [commands]：不进入交互，执行命令文件或标准输入
+    if ((argc == 3 || argc == 4) && strcmp(argv[1], "script") == 0) {
+        ifstream file;
+        if (argc == 4) {
+            file.open(argv[3]);
+        }
+        ScriptConsoleView view(
+            controller,
+            argv[2],
+            argc == 4 ? static_cast<istream&>(file) : cin,
+            cout
+        );
+        return view.Run() ? 0 : 1;
+    }
     MainConsoleView view(controller);
     view.Display();
     return 0;